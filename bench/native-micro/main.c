@@ -0,0 +1,461 @@
+/* Native micro-benchmark harness.
+ *
+ * Compiled once per native library (-DBENCH_KIND_*) so each binary links
+ * exactly one Rust staticlib; linking several into one binary collides on
+ * the libstd symbols each staticlib embeds.
+ *
+ * Each binary prints one JSON object per workload on stdout (one per
+ * line); bench/native-micro/run.sh assembles them into the suite result.
+ * Iteration counts come from BENCH_ITERS / BENCH_WARMUP (defaults below).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BENCH_ITERS_DEFAULT 200000ull
+#define BENCH_WARMUP_DEFAULT 2000ull
+
+typedef struct {
+  uint8_t* ptr;
+  uint32_t len;
+} ev_bytes;
+
+/* --- Runtime hooks (normally provided by generated C) --- */
+
+/* Bump arena reset before each op so backend output allocations are cheap
+ * and counted without a free path. */
+static uint8_t g_arena[1 << 20];
+static uint32_t g_arena_used;
+static uint64_t g_alloc_count;
+
+ev_bytes ev_bytes_alloc(uint32_t len) {
+  ev_bytes out;
+  uint32_t aligned = (len + 7u) & ~7u;
+  if ((uint64_t)g_arena_used + aligned > sizeof(g_arena)) {
+    fprintf(stderr, "bench arena exhausted\n");
+    exit(3);
+  }
+  out.ptr = g_arena + g_arena_used;
+  out.len = len;
+  g_arena_used += aligned;
+  g_alloc_count++;
+  return out;
+}
+
+void ev_trap(int32_t code) {
+  fprintf(stderr, "ev_trap(%d)\n", (int)code);
+  exit(3);
+}
+
+/* --- Timing and reporting --- */
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t env_u64(const char* name, uint64_t fallback) {
+  const char* raw = getenv(name);
+  if (!raw || !*raw) {
+    return fallback;
+  }
+  char* end = NULL;
+  unsigned long long value = strtoull(raw, &end, 10);
+  if (!end || *end || value == 0) {
+    return fallback;
+  }
+  return (uint64_t)value;
+}
+
+static void report(const char* name, uint64_t iters, uint64_t ns_total,
+                   uint64_t bytes_total, uint64_t allocs_total) {
+  double secs = ns_total > 0 ? (double)ns_total / 1e9 : 1e-9;
+  printf(
+      "{\"name\":\"%s\",\"iters\":%llu,\"ns_total\":%llu,"
+      "\"ops_per_sec\":%.1f,\"bytes_per_sec\":%.1f,\"allocs_per_op\":%.3f}\n",
+      name, (unsigned long long)iters, (unsigned long long)ns_total,
+      (double)iters / secs, (double)bytes_total / secs,
+      iters > 0 ? (double)allocs_total / (double)iters : 0.0);
+}
+
+#ifdef BENCH_KIND_ALLOC
+
+/* libx07_alloc: the arena that swaps in for the generated runtime's heap
+ * via the weak x07_custom_allocator hook. rt_heap_alloc itself is static
+ * to each generated translation unit, so this is the linkable stand-in
+ * for the runtime allocation path. */
+typedef struct {
+  void* ctx;
+  void* (*alloc)(void* ctx, uint32_t size, uint32_t align);
+  void* (*realloc)(void* ctx, void* ptr, uint32_t old_size, uint32_t new_size,
+                   uint32_t align);
+  void (*free)(void* ctx, void* ptr, uint32_t size, uint32_t align);
+} ev_allocator_v1_t;
+
+ev_allocator_v1_t x07_custom_allocator(void);
+
+static void bench_alloc_free(const char* name, uint32_t size, uint64_t iters,
+                             uint64_t warmup) {
+  ev_allocator_v1_t a = x07_custom_allocator();
+  for (uint64_t i = 0; i < warmup; i++) {
+    void* p = a.alloc(a.ctx, size, 8);
+    a.free(a.ctx, p, size, 8);
+  }
+  uint64_t start = now_ns();
+  for (uint64_t i = 0; i < iters; i++) {
+    void* p = a.alloc(a.ctx, size, 8);
+    a.free(a.ctx, p, size, 8);
+  }
+  uint64_t ns = now_ns() - start;
+  report(name, iters, ns, (uint64_t)size * iters, iters);
+}
+
+static void run_benches(uint64_t iters, uint64_t warmup) {
+  bench_alloc_free("heap.alloc_free_64b", 64, iters, warmup);
+  bench_alloc_free("heap.alloc_free_4k", 4096, iters, warmup);
+}
+
+#endif /* BENCH_KIND_ALLOC */
+
+#ifdef BENCH_KIND_MATH
+
+ev_bytes ev_math_f64_add_v1(ev_bytes a, ev_bytes b);
+ev_bytes ev_math_f64_mul_v1(ev_bytes a, ev_bytes b);
+ev_bytes ev_math_f64_sqrt_v1(ev_bytes x);
+
+static ev_bytes f64_bytes(uint8_t* storage, double value) {
+  ev_bytes out;
+  memcpy(storage, &value, 8);
+  out.ptr = storage;
+  out.len = 8;
+  return out;
+}
+
+static void bench_math_bin(const char* name,
+                           ev_bytes (*fn)(ev_bytes, ev_bytes), uint64_t iters,
+                           uint64_t warmup) {
+  static uint8_t sa[8], sb[8];
+  ev_bytes a = f64_bytes(sa, 1.618033988749895);
+  ev_bytes b = f64_bytes(sb, 2.718281828459045);
+  for (uint64_t i = 0; i < warmup; i++) {
+    g_arena_used = 0;
+    (void)fn(a, b);
+  }
+  g_alloc_count = 0;
+  uint64_t start = now_ns();
+  for (uint64_t i = 0; i < iters; i++) {
+    g_arena_used = 0;
+    (void)fn(a, b);
+  }
+  uint64_t ns = now_ns() - start;
+  report(name, iters, ns, 8 * iters, g_alloc_count);
+}
+
+static void bench_math_un(const char* name, ev_bytes (*fn)(ev_bytes),
+                          uint64_t iters, uint64_t warmup) {
+  static uint8_t sx[8];
+  ev_bytes x = f64_bytes(sx, 3.141592653589793);
+  for (uint64_t i = 0; i < warmup; i++) {
+    g_arena_used = 0;
+    (void)fn(x);
+  }
+  g_alloc_count = 0;
+  uint64_t start = now_ns();
+  for (uint64_t i = 0; i < iters; i++) {
+    g_arena_used = 0;
+    (void)fn(x);
+  }
+  uint64_t ns = now_ns() - start;
+  report(name, iters, ns, 8 * iters, g_alloc_count);
+}
+
+static void run_benches(uint64_t iters, uint64_t warmup) {
+  bench_math_bin("math.f64_add_v1", ev_math_f64_add_v1, iters, warmup);
+  bench_math_bin("math.f64_mul_v1", ev_math_f64_mul_v1, iters, warmup);
+  bench_math_un("math.f64_sqrt_v1", ev_math_f64_sqrt_v1, iters, warmup);
+}
+
+#endif /* BENCH_KIND_MATH */
+
+#ifdef BENCH_KIND_XF
+
+typedef struct {
+  const uint8_t* ptr;
+  uint32_t len;
+} x07_bytes_view_v1;
+
+typedef struct {
+  uint8_t* ptr;
+  uint32_t cap;
+  uint32_t len;
+} x07_out_buf_v1;
+
+typedef struct {
+  uint8_t* ptr;
+  uint32_t cap;
+  uint32_t used;
+} x07_scratch_v1;
+
+typedef struct {
+  uint32_t max_out_bytes_per_step;
+  uint32_t max_out_items_per_step;
+  uint32_t max_out_buf_bytes;
+  uint32_t max_state_bytes;
+  uint32_t max_cfg_bytes;
+  uint32_t max_scratch_bytes;
+} x07_xf_budget_v1;
+
+typedef struct x07_xf_emit_v1 {
+  void* emit_ctx;
+  int32_t (*emit_alloc)(void* emit_ctx, uint32_t cap, x07_out_buf_v1* out);
+  int32_t (*emit_commit)(void* emit_ctx, const x07_out_buf_v1* out);
+  int32_t (*emit_view)(void* emit_ctx, const uint8_t* ptr, uint32_t len,
+                       uint32_t view_kind);
+} x07_xf_emit_v1;
+
+typedef struct x07_stream_xf_plugin_v1 {
+  uint32_t abi_tag;
+  uint32_t abi_version;
+  const char* plugin_id;
+  uint32_t flags;
+  const char* in_item_brand;
+  const char* out_item_brand;
+  uint32_t state_size;
+  uint32_t state_align;
+  uint32_t scratch_hint;
+  uint32_t scratch_max;
+  int32_t (*init)(void* state, x07_scratch_v1* scratch, x07_bytes_view_v1 cfg,
+                  x07_xf_emit_v1 emit, x07_xf_budget_v1 budget);
+  int32_t (*step)(void* state, x07_scratch_v1* scratch, x07_bytes_view_v1 in,
+                  x07_xf_emit_v1 emit, x07_xf_budget_v1 budget);
+  int32_t (*flush)(void* state, x07_scratch_v1* scratch, x07_xf_emit_v1 emit,
+                   x07_xf_budget_v1 budget);
+  void (*drop)(void* state);
+} x07_stream_xf_plugin_v1;
+
+extern const x07_stream_xf_plugin_v1 x07_xf_frame_u32le_v1;
+
+/* The staticlib's json-canon plugin sits in the same codegen unit as
+ * frame_u32le and references this generated-runtime symbol; the frame
+ * workload never reaches it, so a trap stub satisfies the link. */
+ev_bytes x07_json_jcs_canon_doc_v1(const uint8_t* input_ptr, uint32_t input_len,
+                                   int32_t max_depth, int32_t max_object_members,
+                                   int32_t max_object_total_bytes) {
+  (void)input_ptr;
+  (void)input_len;
+  (void)max_depth;
+  (void)max_object_members;
+  (void)max_object_total_bytes;
+  fprintf(stderr, "x07_json_jcs_canon_doc_v1 stub reached\n");
+  exit(3);
+}
+
+static uint8_t g_emit_buf[64 * 1024];
+static uint64_t g_emit_bytes;
+
+static int32_t emit_alloc_cb(void* ctx, uint32_t cap, x07_out_buf_v1* out) {
+  (void)ctx;
+  if (cap > sizeof(g_emit_buf)) {
+    return -1;
+  }
+  out->ptr = g_emit_buf;
+  out->cap = cap;
+  out->len = 0;
+  return 0;
+}
+
+static int32_t emit_commit_cb(void* ctx, const x07_out_buf_v1* out) {
+  (void)ctx;
+  g_emit_bytes += out->len;
+  return 0;
+}
+
+static int32_t emit_view_cb(void* ctx, const uint8_t* ptr, uint32_t len,
+                            uint32_t view_kind) {
+  (void)ctx;
+  (void)ptr;
+  (void)view_kind;
+  g_emit_bytes += len;
+  return 0;
+}
+
+static void run_benches(uint64_t iters, uint64_t warmup) {
+  static _Alignas(8) uint8_t state[64];
+  static uint8_t payload[4096];
+  for (uint32_t i = 0; i < sizeof(payload); i++) {
+    payload[i] = (uint8_t)(i * 31u + 7u);
+  }
+
+  x07_scratch_v1 scratch = {NULL, 0, 0};
+  x07_bytes_view_v1 cfg = {NULL, 0};
+  x07_bytes_view_v1 in = {payload, sizeof(payload)};
+  x07_xf_emit_v1 emit = {NULL, emit_alloc_cb, emit_commit_cb, emit_view_cb};
+  x07_xf_budget_v1 budget = {1u << 30, 1u << 20, 1u << 30,
+                             1u << 20, 1u << 20, 1u << 20};
+
+  const x07_stream_xf_plugin_v1* plugin = &x07_xf_frame_u32le_v1;
+  if (plugin->init(state, &scratch, cfg, emit, budget) != 0) {
+    fprintf(stderr, "xf init failed\n");
+    exit(3);
+  }
+  for (uint64_t i = 0; i < warmup; i++) {
+    if (plugin->step(state, &scratch, in, emit, budget) != 0) {
+      fprintf(stderr, "xf step failed\n");
+      exit(3);
+    }
+  }
+  g_alloc_count = 0;
+  g_emit_bytes = 0;
+  uint64_t start = now_ns();
+  for (uint64_t i = 0; i < iters; i++) {
+    if (plugin->step(state, &scratch, in, emit, budget) != 0) {
+      fprintf(stderr, "xf step failed\n");
+      exit(3);
+    }
+  }
+  uint64_t ns = now_ns() - start;
+  if (plugin->flush(state, &scratch, emit, budget) != 0) {
+    fprintf(stderr, "xf flush failed\n");
+    exit(3);
+  }
+  report("stream_xf.frame_u32le_step_4k", iters, ns, g_emit_bytes,
+         g_alloc_count);
+}
+
+#endif /* BENCH_KIND_XF */
+
+#ifdef BENCH_KIND_ZLIB
+
+int32_t x07_ext_zlib_compress_alloc(const uint8_t* source, uint32_t source_len,
+                                    uint32_t* out_handle);
+int32_t x07_ext_zlib_gzip_compress_parallel_alloc(const uint8_t* source,
+                                                  uint32_t source_len,
+                                                  int32_t level,
+                                                  uint32_t block_size,
+                                                  uint32_t workers,
+                                                  uint32_t* out_handle);
+int32_t x07_ext_zlib_inflate_open(int32_t window_bits, uint32_t* out_handle);
+int32_t x07_ext_zlib_inflate_chunk(uint32_t handle, const uint8_t* src,
+                                   uint32_t src_len, uint8_t* dst,
+                                   uint32_t dst_cap, uint32_t* out_consumed,
+                                   uint32_t* out_written);
+int32_t x07_ext_zlib_stream_reset(uint32_t handle);
+void x07_ext_zlib_stream_close(uint32_t handle);
+uint32_t x07_ext_zlib_buf_len(uint32_t handle);
+const uint8_t* x07_ext_zlib_buf_ptr(uint32_t handle);
+void x07_ext_zlib_buf_free(uint32_t handle);
+
+static void run_benches(uint64_t iters, uint64_t warmup) {
+  /* Pinned compressible-ish input: repeating text with a slow drift. */
+  static uint8_t input[64 * 1024];
+  const char* pattern = "the quick brown fox jumps over the lazy dog 0123456789 ";
+  size_t pattern_len = strlen(pattern);
+  for (size_t i = 0; i < sizeof(input); i++) {
+    input[i] = (uint8_t)(pattern[i % pattern_len] + ((i >> 10) & 3));
+  }
+
+  /* Compression dominates; scale the count down to keep runs short. */
+  uint64_t zlib_iters = iters / 64;
+  if (zlib_iters < 8) {
+    zlib_iters = 8;
+  }
+  uint64_t zlib_warmup = warmup / 64;
+  if (zlib_warmup < 2) {
+    zlib_warmup = 2;
+  }
+
+  for (uint64_t i = 0; i < zlib_warmup; i++) {
+    uint32_t handle = 0;
+    if (x07_ext_zlib_compress_alloc(input, sizeof(input), &handle) != 0) {
+      fprintf(stderr, "zlib compress failed\n");
+      exit(3);
+    }
+    x07_ext_zlib_buf_free(handle);
+  }
+  uint64_t start = now_ns();
+  for (uint64_t i = 0; i < zlib_iters; i++) {
+    uint32_t handle = 0;
+    if (x07_ext_zlib_compress_alloc(input, sizeof(input), &handle) != 0) {
+      fprintf(stderr, "zlib compress failed\n");
+      exit(3);
+    }
+    x07_ext_zlib_buf_free(handle);
+  }
+  uint64_t ns = now_ns() - start;
+  report("zlib.compress_alloc_64k", zlib_iters, ns,
+         (uint64_t)sizeof(input) * zlib_iters, zlib_iters);
+
+  /* Parallel gzip: 1 MiB input in 64 KiB blocks across 4 workers, so the
+   * worker pool actually claims multiple blocks. Every iteration checks
+   * the pigz-style output round-trips back to the input bytes. */
+  static uint8_t big[1024 * 1024];
+  for (size_t i = 0; i < sizeof(big); i++) {
+    big[i] = (uint8_t)(pattern[i % pattern_len] + ((i >> 12) & 7));
+  }
+  uint64_t par_iters = zlib_iters / 4;
+  if (par_iters < 4) {
+    par_iters = 4;
+  }
+  start = now_ns();
+  for (uint64_t i = 0; i < par_iters; i++) {
+    uint32_t handle = 0;
+    if (x07_ext_zlib_gzip_compress_parallel_alloc(big, sizeof(big), 6,
+                                                  64 * 1024, 4, &handle) != 0) {
+      fprintf(stderr, "zlib parallel gzip failed\n");
+      exit(3);
+    }
+    /* The output is a concatenation of gzip members (one per block), so
+     * walk it with the streaming inflater, resetting at member ends. */
+    static uint8_t plain[sizeof(big)];
+    const uint8_t* gz = x07_ext_zlib_buf_ptr(handle);
+    uint32_t gz_len = x07_ext_zlib_buf_len(handle);
+    uint32_t stream = 0;
+    if (x07_ext_zlib_inflate_open(16 + 15, &stream) != 0) {
+      fprintf(stderr, "zlib inflate_open failed\n");
+      exit(3);
+    }
+    uint32_t in_off = 0;
+    uint32_t out_off = 0;
+    while (in_off < gz_len) {
+      uint32_t consumed = 0;
+      uint32_t written = 0;
+      int32_t rc = x07_ext_zlib_inflate_chunk(
+          stream, gz + in_off, gz_len - in_off, plain + out_off,
+          (uint32_t)sizeof(plain) - out_off, &consumed, &written);
+      if (rc < 0 || (consumed == 0 && written == 0)) {
+        fprintf(stderr, "zlib inflate_chunk failed\n");
+        exit(3);
+      }
+      in_off += consumed;
+      out_off += written;
+      if (rc == 1 && x07_ext_zlib_stream_reset(stream) != 0) {
+        fprintf(stderr, "zlib stream_reset failed\n");
+        exit(3);
+      }
+    }
+    x07_ext_zlib_stream_close(stream);
+    if (out_off != sizeof(big) || memcmp(plain, big, sizeof(big)) != 0) {
+      fprintf(stderr, "zlib parallel gzip round-trip mismatch\n");
+      exit(3);
+    }
+    x07_ext_zlib_buf_free(handle);
+  }
+  ns = now_ns() - start;
+  report("zlib.gzip_parallel_4w_1m", par_iters, ns,
+         (uint64_t)sizeof(big) * par_iters, par_iters * 2);
+}
+
+#endif /* BENCH_KIND_ZLIB */
+
+int main(void) {
+  uint64_t iters = env_u64("BENCH_ITERS", BENCH_ITERS_DEFAULT);
+  uint64_t warmup = env_u64("BENCH_WARMUP", BENCH_WARMUP_DEFAULT);
+  run_benches(iters, warmup);
+  return 0;
+}
@@ -0,0 +1,83 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")/../.." && pwd)
+BENCH_DIR="$ROOT_DIR/bench/native-micro"
+ZLIB_SHIM="$ROOT_DIR/packages/ext/x07-ext-zlib-c/0.1.6/ffi/zlib_shim.c"
+
+out=""
+while [[ $# -gt 0 ]]; do
+  case "$1" in
+    --out)
+      out="${2:-}"
+      shift 2
+      ;;
+    *)
+      echo "usage: $0 --out <path>" >&2
+      exit 2
+      ;;
+  esac
+done
+
+if [[ -z "${out}" ]]; then
+  echo "missing --out" >&2
+  exit 2
+fi
+
+iters="${BENCH_ITERS:-200000}"
+warmup="${BENCH_WARMUP:-2000}"
+
+emit_json() {
+  local results="$1"
+  cat >"${out}" <<JSON
+{
+  "schema_version": "x07.native_bench.micro@0.1.0",
+  "kind": "native-micro",
+  "iters": ${iters},
+  "warmup_iters": ${warmup},
+  "results": [${results}]
+}
+JSON
+}
+
+if [[ "${BENCH_DRY:-0}" == "1" ]]; then
+  iters=0
+  warmup=0
+  emit_json ""
+  echo "ok: wrote ${out}"
+  exit 0
+fi
+
+# Real mode: stage the native staticlibs, then build one binary per
+# library (each Rust staticlib embeds libstd, so they cannot share a
+# binary) plus one for the zlib C shim.
+"$ROOT_DIR/scripts/build_ext_alloc.sh"
+"$ROOT_DIR/scripts/build_ext_math.sh"
+"$ROOT_DIR/scripts/build_ext_stream_xf.sh"
+
+build_dir=$(mktemp -d)
+trap 'rm -rf "${build_dir}"' EXIT
+
+cc_flags=(-O2 -std=c11 -Wall -Wextra)
+deps_dir="$ROOT_DIR/deps/x07"
+
+cc "${cc_flags[@]}" -DBENCH_KIND_ALLOC -o "${build_dir}/bench_alloc" \
+  "$BENCH_DIR/main.c" "$deps_dir/libx07_alloc.a" -lpthread -ldl -lm
+cc "${cc_flags[@]}" -DBENCH_KIND_MATH -o "${build_dir}/bench_math" \
+  "$BENCH_DIR/main.c" "$deps_dir/libx07_math.a" -lpthread -ldl -lm
+cc "${cc_flags[@]}" -DBENCH_KIND_XF -o "${build_dir}/bench_xf" \
+  "$BENCH_DIR/main.c" "$deps_dir/libx07_stream_xf.a" -lpthread -ldl -lm
+cc "${cc_flags[@]}" -DBENCH_KIND_ZLIB -o "${build_dir}/bench_zlib" \
+  "$BENCH_DIR/main.c" "$ZLIB_SHIM" -lz -lpthread -lm
+
+results=$(
+  BENCH_ITERS="${iters}" BENCH_WARMUP="${warmup}" bash -c '
+    "$1/bench_alloc"
+    "$1/bench_math"
+    "$1/bench_xf"
+    "$1/bench_zlib"
+  ' _ "${build_dir}" | paste -sd, -
+)
+
+emit_json "${results}"
+echo "ok: wrote ${out}"
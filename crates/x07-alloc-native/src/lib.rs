@@ -0,0 +1,392 @@
+#![allow(non_camel_case_types)]
+#![allow(clippy::missing_safety_doc)]
+
+//! Alternate allocator backends for the X07 runtime.
+//!
+//! The generated C runtime resolves allocation through a weak
+//! `x07_custom_allocator()` hook (see `docs/spec/abi/allocator-v1.md` and
+//! `crates/x07c/include/x07_abi_v2.h`). Linking `libx07_alloc.a` overrides
+//! that hook with an arena allocator whose backing pages can be
+//! transparent-huge-page-backed and/or pinned to a NUMA node, which matters
+//! for large heaps on multi-socket hosts where first-touch placement and TLB
+//! misses dominate.
+//!
+//! Backend selection (read once, when the runtime initializes):
+//! - `X07_ALLOC_BACKEND=thp` (default): anonymous arena + `MADV_HUGEPAGE`.
+//! - `X07_ALLOC_BACKEND=numa:<node>`: additionally `mbind(MPOL_BIND)` the
+//!   arena to the given node. THP stays on unless `X07_ALLOC_THP=0`.
+//! - `X07_ALLOC_BACKEND=off`: return null hooks so the runtime falls back to
+//!   its default deterministic heap (useful to A/B without relinking).
+//! - `X07_ALLOC_ARENA_CAP=<bytes>`: arena capacity (default 1 GiB, rounded
+//!   up to a 2 MiB multiple).
+//!
+//! Allocation policy is a deterministic address-ordered first-fit free list
+//! over the arena, matching the allocator-v1 contract: allocations are
+//! zero-initialized and `realloc` is an allocate-new operation (the runtime
+//! copies and frees the old block itself).
+
+use core::ffi::c_void;
+use std::sync::Mutex;
+
+#[repr(C)]
+#[derive(Copy, Clone)]
+pub struct ev_allocator_v1 {
+    pub ctx: *mut c_void,
+    pub alloc: Option<unsafe extern "C" fn(*mut c_void, u32, u32) -> *mut c_void>,
+    pub realloc:
+        Option<unsafe extern "C" fn(*mut c_void, *mut c_void, u32, u32, u32) -> *mut c_void>,
+    pub free: Option<unsafe extern "C" fn(*mut c_void, *mut c_void, u32, u32)>,
+}
+
+const ARENA_ALIGN: usize = 16;
+const HUGE_PAGE: usize = 2 * 1024 * 1024;
+const DEFAULT_ARENA_CAP: usize = 1024 * 1024 * 1024;
+
+/// One free range inside the arena, kept address-ordered so freeing can
+/// coalesce adjacent ranges and allocation order stays deterministic.
+struct FreeRange {
+    off: usize,
+    size: usize,
+}
+
+struct Arena {
+    base: *mut u8,
+    cap: usize,
+    /// High-water mark of carved space. Pages above it are untouched (and
+    /// therefore zero); recycled ranges below it are zeroed on reuse.
+    bump: usize,
+    free: Vec<FreeRange>,
+}
+
+// The arena is only reached through the mutex below.
+unsafe impl Send for Arena {}
+
+static ARENA: Mutex<Option<Arena>> = Mutex::new(None);
+
+fn round_up(v: usize, align: usize) -> usize {
+    (v + (align - 1)) & !(align - 1)
+}
+
+fn env_arena_cap() -> usize {
+    let cap = std::env::var("X07_ALLOC_ARENA_CAP")
+        .ok()
+        .and_then(|v| v.trim().parse::<usize>().ok())
+        .unwrap_or(DEFAULT_ARENA_CAP);
+    round_up(cap.max(HUGE_PAGE), HUGE_PAGE)
+}
+
+#[cfg(unix)]
+fn map_arena(cap: usize, numa_node: Option<u32>, want_thp: bool) -> Option<*mut u8> {
+    unsafe {
+        let ptr = libc::mmap(
+            core::ptr::null_mut(),
+            cap,
+            libc::PROT_READ | libc::PROT_WRITE,
+            libc::MAP_PRIVATE | libc::MAP_ANONYMOUS | libc::MAP_NORESERVE,
+            -1,
+            0,
+        );
+        if ptr == libc::MAP_FAILED {
+            return None;
+        }
+        #[cfg(target_os = "linux")]
+        {
+            if want_thp {
+                // Best effort: THP may be disabled system-wide.
+                let _ = libc::madvise(ptr, cap, libc::MADV_HUGEPAGE);
+            }
+            if let Some(node) = numa_node {
+                // MPOL_BIND the whole arena up front so every page faults in
+                // on the requested node regardless of which thread touches it
+                // first. Best effort: a bad node id leaves the arena unpinned.
+                let mask: u64 = 1u64 << (node % 64);
+                let rc = libc::syscall(
+                    libc::SYS_mbind,
+                    ptr,
+                    cap,
+                    2usize, // MPOL_BIND
+                    &mask as *const u64,
+                    64usize,
+                    0usize,
+                );
+                if rc != 0 {
+                    eprintln!("x07-alloc: mbind to node {node} failed; arena left unpinned");
+                }
+            }
+        }
+        #[cfg(not(target_os = "linux"))]
+        {
+            let _ = want_thp;
+            if numa_node.is_some() {
+                eprintln!("x07-alloc: NUMA pinning is Linux-only; arena left unpinned");
+            }
+        }
+        Some(ptr as *mut u8)
+    }
+}
+
+#[cfg(not(unix))]
+fn map_arena(_cap: usize, _numa_node: Option<u32>, _want_thp: bool) -> Option<*mut u8> {
+    None
+}
+
+impl Arena {
+    fn alloc(&mut self, size: u32, align: u32) -> *mut u8 {
+        if size == 0 {
+            return core::ptr::null_mut();
+        }
+        let need = round_up(size as usize, ARENA_ALIGN);
+        let align = (align as usize).max(ARENA_ALIGN);
+        // First fit over the address-ordered free list. Every range starts
+        // 16-aligned; skip ranges whose start misses a larger alignment.
+        for i in 0..self.free.len() {
+            let r = &self.free[i];
+            if r.size < need || (self.base as usize + r.off) % align != 0 {
+                continue;
+            }
+            let off = r.off;
+            if r.size - need >= ARENA_ALIGN {
+                let fr = &mut self.free[i];
+                fr.off += need;
+                fr.size -= need;
+            } else {
+                self.free.remove(i);
+            }
+            unsafe {
+                // Recycled ranges have been written to; the allocator-v1
+                // contract promises zero-initialized memory.
+                core::ptr::write_bytes(self.base.add(off), 0, need);
+                return self.base.add(off);
+            }
+        }
+        let off = round_up(self.bump, align);
+        if off > self.cap || self.cap - off < need {
+            return core::ptr::null_mut();
+        }
+        if off > self.bump {
+            // Alignment gap: return it to the free list rather than leaking.
+            self.insert_free(self.bump, off - self.bump);
+        }
+        self.bump = off + need;
+        // Fresh pages above the old high-water mark are already zero.
+        unsafe { self.base.add(off) }
+    }
+
+    fn insert_free(&mut self, off: usize, size: usize) {
+        let pos = self.free.partition_point(|r| r.off < off);
+        // Coalesce with the successor, then the predecessor.
+        if pos < self.free.len() && off + size == self.free[pos].off {
+            self.free[pos].off = off;
+            self.free[pos].size += size;
+            if pos > 0 && self.free[pos - 1].off + self.free[pos - 1].size == off {
+                self.free[pos - 1].size += self.free[pos].size;
+                self.free.remove(pos);
+            }
+            return;
+        }
+        if pos > 0 && self.free[pos - 1].off + self.free[pos - 1].size == off {
+            self.free[pos - 1].size += size;
+            return;
+        }
+        self.free.insert(pos, FreeRange { off, size });
+    }
+
+    fn free(&mut self, ptr: *mut u8, size: u32) {
+        if ptr.is_null() || size == 0 {
+            return;
+        }
+        let addr = ptr as usize;
+        let base = self.base as usize;
+        if addr < base || addr >= base + self.cap {
+            // Not ours (e.g. freed across allocator swaps); ignore.
+            return;
+        }
+        self.insert_free(addr - base, round_up(size as usize, ARENA_ALIGN));
+    }
+}
+
+unsafe extern "C" fn xa_alloc(_ctx: *mut c_void, size: u32, align: u32) -> *mut c_void {
+    let mut guard = match ARENA.lock() {
+        Ok(g) => g,
+        Err(_) => return core::ptr::null_mut(),
+    };
+    match guard.as_mut() {
+        Some(a) => a.alloc(size, align) as *mut c_void,
+        None => core::ptr::null_mut(),
+    }
+}
+
+unsafe extern "C" fn xa_realloc(
+    ctx: *mut c_void,
+    _old_ptr: *mut c_void,
+    _old_size: u32,
+    new_size: u32,
+    align: u32,
+) -> *mut c_void {
+    // Allocate-new per the allocator-v1 contract; the runtime copies the old
+    // contents and frees the old block itself.
+    xa_alloc(ctx, new_size, align)
+}
+
+unsafe extern "C" fn xa_free(_ctx: *mut c_void, ptr: *mut c_void, size: u32, _align: u32) {
+    if let Ok(mut guard) = ARENA.lock() {
+        if let Some(a) = guard.as_mut() {
+            a.free(ptr as *mut u8, size);
+        }
+    }
+}
+
+fn null_hooks() -> ev_allocator_v1 {
+    ev_allocator_v1 {
+        ctx: core::ptr::null_mut(),
+        alloc: None,
+        realloc: None,
+        free: None,
+    }
+}
+
+/// Strong definition overriding the runtime's weak hook. Called once during
+/// runtime initialization, before any tasks run.
+#[no_mangle]
+pub extern "C" fn x07_custom_allocator() -> ev_allocator_v1 {
+    let backend = std::env::var("X07_ALLOC_BACKEND").unwrap_or_else(|_| "thp".to_string());
+    let backend = backend.trim();
+    if backend == "off" || backend == "none" || backend == "0" {
+        return null_hooks();
+    }
+    let numa_node = match backend.strip_prefix("numa:") {
+        Some(node) => match node.parse::<u32>() {
+            Ok(n) => Some(n),
+            Err(_) => {
+                eprintln!("x07-alloc: bad X07_ALLOC_BACKEND node {node:?}; using default heap");
+                return null_hooks();
+            }
+        },
+        None => {
+            if backend != "thp" {
+                eprintln!("x07-alloc: unknown X07_ALLOC_BACKEND {backend:?}; using default heap");
+                return null_hooks();
+            }
+            None
+        }
+    };
+    let want_thp = std::env::var("X07_ALLOC_THP").map(|v| v != "0").unwrap_or(true);
+    let cap = env_arena_cap();
+    let base = match map_arena(cap, numa_node, want_thp) {
+        Some(p) => p,
+        None => {
+            eprintln!("x07-alloc: arena mmap of {cap} bytes failed; using default heap");
+            return null_hooks();
+        }
+    };
+    let mut guard = match ARENA.lock() {
+        Ok(g) => g,
+        Err(_) => return null_hooks(),
+    };
+    *guard = Some(Arena {
+        base,
+        cap,
+        bump: 0,
+        free: Vec::new(),
+    });
+    ev_allocator_v1 {
+        ctx: core::ptr::null_mut(),
+        alloc: Some(xa_alloc),
+        realloc: Some(xa_realloc),
+        free: Some(xa_free),
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    /// Arena over a heap buffer so the policy is testable without mmap.
+    fn test_arena(cap: usize) -> (Arena, *mut u8) {
+        let layout = std::alloc::Layout::from_size_align(cap, HUGE_PAGE.min(4096)).unwrap();
+        let base = unsafe { std::alloc::alloc_zeroed(layout) };
+        assert!(!base.is_null());
+        (
+            Arena {
+                base,
+                cap,
+                bump: 0,
+                free: Vec::new(),
+            },
+            base,
+        )
+    }
+
+    fn drop_arena(base: *mut u8, cap: usize) {
+        let layout = std::alloc::Layout::from_size_align(cap, HUGE_PAGE.min(4096)).unwrap();
+        unsafe { std::alloc::dealloc(base, layout) };
+    }
+
+    #[test]
+    fn first_fit_reuses_and_zeroes_recycled_ranges() {
+        let (mut a, base) = test_arena(64 * 1024);
+        let p1 = a.alloc(100, 16);
+        let p2 = a.alloc(100, 16);
+        assert!(!p1.is_null() && !p2.is_null());
+        unsafe { core::ptr::write_bytes(p1, 0xAB, 100) };
+        a.free(p1, 100);
+        // Same rounded size: first fit must hand the recycled range back,
+        // and the allocator-v1 contract requires it zeroed.
+        let p3 = a.alloc(100, 16);
+        assert_eq!(p3, p1);
+        let bytes = unsafe { core::slice::from_raw_parts(p3, 100) };
+        assert!(bytes.iter().all(|&b| b == 0));
+        drop_arena(base, 64 * 1024);
+    }
+
+    #[test]
+    fn free_coalesces_adjacent_ranges() {
+        let (mut a, base) = test_arena(64 * 1024);
+        let p1 = a.alloc(256, 16);
+        let p2 = a.alloc(256, 16);
+        let p3 = a.alloc(256, 16);
+        // Free out of order; predecessor+successor coalescing must leave one
+        // range big enough for a 3x allocation.
+        a.free(p1, 256);
+        a.free(p3, 256);
+        a.free(p2, 256);
+        assert_eq!(a.free.len(), 1);
+        let big = a.alloc(768, 16);
+        assert_eq!(big, p1);
+        drop_arena(base, 64 * 1024);
+    }
+
+    #[test]
+    fn alignment_gaps_return_to_the_free_list() {
+        let (mut a, base) = test_arena(64 * 1024);
+        let _ = a.alloc(16, 16);
+        let aligned = a.alloc(64, 4096);
+        assert_eq!(aligned as usize % 4096, 0);
+        // The gap between the 16-byte block and the 4 KiB boundary must be
+        // reusable, not leaked.
+        let gap = a.alloc(16, 16);
+        assert!((gap as usize) < aligned as usize);
+        drop_arena(base, 64 * 1024);
+    }
+
+    #[test]
+    fn zero_size_and_foreign_pointers_are_ignored() {
+        let (mut a, base) = test_arena(64 * 1024);
+        assert!(a.alloc(0, 16).is_null());
+        let mut outside = 0u8;
+        a.free(&mut outside as *mut u8, 8); // not ours: must be a no-op
+        assert!(a.free.is_empty());
+        drop_arena(base, 64 * 1024);
+    }
+
+    #[cfg(unix)]
+    #[test]
+    fn map_arena_smoke() {
+        let cap = 2 * HUGE_PAGE;
+        let base = map_arena(cap, None, true).expect("mmap arena");
+        // Fresh anonymous pages read as zero.
+        let bytes = unsafe { core::slice::from_raw_parts(base, 4096) };
+        assert!(bytes.iter().all(|&b| b == 0));
+        unsafe { libc::munmap(base as *mut c_void, cap) };
+    }
+}
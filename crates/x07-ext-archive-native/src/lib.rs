@@ -7,15 +7,18 @@ use serde_json::Value;
 use std::collections::BTreeMap;
 use std::collections::HashSet;
 use std::fs;
-use std::io::{self, Read, Write};
+use std::io::{self, Read, Seek, Write};
 use std::path::{Path, PathBuf};
+use std::sync::atomic::{AtomicBool, AtomicU64, AtomicUsize, Ordering};
+use std::sync::Mutex;
+use std::thread;
 use tar::Archive;
 use x07_ext_os_native_core::{
     canonicalize_best_effort, canonicalize_existing_prefix, cap_allow_symlinks, cap_atomic_write,
     cap_create_parents, cap_overwrite, effective_max, enforce_read_path, enforce_write_path,
     map_io_err, open_atomic_tmp_best_effort, parse_caps_v1, policy, FS_ERR_BAD_CAPS,
-    FS_ERR_BAD_PATH, FS_ERR_DISABLED, FS_ERR_IO, FS_ERR_IS_DIR, FS_ERR_NOT_FOUND,
-    FS_ERR_POLICY_DENY, FS_ERR_SYMLINK_DENIED, FS_ERR_TOO_LARGE,
+    FS_ERR_BAD_HANDLE, FS_ERR_BAD_PATH, FS_ERR_DISABLED, FS_ERR_IO, FS_ERR_IS_DIR,
+    FS_ERR_NOT_FOUND, FS_ERR_POLICY_DENY, FS_ERR_SYMLINK_DENIED, FS_ERR_TOO_LARGE,
 };
 use zip::unstable::stream::{ZipStreamFileMetadata, ZipStreamReader, ZipStreamVisitor};
 
@@ -55,6 +58,11 @@ const ZIP_MAX_TOTAL_NAME_BYTES: usize = 81_920_000;
 
 const TGZ_MAX_INFLATE_RATIO_X100: u64 = 20_000;
 
+// Zip archives at or above this member count are extracted on a worker
+// pool; smaller ones keep the streaming reader.
+const ZIP_PAR_MIN_ENTRIES: usize = 8;
+const ZIP_PAR_MAX_WORKERS: usize = 8;
+
 #[inline]
 unsafe fn alloc_bytes(len: u32) -> ev_bytes {
     let out = ev_bytes_alloc(len);
@@ -509,43 +517,92 @@ fn tar_extract_impl(
         return unsafe { err_doc_from_issue(FS_ERR_TOO_LARGE as u32, issue) };
     }
 
-    let mut archive = Archive::new(reader);
-    let entries = match archive.entries() {
-        Ok(e) => e,
-        Err(_) => {
-            let issue = archive_limits_err_doc(
-                op,
-                profile_id,
-                "invalid_archive",
-                1,
-                "invalid tar: truncated header or invalid fields",
-                "valid tar bytes",
-                "ensure the tar input is complete and correctly formatted",
-            );
-            return unsafe { err_doc_from_issue(1, issue) };
+    match tar_extract_entries(op, profile_id, out_root, &out_root_canon, caps_write, reader) {
+        Ok(extracted) => unsafe { ok_doc(&write_json_entries(extracted)) },
+        Err((code, issue)) => unsafe { err_doc_from_issue(code, issue) },
+    }
+}
+
+// Byte-budget guard shared by the gzip and reader-based extract paths.
+// `hit_cap` distinguishes budget exhaustion from ordinary read errors so
+// callers can report the right limit doc afterwards.
+struct LimitReader<R> {
+    inner: R,
+    cap: u64,
+    read: u64,
+    hit_cap: bool,
+}
+
+impl<R: Read> Read for LimitReader<R> {
+    fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
+        if self.hit_cap {
+            return Err(io::Error::other("inflate cap"));
         }
-    };
+        let n = self.inner.read(buf)?;
+        self.read = self.read.saturating_add(n as u64);
+        if self.read > self.cap {
+            self.hit_cap = true;
+            return Err(io::Error::other("inflate cap"));
+        }
+        Ok(n)
+    }
+}
+
+fn tar_invalid_doc(op: &str, profile_id: &str, detail: &str) -> Vec<u8> {
+    archive_limits_err_doc(
+        op,
+        profile_id,
+        "invalid_archive",
+        1,
+        detail,
+        "valid tar bytes",
+        "ensure the tar input is complete and correctly formatted",
+    )
+}
+
+fn tar_output_limit_doc(op: &str, profile_id: &str) -> Vec<u8> {
+    archive_limits_err_doc(
+        op,
+        profile_id,
+        "output_limit",
+        3,
+        "output limit exceeded",
+        "tar where each file <= 268435456 bytes and total <= 1073741824 bytes",
+        "reduce extracted output or relax archive profile limits",
+    )
+}
+
+// Shared entry loop for the path- and reader-based tar extract paths:
+// walks entries off the (possibly streaming) reader, applying the path
+// policy and output limits per entry as bytes arrive.
+fn tar_extract_entries(
+    op: &str,
+    profile_id: &str,
+    out_root: &[u8],
+    out_root_canon: &Path,
+    caps_write: x07_ext_os_native_core::CapsV1,
+    reader: impl Read,
+) -> Result<Vec<Value>, (u32, Vec<u8>)> {
+    let pol = policy();
+    let mut archive = Archive::new(reader);
+    let entries = archive.entries().map_err(|_| {
+        (
+            1u32,
+            tar_invalid_doc(op, profile_id, "invalid tar: truncated header or invalid fields"),
+        )
+    })?;
 
     let mut extracted: Vec<Value> = Vec::new();
     let mut count: usize = 0;
     let mut total_out: u64 = 0;
 
     for ent in entries {
-        let mut entry = match ent {
-            Ok(e) => e,
-            Err(_) => {
-                let issue = archive_limits_err_doc(
-                    op,
-                    profile_id,
-                    "invalid_archive",
-                    1,
-                    "invalid tar: truncated header or invalid fields",
-                    "valid tar bytes",
-                    "ensure the tar input is complete and correctly formatted",
-                );
-                return unsafe { err_doc_from_issue(1, issue) };
-            }
-        };
+        let mut entry = ent.map_err(|_| {
+            (
+                1u32,
+                tar_invalid_doc(op, profile_id, "invalid tar: truncated header or invalid fields"),
+            )
+        })?;
 
         if !entry.header().entry_type().is_file() {
             continue;
@@ -553,30 +610,12 @@ fn tar_extract_impl(
 
         let size = entry.size();
         if size > ARCHIVE_MAX_FILE_BYTES {
-            let issue = archive_limits_err_doc(
-                op,
-                profile_id,
-                "output_limit",
-                3,
-                "output limit exceeded",
-                "tar where each file <= 268435456 bytes and total <= 1073741824 bytes",
-                "reduce extracted output or relax archive profile limits",
-            );
-            return unsafe { err_doc_from_issue(3, issue) };
+            return Err((3, tar_output_limit_doc(op, profile_id)));
         }
 
         total_out = total_out.saturating_add(size);
         if total_out > ARCHIVE_MAX_TOTAL_OUT_BYTES {
-            let issue = archive_limits_err_doc(
-                op,
-                profile_id,
-                "output_limit",
-                3,
-                "output limit exceeded",
-                "tar where each file <= 268435456 bytes and total <= 1073741824 bytes",
-                "reduce extracted output or relax archive profile limits",
-            );
-            return unsafe { err_doc_from_issue(3, issue) };
+            return Err((3, tar_output_limit_doc(op, profile_id)));
         }
 
         count += 1;
@@ -590,7 +629,7 @@ fn tar_extract_impl(
                 "tar with <= 20000 entries",
                 "reduce entry count/paths or relax limits in the archive profile",
             );
-            return unsafe { err_doc_from_issue(2, issue) };
+            return Err((2, issue));
         }
 
         let path_bytes = entry.path_bytes();
@@ -600,7 +639,7 @@ fn tar_extract_impl(
             Err(rc) => {
                 let path_s = String::from_utf8_lossy(path_bytes);
                 let issue = path_policy_err_doc(op, profile_id, &path_s, rc);
-                return unsafe { err_doc_from_issue(100 + rc, issue) };
+                return Err((100 + rc, issue));
             }
         };
 
@@ -609,53 +648,28 @@ fn tar_extract_impl(
             x07_ext_os_native_core::bytes_to_utf8(out_root).unwrap_or(""),
             path_str
         );
-        let out_path = match enforce_write_path(caps_write, out_path_bytes.as_bytes()) {
-            Ok(p) => p,
-            Err(code) => {
-                let issue = fs_err_doc(op, profile_id, &path_str, code as u32);
-                return unsafe { err_doc_from_issue(code as u32, issue) };
-            }
-        };
+        let out_path = enforce_write_path(caps_write, out_path_bytes.as_bytes())
+            .map_err(|code| (code as u32, fs_err_doc(op, profile_id, &path_str, code as u32)))?;
 
-        if let Err(code) = enforce_out_path(&out_root_canon, &out_path) {
-            let issue = fs_err_doc(op, profile_id, &path_str, code);
-            return unsafe { err_doc_from_issue(code, issue) };
-        }
+        enforce_out_path(out_root_canon, &out_path)
+            .map_err(|code| (code, fs_err_doc(op, profile_id, &path_str, code)))?;
 
         let max_write = effective_max(pol.max_write_bytes, caps_write.max_write_bytes) as u64;
         let per_file_max = max_write.min(ARCHIVE_MAX_FILE_BYTES);
 
-        let (outfile, tmp) = match open_output_file(&out_path, caps_write) {
-            Ok(v) => v,
-            Err(code) => {
-                let issue = fs_err_doc(op, profile_id, &path_str, code);
-                return unsafe { err_doc_from_issue(code, issue) };
-            }
-        };
-        let written = match copy_to_file(&mut entry, outfile, per_file_max) {
-            Ok(n) => n,
-            Err(code) => {
-                let issue = fs_err_doc(op, profile_id, &path_str, code);
-                return unsafe { err_doc_from_issue(code, issue) };
-            }
-        };
+        let (outfile, tmp) = open_output_file(&out_path, caps_write)
+            .map_err(|code| (code, fs_err_doc(op, profile_id, &path_str, code)))?;
+        let written = copy_to_file(&mut entry, outfile, per_file_max)
+            .map_err(|code| (code, fs_err_doc(op, profile_id, &path_str, code)))?;
         if written != size {
-            let issue = archive_limits_err_doc(
-                op,
-                profile_id,
-                "invalid_archive",
+            return Err((
                 1,
-                "invalid tar: truncated file payload",
-                "valid tar bytes",
-                "ensure the tar input is complete and correctly formatted",
-            );
-            return unsafe { err_doc_from_issue(1, issue) };
+                tar_invalid_doc(op, profile_id, "invalid tar: truncated file payload"),
+            ));
         }
         if let Some(tmp) = tmp {
-            if let Err(code) = finalize_atomic_write(tmp, &out_path) {
-                let issue = fs_err_doc(op, profile_id, &path_str, code);
-                return unsafe { err_doc_from_issue(code, issue) };
-            }
+            finalize_atomic_write(tmp, &out_path)
+                .map_err(|code| (code, fs_err_doc(op, profile_id, &path_str, code)))?;
         }
 
         let mut entry_obj: BTreeMap<String, Value> = BTreeMap::new();
@@ -665,7 +679,7 @@ fn tar_extract_impl(
         extracted.push(Value::Object(entry_obj.into_iter().collect()));
     }
 
-    unsafe { ok_doc(&write_json_entries(extracted)) }
+    Ok(extracted)
 }
 
 #[no_mangle]
@@ -818,27 +832,6 @@ pub unsafe extern "C" fn x07_ext_archive_tgz_extract_to_fs_v1(
             }
         };
 
-        struct LimitReader<R> {
-            inner: R,
-            cap: u64,
-            read: u64,
-            hit_cap: bool,
-        }
-        impl<R: Read> Read for LimitReader<R> {
-            fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
-                if self.hit_cap {
-                    return Err(io::Error::other("inflate cap"));
-                }
-                let n = self.inner.read(buf)?;
-                self.read = self.read.saturating_add(n as u64);
-                if self.read > self.cap {
-                    self.hit_cap = true;
-                    return Err(io::Error::other("inflate cap"));
-                }
-                Ok(n)
-            }
-        }
-
         let gz = GzDecoder::new(f);
         let mut limited = LimitReader {
             inner: gz,
@@ -906,84 +899,679 @@ pub unsafe extern "C" fn x07_ext_archive_tgz_extract_to_fs_v1(
     })
 }
 
+// C read callback used by the reader-based extract entrypoints. It has the
+// same shape as the runtime's io-reader vtable read fn: fill up to `cap`
+// bytes at `dst` and return the count produced, with 0 meaning end of
+// stream. Call sites wrap a runtime reader (e.g. an http or socket stream)
+// in a callback of this shape so extraction overlaps the transfer.
+pub type x07_ext_archive_read_fn_v1 =
+    unsafe extern "C" fn(data: u32, dst: *mut u8, cap: u32) -> u32;
+
+struct CallbackReader {
+    read_fn: x07_ext_archive_read_fn_v1,
+    data: u32,
+}
+
+impl Read for CallbackReader {
+    fn read(&mut self, buf: &mut [u8]) -> io::Result<usize> {
+        if buf.is_empty() {
+            return Ok(0);
+        }
+        let cap = buf.len().min(u32::MAX as usize) as u32;
+        let n = unsafe { (self.read_fn)(self.data, buf.as_mut_ptr(), cap) };
+        Ok(n.min(cap) as usize)
+    }
+}
+
+// Validation shared by the reader-based extract entrypoints: the same caps,
+// profile, and out_root checks as tar_extract_impl minus the archive-path
+// checks — there is no file to stat, so callers bound the stream with
+// LimitReader instead of a size pre-check.
+fn tar_reader_extract_impl(
+    op: &str,
+    profile_expected: &str,
+    profile_id: &str,
+    out_root: &[u8],
+    caps_read: &[u8],
+    caps_write: &[u8],
+    reader: impl Read,
+) -> ev_bytes {
+    if profile_id != profile_expected {
+        let issue = unsupported_profile_doc(op, profile_id, profile_expected);
+        return unsafe { err_doc_from_issue(9001, issue) };
+    }
+
+    let caps_read = match parse_caps_v1(caps_read) {
+        Ok(c) => c,
+        Err(code) => {
+            let issue = fs_err_doc(op, profile_id, "", code as u32);
+            return unsafe { err_doc_from_issue(code as u32, issue) };
+        }
+    };
+    let caps_write = match parse_caps_v1(caps_write) {
+        Ok(c) => c,
+        Err(code) => {
+            let p = String::from_utf8_lossy(out_root);
+            let issue = fs_err_doc(op, profile_id, &p, code as u32);
+            return unsafe { err_doc_from_issue(code as u32, issue) };
+        }
+    };
+
+    let pol = policy();
+    if cap_allow_symlinks(caps_read) && !pol.allow_symlinks {
+        let issue = fs_err_doc(op, profile_id, "", FS_ERR_SYMLINK_DENIED as u32);
+        return unsafe { err_doc_from_issue(FS_ERR_SYMLINK_DENIED as u32, issue) };
+    }
+    if cap_allow_symlinks(caps_write) && !pol.allow_symlinks {
+        let p = String::from_utf8_lossy(out_root);
+        let issue = fs_err_doc(op, profile_id, &p, FS_ERR_SYMLINK_DENIED as u32);
+        return unsafe { err_doc_from_issue(FS_ERR_SYMLINK_DENIED as u32, issue) };
+    }
+
+    let out_root_pb = match enforce_write_path(caps_write, out_root) {
+        Ok(p) => p,
+        Err(code) => {
+            let p = String::from_utf8_lossy(out_root);
+            let issue = fs_err_doc(op, profile_id, &p, code as u32);
+            return unsafe { err_doc_from_issue(code as u32, issue) };
+        }
+    };
+
+    if let Err(code) = ensure_out_root(caps_write, &out_root_pb) {
+        let p = String::from_utf8_lossy(out_root);
+        let issue = fs_err_doc(op, profile_id, &p, code);
+        return unsafe { err_doc_from_issue(code, issue) };
+    }
+
+    let out_root_canon = canonicalize_best_effort(&out_root_pb);
+
+    match tar_extract_entries(op, profile_id, out_root, &out_root_canon, caps_write, reader) {
+        Ok(extracted) => unsafe { ok_doc(&write_json_entries(extracted)) },
+        Err((code, issue)) => unsafe { err_doc_from_issue(code, issue) },
+    }
+}
+
 #[no_mangle]
-pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
+pub unsafe extern "C" fn x07_ext_archive_tar_extract_reader_to_fs_v1(
     out_root: ev_bytes,
-    zip_path: ev_bytes,
+    read_fn: Option<x07_ext_archive_read_fn_v1>,
+    read_data: u32,
     caps_read: ev_bytes,
     caps_write: ev_bytes,
     profile_id: ev_bytes,
 ) -> ev_bytes {
     std::panic::catch_unwind(|| unsafe {
         let out_root_b = bytes_as_slice(out_root);
-        let zip_path_b = bytes_as_slice(zip_path);
         let caps_read_b = bytes_as_slice(caps_read);
         let caps_write_b = bytes_as_slice(caps_write);
         let profile_id_b = bytes_as_slice(profile_id);
         let profile_id_s = String::from_utf8_lossy(profile_id_b);
 
-        let op = "os.archive.zip_extract_to_fs_v1";
-        if profile_id_s.as_ref() != "zip_extract_safe_v1" {
-            let issue = unsupported_profile_doc(op, &profile_id_s, "zip_extract_safe_v1");
-            return err_doc_from_issue(9001, issue);
-        }
-
+        let op = "os.archive.tar_extract_reader_to_fs_v1";
+        let read_fn = match read_fn {
+            Some(f) => f,
+            None => {
+                let issue = fs_err_doc(op, &profile_id_s, "", FS_ERR_BAD_HANDLE as u32);
+                return err_doc_from_issue(FS_ERR_BAD_HANDLE as u32, issue);
+            }
+        };
         let caps_read = match parse_caps_v1(caps_read_b) {
             Ok(c) => c,
             Err(code) => {
-                let issue = fs_err_doc(
-                    op,
-                    &profile_id_s,
-                    &String::from_utf8_lossy(zip_path_b),
-                    code as u32,
-                );
+                let issue = fs_err_doc(op, &profile_id_s, "", code as u32);
                 return err_doc_from_issue(code as u32, issue);
             }
         };
-        let caps_write = match parse_caps_v1(caps_write_b) {
+
+        // The read budget that the path variant enforces by statting the
+        // archive applies here to the bytes pulled off the stream.
+        let pol = policy();
+        let max_read = effective_max(pol.max_read_bytes, caps_read.max_read_bytes) as u64;
+        let mut limited = LimitReader {
+            inner: CallbackReader {
+                read_fn,
+                data: read_data,
+            },
+            cap: max_read,
+            read: 0,
+            hit_cap: false,
+        };
+        let out = tar_reader_extract_impl(
+            op,
+            "tar_extract_safe_v1",
+            &profile_id_s,
+            out_root_b,
+            caps_read_b,
+            caps_write_b,
+            &mut limited,
+        );
+        if limited.hit_cap {
+            let issue = fs_err_doc(op, &profile_id_s, "", FS_ERR_TOO_LARGE as u32);
+            return err_doc_from_issue(FS_ERR_TOO_LARGE as u32, issue);
+        }
+        out
+    })
+    .unwrap_or_else(|_| {
+        let msg = canonical_issue_json(
+            "internal",
+            "os.archive.tar_extract_reader_to_fs_v1",
+            "",
+            "",
+            9850,
+            0,
+            "panic in ext-archive-native backend",
+            "valid archive inputs and caps",
+            "file a bug with the repro input",
+        );
+        err_doc(9850, &msg)
+    })
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_archive_tgz_extract_reader_to_fs_v1(
+    out_root: ev_bytes,
+    read_fn: Option<x07_ext_archive_read_fn_v1>,
+    read_data: u32,
+    caps_read: ev_bytes,
+    caps_write: ev_bytes,
+    profile_id: ev_bytes,
+) -> ev_bytes {
+    std::panic::catch_unwind(|| unsafe {
+        let out_root_b = bytes_as_slice(out_root);
+        let caps_read_b = bytes_as_slice(caps_read);
+        let caps_write_b = bytes_as_slice(caps_write);
+        let profile_id_b = bytes_as_slice(profile_id);
+        let profile_id_s = String::from_utf8_lossy(profile_id_b);
+
+        let op = "os.archive.tgz_extract_reader_to_fs_v1";
+        let read_fn = match read_fn {
+            Some(f) => f,
+            None => {
+                let issue = fs_err_doc(op, &profile_id_s, "", FS_ERR_BAD_HANDLE as u32);
+                return err_doc_from_issue(FS_ERR_BAD_HANDLE as u32, issue);
+            }
+        };
+        let caps_read = match parse_caps_v1(caps_read_b) {
             Ok(c) => c,
             Err(code) => {
-                let issue = fs_err_doc(
-                    op,
-                    &profile_id_s,
-                    &String::from_utf8_lossy(out_root_b),
-                    code as u32,
-                );
+                let issue = fs_err_doc(op, &profile_id_s, "", code as u32);
                 return err_doc_from_issue(code as u32, issue);
             }
         };
 
+        // The compressed size is unknown up front, so the ratio cap the
+        // path variant derives from it does not apply: the read budget
+        // bounds the compressed stream and the absolute output cap bounds
+        // the inflated side.
         let pol = policy();
-        if cap_allow_symlinks(caps_read) && !pol.allow_symlinks {
-            let issue = fs_err_doc(
-                op,
-                &profile_id_s,
-                &String::from_utf8_lossy(zip_path_b),
-                FS_ERR_SYMLINK_DENIED as u32,
-            );
-            return err_doc_from_issue(FS_ERR_SYMLINK_DENIED as u32, issue);
+        let max_read = effective_max(pol.max_read_bytes, caps_read.max_read_bytes) as u64;
+        let compressed = LimitReader {
+            inner: CallbackReader {
+                read_fn,
+                data: read_data,
+            },
+            cap: max_read,
+            read: 0,
+            hit_cap: false,
+        };
+        let gz = GzDecoder::new(compressed);
+        let mut inflated = LimitReader {
+            inner: gz,
+            cap: ARCHIVE_MAX_TOTAL_OUT_BYTES,
+            read: 0,
+            hit_cap: false,
+        };
+        let out = tar_reader_extract_impl(
+            op,
+            "tgz_extract_safe_v1",
+            &profile_id_s,
+            out_root_b,
+            caps_read_b,
+            caps_write_b,
+            &mut inflated,
+        );
+        if inflated.inner.get_ref().hit_cap {
+            let issue = fs_err_doc(op, &profile_id_s, "", FS_ERR_TOO_LARGE as u32);
+            return err_doc_from_issue(FS_ERR_TOO_LARGE as u32, issue);
         }
-        if cap_allow_symlinks(caps_write) && !pol.allow_symlinks {
-            let issue = fs_err_doc(
+        if inflated.hit_cap {
+            let issue = archive_limits_err_doc(
                 op,
                 &profile_id_s,
-                &String::from_utf8_lossy(out_root_b),
-                FS_ERR_SYMLINK_DENIED as u32,
+                "inflate_output_limit",
+                22,
+                "inflate output limit exceeded",
+                "tgz with inflate_out_bytes <= 1073741824",
+                "reduce inflated output or relax max_inflate_out_bytes in the archive profile",
             );
-            return err_doc_from_issue(FS_ERR_SYMLINK_DENIED as u32, issue);
+            return err_doc_from_issue(22, issue);
         }
-
-        let out_root_pb = match enforce_write_path(caps_write, out_root_b) {
-            Ok(p) => p,
-            Err(code) => {
-                let issue = fs_err_doc(
-                    op,
-                    &profile_id_s,
-                    &String::from_utf8_lossy(out_root_b),
-                    code as u32,
-                );
-                return err_doc_from_issue(code as u32, issue);
-            }
+        out
+    })
+    .unwrap_or_else(|_| {
+        let msg = canonical_issue_json(
+            "internal",
+            "os.archive.tgz_extract_reader_to_fs_v1",
+            "",
+            "",
+            9850,
+            0,
+            "panic in ext-archive-native backend",
+            "valid archive inputs and caps",
+            "file a bug with the repro input",
+        );
+        err_doc(9850, &msg)
+    })
+}
+
+struct ZipParItem {
+    index: usize,
+    path_str: String,
+    out_path: PathBuf,
+}
+
+fn zip_invalid_doc(op: &str, profile_id: &str, detail: &str) -> Vec<u8> {
+    archive_limits_err_doc(
+        op,
+        profile_id,
+        "invalid_archive",
+        1,
+        detail,
+        "valid zip bytes",
+        "ensure the zip input is complete and correctly formatted",
+    )
+}
+
+fn zip_entry_limit_doc(op: &str, profile_id: &str) -> Vec<u8> {
+    archive_limits_err_doc(
+        op,
+        profile_id,
+        "entry_limit",
+        2,
+        "entry limit exceeded",
+        "zip with <= 20000 entries and total name bytes <= 81920000",
+        "reduce entry count/paths or relax limits in the archive profile",
+    )
+}
+
+fn zip_output_limit_doc(op: &str, profile_id: &str) -> Vec<u8> {
+    archive_limits_err_doc(
+        op,
+        profile_id,
+        "output_limit",
+        3,
+        "output limit exceeded",
+        "zip where each file <= 268435456 bytes and total <= 1073741824 bytes",
+        "reduce extracted output or relax archive profile limits",
+    )
+}
+
+fn zip_checksum_doc(op: &str, profile_id: &str) -> Vec<u8> {
+    archive_limits_err_doc(
+        op,
+        profile_id,
+        "checksum_mismatch",
+        4,
+        "checksum mismatch",
+        "zip with valid CRC32 checksums",
+        "ensure the zip is not corrupted",
+    )
+}
+
+// Extracts one member on a worker. The limits, caps checks, and error
+// docs mirror the streaming visitor byte for byte; only total-output
+// accounting goes through the shared atomic counter.
+#[allow(clippy::too_many_arguments)]
+fn zip_par_extract_one(
+    archive: &mut zip::ZipArchive<fs::File>,
+    item: &ZipParItem,
+    op: &str,
+    profile_id: &str,
+    caps_write: x07_ext_os_native_core::CapsV1,
+    max_write: u64,
+    per_file_max: u64,
+    total_out: &AtomicU64,
+) -> Result<Value, (u32, Vec<u8>)> {
+    let path_str = item.path_str.as_str();
+    let mut file = archive
+        .by_index(item.index)
+        .map_err(|e| (1, zip_invalid_doc(op, profile_id, &format!("invalid zip: {e}"))))?;
+
+    let (mut outfile, tmp) = open_output_file(&item.out_path, caps_write)
+        .map_err(|code| (code, fs_err_doc(op, profile_id, path_str, code)))?;
+
+    let mut buf = [0u8; 64 * 1024];
+    let mut hasher = Crc32::new();
+    let mut total: u64 = 0;
+    loop {
+        let n = match file.read(&mut buf) {
+            Ok(n) => n,
+            Err(e) => {
+                // The seekable zip reader verifies CRC32 itself at
+                // end-of-entry and surfaces a mismatch as a read error;
+                // map it to the streaming path's checksum doc.
+                if e.to_string().contains("checksum") {
+                    return Err((4, zip_checksum_doc(op, profile_id)));
+                }
+                return Err((
+                    1,
+                    zip_invalid_doc(op, profile_id, &format!("invalid zip: {e}")),
+                ));
+            }
+        };
+        if n == 0 {
+            break;
+        }
+        total = total.saturating_add(n as u64);
+        if total > per_file_max {
+            if max_write < ARCHIVE_MAX_FILE_BYTES {
+                return Err((
+                    FS_ERR_TOO_LARGE as u32,
+                    fs_err_doc(op, profile_id, path_str, FS_ERR_TOO_LARGE as u32),
+                ));
+            }
+            return Err((3, zip_output_limit_doc(op, profile_id)));
+        }
+        let so_far = total_out
+            .fetch_add(n as u64, Ordering::Relaxed)
+            .saturating_add(n as u64);
+        if so_far > ARCHIVE_MAX_TOTAL_OUT_BYTES {
+            return Err((3, zip_output_limit_doc(op, profile_id)));
+        }
+        hasher.update(&buf[..n]);
+        if let Err(e) = outfile.write_all(&buf[..n]) {
+            let code = map_io_err(&e) as u32;
+            return Err((code, fs_err_doc(op, profile_id, path_str, code)));
+        }
+    }
+    if hasher.finalize() != file.crc32() {
+        return Err((4, zip_checksum_doc(op, profile_id)));
+    }
+
+    if let Err(e) = outfile.flush() {
+        let code = map_io_err(&e) as u32;
+        return Err((code, fs_err_doc(op, profile_id, path_str, code)));
+    }
+    drop(outfile);
+
+    if let Some(tmp) = tmp {
+        if let Err(code) = finalize_atomic_write(tmp, &item.out_path) {
+            return Err((code, fs_err_doc(op, profile_id, path_str, code)));
+        }
+    }
+
+    let mut entry_obj: BTreeMap<String, Value> = BTreeMap::new();
+    entry_obj.insert("path".to_string(), Value::from(path_str));
+    entry_obj.insert("size".to_string(), Value::from(total));
+    Ok(Value::Object(entry_obj.into_iter().collect()))
+}
+
+// Parallel zip extraction. The central directory makes members
+// independently addressable, so a first sequential pass applies every
+// name/policy/entry-limit check in archive order (deterministic
+// errors, no bytes written yet), then payload inflation and writing
+// shard across a worker pool with one archive handle (and inflate
+// context) per worker. On competing worker errors the lowest member
+// index wins, keeping reported failures deterministic.
+#[allow(clippy::too_many_arguments)]
+fn zip_extract_parallel(
+    op: &str,
+    profile_id: &str,
+    zip_pb: &Path,
+    out_root: &[u8],
+    out_root_canon: &Path,
+    caps_write: x07_ext_os_native_core::CapsV1,
+    pol: &x07_ext_os_native_core::Policy,
+) -> Result<Vec<Value>, (u32, Vec<u8>)> {
+    let open_archive = || -> Result<zip::ZipArchive<fs::File>, (u32, Vec<u8>)> {
+        let f = fs::File::open(zip_pb).map_err(|e| {
+            let code = map_io_err(&e) as u32;
+            (
+                code,
+                fs_err_doc(op, profile_id, &zip_pb.display().to_string(), code),
+            )
+        })?;
+        zip::ZipArchive::new(f)
+            .map_err(|e| (1, zip_invalid_doc(op, profile_id, &format!("invalid zip: {e}"))))
+    };
+
+    let mut archive = open_archive()?;
+    let mut names: HashSet<Vec<u8>> = HashSet::new();
+    let mut total_name_bytes: usize = 0;
+    let mut items: Vec<ZipParItem> = Vec::new();
+
+    for index in 0..archive.len() {
+        let file = archive
+            .by_index_raw(index)
+            .map_err(|e| (1, zip_invalid_doc(op, profile_id, &format!("invalid zip: {e}"))))?;
+
+        if names.len() >= ARCHIVE_MAX_ENTRIES {
+            return Err((2, zip_entry_limit_doc(op, profile_id)));
+        }
+        let name_raw = file.name_raw().to_vec();
+        total_name_bytes = total_name_bytes.saturating_add(name_raw.len());
+        if total_name_bytes > ZIP_MAX_TOTAL_NAME_BYTES {
+            return Err((2, zip_entry_limit_doc(op, profile_id)));
+        }
+
+        let is_dir = file.is_dir();
+        let name_trimmed = if is_dir && name_raw.ends_with(b"/") {
+            &name_raw[..name_raw.len().saturating_sub(1)]
+        } else {
+            &name_raw[..]
+        };
+        if name_trimmed.is_empty() {
+            continue;
+        }
+        if let Err(rc) = posix_strict_check_v1(name_trimmed) {
+            let name_s = String::from_utf8_lossy(name_trimmed).to_string();
+            return Err((100 + rc, path_policy_err_doc(op, profile_id, &name_s, rc)));
+        }
+
+        if !names.insert(name_trimmed.to_vec()) {
+            let issue = archive_limits_err_doc(
+                op,
+                profile_id,
+                "duplicate_name",
+                5,
+                "duplicate name in central directory",
+                "zip with unique file names",
+                "dedupe file names or re-create the zip without duplicates",
+            );
+            return Err((5, issue));
+        }
+
+        if file.is_symlink() {
+            let issue = archive_limits_err_doc(
+                op,
+                profile_id,
+                "symlink_denied",
+                6,
+                "symlinks are not allowed",
+                "zip entries must be regular files or directories",
+                "re-create the zip without symlink entries",
+            );
+            return Err((6, issue));
+        }
+        if is_dir {
+            continue;
+        }
+
+        // posix_strict_check_v1 already guaranteed UTF-8.
+        let path_str = String::from_utf8_lossy(name_trimmed).to_string();
+        let out_path_bytes = format!(
+            "{}/{}",
+            x07_ext_os_native_core::bytes_to_utf8(out_root).unwrap_or(""),
+            path_str
+        );
+        let out_path = enforce_write_path(caps_write, out_path_bytes.as_bytes())
+            .map_err(|code| (code as u32, fs_err_doc(op, profile_id, &path_str, code as u32)))?;
+        enforce_out_path(out_root_canon, &out_path)
+            .map_err(|code| (code, fs_err_doc(op, profile_id, &path_str, code)))?;
+
+        items.push(ZipParItem {
+            index,
+            path_str,
+            out_path,
+        });
+    }
+    drop(archive);
+
+    let max_write = effective_max(pol.max_write_bytes, caps_write.max_write_bytes) as u64;
+    let per_file_max = max_write.min(ARCHIVE_MAX_FILE_BYTES);
+
+    let next = AtomicUsize::new(0);
+    let failed = AtomicBool::new(false);
+    let total_out = AtomicU64::new(0);
+    let first_err: Mutex<Option<(usize, u32, Vec<u8>)>> = Mutex::new(None);
+    let results: Mutex<Vec<Option<Value>>> = Mutex::new((0..items.len()).map(|_| None).collect());
+
+    let record_err = |slot: usize, code: u32, issue: Vec<u8>| {
+        let mut guard = first_err.lock().unwrap_or_else(|p| p.into_inner());
+        match guard.as_ref() {
+            Some((held, _, _)) if *held <= slot => {}
+            _ => *guard = Some((slot, code, issue)),
+        }
+        failed.store(true, Ordering::Relaxed);
+    };
+
+    let workers = thread::available_parallelism()
+        .map(|n| n.get())
+        .unwrap_or(1)
+        .min(ZIP_PAR_MAX_WORKERS)
+        .min(items.len())
+        .max(1);
+
+    thread::scope(|s| {
+        for _ in 0..workers {
+            s.spawn(|| {
+                let mut archive = match open_archive() {
+                    Ok(a) => a,
+                    Err((code, issue)) => {
+                        record_err(0, code, issue);
+                        return;
+                    }
+                };
+                loop {
+                    if failed.load(Ordering::Relaxed) {
+                        return;
+                    }
+                    let slot = next.fetch_add(1, Ordering::Relaxed);
+                    if slot >= items.len() {
+                        return;
+                    }
+                    match zip_par_extract_one(
+                        &mut archive,
+                        &items[slot],
+                        op,
+                        profile_id,
+                        caps_write,
+                        max_write,
+                        per_file_max,
+                        &total_out,
+                    ) {
+                        Ok(value) => {
+                            let mut guard = results.lock().unwrap_or_else(|p| p.into_inner());
+                            guard[slot] = Some(value);
+                        }
+                        Err((code, issue)) => {
+                            record_err(slot, code, issue);
+                            return;
+                        }
+                    }
+                }
+            });
+        }
+    });
+
+    if let Some((_, code, issue)) = first_err.into_inner().unwrap_or_else(|p| p.into_inner()) {
+        return Err((code, issue));
+    }
+    let results = results.into_inner().unwrap_or_else(|p| p.into_inner());
+    Ok(results
+        .into_iter()
+        .map(|v| v.expect("every member slot extracted"))
+        .collect())
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
+    out_root: ev_bytes,
+    zip_path: ev_bytes,
+    caps_read: ev_bytes,
+    caps_write: ev_bytes,
+    profile_id: ev_bytes,
+) -> ev_bytes {
+    std::panic::catch_unwind(|| unsafe {
+        let out_root_b = bytes_as_slice(out_root);
+        let zip_path_b = bytes_as_slice(zip_path);
+        let caps_read_b = bytes_as_slice(caps_read);
+        let caps_write_b = bytes_as_slice(caps_write);
+        let profile_id_b = bytes_as_slice(profile_id);
+        let profile_id_s = String::from_utf8_lossy(profile_id_b);
+
+        let op = "os.archive.zip_extract_to_fs_v1";
+        if profile_id_s.as_ref() != "zip_extract_safe_v1" {
+            let issue = unsupported_profile_doc(op, &profile_id_s, "zip_extract_safe_v1");
+            return err_doc_from_issue(9001, issue);
+        }
+
+        let caps_read = match parse_caps_v1(caps_read_b) {
+            Ok(c) => c,
+            Err(code) => {
+                let issue = fs_err_doc(
+                    op,
+                    &profile_id_s,
+                    &String::from_utf8_lossy(zip_path_b),
+                    code as u32,
+                );
+                return err_doc_from_issue(code as u32, issue);
+            }
+        };
+        let caps_write = match parse_caps_v1(caps_write_b) {
+            Ok(c) => c,
+            Err(code) => {
+                let issue = fs_err_doc(
+                    op,
+                    &profile_id_s,
+                    &String::from_utf8_lossy(out_root_b),
+                    code as u32,
+                );
+                return err_doc_from_issue(code as u32, issue);
+            }
+        };
+
+        let pol = policy();
+        if cap_allow_symlinks(caps_read) && !pol.allow_symlinks {
+            let issue = fs_err_doc(
+                op,
+                &profile_id_s,
+                &String::from_utf8_lossy(zip_path_b),
+                FS_ERR_SYMLINK_DENIED as u32,
+            );
+            return err_doc_from_issue(FS_ERR_SYMLINK_DENIED as u32, issue);
+        }
+        if cap_allow_symlinks(caps_write) && !pol.allow_symlinks {
+            let issue = fs_err_doc(
+                op,
+                &profile_id_s,
+                &String::from_utf8_lossy(out_root_b),
+                FS_ERR_SYMLINK_DENIED as u32,
+            );
+            return err_doc_from_issue(FS_ERR_SYMLINK_DENIED as u32, issue);
+        }
+
+        let out_root_pb = match enforce_write_path(caps_write, out_root_b) {
+            Ok(p) => p,
+            Err(code) => {
+                let issue = fs_err_doc(
+                    op,
+                    &profile_id_s,
+                    &String::from_utf8_lossy(out_root_b),
+                    code as u32,
+                );
+                return err_doc_from_issue(code as u32, issue);
+            }
         };
         if let Err(code) = ensure_out_root(caps_write, &out_root_pb) {
             let issue = fs_err_doc(
@@ -1036,7 +1624,7 @@ pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
             return err_doc_from_issue(FS_ERR_TOO_LARGE as u32, issue);
         }
 
-        let f = match fs::File::open(&zip_pb) {
+        let mut f = match fs::File::open(&zip_pb) {
             Ok(f) => f,
             Err(e) => {
                 let code = map_io_err(&e) as u32;
@@ -1045,6 +1633,36 @@ pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
             }
         };
 
+        // Member-heavy archives go to the worker pool; the central
+        // directory makes members independently addressable. Archives
+        // whose central directory cannot be read (and small ones) keep
+        // the streaming reader and its error reporting.
+        let entry_count = zip::ZipArchive::new(&f).map(|a| a.len()).unwrap_or(0);
+        if f.seek(io::SeekFrom::Start(0)).is_err() {
+            let issue = fs_err_doc(
+                op,
+                &profile_id_s,
+                &zip_pb.display().to_string(),
+                FS_ERR_IO as u32,
+            );
+            return err_doc_from_issue(FS_ERR_IO as u32, issue);
+        }
+        if entry_count >= ZIP_PAR_MIN_ENTRIES {
+            drop(f);
+            return match zip_extract_parallel(
+                op,
+                &profile_id_s,
+                &zip_pb,
+                out_root_b,
+                &out_root_canon,
+                caps_write,
+                pol,
+            ) {
+                Ok(entries) => ok_doc(&write_json_entries(entries)),
+                Err((code, issue)) => err_doc_from_issue(code, issue),
+            };
+        }
+
         let mut extracted: Vec<Value> = Vec::new();
         let mut total_out: u64 = 0;
         let mut total_name_bytes: usize = 0;
@@ -1077,30 +1695,14 @@ pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
                 file: &mut zip::read::ZipFile<'_>,
             ) -> zip::result::ZipResult<()> {
                 if self.names.len() >= ARCHIVE_MAX_ENTRIES {
-                    let issue = archive_limits_err_doc(
-                        self.op,
-                        self.profile_id,
-                        "entry_limit",
-                        2,
-                        "entry limit exceeded",
-                        "zip with <= 20000 entries and total name bytes <= 81920000",
-                        "reduce entry count/paths or relax limits in the archive profile",
-                    );
+                    let issue = zip_entry_limit_doc(self.op, self.profile_id);
                     return Err(self.abort_with_issue(2, issue));
                 }
 
                 let name_raw = file.name_raw().to_vec();
                 *self.total_name_bytes = self.total_name_bytes.saturating_add(name_raw.len());
                 if *self.total_name_bytes > ZIP_MAX_TOTAL_NAME_BYTES {
-                    let issue = archive_limits_err_doc(
-                        self.op,
-                        self.profile_id,
-                        "entry_limit",
-                        2,
-                        "entry limit exceeded",
-                        "zip with <= 20000 entries and total name bytes <= 81920000",
-                        "reduce entry count/paths or relax limits in the archive profile",
-                    );
+                    let issue = zip_entry_limit_doc(self.op, self.profile_id);
                     return Err(self.abort_with_issue(2, issue));
                 }
 
@@ -1195,14 +1797,10 @@ pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
                     let n = match file.read(&mut buf) {
                         Ok(n) => n,
                         Err(e) => {
-                            let issue = archive_limits_err_doc(
+                            let issue = zip_invalid_doc(
                                 self.op,
                                 self.profile_id,
-                                "invalid_archive",
-                                1,
                                 &format!("invalid zip: {e}"),
-                                "valid zip bytes",
-                                "ensure the zip input is complete and correctly formatted",
                             );
                             return Err(self.abort_with_issue(1, issue));
                         }
@@ -1221,28 +1819,12 @@ pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
                             );
                             return Err(self.abort_with_issue(FS_ERR_TOO_LARGE as u32, issue));
                         }
-                        let issue = archive_limits_err_doc(
-                            self.op,
-                            self.profile_id,
-                            "output_limit",
-                            3,
-                            "output limit exceeded",
-                            "zip where each file <= 268435456 bytes and total <= 1073741824 bytes",
-                            "reduce extracted output or relax archive profile limits",
-                        );
+                        let issue = zip_output_limit_doc(self.op, self.profile_id);
                         return Err(self.abort_with_issue(3, issue));
                     }
                     *self.total_out = self.total_out.saturating_add(n as u64);
                     if *self.total_out > ARCHIVE_MAX_TOTAL_OUT_BYTES {
-                        let issue = archive_limits_err_doc(
-                            self.op,
-                            self.profile_id,
-                            "output_limit",
-                            3,
-                            "output limit exceeded",
-                            "zip where each file <= 268435456 bytes and total <= 1073741824 bytes",
-                            "reduce extracted output or relax archive profile limits",
-                        );
+                        let issue = zip_output_limit_doc(self.op, self.profile_id);
                         return Err(self.abort_with_issue(3, issue));
                     }
                     hasher.update(&buf[..n]);
@@ -1254,15 +1836,7 @@ pub unsafe extern "C" fn x07_ext_archive_zip_extract_to_fs_v1(
                 }
                 let actual_crc = hasher.finalize();
                 if actual_crc != file.crc32() {
-                    let issue = archive_limits_err_doc(
-                        self.op,
-                        self.profile_id,
-                        "checksum_mismatch",
-                        4,
-                        "checksum mismatch",
-                        "zip with valid CRC32 checksums",
-                        "ensure the zip is not corrupted",
-                    );
+                    let issue = zip_checksum_doc(self.op, self.profile_id);
                     return Err(self.abort_with_issue(4, issue));
                 }
 
@@ -1517,6 +2091,74 @@ mod tests {
         let _ = std::fs::remove_dir_all(&root);
     }
 
+    #[test]
+    fn zip_extract_to_fs_v1_parallel_many_members() {
+        std::env::set_var("X07_OS_SANDBOXED", "0");
+        std::env::set_var("X07_OS_FS", "1");
+        std::env::set_var("X07_OS_FS_ALLOW_MKDIR", "1");
+        std::env::set_var("X07_OS_FS_ALLOW_RENAME", "1");
+        std::env::set_var("X07_OS_FS_MAX_READ_BYTES", "10000000");
+        std::env::set_var("X07_OS_FS_MAX_WRITE_BYTES", "10000000");
+
+        let root = make_root("zip_par");
+        let zip_path = root.join("in.zip");
+
+        // Enough members to take the worker-pool path, deflated so each
+        // worker exercises its own inflate context.
+        let member_count = 20usize;
+        {
+            let f = std::fs::File::create(&zip_path).expect("create zip file");
+            let mut zip = zip::ZipWriter::new(f);
+            for i in 0..member_count {
+                let opts = zip::write::FileOptions::<()>::default().unix_permissions(0o644);
+                zip.start_file(format!("dir{}/file{i}.txt", i % 3), opts)
+                    .expect("start zip entry");
+                let data = format!("payload {i} ").repeat(200);
+                zip.write_all(data.as_bytes()).expect("write zip entry");
+            }
+            zip.finish().expect("finish zip");
+        }
+
+        let out_root = root.join("out");
+        let caps = caps_v1(
+            10_000_000,
+            10_000_000,
+            CAP_CREATE_PARENTS | CAP_OVERWRITE | CAP_ATOMIC_WRITE,
+        );
+        let pid = b"zip_extract_safe_v1";
+
+        let doc = unsafe {
+            ev_to_vec(x07_ext_archive_zip_extract_to_fs_v1(
+                to_ev_bytes(out_root.to_string_lossy().as_bytes()),
+                to_ev_bytes(zip_path.to_string_lossy().as_bytes()),
+                to_ev_bytes(&caps),
+                to_ev_bytes(&caps),
+                to_ev_bytes(pid),
+            ))
+        };
+        let payload = parse_ok_payload(&doc);
+        let entries = payload
+            .get("entries")
+            .and_then(|v| v.as_array())
+            .expect("entries array");
+        assert_eq!(entries.len(), member_count);
+
+        // Entries keep archive order and every payload round-trips.
+        for (i, entry) in entries.iter().enumerate() {
+            let path = entry.get("path").and_then(|v| v.as_str()).expect("path");
+            assert_eq!(path, format!("dir{}/file{i}.txt", i % 3));
+            let want = format!("payload {i} ").repeat(200);
+            assert_eq!(
+                entry.get("size").and_then(|v| v.as_u64()),
+                Some(want.len() as u64)
+            );
+            let got = std::fs::read(out_root.join(path)).expect("read extracted file");
+            assert_eq!(got, want.as_bytes());
+        }
+
+        let _ = std::fs::remove_dir_all(&root);
+    }
+
     #[test]
     fn tar_extract_to_fs_v1_hello_smoke() {
         std::env::set_var("X07_OS_SANDBOXED", "0");
@@ -1617,6 +2259,137 @@ mod tests {
         let _ = std::fs::remove_dir_all(&root);
     }
 
+    // In-memory byte sources served through the C read callback, keyed by
+    // the callback data word. Reads are deliberately short (7 bytes) to
+    // exercise partial reads on the streaming path.
+    static READER_SRCS: Mutex<Vec<(Vec<u8>, usize)>> = Mutex::new(Vec::new());
+
+    unsafe extern "C" fn test_reader_read(data: u32, dst: *mut u8, cap: u32) -> u32 {
+        let mut srcs = READER_SRCS.lock().unwrap();
+        let (buf, pos) = &mut srcs[data as usize];
+        let n = (buf.len() - *pos).min(cap as usize).min(7);
+        unsafe { std::ptr::copy_nonoverlapping(buf.as_ptr().add(*pos), dst, n) };
+        *pos += n;
+        n as u32
+    }
+
+    fn register_reader_src(bytes: Vec<u8>) -> u32 {
+        let mut srcs = READER_SRCS.lock().unwrap();
+        srcs.push((bytes, 0));
+        (srcs.len() - 1) as u32
+    }
+
+    fn tar_bytes(name: &str, data: &[u8]) -> Vec<u8> {
+        let mut tar = tar::Builder::new(Vec::new());
+        let mut header = tar::Header::new_ustar();
+        header.set_path(name).expect("set tar path");
+        header.set_mode(0o644);
+        header.set_size(data.len() as u64);
+        header.set_cksum();
+        tar.append(&header, Cursor::new(data))
+            .expect("append tar entry");
+        tar.into_inner().expect("finish tar")
+    }
+
+    #[test]
+    fn tar_extract_reader_to_fs_v1_hello_smoke() {
+        std::env::set_var("X07_OS_SANDBOXED", "0");
+        std::env::set_var("X07_OS_FS", "1");
+        std::env::set_var("X07_OS_FS_ALLOW_MKDIR", "1");
+        std::env::set_var("X07_OS_FS_ALLOW_RENAME", "1");
+        std::env::set_var("X07_OS_FS_MAX_READ_BYTES", "1000000");
+        std::env::set_var("X07_OS_FS_MAX_WRITE_BYTES", "1000000");
+
+        let root = make_root("tar_reader_smoke");
+        let src = register_reader_src(tar_bytes("hello.txt", b"hello"));
+
+        let out_root = root.join("out");
+        let caps = caps_v1(
+            1_000_000,
+            1_000_000,
+            CAP_CREATE_PARENTS | CAP_OVERWRITE | CAP_ATOMIC_WRITE,
+        );
+        let pid = b"tar_extract_safe_v1";
+
+        let doc = unsafe {
+            ev_to_vec(x07_ext_archive_tar_extract_reader_to_fs_v1(
+                to_ev_bytes(out_root.to_string_lossy().as_bytes()),
+                Some(test_reader_read),
+                src,
+                to_ev_bytes(&caps),
+                to_ev_bytes(&caps),
+                to_ev_bytes(pid),
+            ))
+        };
+        let payload = parse_ok_payload(&doc);
+        let entries = payload
+            .get("entries")
+            .and_then(|v| v.as_array())
+            .expect("entries array");
+        assert_eq!(entries.len(), 1);
+        assert_eq!(
+            entries[0].get("path").and_then(|v| v.as_str()),
+            Some("hello.txt")
+        );
+        assert_eq!(entries[0].get("size").and_then(|v| v.as_u64()), Some(5));
+
+        let got = std::fs::read(out_root.join("hello.txt")).expect("read extracted file");
+        assert_eq!(got, b"hello");
+
+        let _ = std::fs::remove_dir_all(&root);
+    }
+
+    #[test]
+    fn tgz_extract_reader_to_fs_v1_hello_smoke() {
+        std::env::set_var("X07_OS_SANDBOXED", "0");
+        std::env::set_var("X07_OS_FS", "1");
+        std::env::set_var("X07_OS_FS_ALLOW_MKDIR", "1");
+        std::env::set_var("X07_OS_FS_ALLOW_RENAME", "1");
+        std::env::set_var("X07_OS_FS_MAX_READ_BYTES", "1000000");
+        std::env::set_var("X07_OS_FS_MAX_WRITE_BYTES", "1000000");
+
+        let root = make_root("tgz_reader_smoke");
+        let mut enc =
+            flate2::write::GzEncoder::new(Vec::new(), flate2::Compression::default());
+        enc.write_all(&tar_bytes("hello.txt", b"hello"))
+            .expect("gz write");
+        let src = register_reader_src(enc.finish().expect("finish gz"));
+
+        let out_root = root.join("out");
+        let caps = caps_v1(
+            1_000_000,
+            1_000_000,
+            CAP_CREATE_PARENTS | CAP_OVERWRITE | CAP_ATOMIC_WRITE,
+        );
+        let pid = b"tgz_extract_safe_v1";
+
+        let doc = unsafe {
+            ev_to_vec(x07_ext_archive_tgz_extract_reader_to_fs_v1(
+                to_ev_bytes(out_root.to_string_lossy().as_bytes()),
+                Some(test_reader_read),
+                src,
+                to_ev_bytes(&caps),
+                to_ev_bytes(&caps),
+                to_ev_bytes(pid),
+            ))
+        };
+        let payload = parse_ok_payload(&doc);
+        let entries = payload
+            .get("entries")
+            .and_then(|v| v.as_array())
+            .expect("entries array");
+        assert_eq!(entries.len(), 1);
+        assert_eq!(
+            entries[0].get("path").and_then(|v| v.as_str()),
+            Some("hello.txt")
+        );
+
+        let got = std::fs::read(out_root.join("hello.txt")).expect("read extracted file");
+        assert_eq!(got, b"hello");
+
+        let _ = std::fs::remove_dir_all(&root);
+    }
+
     #[test]
     fn zip_extract_rejects_zip_slip_paths() {
         std::env::set_var("X07_OS_SANDBOXED", "0");
@@ -29,12 +29,20 @@ pub fn trap_db_internal() -> ! {
 pub const DB_ERR_POLICY_DENIED: u32 = 53_249;
 pub const DB_ERR_BAD_REQ: u32 = 53_250;
 pub const DB_ERR_BAD_CONN: u32 = 53_251;
+pub const DB_ERR_BAD_STMT: u32 = 53_252;
 pub const DB_ERR_TOO_LARGE: u32 = 53_760;
 
 pub const OP_OPEN_V1: u32 = 1;
 pub const OP_EXEC_V1: u32 = 2;
 pub const OP_QUERY_V1: u32 = 3;
 pub const OP_CLOSE_V1: u32 = 4;
+pub const OP_PREPARE_V1: u32 = 5;
+pub const OP_STMT_QUERY_V1: u32 = 6;
+pub const OP_STMT_EXEC_V1: u32 = 7;
+pub const OP_FINALIZE_V1: u32 = 8;
+pub const OP_COPY_BEGIN_V1: u32 = 9;
+pub const OP_COPY_WRITE_V1: u32 = 10;
+pub const OP_COPY_FINISH_V1: u32 = 11;
 
 pub fn env_bool(name: &str, default: bool) -> bool {
     std::env::var(name)
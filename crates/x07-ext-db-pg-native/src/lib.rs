@@ -5,13 +5,17 @@ use dbcore::{
     dm_value_number_ascii, dm_value_seq, dm_value_string, effective_connect_timeout_ms,
     effective_max, effective_query_timeout_ms, evdb_err, evdb_ok, parse_db_caps_v1,
     parse_ipnet_list, parse_params_doc_v1, read_u32_le, DmScalar, DB_ERR_BAD_CONN, DB_ERR_BAD_REQ,
-    DB_ERR_POLICY_DENIED, DB_ERR_TOO_LARGE, OP_CLOSE_V1, OP_EXEC_V1, OP_OPEN_V1, OP_QUERY_V1,
+    DB_ERR_BAD_STMT, DB_ERR_POLICY_DENIED, DB_ERR_TOO_LARGE, OP_CLOSE_V1, OP_COPY_BEGIN_V1,
+    OP_COPY_FINISH_V1, OP_COPY_WRITE_V1, OP_EXEC_V1, OP_FINALIZE_V1, OP_OPEN_V1, OP_PREPARE_V1,
+    OP_QUERY_V1, OP_STMT_EXEC_V1, OP_STMT_QUERY_V1,
 };
-use futures_util::{pin_mut, TryStreamExt as _};
+use bytes::Bytes;
+use futures_util::{pin_mut, SinkExt as _, TryStreamExt as _};
 use once_cell::sync::OnceCell;
 use rustls::client::danger::{HandshakeSignatureValid, ServerCertVerified, ServerCertVerifier};
 use rustls::pki_types::{CertificateDer, ServerName, UnixTime};
 use rustls::{ClientConfig, Error as RustlsError, SignatureScheme};
+use std::pin::Pin;
 use std::sync::atomic::{AtomicU32, Ordering};
 use std::sync::Arc;
 use std::sync::Mutex;
@@ -26,6 +30,7 @@ const DB_ERR_PG_CONNECT: u32 = 53_520;
 const DB_ERR_PG_QUERY: u32 = 53_521;
 const DB_ERR_PG_EXEC: u32 = 53_522;
 const DB_ERR_PG_TLS: u32 = 53_523;
+const DB_ERR_PG_COPY: u32 = 53_524;
 
 #[derive(Debug, Clone)]
 struct Policy {
@@ -194,11 +199,114 @@ fn take_conn(conn_id: u32) -> Option<Arc<Client>> {
     slot.take()
 }
 
+// Prepared statements resident across calls: the server-side plan from
+// prepare_v1 is reused by stmt_query/stmt_exec, which only bind and run.
+// The owning connection is recorded so close can drop dependents.
+#[derive(Clone)]
+struct PgStmt {
+    stmt: tokio_postgres::Statement,
+    conn_id: u32,
+}
+
+static STMTS: OnceCell<Mutex<Vec<Option<PgStmt>>>> = OnceCell::new();
+
+fn stmts() -> &'static Mutex<Vec<Option<PgStmt>>> {
+    STMTS.get_or_init(|| Mutex::new(vec![None; 4096]))
+}
+
+fn open_stmt_slot(entry: PgStmt) -> Option<u32> {
+    let mut table = stmts().lock().ok()?;
+    for (idx, slot) in table.iter_mut().enumerate().skip(1) {
+        if slot.is_none() {
+            *slot = Some(entry);
+            return Some(idx as u32);
+        }
+    }
+    None
+}
+
+fn get_stmt(stmt_id: u32) -> Option<PgStmt> {
+    let table = stmts().lock().ok()?;
+    table.get(stmt_id as usize).cloned().flatten()
+}
+
+fn take_stmt(stmt_id: u32) -> Option<PgStmt> {
+    let mut table = stmts().lock().ok()?;
+    let slot = table.get_mut(stmt_id as usize)?;
+    slot.take()
+}
+
+fn drop_stmts_for_conn(conn_id: u32) {
+    let Ok(mut table) = stmts().lock() else {
+        return;
+    };
+    for slot in table.iter_mut().skip(1) {
+        if slot.as_ref().is_some_and(|e| e.conn_id == conn_id) {
+            *slot = None;
+        }
+    }
+}
+
 fn get_conn(conn_id: u32) -> Option<Arc<Client>> {
     let table = conns().lock().ok()?;
     table.get(conn_id as usize).cloned().flatten()
 }
 
+// An in-progress COPY FROM STDIN. The sink is taken out of its slot for
+// the duration of each write so no lock is held across an await; a second
+// caller racing on the same copy_id simply sees a dead handle.
+struct PgCopy {
+    sink: Pin<Box<tokio_postgres::CopyInSink<Bytes>>>,
+    conn_id: u32,
+}
+
+static COPIES: OnceCell<Mutex<Vec<Option<PgCopy>>>> = OnceCell::new();
+
+fn copies() -> &'static Mutex<Vec<Option<PgCopy>>> {
+    COPIES.get_or_init(|| {
+        let mut v: Vec<Option<PgCopy>> = Vec::with_capacity(4096);
+        v.resize_with(4096, || None);
+        Mutex::new(v)
+    })
+}
+
+fn open_copy_slot(entry: PgCopy) -> Option<u32> {
+    let mut table = copies().lock().ok()?;
+    for (idx, slot) in table.iter_mut().enumerate().skip(1) {
+        if slot.is_none() {
+            *slot = Some(entry);
+            return Some(idx as u32);
+        }
+    }
+    None
+}
+
+fn take_copy(copy_id: u32) -> Option<PgCopy> {
+    let mut table = copies().lock().ok()?;
+    let slot = table.get_mut(copy_id as usize)?;
+    slot.take()
+}
+
+fn put_copy(copy_id: u32, entry: PgCopy) {
+    let Ok(mut table) = copies().lock() else {
+        return;
+    };
+    if let Some(slot) = table.get_mut(copy_id as usize) {
+        *slot = Some(entry);
+    }
+}
+
+fn drop_copies_for_conn(conn_id: u32) {
+    let Ok(mut table) = copies().lock() else {
+        return;
+    };
+    for slot in table.iter_mut().skip(1) {
+        if slot.as_ref().is_some_and(|e| e.conn_id == conn_id) {
+            *slot = None;
+        }
+    }
+}
+
 struct PgOpenReq<'a> {
     flags: u32,
     host: &'a [u8],
@@ -329,6 +437,188 @@ fn parse_evpc_close_req(req: &[u8]) -> Result<u32, u32> {
     Ok(conn_id)
 }
 
+struct PgPrepareReq<'a> {
+    conn_id: u32,
+    sql: &'a [u8],
+}
+
+fn parse_evpp_prepare_req(req: &[u8]) -> Result<PgPrepareReq<'_>, u32> {
+    if req.len() < 20 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7PP" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let conn_id = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    let flags = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let sql_len = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)? as usize;
+    if req.len() != 20 + sql_len {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    Ok(PgPrepareReq {
+        conn_id,
+        sql: &req[20..],
+    })
+}
+
+struct PgStmtReq<'a> {
+    stmt_id: u32,
+    params_doc: &'a [u8],
+}
+
+fn parse_evpt_stmt_req<'a>(req: &'a [u8], magic: &[u8; 4]) -> Result<PgStmtReq<'a>, u32> {
+    if req.len() < 20 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != magic {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let stmt_id = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    let flags = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let params_len = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)? as usize;
+    if req.len() != 20 + params_len {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    Ok(PgStmtReq {
+        stmt_id,
+        params_doc: &req[20..],
+    })
+}
+
+fn parse_evpf_finalize_req(req: &[u8]) -> Result<u32, u32> {
+    if req.len() != 12 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7PF" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)
+}
+
+struct PgCopyBeginReq<'a> {
+    conn_id: u32,
+    table: &'a [u8],
+    cols: Vec<&'a [u8]>,
+}
+
+fn parse_evpc_copy_begin_req(req: &[u8]) -> Result<PgCopyBeginReq<'_>, u32> {
+    if req.len() < 24 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7PC" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let conn_id = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    let flags = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let table_len = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)? as usize;
+    let mut off = 20usize;
+    let table_end = off.checked_add(table_len).ok_or(DB_ERR_BAD_REQ)?;
+    let table = req.get(off..table_end).ok_or(DB_ERR_BAD_REQ)?;
+    off = table_end;
+
+    let col_count = read_u32_le(req, off).ok_or(DB_ERR_BAD_REQ)? as usize;
+    off += 4;
+    let mut cols: Vec<&[u8]> = Vec::with_capacity(col_count.min(req.len() / 4));
+    for _ in 0..col_count {
+        let len = read_u32_le(req, off).ok_or(DB_ERR_BAD_REQ)? as usize;
+        off += 4;
+        let end = off.checked_add(len).ok_or(DB_ERR_BAD_REQ)?;
+        let col = req.get(off..end).ok_or(DB_ERR_BAD_REQ)?;
+        cols.push(col);
+        off = end;
+    }
+
+    if off != req.len() {
+        return Err(DB_ERR_BAD_REQ);
+    }
+
+    Ok(PgCopyBeginReq {
+        conn_id,
+        table,
+        cols,
+    })
+}
+
+fn parse_evpw_copy_write_req(req: &[u8]) -> Result<(u32, &[u8]), u32> {
+    if req.len() < 20 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7PW" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let copy_id = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    let flags = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let data_len = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)? as usize;
+    let end = 20usize.checked_add(data_len).ok_or(DB_ERR_BAD_REQ)?;
+    if end != req.len() {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    Ok((copy_id, &req[20..end]))
+}
+
+fn parse_evpd_copy_finish_req(req: &[u8]) -> Result<u32, u32> {
+    if req.len() != 12 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7PD" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)
+}
+
+fn pg_quote_ident(name: &[u8]) -> Result<String, u32> {
+    let s = std::str::from_utf8(name).map_err(|_| DB_ERR_BAD_REQ)?;
+    if s.is_empty() || s.contains('\0') {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let mut out = String::with_capacity(s.len() + 2);
+    out.push('"');
+    for ch in s.chars() {
+        if ch == '"' {
+            out.push('"');
+        }
+        out.push(ch);
+    }
+    out.push('"');
+    Ok(out)
+}
+
 fn pg_host_port_allowed(pol: &Policy, host: &str, port: u16) -> bool {
     if !pol.sandboxed {
         return true;
@@ -579,6 +869,8 @@ pub extern "C" fn x07_ext_db_pg_close_v1(
     if take_conn(conn_id).is_none() {
         return alloc_return_bytes(&evdb_err(OP_CLOSE_V1, DB_ERR_BAD_CONN, &[]));
     }
+    drop_stmts_for_conn(conn_id);
+    drop_copies_for_conn(conn_id);
 
     alloc_return_bytes(&evdb_ok(OP_CLOSE_V1, &[]))
 }
@@ -797,3 +1089,536 @@ pub extern "C" fn x07_ext_db_pg_exec_v1(
 
     alloc_return_bytes(&evdb_ok(OP_EXEC_V1, &doc))
 }
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_prepare_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, code, &[])),
+    };
+
+    let prep = match parse_evpp_prepare_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, code, &[])),
+    };
+
+    if prep.sql.len() > pol.max_sql_bytes as usize {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    let Some(client) = get_conn(prep.conn_id) else {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_BAD_CONN, &[]));
+    };
+
+    let sql = match std::str::from_utf8(prep.sql) {
+        Ok(s) => s.to_string(),
+        Err(_) => return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_BAD_REQ, &[])),
+    };
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+
+    let stmt = match runtime().block_on(async move {
+        let fut = client.prepare(&sql);
+        if timeout_ms != 0 {
+            tokio::time::timeout(Duration::from_millis(timeout_ms as u64), fut)
+                .await
+                .map_err(|_| (DB_ERR_PG_QUERY, b"timeout".to_vec()))?
+                .map_err(|e| (DB_ERR_PG_QUERY, e.to_string().into_bytes()))
+        } else {
+            fut.await
+                .map_err(|e| (DB_ERR_PG_QUERY, e.to_string().into_bytes()))
+        }
+    }) {
+        Ok(v) => v,
+        Err((code, msg)) => {
+            if msg.as_slice() == b"timeout" {
+                dbcore::evict_conn_slot(conns(), prep.conn_id);
+            }
+            return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, code, &msg));
+        }
+    };
+
+    let Some(stmt_id) = open_stmt_slot(PgStmt {
+        stmt,
+        conn_id: prep.conn_id,
+    }) else {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_TOO_LARGE, &[]));
+    };
+
+    alloc_return_bytes(&evdb_ok(OP_PREPARE_V1, &stmt_id.to_le_bytes()))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_stmt_query_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+    if let Err(out) = count_query_or_deny(pol, OP_STMT_QUERY_V1) {
+        return out;
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &[])),
+    };
+
+    let stmt_req = match parse_evpt_stmt_req(req, b"X7PR") {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &[])),
+    };
+
+    let Some(entry) = get_stmt(stmt_req.stmt_id) else {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_BAD_STMT, &[]));
+    };
+    let conn_id = entry.conn_id;
+    let Some(client) = get_conn(conn_id) else {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_BAD_CONN, &[]));
+    };
+
+    let params = match pg_params_as_unknown_text(stmt_req.params_doc) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &[])),
+    };
+
+    let max_rows = effective_max(pol.max_rows, caps.max_rows);
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+
+    let doc = match runtime().block_on(async move {
+        let stmt = entry.stmt;
+        let stream = client
+            .query_raw(&stmt, params.iter().map(|p| p as &dyn ToSql))
+            .await
+            .map_err(|e| (DB_ERR_PG_QUERY, e.to_string().into_bytes()))?;
+        pin_mut!(stream);
+
+        let mut rows: Vec<tokio_postgres::Row> = Vec::new();
+        let mut too_many = false;
+
+        loop {
+            let next = if timeout_ms != 0 {
+                tokio::time::timeout(Duration::from_millis(timeout_ms as u64), stream.try_next())
+                    .await
+                    .map_err(|_| (DB_ERR_PG_QUERY, b"timeout".to_vec()))?
+            } else {
+                stream.try_next().await
+            };
+            let row = next.map_err(|e| (DB_ERR_PG_QUERY, e.to_string().into_bytes()))?;
+            let Some(row) = row else {
+                break;
+            };
+            if max_rows != 0 && rows.len() >= max_rows as usize {
+                too_many = true;
+                continue;
+            }
+            rows.push(row);
+        }
+
+        if too_many {
+            return Err((DB_ERR_TOO_LARGE, Vec::new()));
+        }
+
+        dm_rows_doc_from_pg(stmt.columns(), &rows).map_err(|code| (code, Vec::new()))
+    }) {
+        Ok(doc) => doc,
+        Err((code, msg)) => {
+            if code == DB_ERR_BAD_CONN || msg.as_slice() == b"timeout" {
+                dbcore::evict_conn_slot(conns(), conn_id);
+                drop_stmts_for_conn(conn_id);
+            }
+            return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &msg));
+        }
+    };
+
+    let max_resp = effective_max(pol.max_resp_bytes, caps.max_resp_bytes);
+    if max_resp != 0 && doc.len() > max_resp as usize {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    alloc_return_bytes(&evdb_ok(OP_STMT_QUERY_V1, &doc))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_stmt_exec_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+    if let Err(out) = count_query_or_deny(pol, OP_STMT_EXEC_V1) {
+        return out;
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+
+    let stmt_req = match parse_evpt_stmt_req(req, b"X7PX") {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+
+    let Some(entry) = get_stmt(stmt_req.stmt_id) else {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_BAD_STMT, &[]));
+    };
+    let conn_id = entry.conn_id;
+    let Some(client) = get_conn(conn_id) else {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_BAD_CONN, &[]));
+    };
+
+    let params = match pg_params_as_unknown_text(stmt_req.params_doc) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+
+    let rows_affected = match runtime().block_on(async move {
+        let stream = client
+            .query_raw(&entry.stmt, params.iter().map(|p| p as &dyn ToSql))
+            .await
+            .map_err(|e| (DB_ERR_PG_EXEC, e.to_string().into_bytes()))?;
+        pin_mut!(stream);
+
+        loop {
+            let next = if timeout_ms != 0 {
+                tokio::time::timeout(Duration::from_millis(timeout_ms as u64), stream.try_next())
+                    .await
+                    .map_err(|_| (DB_ERR_PG_EXEC, b"timeout".to_vec()))?
+            } else {
+                stream.try_next().await
+            };
+            let row = next.map_err(|e| (DB_ERR_PG_EXEC, e.to_string().into_bytes()))?;
+            if row.is_none() {
+                break;
+            }
+        }
+
+        Ok::<u64, (u32, Vec<u8>)>(stream.rows_affected().unwrap_or(0))
+    }) {
+        Ok(v) => v,
+        Err((code, msg)) => {
+            if code == DB_ERR_BAD_CONN || msg.as_slice() == b"timeout" {
+                dbcore::evict_conn_slot(conns(), conn_id);
+                drop_stmts_for_conn(conn_id);
+            }
+            return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &msg));
+        }
+    };
+
+    let mut entries: Vec<(Vec<u8>, Vec<u8>)> = Vec::new();
+    entries.push((b"last_insert_id".to_vec(), dm_value_number_ascii(b"0")));
+    let mut buf = itoa::Buffer::new();
+    entries.push((
+        b"rows_affected".to_vec(),
+        dm_value_number_ascii(buf.format(rows_affected).as_bytes()),
+    ));
+
+    let map_val = match dm_value_map(entries) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+    let doc = dm_doc_ok(&map_val);
+
+    let max_resp = effective_max(pol.max_resp_bytes, caps.max_resp_bytes);
+    if max_resp != 0 && doc.len() > max_resp as usize {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    alloc_return_bytes(&evdb_ok(OP_STMT_EXEC_V1, &doc))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_finalize_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let _caps_raw = unsafe { bytes_as_slice(caps) };
+    let req = unsafe { bytes_as_slice(req) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_FINALIZE_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    let stmt_id = match parse_evpf_finalize_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_FINALIZE_V1, code, &[])),
+    };
+
+    if take_stmt(stmt_id).is_none() {
+        return alloc_return_bytes(&evdb_err(OP_FINALIZE_V1, DB_ERR_BAD_STMT, &[]));
+    }
+
+    alloc_return_bytes(&evdb_ok(OP_FINALIZE_V1, &[]))
+}
+
+// PGCOPY binary signature plus zero flags and zero extension length. The
+// backend writes the header and trailer itself; callers feed only packed
+// row tuples (u16_be field count, then i32_be length + bytes per field).
+const PG_COPY_BINARY_HEADER: [u8; 19] = *b"PGCOPY\n\xff\r\n\0\0\0\0\0\0\0\0\0";
+const PG_COPY_BINARY_TRAILER: [u8; 2] = [0xff, 0xff];
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_copy_begin_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+    if let Err(out) = count_query_or_deny(pol, OP_COPY_BEGIN_V1) {
+        return out;
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, code, &[])),
+    };
+
+    let begin = match parse_evpc_copy_begin_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, code, &[])),
+    };
+
+    let Some(client) = get_conn(begin.conn_id) else {
+        return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, DB_ERR_BAD_CONN, &[]));
+    };
+
+    let mut sql = String::from("COPY ");
+    match pg_quote_ident(begin.table) {
+        Ok(q) => sql.push_str(&q),
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, code, &[])),
+    }
+    if !begin.cols.is_empty() {
+        sql.push_str(" (");
+        for (i, col) in begin.cols.iter().enumerate() {
+            if i != 0 {
+                sql.push_str(", ");
+            }
+            match pg_quote_ident(col) {
+                Ok(q) => sql.push_str(&q),
+                Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, code, &[])),
+            }
+        }
+        sql.push(')');
+    }
+    sql.push_str(" FROM STDIN WITH (FORMAT binary)");
+    if sql.len() > pol.max_sql_bytes as usize {
+        return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+
+    let sink = match runtime().block_on(async move {
+        let fut = async {
+            let sink: tokio_postgres::CopyInSink<Bytes> = client
+                .copy_in(&sql)
+                .await
+                .map_err(|e| (DB_ERR_PG_COPY, e.to_string().into_bytes()))?;
+            let mut sink = Box::pin(sink);
+            sink.send(Bytes::from_static(&PG_COPY_BINARY_HEADER))
+                .await
+                .map_err(|e| (DB_ERR_PG_COPY, e.to_string().into_bytes()))?;
+            Ok::<Pin<Box<tokio_postgres::CopyInSink<Bytes>>>, (u32, Vec<u8>)>(sink)
+        };
+
+        if timeout_ms != 0 {
+            tokio::time::timeout(Duration::from_millis(timeout_ms as u64), fut)
+                .await
+                .map_err(|_| (DB_ERR_PG_COPY, b"timeout".to_vec()))?
+        } else {
+            fut.await
+        }
+    }) {
+        Ok(v) => v,
+        Err((code, msg)) => {
+            if msg.as_slice() == b"timeout" {
+                dbcore::evict_conn_slot(conns(), begin.conn_id);
+                drop_stmts_for_conn(begin.conn_id);
+                drop_copies_for_conn(begin.conn_id);
+            }
+            return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, code, &msg));
+        }
+    };
+
+    let Some(copy_id) = open_copy_slot(PgCopy {
+        sink,
+        conn_id: begin.conn_id,
+    }) else {
+        return alloc_return_bytes(&evdb_err(OP_COPY_BEGIN_V1, DB_ERR_TOO_LARGE, &[]));
+    };
+
+    alloc_return_bytes(&evdb_ok(OP_COPY_BEGIN_V1, &copy_id.to_le_bytes()))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_copy_write_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_COPY_WRITE_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_WRITE_V1, code, &[])),
+    };
+
+    let (copy_id, data) = match parse_evpw_copy_write_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_WRITE_V1, code, &[])),
+    };
+
+    let Some(mut entry) = take_copy(copy_id) else {
+        return alloc_return_bytes(&evdb_err(OP_COPY_WRITE_V1, DB_ERR_BAD_STMT, &[]));
+    };
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+    let chunk = Bytes::copy_from_slice(data);
+
+    let res = runtime().block_on(async {
+        let fut = async {
+            entry
+                .sink
+                .send(chunk)
+                .await
+                .map_err(|e| (DB_ERR_PG_COPY, e.to_string().into_bytes()))
+        };
+
+        if timeout_ms != 0 {
+            tokio::time::timeout(Duration::from_millis(timeout_ms as u64), fut)
+                .await
+                .map_err(|_| (DB_ERR_PG_COPY, b"timeout".to_vec()))?
+        } else {
+            fut.await
+        }
+    });
+
+    match res {
+        Ok(()) => {
+            put_copy(copy_id, entry);
+            alloc_return_bytes(&evdb_ok(OP_COPY_WRITE_V1, &[]))
+        }
+        Err((code, msg)) => {
+            // A failed COPY leaves the connection in copy mode with no way
+            // to resync from here; drop everything hanging off it.
+            let conn_id = entry.conn_id;
+            drop(entry);
+            dbcore::evict_conn_slot(conns(), conn_id);
+            drop_stmts_for_conn(conn_id);
+            drop_copies_for_conn(conn_id);
+            alloc_return_bytes(&evdb_err(OP_COPY_WRITE_V1, code, &msg))
+        }
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_pg_copy_finish_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.pg_enabled {
+        return alloc_return_bytes(&evdb_err(OP_COPY_FINISH_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_FINISH_V1, code, &[])),
+    };
+
+    let copy_id = match parse_evpd_copy_finish_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_FINISH_V1, code, &[])),
+    };
+
+    let Some(mut entry) = take_copy(copy_id) else {
+        return alloc_return_bytes(&evdb_err(OP_COPY_FINISH_V1, DB_ERR_BAD_STMT, &[]));
+    };
+    let conn_id = entry.conn_id;
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+
+    let rows = match runtime().block_on(async {
+        let fut = async {
+            entry
+                .sink
+                .send(Bytes::from_static(&PG_COPY_BINARY_TRAILER))
+                .await
+                .map_err(|e| (DB_ERR_PG_COPY, e.to_string().into_bytes()))?;
+            entry
+                .sink
+                .as_mut()
+                .finish()
+                .await
+                .map_err(|e| (DB_ERR_PG_COPY, e.to_string().into_bytes()))
+        };
+
+        if timeout_ms != 0 {
+            tokio::time::timeout(Duration::from_millis(timeout_ms as u64), fut)
+                .await
+                .map_err(|_| (DB_ERR_PG_COPY, b"timeout".to_vec()))?
+        } else {
+            fut.await
+        }
+    }) {
+        Ok(v) => v,
+        Err((code, msg)) => {
+            dbcore::evict_conn_slot(conns(), conn_id);
+            drop_stmts_for_conn(conn_id);
+            drop_copies_for_conn(conn_id);
+            return alloc_return_bytes(&evdb_err(OP_COPY_FINISH_V1, code, &msg));
+        }
+    };
+
+    let mut entries: Vec<(Vec<u8>, Vec<u8>)> = Vec::new();
+    entries.push((b"last_insert_id".to_vec(), dm_value_number_ascii(b"0")));
+    let mut buf = itoa::Buffer::new();
+    entries.push((
+        b"rows_affected".to_vec(),
+        dm_value_number_ascii(buf.format(rows).as_bytes()),
+    ));
+
+    let map_val = match dm_value_map(entries) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_COPY_FINISH_V1, code, &[])),
+    };
+
+    alloc_return_bytes(&evdb_ok(OP_COPY_FINISH_V1, &dm_doc_ok(&map_val)))
+}
@@ -183,6 +183,19 @@ fn count_query_or_deny(pol: &Policy, op: u32) -> Result<(), dbcore::ev_bytes> {
     Ok(())
 }
 
+// Like count_query_or_deny, but charges n commands at once so a pipelined
+// batch is accounted the same as n individual cmd_v1 calls.
+fn count_queries_or_deny(pol: &Policy, op: u32, n: u32) -> Result<(), dbcore::ev_bytes> {
+    if pol.max_queries == 0 {
+        return Ok(());
+    }
+    let prev = QUERIES.fetch_add(n, Ordering::Relaxed);
+    if prev.saturating_add(n) > pol.max_queries {
+        return Err(alloc_return_bytes(&evdb_err(op, DB_ERR_POLICY_DENIED, &[])));
+    }
+    Ok(())
+}
+
 fn open_slot(conn: RedisConn, pol: &Policy) -> Option<u32> {
     let mut table = conns().lock().ok()?;
     if pol.max_live_conns != 0 {
@@ -363,6 +376,40 @@ fn parse_evrv_argv<'a>(argv: &'a [u8]) -> Result<Vec<&'a [u8]>, u32> {
     Ok(out)
 }
 
+fn parse_evrb_pipeline_req(req: &[u8]) -> Result<(u32, u32, Vec<&[u8]>), u32> {
+    if req.len() < 24 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7RB" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let flags = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let conn_id = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    let window = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)?;
+    let count = read_u32_le(req, 20).ok_or(DB_ERR_BAD_REQ)? as usize;
+    let mut off = 24usize;
+    let mut cmds: Vec<&[u8]> = Vec::with_capacity(count.min(req.len() / 4));
+    for _ in 0..count {
+        let len = read_u32_le(req, off).ok_or(DB_ERR_BAD_REQ)? as usize;
+        off += 4;
+        let end = off.checked_add(len).ok_or(DB_ERR_BAD_REQ)?;
+        let slice = req.get(off..end).ok_or(DB_ERR_BAD_REQ)?;
+        cmds.push(slice);
+        off = end;
+    }
+    if off != req.len() {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    Ok((conn_id, window, cmds))
+}
+
 fn redis_host_port_allowed(pol: &Policy, host: &str, port: u16) -> bool {
     if !pol.sandboxed {
         return true;
@@ -573,7 +620,10 @@ fn resp_to_dm_value(v: Resp3) -> Result<Vec<u8>, u32> {
     }
 }
 
-async fn write_argv(io: &mut BufStream<DynStream>, argv: &[&[u8]]) -> Result<(), (u32, Vec<u8>)> {
+async fn write_argv_frame(
+    io: &mut BufStream<DynStream>,
+    argv: &[&[u8]],
+) -> Result<(), (u32, Vec<u8>)> {
     io.write_all(format!("*{}\r\n", argv.len()).as_bytes())
         .await
         .map_err(|e| (DB_ERR_REDIS_CMD, e.to_string().into_bytes()))?;
@@ -588,6 +638,11 @@ async fn write_argv(io: &mut BufStream<DynStream>, argv: &[&[u8]]) -> Result<(),
             .await
             .map_err(|e| (DB_ERR_REDIS_CMD, e.to_string().into_bytes()))?;
     }
+    Ok(())
+}
+
+async fn write_argv(io: &mut BufStream<DynStream>, argv: &[&[u8]]) -> Result<(), (u32, Vec<u8>)> {
+    write_argv_frame(io, argv).await?;
     io.flush()
         .await
         .map_err(|e| (DB_ERR_REDIS_CMD, e.to_string().into_bytes()))?;
@@ -840,3 +895,116 @@ pub extern "C" fn x07_ext_db_redis_cmd_v1(
 
     alloc_return_bytes(&evdb_ok(OP_QUERY_V1, &doc))
 }
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_redis_pipeline_v1(
+    req: dbcore::ev_bytes,
+    caps: dbcore::ev_bytes,
+) -> dbcore::ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.redis_enabled {
+        return alloc_return_bytes(&evdb_err(OP_QUERY_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_QUERY_V1, code, &[])),
+    };
+
+    if req.len() > pol.max_req_bytes as usize {
+        return alloc_return_bytes(&evdb_err(OP_QUERY_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    let (conn_id, window, cmd_blobs) = match parse_evrb_pipeline_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_QUERY_V1, code, &[])),
+    };
+
+    if let Err(out) = count_queries_or_deny(pol, OP_QUERY_V1, cmd_blobs.len() as u32) {
+        return out;
+    }
+
+    let mut cmds: Vec<Vec<&[u8]>> = Vec::with_capacity(cmd_blobs.len());
+    for blob in &cmd_blobs {
+        match parse_evrv_argv(blob) {
+            Ok(argv) => cmds.push(argv),
+            Err(code) => return alloc_return_bytes(&evdb_err(OP_QUERY_V1, code, &[])),
+        }
+    }
+    if cmds.is_empty() {
+        let value = dm_value_seq(&[]);
+        return alloc_return_bytes(&evdb_ok(OP_QUERY_V1, &dm_doc_ok(&value)));
+    }
+
+    let Some(conn) = get_conn(conn_id) else {
+        return alloc_return_bytes(&evdb_err(OP_QUERY_V1, DB_ERR_BAD_CONN, &[]));
+    };
+
+    // window == 0 means "everything in one flight"; otherwise commands are
+    // written and flushed in chunks of `window` so server-side reply buffers
+    // for huge batches stay bounded. Either way each chunk is one round trip.
+    let window = if window == 0 {
+        cmds.len()
+    } else {
+        (window as usize).min(cmds.len())
+    };
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+
+    let doc = match runtime().block_on(async move {
+        let fut = async {
+            let mut conn = conn.lock().await;
+            let mut vals: Vec<Vec<u8>> = Vec::with_capacity(cmds.len());
+            for chunk in cmds.chunks(window) {
+                for argv in chunk {
+                    write_argv_frame(&mut conn.io, argv).await?;
+                }
+                conn.io
+                    .flush()
+                    .await
+                    .map_err(|e| (DB_ERR_REDIS_CMD, e.to_string().into_bytes()))?;
+                for _ in chunk {
+                    let resp = read_resp3(&mut conn.io, 64).await?;
+                    let pair = match resp {
+                        Resp3::Error(msg) => {
+                            dm_value_seq(&[dm_value_bool(false), dm_value_string(&msg)])
+                        }
+                        other => {
+                            let v =
+                                resp_to_dm_value(other).map_err(|code| (code, Vec::new()))?;
+                            dm_value_seq(&[dm_value_bool(true), v])
+                        }
+                    };
+                    vals.push(pair);
+                }
+            }
+            Ok::<Vec<u8>, (u32, Vec<u8>)>(dm_doc_ok(&dm_value_seq(&vals)))
+        };
+
+        if timeout_ms != 0 {
+            tokio::time::timeout(Duration::from_millis(timeout_ms as u64), fut)
+                .await
+                .map_err(|_| (DB_ERR_REDIS_CMD, b"timeout".to_vec()))?
+        } else {
+            fut.await
+        }
+    }) {
+        Ok(v) => v,
+        Err((code, msg)) => {
+            // A failed or timed-out batch leaves unread replies on the wire;
+            // the connection cannot be reused.
+            dbcore::evict_conn_slot(conns(), conn_id);
+            return alloc_return_bytes(&evdb_err(OP_QUERY_V1, code, &msg));
+        }
+    };
+
+    let max_resp = effective_max(pol.max_resp_bytes, caps.max_resp_bytes);
+    if max_resp != 0 && doc.len() > max_resp as usize {
+        return alloc_return_bytes(&evdb_err(OP_QUERY_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    alloc_return_bytes(&evdb_ok(OP_QUERY_V1, &doc))
+}
@@ -6,7 +6,8 @@ use dbcore::{
     dm_value_number_ascii, dm_value_seq, dm_value_string, effective_connect_timeout_ms,
     effective_max, effective_query_timeout_ms, env_bool, env_u32_nonzero, evdb_err, evdb_ok,
     parse_db_caps_v1, parse_params_doc_v1, read_u32_le, DmScalar, DB_ERR_BAD_CONN, DB_ERR_BAD_REQ,
-    DB_ERR_POLICY_DENIED, DB_ERR_TOO_LARGE, OP_CLOSE_V1, OP_EXEC_V1, OP_OPEN_V1, OP_QUERY_V1,
+    DB_ERR_BAD_STMT, DB_ERR_POLICY_DENIED, DB_ERR_TOO_LARGE, OP_CLOSE_V1, OP_EXEC_V1,
+    OP_FINALIZE_V1, OP_OPEN_V1, OP_PREPARE_V1, OP_QUERY_V1, OP_STMT_EXEC_V1, OP_STMT_QUERY_V1,
 };
 use libsqlite3_sys as sqlite;
 use once_cell::sync::OnceCell;
@@ -266,6 +267,10 @@ fn get_conn(conn_id: u32) -> Option<*mut sqlite::sqlite3> {
 }
 
 fn close_conn(conn_id: u32) -> Result<(), u32> {
+    // Unfinalized statements would make sqlite3_close fail with
+    // SQLITE_BUSY, so drop any still registered for this connection.
+    finalize_stmts_for_conn(conn_id);
+
     let mut table = conns().lock().map_err(|_| DB_ERR_BAD_CONN)?;
     let slot = table.get_mut(conn_id as usize).ok_or(DB_ERR_BAD_CONN)?;
     let Some(conn) = *slot else {
@@ -281,6 +286,144 @@ fn close_conn(conn_id: u32) -> Result<(), u32> {
     Ok(())
 }
 
+// Prepared statements resident across calls: the statement keeps its
+// parse/plan from prepare_v1, stmt_query/stmt_exec only reset, rebind,
+// and step it. The owning connection is recorded so close can finalize
+// dependents.
+#[derive(Copy, Clone)]
+struct SqliteStmt {
+    stmt: *mut sqlite::sqlite3_stmt,
+    db: *mut sqlite::sqlite3,
+    conn_id: u32,
+}
+
+unsafe impl Send for SqliteStmt {}
+
+static STMTS: OnceCell<Mutex<Vec<Option<SqliteStmt>>>> = OnceCell::new();
+
+fn stmts() -> &'static Mutex<Vec<Option<SqliteStmt>>> {
+    STMTS.get_or_init(|| Mutex::new(vec![None; 4096]))
+}
+
+fn open_stmt_slot(entry: SqliteStmt) -> Option<u32> {
+    let mut table = stmts().lock().ok()?;
+    for (idx, slot) in table.iter_mut().enumerate().skip(1) {
+        if slot.is_none() {
+            *slot = Some(entry);
+            return Some(idx as u32);
+        }
+    }
+    None
+}
+
+fn get_stmt(stmt_id: u32) -> Option<SqliteStmt> {
+    let table = stmts().lock().ok()?;
+    table.get(stmt_id as usize).copied().flatten()
+}
+
+fn finalize_stmt(stmt_id: u32) -> Result<(), u32> {
+    let mut table = stmts().lock().map_err(|_| DB_ERR_BAD_STMT)?;
+    let slot = table.get_mut(stmt_id as usize).ok_or(DB_ERR_BAD_STMT)?;
+    let Some(entry) = slot.take() else {
+        return Err(DB_ERR_BAD_STMT);
+    };
+    unsafe {
+        let _ = sqlite::sqlite3_finalize(entry.stmt);
+    }
+    Ok(())
+}
+
+fn finalize_stmts_for_conn(conn_id: u32) {
+    let Ok(mut table) = stmts().lock() else {
+        return;
+    };
+    for slot in table.iter_mut().skip(1) {
+        if slot.is_some_and(|e| e.conn_id == conn_id) {
+            if let Some(entry) = slot.take() {
+                unsafe {
+                    let _ = sqlite::sqlite3_finalize(entry.stmt);
+                }
+            }
+        }
+    }
+}
+
+struct PrepareReq<'a> {
+    conn_id: u32,
+    sql: &'a [u8],
+}
+
+fn parse_evsp_prepare_req(req: &[u8]) -> Result<PrepareReq<'_>, u32> {
+    if req.len() < 20 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7SP" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let conn_id = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    let flags = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let sql_len = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)? as usize;
+    if req.len() != 20 + sql_len {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    Ok(PrepareReq {
+        conn_id,
+        sql: &req[20..],
+    })
+}
+
+struct StmtReq<'a> {
+    stmt_id: u32,
+    params: &'a [u8],
+}
+
+fn parse_evst_stmt_req<'a>(req: &'a [u8], magic: &[u8; 4]) -> Result<StmtReq<'a>, u32> {
+    if req.len() < 20 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != magic {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let stmt_id = read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)?;
+    let flags = read_u32_le(req, 12).ok_or(DB_ERR_BAD_REQ)?;
+    if flags != 0 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let params_len = read_u32_le(req, 16).ok_or(DB_ERR_BAD_REQ)? as usize;
+    if req.len() != 20 + params_len {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    Ok(StmtReq {
+        stmt_id,
+        params: &req[20..],
+    })
+}
+
+fn parse_evsf_finalize_req(req: &[u8]) -> Result<u32, u32> {
+    if req.len() != 12 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    if &req[0..4] != b"X7SF" {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    let ver = read_u32_le(req, 4).ok_or(DB_ERR_BAD_REQ)?;
+    if ver != 1 {
+        return Err(DB_ERR_BAD_REQ);
+    }
+    read_u32_le(req, 8).ok_or(DB_ERR_BAD_REQ)
+}
+
 unsafe fn bytes_to_utf8_path(b: &[u8]) -> Result<PathBuf, u32> {
     let s = std::str::from_utf8(b).map_err(|_| DB_ERR_BAD_REQ)?;
     if s.contains('\0') {
@@ -699,3 +842,244 @@ pub extern "C" fn x07_ext_db_sqlite_exec_v1(req: ev_bytes, caps: ev_bytes) -> ev
 
     alloc_return_bytes(&evdb_ok(OP_EXEC_V1, &doc))
 }
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_sqlite_prepare_v1(req: ev_bytes, caps: ev_bytes) -> ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.sqlite_enabled {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    if let Err(code) = parse_db_caps_v1(caps_raw) {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, code, &[]));
+    }
+
+    let prep = match parse_evsp_prepare_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, code, &[])),
+    };
+
+    if prep.sql.len() > pol.max_sql_bytes as usize {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    let Some(db) = get_conn(prep.conn_id) else {
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_BAD_CONN, &[]));
+    };
+
+    let sql_c = match std::ffi::CString::new(prep.sql) {
+        Ok(s) => s,
+        Err(_) => return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_BAD_REQ, &[])),
+    };
+
+    let mut stmt: *mut sqlite::sqlite3_stmt = std::ptr::null_mut();
+    let rc = unsafe {
+        sqlite::sqlite3_prepare_v2(db, sql_c.as_ptr(), -1, &mut stmt, std::ptr::null_mut())
+    };
+    if rc != SQLITE_OK || stmt.is_null() {
+        let msg = unsafe { sqlite_last_errmsg(db) };
+        if !stmt.is_null() {
+            unsafe {
+                let _ = sqlite::sqlite3_finalize(stmt);
+            }
+        }
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_SQLITE_PREP, &msg));
+    }
+
+    let Some(stmt_id) = open_stmt_slot(SqliteStmt {
+        stmt,
+        db,
+        conn_id: prep.conn_id,
+    }) else {
+        unsafe {
+            let _ = sqlite::sqlite3_finalize(stmt);
+        }
+        return alloc_return_bytes(&evdb_err(OP_PREPARE_V1, DB_ERR_TOO_LARGE, &[]));
+    };
+
+    alloc_return_bytes(&evdb_ok(OP_PREPARE_V1, &stmt_id.to_le_bytes()))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_sqlite_stmt_query_v1(req: ev_bytes, caps: ev_bytes) -> ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.sqlite_enabled {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+    if let Err(out) = count_query_or_deny(pol, OP_STMT_QUERY_V1) {
+        return out;
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &[])),
+    };
+
+    let stmt_req = match parse_evst_stmt_req(req, b"X7SR") {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &[])),
+    };
+
+    let Some(entry) = get_stmt(stmt_req.stmt_id) else {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_BAD_STMT, &[]));
+    };
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+    if timeout_ms != 0 {
+        let timeout_i = timeout_ms.min(c_int::MAX as u32) as c_int;
+        unsafe {
+            let _ = sqlite::sqlite3_busy_timeout(entry.db, timeout_i);
+        }
+    }
+
+    unsafe {
+        let _ = sqlite::sqlite3_reset(entry.stmt);
+        let _ = sqlite::sqlite3_clear_bindings(entry.stmt);
+    }
+    let bind_res = unsafe { bind_params(entry.stmt, stmt_req.params) };
+    if bind_res.is_err() {
+        unsafe {
+            let _ = sqlite::sqlite3_reset(entry.stmt);
+        }
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_BAD_REQ, &[]));
+    }
+
+    let max_rows = effective_max(pol.max_rows, caps.max_rows);
+    let doc = unsafe { query_rows_doc(entry.stmt, entry.db, max_rows) };
+    unsafe {
+        // Reset so the statement releases its locks and stays reusable.
+        let _ = sqlite::sqlite3_reset(entry.stmt);
+    }
+    let doc = match doc {
+        Ok(d) => d,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, code, &[])),
+    };
+
+    let max_resp = effective_max(pol.max_resp_bytes, caps.max_resp_bytes);
+    if max_resp != 0 && doc.len() > max_resp as usize {
+        return alloc_return_bytes(&evdb_err(OP_STMT_QUERY_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    alloc_return_bytes(&evdb_ok(OP_STMT_QUERY_V1, &doc))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_sqlite_stmt_exec_v1(req: ev_bytes, caps: ev_bytes) -> ev_bytes {
+    let req = unsafe { bytes_as_slice(req) };
+    let caps_raw = unsafe { bytes_as_slice(caps) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.sqlite_enabled {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+    if let Err(out) = count_query_or_deny(pol, OP_STMT_EXEC_V1) {
+        return out;
+    }
+
+    let caps = match parse_db_caps_v1(caps_raw) {
+        Ok(c) => c,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+
+    let stmt_req = match parse_evst_stmt_req(req, b"X7SX") {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+
+    let Some(entry) = get_stmt(stmt_req.stmt_id) else {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_BAD_STMT, &[]));
+    };
+
+    let timeout_ms = effective_query_timeout_ms(pol.max_query_timeout_ms, caps);
+    if timeout_ms != 0 {
+        let timeout_i = timeout_ms.min(c_int::MAX as u32) as c_int;
+        unsafe {
+            let _ = sqlite::sqlite3_busy_timeout(entry.db, timeout_i);
+        }
+    }
+
+    unsafe {
+        let _ = sqlite::sqlite3_reset(entry.stmt);
+        let _ = sqlite::sqlite3_clear_bindings(entry.stmt);
+    }
+    let bind_res = unsafe { bind_params(entry.stmt, stmt_req.params) };
+    if bind_res.is_err() {
+        unsafe {
+            let _ = sqlite::sqlite3_reset(entry.stmt);
+        }
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_BAD_REQ, &[]));
+    }
+
+    loop {
+        let rc = unsafe { sqlite::sqlite3_step(entry.stmt) };
+        if rc == SQLITE_DONE {
+            break;
+        }
+        if rc == SQLITE_ROW {
+            continue;
+        }
+        unsafe {
+            let _ = sqlite::sqlite3_reset(entry.stmt);
+        }
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_SQLITE_STEP, &[]));
+    }
+
+    unsafe {
+        let _ = sqlite::sqlite3_reset(entry.stmt);
+    }
+
+    let rows_affected = unsafe { sqlite::sqlite3_changes(entry.db) };
+    let last_id = unsafe { sqlite::sqlite3_last_insert_rowid(entry.db) };
+
+    let mut entries: Vec<(Vec<u8>, Vec<u8>)> = Vec::new();
+    let mut buf = itoa::Buffer::new();
+    entries.push((
+        b"last_insert_id".to_vec(),
+        dm_value_number_ascii(buf.format(last_id).as_bytes()),
+    ));
+    let mut buf2 = itoa::Buffer::new();
+    entries.push((
+        b"rows_affected".to_vec(),
+        dm_value_number_ascii(buf2.format(rows_affected).as_bytes()),
+    ));
+
+    let map_value = match dm_value_map(entries) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, code, &[])),
+    };
+    let doc = dm_doc_ok(&map_value);
+
+    let max_resp = effective_max(pol.max_resp_bytes, caps.max_resp_bytes);
+    if max_resp != 0 && doc.len() > max_resp as usize {
+        return alloc_return_bytes(&evdb_err(OP_STMT_EXEC_V1, DB_ERR_TOO_LARGE, &[]));
+    }
+
+    alloc_return_bytes(&evdb_ok(OP_STMT_EXEC_V1, &doc))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_db_sqlite_finalize_v1(req: ev_bytes, caps: ev_bytes) -> ev_bytes {
+    let _caps_raw = unsafe { bytes_as_slice(caps) };
+    let req = unsafe { bytes_as_slice(req) };
+
+    let pol = policy();
+    if !pol.enabled || !pol.sqlite_enabled {
+        return alloc_return_bytes(&evdb_err(OP_FINALIZE_V1, DB_ERR_POLICY_DENIED, &[]));
+    }
+
+    let stmt_id = match parse_evsf_finalize_req(req) {
+        Ok(v) => v,
+        Err(code) => return alloc_return_bytes(&evdb_err(OP_FINALIZE_V1, code, &[])),
+    };
+
+    if finalize_stmt(stmt_id).is_err() {
+        return alloc_return_bytes(&evdb_err(OP_FINALIZE_V1, DB_ERR_BAD_STMT, &[]));
+    }
+    alloc_return_bytes(&evdb_ok(OP_FINALIZE_V1, &[]))
+}
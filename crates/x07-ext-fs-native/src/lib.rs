@@ -11,7 +11,8 @@ use std::time::UNIX_EPOCH;
 use walkdir::WalkDir;
 use x07_ext_os_native_core::{
     bytes_to_utf8, cap_allow_hidden, cap_allow_symlinks, cap_atomic_write, cap_create_parents,
-    cap_overwrite, effective_max, enforce_read_path, enforce_write_path, map_io_err,
+    cap_overwrite, cap_preallocate, cap_write_nocache, effective_max, enforce_read_path,
+    enforce_write_path, map_io_err,
     open_atomic_tmp_best_effort, parse_caps_v1, policy, FS_ERR_ALREADY_EXISTS, FS_ERR_BAD_HANDLE,
     FS_ERR_BAD_PATH, FS_ERR_DEPTH_EXCEEDED, FS_ERR_IO, FS_ERR_IS_DIR, FS_ERR_NOT_DIR,
     FS_ERR_NOT_FOUND, FS_ERR_POLICY_DENY, FS_ERR_SYMLINK_DENIED, FS_ERR_TOO_LARGE,
@@ -64,6 +65,16 @@ const EV_TRAP_FS_INTERNAL: i32 = 9300;
 // Streaming write handles (FS v1)
 // -------------------------
 
+// Size of the per-handle staging buffers. Sequential readers are
+// refilled in blocks of this size and writers coalesce small chunks up
+// to it, so a caller streaming 4 KiB chunks pays one syscall per 64
+// calls instead of one each.
+const STREAM_BUF_BYTES: usize = 256 * 1024;
+
+// Written-back pages are dropped from the page cache one window at a
+// time when CAP_WRITE_NOCACHE is set.
+const NOCACHE_WINDOW_BYTES: u32 = 8 * 1024 * 1024;
+
 #[derive(Debug)]
 struct WriterHandleV1 {
     file: Option<std::fs::File>,
@@ -71,8 +82,86 @@ struct WriterHandleV1 {
     tmp_path: Option<PathBuf>,
     max_write_bytes: u32,
     written: u32,
+    // Coalesced-but-unwritten bytes; flushed when full, on a large
+    // write, and at close.
+    buf: Vec<u8>,
+    // CAP_WRITE_NOCACHE: start writeback early and evict written pages
+    // so bulk writes don't push the read working set out of the cache.
+    nocache: bool,
+    // Window-aligned watermark of bytes already queued for writeback.
+    evicted: u32,
+}
+
+fn writer_flush(w: &mut WriterHandleV1) -> io::Result<()> {
+    if w.buf.is_empty() {
+        return Ok(());
+    }
+    let Some(f) = w.file.as_mut() else {
+        return Ok(());
+    };
+    f.write_all(&w.buf)?;
+    w.buf.clear();
+    Ok(())
 }
 
+// Best-effort extent reservation for CAP_PREALLOCATE. FALLOC_FL_KEEP_SIZE
+// keeps the visible length at the bytes actually written, so no truncate
+// is needed at close; filesystems without fallocate just skip it.
+#[cfg(target_os = "linux")]
+fn writer_preallocate(f: &std::fs::File, len: u32) {
+    use std::os::unix::io::AsRawFd;
+    if len == 0 {
+        return;
+    }
+    unsafe {
+        libc::fallocate(f.as_raw_fd(), libc::FALLOC_FL_KEEP_SIZE, 0, len as libc::off_t);
+    }
+}
+
+#[cfg(not(target_os = "linux"))]
+fn writer_preallocate(_f: &std::fs::File, _len: u32) {}
+
+// Kicks off writeback for newly flushed whole windows and drops the
+// previously written-back span from the page cache. Purely advisory;
+// write errors still surface through write_all/close.
+#[cfg(target_os = "linux")]
+fn writer_evict_cache(w: &mut WriterHandleV1, finished: bool) {
+    use std::os::unix::io::AsRawFd;
+    let Some(f) = w.file.as_ref() else {
+        return;
+    };
+    let fd = f.as_raw_fd();
+    let flushed = w.written - (w.buf.len() as u32);
+    let end = if finished {
+        flushed
+    } else {
+        flushed & !(NOCACHE_WINDOW_BYTES - 1)
+    };
+    if end <= w.evicted && !finished {
+        return;
+    }
+    unsafe {
+        let flags = if finished {
+            libc::SYNC_FILE_RANGE_WAIT_BEFORE
+                | libc::SYNC_FILE_RANGE_WRITE
+                | libc::SYNC_FILE_RANGE_WAIT_AFTER
+        } else {
+            libc::SYNC_FILE_RANGE_WRITE
+        };
+        libc::sync_file_range(fd, 0, end as libc::off64_t, flags);
+        // Only the span whose writeback started last round (or, at the
+        // end, everything) is reliably clean and droppable.
+        let drop_end = if finished { end } else { w.evicted };
+        if drop_end > 0 {
+            libc::posix_fadvise(fd, 0, drop_end as libc::off_t, libc::POSIX_FADV_DONTNEED);
+        }
+    }
+    w.evicted = end;
+}
+
+#[cfg(not(target_os = "linux"))]
+fn writer_evict_cache(_w: &mut WriterHandleV1, _finished: bool) {}
+
 static WRITERS: OnceCell<Mutex<Vec<Option<WriterHandleV1>>>> = OnceCell::new();
 
 fn writers() -> &'static Mutex<Vec<Option<WriterHandleV1>>> {
@@ -117,6 +206,27 @@ struct ReaderHandleV1 {
     file: Option<std::fs::File>,
     max_read_bytes: u32,
     read: u32,
+    // Readahead window: refilled one STREAM_BUF_BYTES block at a time
+    // and served out in per-call slices. buf_pos tracks the unserved
+    // prefix; `read` counts only delivered bytes.
+    buf: Vec<u8>,
+    buf_pos: usize,
+}
+
+// Refills the readahead window with one block-sized read. Returns the
+// number of buffered-but-unserved bytes (0 = EOF or error passthrough).
+fn reader_refill(r: &mut ReaderHandleV1) -> io::Result<usize> {
+    if r.buf_pos < r.buf.len() {
+        return Ok(r.buf.len() - r.buf_pos);
+    }
+    let Some(f) = r.file.as_mut() else {
+        return Ok(0);
+    };
+    r.buf.resize(STREAM_BUF_BYTES, 0);
+    r.buf_pos = 0;
+    let got = f.read(&mut r.buf)?;
+    r.buf.truncate(got);
+    Ok(got)
 }
 
 static READERS: OnceCell<Mutex<Vec<Option<ReaderHandleV1>>>> = OnceCell::new();
@@ -125,6 +235,125 @@ fn readers() -> &'static Mutex<Vec<Option<ReaderHandleV1>>> {
     READERS.get_or_init(|| Mutex::new(Vec::new()))
 }
 
+// -------------------------
+// Mmap view handles (FS v1)
+// -------------------------
+
+#[derive(Debug)]
+struct ViewHandleV1 {
+    // Mapping base address (0 for an empty file, which maps nothing).
+    // Stored as usize so the table stays Send; the mapping is read-only
+    // and owned exclusively by this handle.
+    addr: usize,
+    len: usize,
+}
+
+static VIEWS: OnceCell<Mutex<Vec<Option<ViewHandleV1>>>> = OnceCell::new();
+
+fn views() -> &'static Mutex<Vec<Option<ViewHandleV1>>> {
+    VIEWS.get_or_init(|| Mutex::new(Vec::new()))
+}
+
+unsafe fn view_unmap(addr: usize, len: usize) {
+    if addr != 0 {
+        libc::munmap(addr as *mut libc::c_void, len);
+    }
+}
+
+// -------------------------
+// Streaming walk handles (FS v1)
+// -------------------------
+
+// One pending traversal step: an entry ready to emit, or a directory
+// not yet expanded. Directories are expanded one read_dir at a time,
+// so the first matches surface after a single directory read and
+// memory stays proportional to depth times directory width instead of
+// the whole listing.
+#[derive(Debug)]
+enum WalkStepV1 {
+    Emit(String),
+    // Absolute dir path, its "a/b/" relative prefix, and its depth
+    // (root = 0).
+    Dir(PathBuf, String, usize),
+}
+
+#[derive(Debug)]
+struct WalkHandleV1 {
+    // LIFO stack. Each expanded directory pushes its children in
+    // descending key order (directory names keyed with a trailing '/'),
+    // so pops come out in exactly the order the one-shot walk's sorted
+    // relative paths would.
+    stack: Vec<WalkStepV1>,
+    matcher: GlobMatcher,
+    follow_links: bool,
+    deny_hidden: bool,
+    max_entries: usize,
+    max_depth: usize,
+    // Matched entries discovered so far, across batches.
+    matched: usize,
+    // Sticky failure: once a walk errors it keeps returning that error.
+    failed: Option<i32>,
+}
+
+static WALKS: OnceCell<Mutex<Vec<Option<WalkHandleV1>>>> = OnceCell::new();
+
+fn walks() -> &'static Mutex<Vec<Option<WalkHandleV1>>> {
+    WALKS.get_or_init(|| Mutex::new(Vec::new()))
+}
+
+// Expands one directory onto the walk stack. Mirrors the one-shot
+// walk's semantics: depth overflow is an error (not a prune), hidden
+// components and non-UTF-8 names are skipped, and only non-directory
+// entries are matched against the glob.
+fn walk_expand_dir(
+    w: &mut WalkHandleV1,
+    dir: &Path,
+    prefix: &str,
+    depth: usize,
+) -> Result<(), i32> {
+    let rd = std::fs::read_dir(dir).map_err(|e| map_io_err(&e))?;
+
+    // (sort key, step); key is the file name, with '/' appended for
+    // directories so subtree paths interleave correctly with siblings.
+    let mut children: Vec<(String, WalkStepV1)> = Vec::new();
+    for ent in rd {
+        let ent = ent.map_err(|_| FS_ERR_IO)?;
+        if depth >= w.max_depth {
+            return Err(FS_ERR_DEPTH_EXCEEDED);
+        }
+        let Ok(name) = ent.file_name().into_string() else {
+            continue;
+        };
+        if w.deny_hidden && name.starts_with('.') {
+            continue;
+        }
+        let mut ft = ent.file_type().map_err(|e| map_io_err(&e))?;
+        if w.follow_links && ft.is_symlink() {
+            ft = std::fs::metadata(ent.path()).map_err(|_| FS_ERR_IO)?.file_type();
+        }
+        if ft.is_dir() {
+            let sub_prefix = format!("{prefix}{name}/");
+            children.push((
+                sub_prefix.clone(),
+                WalkStepV1::Dir(ent.path(), sub_prefix, depth + 1),
+            ));
+        } else {
+            let rel = format!("{prefix}{name}");
+            if w.matcher.is_match(rel.as_str()) {
+                w.matched += 1;
+                if w.matched > w.max_entries {
+                    return Err(FS_ERR_TOO_MANY_ENTRIES);
+                }
+                children.push((rel.clone(), WalkStepV1::Emit(rel)));
+            }
+        }
+    }
+
+    children.sort_by(|a, b| b.0.cmp(&a.0));
+    w.stack.extend(children.into_iter().map(|(_, step)| step));
+    Ok(())
+}
+
 // -------------------------
 // Result helpers
 // -------------------------
@@ -235,7 +464,47 @@ pub extern "C" fn x07_ext_fs_read_all_v1(path: ev_bytes, caps: ev_bytes) -> ev_r
             Err(e) => return err_bytes(map_io_err(&e)),
         };
 
-        let mut data: Vec<u8> = Vec::with_capacity(md.len().min(max as u64) as usize);
+        // Fast path: allocate the output buffer up front and read straight
+        // into runtime memory, skipping the Vec staging copy. If the file
+        // changes size between stat and read we fall back to the staged
+        // path below; the stale buffer is leaked in that race window (the
+        // backend ABI has no free hook).
+        let size = md.len() as usize;
+        let out = alloc_bytes(size as u32);
+        let dst = core::slice::from_raw_parts_mut(out.ptr, size);
+        let mut filled = 0usize;
+        while filled < size {
+            let n = match f.read(&mut dst[filled..]) {
+                Ok(n) => n,
+                Err(e) => return err_bytes(map_io_err(&e)),
+            };
+            if n == 0 {
+                break;
+            }
+            filled += n;
+        }
+        let mut grown = [0u8; 1];
+        let probe = if filled == size {
+            match f.read(&mut grown) {
+                Ok(n) => n,
+                Err(e) => return err_bytes(map_io_err(&e)),
+            }
+        } else {
+            0
+        };
+        if filled == size && probe == 0 {
+            return ev_result_bytes {
+                tag: 1,
+                payload: ev_result_bytes_payload { ok: out },
+            };
+        }
+
+        let mut data: Vec<u8> = Vec::with_capacity(filled + probe);
+        data.extend_from_slice(&dst[..filled]);
+        data.extend_from_slice(&grown[..probe]);
+        if data.len() > (max as usize) {
+            return err_bytes(FS_ERR_TOO_LARGE);
+        }
         let mut buf = [0u8; 8192];
         loop {
             let n = match f.read(&mut buf) {
@@ -430,11 +699,21 @@ pub extern "C" fn x07_ext_fs_stream_open_write_v1(path: ev_bytes, caps: ev_bytes
 
         let overwrite = cap_overwrite(caps);
 
+        // CAP_PREALLOCATE reserves extents up front for the declared
+        // budget (caps.max_write_bytes), so bulk writes don't fragment.
+        let prealloc = if cap_preallocate(caps) && caps.max_write_bytes != 0 {
+            max_write
+        } else {
+            0
+        };
+        let nocache = cap_write_nocache(caps);
+
         if cap_atomic_write(caps) {
             let (f, tmp) = match open_atomic_tmp_best_effort(&pb, overwrite) {
                 Ok(v) => v,
                 Err(code) => return err_i32(code),
             };
+            writer_preallocate(&f, prealloc);
 
             let handle = match writers().lock() {
                 Ok(mut table) => handle_insert(
@@ -445,6 +724,9 @@ pub extern "C" fn x07_ext_fs_stream_open_write_v1(path: ev_bytes, caps: ev_bytes
                         tmp_path: Some(tmp),
                         max_write_bytes: max_write,
                         written: 0,
+                        buf: Vec::new(),
+                        nocache,
+                        evicted: 0,
                     },
                 ),
                 Err(_) => Err(FS_ERR_IO),
@@ -493,6 +775,7 @@ pub extern "C" fn x07_ext_fs_stream_open_write_v1(path: ev_bytes, caps: ev_bytes
             Ok(f) => f,
             Err(e) => return err_i32(map_io_err(&e)),
         };
+        writer_preallocate(&f, prealloc);
 
         let handle = match writers().lock() {
             Ok(mut table) => handle_insert(
@@ -503,6 +786,9 @@ pub extern "C" fn x07_ext_fs_stream_open_write_v1(path: ev_bytes, caps: ev_bytes
                     tmp_path: None,
                     max_write_bytes: max_write,
                     written: 0,
+                    buf: Vec::new(),
+                    nocache,
+                    evicted: 0,
                 },
             ),
             Err(_) => Err(FS_ERR_IO),
@@ -531,9 +817,9 @@ pub extern "C" fn x07_ext_fs_stream_write_all_v1(
         let Some(w) = table.get_mut(idx).and_then(|v| v.as_mut()) else {
             return err_i32(FS_ERR_BAD_HANDLE);
         };
-        let Some(f) = w.file.as_mut() else {
+        if w.file.is_none() {
             return err_i32(FS_ERR_BAD_HANDLE);
-        };
+        }
 
         let data_bytes = bytes_as_slice(data);
         let Some(rem) = w.max_write_bytes.checked_sub(w.written) else {
@@ -543,10 +829,25 @@ pub extern "C" fn x07_ext_fs_stream_write_all_v1(
             return err_i32(FS_ERR_TOO_LARGE);
         }
 
-        if let Err(e) = f.write_all(data_bytes) {
-            return err_i32(map_io_err(&e));
+        // Small chunks coalesce in the staging buffer; big ones flush it
+        // and go straight through.
+        if w.buf.len() + data_bytes.len() > STREAM_BUF_BYTES {
+            if let Err(e) = writer_flush(w) {
+                return err_i32(map_io_err(&e));
+            }
+        }
+        if data_bytes.len() >= STREAM_BUF_BYTES {
+            let f = w.file.as_mut().expect("checked above");
+            if let Err(e) = f.write_all(data_bytes) {
+                return err_i32(map_io_err(&e));
+            }
+        } else {
+            w.buf.extend_from_slice(data_bytes);
         }
         w.written = w.written.saturating_add(data_bytes.len() as u32);
+        if w.nocache {
+            writer_evict_cache(w, false);
+        }
 
         ok_i32(data_bytes.len() as i32)
     })
@@ -567,10 +868,20 @@ pub extern "C" fn x07_ext_fs_stream_close_v1(writer_handle: i32) -> ev_result_i3
         };
 
         // Idempotent close.
-        let Some(f) = w.file.take() else {
+        if w.file.is_none() {
             return ok_i32(1);
-        };
-        drop(f);
+        }
+        if let Err(e) = writer_flush(w) {
+            w.file = None;
+            if let Some(tmp) = w.tmp_path.take() {
+                let _ = std::fs::remove_file(&tmp);
+            }
+            return err_i32(map_io_err(&e));
+        }
+        if w.nocache {
+            writer_evict_cache(w, true);
+        }
+        drop(w.file.take());
 
         if let Some(tmp) = w.tmp_path.take() {
             if let Err(e) = std::fs::rename(&tmp, &w.final_path) {
@@ -594,10 +905,16 @@ pub extern "C" fn x07_ext_fs_stream_drop_v1(writer_handle: i32) -> i32 {
         let Some(idx) = handle_idx(writer_handle) else {
             return 1;
         };
-        let Some(w) = table.get_mut(idx).and_then(|v| v.take()) else {
+        let Some(mut w) = table.get_mut(idx).and_then(|v| v.take()) else {
             return 1;
         };
 
+        // An abandoned atomic writer discards its tmp file anyway; a
+        // plain writer keeps what was already accepted, so flush it
+        // best-effort.
+        if w.tmp_path.is_none() {
+            let _ = writer_flush(&mut w);
+        }
         drop(w.file);
         if let Some(tmp) = w.tmp_path {
             let _ = std::fs::remove_file(&tmp);
@@ -695,6 +1012,8 @@ pub extern "C" fn x07_ext_fs_stream_open_read_v1(path: ev_bytes, caps: ev_bytes)
                     file: Some(f),
                     max_read_bytes: max_read,
                     read: 0,
+                    buf: Vec::new(),
+                    buf_pos: 0,
                 },
             ),
             Err(_) => Err(FS_ERR_IO),
@@ -727,9 +1046,9 @@ pub extern "C" fn x07_ext_fs_stream_read_some_v1(
         let Some(r) = table.get_mut(idx).and_then(|v| v.as_mut()) else {
             return err_bytes(FS_ERR_BAD_HANDLE);
         };
-        let Some(f) = r.file.as_mut() else {
+        if r.file.is_none() && r.buf_pos >= r.buf.len() {
             return ok_bytes_vec(Vec::new());
-        };
+        }
 
         let Some(rem) = r.max_read_bytes.checked_sub(r.read) else {
             r.file = None;
@@ -740,20 +1059,21 @@ pub extern "C" fn x07_ext_fs_stream_read_some_v1(
             return ok_bytes_vec(Vec::new());
         }
 
-        let want = (max_bytes as u32).min(rem);
-        let mut buf: Vec<u8> = vec![0u8; want as usize];
-        let got = match f.read(&mut buf) {
+        let want = ((max_bytes as u32).min(rem)) as usize;
+        let avail = match reader_refill(r) {
             Ok(n) => n,
             Err(e) => return err_bytes(map_io_err(&e)),
         };
-        if got == 0 {
+        if avail == 0 {
             r.file = None;
             return ok_bytes_vec(Vec::new());
         }
-        buf.truncate(got);
+        let take = want.min(avail);
+        let out = r.buf[r.buf_pos..r.buf_pos + take].to_vec();
+        r.buf_pos += take;
 
-        r.read = r.read.saturating_add(got as u32);
-        ok_bytes_vec(buf)
+        r.read = r.read.saturating_add(take as u32);
+        ok_bytes_vec(out)
     })
     .unwrap_or_else(|_| err_bytes(FS_ERR_IO))
 }
@@ -781,9 +1101,9 @@ pub unsafe extern "C" fn x07_ext_fs_stream_read_into_v1(
         let Some(r) = table.get_mut(idx).and_then(|v| v.as_mut()) else {
             return err_i32(FS_ERR_BAD_HANDLE);
         };
-        let Some(f) = r.file.as_mut() else {
+        if r.file.is_none() && r.buf_pos >= r.buf.len() {
             return ok_i32(0);
-        };
+        }
 
         let Some(rem) = r.max_read_bytes.checked_sub(r.read) else {
             r.file = None;
@@ -793,21 +1113,44 @@ pub unsafe extern "C" fn x07_ext_fs_stream_read_into_v1(
             r.file = None;
             return ok_i32(0);
         }
-        let cap = dst_cap.min(rem);
-        let dst = core::slice::from_raw_parts_mut(dst_ptr, cap as usize);
-        let got = match f.read(dst) {
+        let cap = dst_cap.min(rem) as usize;
+
+        // Large destinations skip the readahead buffer entirely: one read
+        // straight into the caller's memory, no extra copy.
+        if r.buf_pos >= r.buf.len() && cap >= STREAM_BUF_BYTES {
+            let Some(f) = r.file.as_mut() else {
+                return ok_i32(0);
+            };
+            let dst = core::slice::from_raw_parts_mut(dst_ptr, cap);
+            let got = match f.read(dst) {
+                Ok(n) => n,
+                Err(e) => return err_i32(map_io_err(&e)),
+            };
+            if got == 0 {
+                r.file = None;
+                return ok_i32(0);
+            }
+            r.read = r.read.saturating_add(got as u32);
+            if got > (i32::MAX as usize) {
+                return err_i32(FS_ERR_UNSUPPORTED);
+            }
+            return ok_i32(got as i32);
+        }
+
+        let avail = match reader_refill(r) {
             Ok(n) => n,
             Err(e) => return err_i32(map_io_err(&e)),
         };
-        if got == 0 {
+        if avail == 0 {
             r.file = None;
             return ok_i32(0);
         }
-        r.read = r.read.saturating_add(got as u32);
-        if got > (i32::MAX as usize) {
-            return err_i32(FS_ERR_UNSUPPORTED);
-        }
-        ok_i32(got as i32)
+        let take = cap.min(avail);
+        let dst = core::slice::from_raw_parts_mut(dst_ptr, take);
+        dst.copy_from_slice(&r.buf[r.buf_pos..r.buf_pos + take]);
+        r.buf_pos += take;
+        r.read = r.read.saturating_add(take as u32);
+        ok_i32(take as i32)
     })
     .unwrap_or_else(|_| err_i32(FS_ERR_IO))
 }
@@ -825,7 +1168,9 @@ pub extern "C" fn x07_ext_fs_stream_close_read_v1(reader_handle: i32) -> ev_resu
             return err_i32(FS_ERR_BAD_HANDLE);
         };
 
-        // Idempotent close.
+        // Idempotent close. Buffered readahead is discarded with the file.
+        r.buf.clear();
+        r.buf_pos = 0;
         let Some(f) = r.file.take() else {
             return ok_i32(1);
         };
@@ -853,6 +1198,124 @@ pub extern "C" fn x07_ext_fs_stream_drop_read_v1(reader_handle: i32) -> i32 {
     .unwrap_or(1)
 }
 
+#[no_mangle]
+pub extern "C" fn x07_ext_fs_view_open_v1(path: ev_bytes, caps: ev_bytes) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe {
+        let caps = match parse_caps_v1(bytes_as_slice(caps)) {
+            Ok(caps) => caps,
+            Err(code) => return err_i32(code),
+        };
+
+        let pol = policy();
+        if cap_allow_symlinks(caps) && !pol.allow_symlinks {
+            return err_i32(FS_ERR_SYMLINK_DENIED);
+        }
+
+        let path_bytes = bytes_as_slice(path);
+        let pb = match enforce_read_path(caps, path_bytes) {
+            Ok(p) => p,
+            Err(code) => return err_i32(code),
+        };
+
+        let md = match std::fs::metadata(&pb) {
+            Ok(m) => m,
+            Err(e) => return err_i32(map_io_err(&e)),
+        };
+        if md.is_dir() {
+            return err_i32(FS_ERR_IS_DIR);
+        }
+
+        let max_read = effective_max(pol.max_read_bytes, caps.max_read_bytes);
+        if md.len() > (max_read as u64) {
+            return err_i32(FS_ERR_TOO_LARGE);
+        }
+
+        let f = match std::fs::File::open(&pb) {
+            Ok(f) => f,
+            Err(e) => return err_i32(map_io_err(&e)),
+        };
+
+        // The view length is pinned at open; bytes appended afterwards are
+        // not part of the mapping. An empty file maps nothing (addr 0).
+        let len = md.len() as usize;
+        let addr = if len == 0 {
+            0usize
+        } else {
+            use std::os::unix::io::AsRawFd;
+            let p = libc::mmap(
+                core::ptr::null_mut(),
+                len,
+                libc::PROT_READ,
+                libc::MAP_PRIVATE,
+                f.as_raw_fd(),
+                0,
+            );
+            if p == libc::MAP_FAILED {
+                return err_i32(FS_ERR_IO);
+            }
+            p as usize
+        };
+        // The mapping keeps the pages alive without the fd.
+        drop(f);
+
+        let handle = match views().lock() {
+            Ok(mut table) => handle_insert(&mut table, ViewHandleV1 { addr, len }),
+            Err(_) => Err(FS_ERR_IO),
+        };
+
+        match handle {
+            Ok(h) => ok_i32(h),
+            Err(code) => {
+                view_unmap(addr, len);
+                err_i32(code)
+            }
+        }
+    })
+    .unwrap_or_else(|_| err_i32(FS_ERR_IO))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_fs_view_bytes_v1(view_handle: i32) -> ev_bytes {
+    let empty = ev_bytes {
+        ptr: core::ptr::null_mut(),
+        len: 0,
+    };
+    std::panic::catch_unwind(|| {
+        let Ok(table) = views().lock() else {
+            return empty;
+        };
+        let Some(idx) = handle_idx(view_handle) else {
+            return empty;
+        };
+        let Some(v) = table.get(idx).and_then(|s| s.as_ref()) else {
+            return empty;
+        };
+        ev_bytes {
+            ptr: v.addr as *mut u8,
+            len: v.len as u32,
+        }
+    })
+    .unwrap_or(empty)
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_fs_view_release_v1(view_handle: i32) -> i32 {
+    std::panic::catch_unwind(|| {
+        let Ok(mut table) = views().lock() else {
+            return 1;
+        };
+        let Some(idx) = handle_idx(view_handle) else {
+            return 1;
+        };
+        let Some(v) = table.get_mut(idx).and_then(|s| s.take()) else {
+            return 1;
+        };
+        unsafe { view_unmap(v.addr, v.len) };
+        1
+    })
+    .unwrap_or(1)
+}
+
 #[no_mangle]
 pub extern "C" fn x07_ext_fs_mkdirs_v1(path: ev_bytes, caps: ev_bytes) -> ev_result_i32 {
     std::panic::catch_unwind(|| unsafe {
@@ -1156,6 +1619,141 @@ pub extern "C" fn x07_ext_fs_walk_glob_sorted_text_v1(
     .unwrap_or_else(|_| err_bytes(FS_ERR_IO))
 }
 
+#[no_mangle]
+pub extern "C" fn x07_ext_fs_walk_open_v1(
+    root: ev_bytes,
+    glob: ev_bytes,
+    caps: ev_bytes,
+) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe {
+        let caps = match parse_caps_v1(bytes_as_slice(caps)) {
+            Ok(caps) => caps,
+            Err(code) => return err_i32(code),
+        };
+
+        let pol = policy();
+        if !pol.allow_walk || !pol.allow_glob {
+            return err_i32(FS_ERR_POLICY_DENY);
+        }
+        if cap_allow_symlinks(caps) && !pol.allow_symlinks {
+            return err_i32(FS_ERR_SYMLINK_DENIED);
+        }
+
+        let root_b = bytes_as_slice(root);
+        let root_pb = match enforce_read_path(caps, root_b) {
+            Ok(p) => p,
+            Err(code) => return err_i32(code),
+        };
+
+        let md = match std::fs::metadata(&root_pb) {
+            Ok(m) => m,
+            Err(e) => return err_i32(map_io_err(&e)),
+        };
+        if !md.is_dir() {
+            return err_i32(FS_ERR_NOT_DIR);
+        }
+
+        let glob_b = bytes_as_slice(glob);
+        let glob_s = match bytes_to_utf8(glob_b) {
+            Ok(s) => s,
+            Err(code) => return err_i32(code),
+        };
+        let matcher = match build_glob_matcher(glob_s) {
+            Ok(m) => m,
+            Err(code) => return err_i32(code),
+        };
+
+        let Ok(mut table) = walks().lock() else {
+            return err_i32(FS_ERR_IO);
+        };
+        match handle_insert(
+            &mut table,
+            WalkHandleV1 {
+                stack: vec![WalkStepV1::Dir(root_pb, String::new(), 0)],
+                matcher,
+                follow_links: cap_allow_symlinks(caps) && pol.allow_symlinks,
+                deny_hidden: pol.deny_hidden && !cap_allow_hidden(caps),
+                max_entries: effective_max(pol.max_entries, caps.max_entries) as usize,
+                max_depth: effective_max(pol.max_depth, caps.max_depth) as usize,
+                matched: 0,
+                failed: None,
+            },
+        ) {
+            Ok(h) => ok_i32(h),
+            Err(code) => err_i32(code),
+        }
+    })
+    .unwrap_or_else(|_| err_i32(FS_ERR_IO))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_fs_walk_next_v1(
+    walk_handle: i32,
+    max_entries: i32,
+) -> ev_result_bytes {
+    std::panic::catch_unwind(|| {
+        let Ok(mut table) = walks().lock() else {
+            return err_bytes(FS_ERR_IO);
+        };
+        let Some(idx) = handle_idx(walk_handle) else {
+            return err_bytes(FS_ERR_BAD_HANDLE);
+        };
+        let Some(w) = table.get_mut(idx).and_then(|v| v.as_mut()) else {
+            return err_bytes(FS_ERR_BAD_HANDLE);
+        };
+        if let Some(code) = w.failed {
+            return err_bytes(code);
+        }
+
+        let batch_max = if max_entries <= 0 {
+            1024
+        } else {
+            max_entries as usize
+        };
+
+        let mut text = String::new();
+        let mut emitted = 0usize;
+        while emitted < batch_max {
+            match w.stack.pop() {
+                None => break,
+                Some(WalkStepV1::Emit(rel)) => {
+                    text.push_str(&rel);
+                    text.push('\n');
+                    emitted += 1;
+                }
+                Some(WalkStepV1::Dir(dir, prefix, depth)) => {
+                    if let Err(code) = walk_expand_dir(w, &dir, &prefix, depth) {
+                        w.failed = Some(code);
+                        w.stack.clear();
+                        return err_bytes(code);
+                    }
+                }
+            }
+        }
+
+        // An empty payload means the walk is exhausted.
+        ok_bytes_vec(text.into_bytes())
+    })
+    .unwrap_or_else(|_| err_bytes(FS_ERR_IO))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_fs_walk_drop_v1(walk_handle: i32) -> i32 {
+    std::panic::catch_unwind(|| {
+        let Ok(mut table) = walks().lock() else {
+            return 1;
+        };
+        let Some(idx) = handle_idx(walk_handle) else {
+            return 1;
+        };
+        if let Some(slot) = table.get_mut(idx) {
+            *slot = None;
+        }
+        1
+    })
+    .unwrap_or(1)
+}
+
 #[no_mangle]
 pub extern "C" fn x07_ext_fs_stat_v1(path: ev_bytes, caps: ev_bytes) -> ev_result_bytes {
     std::panic::catch_unwind(|| unsafe {
@@ -1223,7 +1821,9 @@ pub extern "C" fn x07_ext_fs_stat_v1(path: ev_bytes, caps: ev_bytes) -> ev_resul
 #[cfg(test)]
 mod tests {
     use super::*;
-    use x07_ext_os_native_core::{CAP_ATOMIC_WRITE, CAP_CREATE_PARENTS, CAP_OVERWRITE};
+    use x07_ext_os_native_core::{
+        CAP_ATOMIC_WRITE, CAP_CREATE_PARENTS, CAP_OVERWRITE, CAP_PREALLOCATE, CAP_WRITE_NOCACHE,
+    };
 
     #[no_mangle]
     extern "C" fn ev_bytes_alloc(len: u32) -> ev_bytes {
@@ -1381,6 +1981,48 @@ mod tests {
         let _ = std::fs::remove_dir_all(&root);
     }
 
+    #[test]
+    fn fs_stream_writer_bulk_flags_v1_smoke() {
+        std::env::set_var("X07_OS_SANDBOXED", "0");
+        std::env::set_var("X07_OS_FS", "1");
+        std::env::set_var("X07_OS_FS_MAX_WRITE_BYTES", "1000000");
+
+        let root = format!("target/x07_ext_fs_bulk_test_{}", std::process::id());
+        let _ = std::fs::remove_dir_all(&root);
+        std::fs::create_dir_all(&root).expect("create test dir");
+
+        // Preallocation and cache eviction are advisory: content and
+        // limit semantics are identical to a plain writer. Stay under the
+        // 1 MB policy budget every test in this process agrees on (the
+        // policy is read from env once, by whichever test runs first).
+        let out_path = format!("{root}/bulk.bin");
+        let caps = caps_v1(
+            1000000,
+            CAP_CREATE_PARENTS | CAP_OVERWRITE | CAP_PREALLOCATE | CAP_WRITE_NOCACHE,
+        );
+        let h = ok_i32(x07_ext_fs_stream_open_write_v1(
+            to_ev_bytes(out_path.as_bytes()),
+            to_ev_bytes(&caps),
+        ));
+        assert!(h > 0);
+        let chunk = vec![0xabu8; 128 * 1024];
+        for _ in 0..5 {
+            assert_eq!(
+                ok_i32(x07_ext_fs_stream_write_all_v1(h, to_ev_bytes(&chunk))),
+                chunk.len() as i32
+            );
+        }
+        assert_eq!(ok_i32(x07_ext_fs_stream_close_v1(h)), 1);
+        assert_eq!(x07_ext_fs_stream_drop_v1(h), 1);
+
+        let md = std::fs::metadata(&out_path).expect("stat bulk.bin");
+        assert_eq!(md.len(), 5 * chunk.len() as u64);
+        let got = std::fs::read(&out_path).expect("read bulk.bin");
+        assert!(got.iter().all(|&b| b == 0xab));
+
+        let _ = std::fs::remove_dir_all(&root);
+    }
+
     #[test]
     fn fs_stream_reader_handle_v1_smoke() {
         std::env::set_var("X07_OS_SANDBOXED", "0");
@@ -1460,6 +2102,129 @@ mod tests {
         let _ = std::fs::remove_dir_all(&root);
     }
 
+    #[test]
+    fn fs_view_handle_v1_smoke() {
+        std::env::set_var("X07_OS_SANDBOXED", "0");
+        std::env::set_var("X07_OS_FS", "1");
+        std::env::set_var("X07_OS_FS_MAX_READ_BYTES", "1000000");
+
+        let root = format!("target/x07_ext_fs_view_test_{}", std::process::id());
+        let _ = std::fs::remove_dir_all(&root);
+        std::fs::create_dir_all(&root).expect("create test dir");
+
+        let in_path = format!("{root}/in.txt");
+        std::fs::write(&in_path, b"abcdefgh").expect("write in.txt");
+
+        let caps = caps_read_v1(8, 0);
+        let h = ok_i32(x07_ext_fs_view_open_v1(
+            to_ev_bytes(in_path.as_bytes()),
+            to_ev_bytes(&caps),
+        ));
+        assert!(h > 0);
+
+        let view = x07_ext_fs_view_bytes_v1(h);
+        assert_eq!(view.len, 8);
+        assert_eq!(
+            unsafe { std::slice::from_raw_parts(view.ptr, view.len as usize) },
+            b"abcdefgh"
+        );
+        assert_eq!(x07_ext_fs_view_release_v1(h), 1);
+
+        // Released (and bogus) handles yield the empty view; release is
+        // idempotent.
+        let gone = x07_ext_fs_view_bytes_v1(h);
+        assert!(gone.ptr.is_null() && gone.len == 0);
+        assert_eq!(x07_ext_fs_view_release_v1(h), 1);
+        let bogus = x07_ext_fs_view_bytes_v1(123);
+        assert!(bogus.ptr.is_null() && bogus.len == 0);
+
+        // Empty files open as empty views.
+        let empty_path = format!("{root}/empty.txt");
+        std::fs::write(&empty_path, b"").expect("write empty.txt");
+        let h2 = ok_i32(x07_ext_fs_view_open_v1(
+            to_ev_bytes(empty_path.as_bytes()),
+            to_ev_bytes(&caps),
+        ));
+        assert_eq!(x07_ext_fs_view_bytes_v1(h2).len, 0);
+        assert_eq!(x07_ext_fs_view_release_v1(h2), 1);
+
+        // Too-large files are rejected at open, like stream reads.
+        let too_big_path = format!("{root}/too_big.txt");
+        std::fs::write(&too_big_path, b"abcdefghi").expect("write too_big.txt");
+        assert_eq!(
+            err_i32(x07_ext_fs_view_open_v1(
+                to_ev_bytes(too_big_path.as_bytes()),
+                to_ev_bytes(&caps),
+            )),
+            FS_ERR_TOO_LARGE
+        );
+
+        let _ = std::fs::remove_dir_all(&root);
+    }
+
+    #[test]
+    fn fs_walk_handle_v1_smoke() {
+        std::env::set_var("X07_OS_SANDBOXED", "0");
+        std::env::set_var("X07_OS_FS", "1");
+
+        let root = format!("target/x07_ext_fs_walk_test_{}", std::process::id());
+        let _ = std::fs::remove_dir_all(&root);
+        std::fs::create_dir_all(format!("{root}/a/c")).expect("create test dirs");
+        std::fs::write(format!("{root}/a.txt"), b"1").expect("write a.txt");
+        std::fs::write(format!("{root}/a/b.txt"), b"2").expect("write a/b.txt");
+        std::fs::write(format!("{root}/a/c/d.txt"), b"3").expect("write a/c/d.txt");
+        std::fs::write(format!("{root}/z.txt"), b"4").expect("write z.txt");
+
+        let caps = caps_read_v1(0, 0);
+        let one_shot = ok_bytes(x07_ext_fs_walk_glob_sorted_text_v1(
+            to_ev_bytes(root.as_bytes()),
+            to_ev_bytes(b"**/*.txt"),
+            to_ev_bytes(&caps),
+        ));
+        assert_eq!(one_shot, b"a.txt\na/b.txt\na/c/d.txt\nz.txt\n");
+
+        // Streamed batches concatenate to exactly the one-shot output.
+        let h = ok_i32(x07_ext_fs_walk_open_v1(
+            to_ev_bytes(root.as_bytes()),
+            to_ev_bytes(b"**/*.txt"),
+            to_ev_bytes(&caps),
+        ));
+        assert!(h > 0);
+        let mut streamed: Vec<u8> = Vec::new();
+        loop {
+            let batch = ok_bytes(x07_ext_fs_walk_next_v1(h, 2));
+            if batch.is_empty() {
+                break;
+            }
+            assert!(batch.split(|&b| b == b'\n').filter(|l| !l.is_empty()).count() <= 2);
+            streamed.extend_from_slice(&batch);
+        }
+        assert_eq!(streamed, one_shot);
+        // Exhausted walks keep reporting done; drop is idempotent.
+        assert_eq!(ok_bytes(x07_ext_fs_walk_next_v1(h, 2)), b"");
+        assert_eq!(x07_ext_fs_walk_drop_v1(h), 1);
+        assert_eq!(x07_ext_fs_walk_drop_v1(h), 1);
+
+        // Invalid handle errors.
+        assert_eq!(
+            err_bytes(x07_ext_fs_walk_next_v1(123, 1)),
+            FS_ERR_BAD_HANDLE
+        );
+
+        // Non-directory roots are rejected at open.
+        let file_root = format!("{root}/a.txt");
+        assert_eq!(
+            err_i32(x07_ext_fs_walk_open_v1(
+                to_ev_bytes(file_root.as_bytes()),
+                to_ev_bytes(b"**"),
+                to_ev_bytes(&caps),
+            )),
+            FS_ERR_NOT_DIR
+        );
+
+        let _ = std::fs::remove_dir_all(&root);
+    }
+
     #[test]
     fn fs_append_all_v1_smoke() {
         std::env::set_var("X07_OS_SANDBOXED", "0");
@@ -39,6 +39,12 @@ const CODE_VALIDATE_ERRORS: u32 = 1;
 const CODE_VALIDATE_INVALID_HANDLE: u32 = 2;
 const CODE_VALIDATE_INSTANCE_JSON_INVALID: u32 = 3;
 const CODE_VALIDATE_INTERNAL: u32 = 4;
+const CODE_VALIDATE_BATCH_INVALID_FRAMES: u32 = 5;
+
+const HANDLE_OK_LEN: u32 = 10;
+
+const BATCH_MAGIC: &[u8; 4] = b"X7JB";
+const BATCH_VERSION: u8 = 1;
 
 #[derive(Clone)]
 struct Compiled {
@@ -75,6 +81,21 @@ impl SchemaTable {
     fn get(&self, h: u32) -> Option<&Compiled> {
         self.entries.get(h as usize)?.as_ref()
     }
+
+    fn remove(&mut self, h: i32) -> bool {
+        if h <= 0 {
+            return false;
+        }
+        let Some(slot) = self.entries.get_mut(h as usize) else {
+            return false;
+        };
+        if slot.take().is_none() {
+            return false;
+        }
+        // The dedup cache must not hand the freed handle back out.
+        self.by_key.retain(|_, v| *v != h as u32);
+        true
+    }
 }
 
 static TABLE: OnceLock<Mutex<SchemaTable>> = OnceLock::new();
@@ -322,73 +343,73 @@ fn parse_compiled(doc: &[u8]) -> Result<u32, (u32, &'static str)> {
     Ok(handle)
 }
 
-#[no_mangle]
-pub unsafe extern "C" fn x07_ext_jsonschema_compile_v1(schema_json: ev_bytes) -> ev_bytes {
-    std::panic::catch_unwind(|| {
-        let schema_bytes = unsafe { bytes_as_slice(schema_json) };
-        let schema_hash = fnv1a32(schema_bytes);
-        let schema_hash64 = fnv1a64(schema_bytes);
-        let schema_str = match core::str::from_utf8(schema_bytes) {
-            Ok(s) => s,
-            Err(_) => {
-                return make_compile_err(
-                    CODE_COMPILE_SCHEMA_JSON_INVALID,
-                    "schema_json must be utf-8",
-                );
-            }
-        };
+fn compile_core(schema_bytes: &[u8]) -> Result<(u32, u8, u32), ev_bytes> {
+    let schema_hash = fnv1a32(schema_bytes);
+    let schema_hash64 = fnv1a64(schema_bytes);
+    let schema_str = core::str::from_utf8(schema_bytes).map_err(|_| {
+        make_compile_err(CODE_COMPILE_SCHEMA_JSON_INVALID, "schema_json must be utf-8")
+    })?;
+
+    let schema_val: Value = serde_json::from_str(schema_str).map_err(|e| {
+        make_compile_err(
+            CODE_COMPILE_SCHEMA_JSON_INVALID,
+            &format!("invalid schema_json: {e}"),
+        )
+    })?;
 
-        let schema_val: Value = match serde_json::from_str(schema_str) {
-            Ok(v) => v,
-            Err(e) => {
-                return make_compile_err(
-                    CODE_COMPILE_SCHEMA_JSON_INVALID,
-                    &format!("invalid schema_json: {e}"),
-                );
+    let (draft, dialect_id) =
+        compile_dialect(&schema_val).map_err(|(code, msg)| make_compile_err(code, &msg))?;
+
+    let cache_key = (
+        dialect_id,
+        schema_bytes.len().min(u32::MAX as usize) as u32,
+        schema_hash64,
+    );
+    {
+        let guard = table().lock().unwrap();
+        if let Some(handle) = guard.by_key.get(&cache_key).copied() {
+            if guard.get(handle).is_some() {
+                return Ok((handle, dialect_id, schema_hash));
             }
-        };
+        }
+    }
 
-        let (draft, dialect_id) = match compile_dialect(&schema_val) {
-            Ok(x) => x,
-            Err((code, msg)) => return make_compile_err(code, &msg),
-        };
+    let schema = jsonschema::options()
+        .with_draft(draft)
+        .build(&schema_val)
+        .map_err(|e| make_compile_err(CODE_COMPILE_SCHEMA_INVALID, &e.to_string()))?;
 
-        let cache_key = (dialect_id, schema_json.len, schema_hash64);
-        {
-            let guard = table().lock().unwrap();
-            if let Some(handle) = guard.by_key.get(&cache_key).copied() {
-                if guard.get(handle).is_some() {
-                    return make_compile_ok(handle, dialect_id, schema_hash);
-                }
-            }
+    let compiled = Compiled {
+        validator: Arc::new(schema),
+    };
+    let mut guard = table().lock().unwrap();
+    if let Some(handle) = guard.by_key.get(&cache_key).copied() {
+        if guard.get(handle).is_some() {
+            return Ok((handle, dialect_id, schema_hash));
         }
+    }
+    let Some(handle) = guard.insert(compiled) else {
+        return Err(make_compile_err(
+            CODE_COMPILE_SCHEMA_INVALID,
+            "failed to allocate schema handle",
+        ));
+    };
+    guard.by_key.insert(cache_key, handle);
+    drop(guard);
 
-        let schema = match jsonschema::options().with_draft(draft).build(&schema_val) {
-            Ok(s) => s,
-            Err(e) => {
-                return make_compile_err(CODE_COMPILE_SCHEMA_INVALID, &e.to_string());
-            }
-        };
+    Ok((handle, dialect_id, schema_hash))
+}
 
-        let compiled = Compiled {
-            validator: Arc::new(schema),
-        };
-        let mut guard = table().lock().unwrap();
-        if let Some(handle) = guard.by_key.get(&cache_key).copied() {
-            if guard.get(handle).is_some() {
-                return make_compile_ok(handle, dialect_id, schema_hash);
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_jsonschema_compile_v1(schema_json: ev_bytes) -> ev_bytes {
+    std::panic::catch_unwind(|| {
+        let schema_bytes = unsafe { bytes_as_slice(schema_json) };
+        match compile_core(schema_bytes) {
+            Ok((handle, dialect_id, schema_hash)) => {
+                make_compile_ok(handle, dialect_id, schema_hash)
             }
+            Err(doc) => doc,
         }
-        let Some(handle) = guard.insert(compiled) else {
-            return make_compile_err(
-                CODE_COMPILE_SCHEMA_INVALID,
-                "failed to allocate schema handle",
-            );
-        };
-        guard.by_key.insert(cache_key, handle);
-        drop(guard);
-
-        make_compile_ok(handle, dialect_id, schema_hash)
     })
     .unwrap_or_else(|_| make_compile_err(CODE_COMPILE_SCHEMA_INVALID, "compile panicked"))
 }
@@ -420,34 +441,204 @@ pub unsafe extern "C" fn x07_ext_jsonschema_validate_v1(
         };
 
         let instance_bytes = unsafe { bytes_as_slice(instance_json) };
-        let instance_str = match core::str::from_utf8(instance_bytes) {
-            Ok(s) => s,
-            Err(_) => {
-                return make_validate_err(
-                    CODE_VALIDATE_INSTANCE_JSON_INVALID,
-                    &single_error_json("", "json", "instance_json must be utf-8"),
-                );
-            }
+        match validate_instance(&compiled, instance_bytes) {
+            Ok(()) => make_validate_ok(),
+            Err((code, errors_json)) => make_validate_err(code, &errors_json),
+        }
+    })
+    .unwrap_or_else(|_| {
+        make_validate_err(
+            CODE_VALIDATE_INTERNAL,
+            &single_error_json("", "internal", "validate panicked"),
+        )
+    })
+}
+
+fn validate_instance(compiled: &Compiled, instance_bytes: &[u8]) -> Result<(), (u32, Vec<u8>)> {
+    let instance_str = core::str::from_utf8(instance_bytes).map_err(|_| {
+        (
+            CODE_VALIDATE_INSTANCE_JSON_INVALID,
+            single_error_json("", "json", "instance_json must be utf-8"),
+        )
+    })?;
+
+    let instance_val: Value = serde_json::from_str(instance_str).map_err(|e| {
+        (
+            CODE_VALIDATE_INSTANCE_JSON_INVALID,
+            single_error_json("", "json", &format!("invalid instance_json: {e}")),
+        )
+    })?;
+
+    // Bind before returning: the validate() temporary borrows instance_val
+    // and must be dropped before the tail expression's extended lifetime.
+    let out = match compiled.validator.validate(&instance_val) {
+        Ok(()) => Ok(()),
+        Err(iter) => Err((CODE_VALIDATE_ERRORS, errors_to_json(iter))),
+    };
+    out
+}
+
+fn get_compiled(handle: i32) -> Option<Compiled> {
+    if handle <= 0 {
+        return None;
+    }
+    let guard = table().lock().unwrap();
+    guard.get(handle as u32).cloned()
+}
+
+fn make_handle_ok(handle: u32) -> ev_bytes {
+    unsafe {
+        let out = alloc_bytes(HANDLE_OK_LEN);
+        let b = bytes_as_mut_slice(out);
+        b[0] = 1;
+        b[1..5].copy_from_slice(COMPILED_MAGIC);
+        b[5] = COMPILED_VERSION;
+        write_u32_le(&mut b[6..10], handle);
+        out
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_jsonschema_handle_compile_v1(schema_json: ev_bytes) -> ev_bytes {
+    std::panic::catch_unwind(|| {
+        let schema_bytes = unsafe { bytes_as_slice(schema_json) };
+        match compile_core(schema_bytes) {
+            Ok((handle, _dialect_id, _schema_hash)) => make_handle_ok(handle),
+            Err(doc) => doc,
+        }
+    })
+    .unwrap_or_else(|_| make_compile_err(CODE_COMPILE_SCHEMA_INVALID, "compile panicked"))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_jsonschema_handle_validate_v1(
+    schema_handle: i32,
+    instance_json: ev_bytes,
+) -> ev_bytes {
+    std::panic::catch_unwind(|| {
+        let Some(compiled) = get_compiled(schema_handle) else {
+            return make_validate_err(
+                CODE_VALIDATE_INVALID_HANDLE,
+                &single_error_json("", "internal", "compiled schema handle not found"),
+            );
         };
 
-        let instance_val: Value = match serde_json::from_str(instance_str) {
-            Ok(v) => v,
-            Err(e) => {
+        let instance_bytes = unsafe { bytes_as_slice(instance_json) };
+        match validate_instance(&compiled, instance_bytes) {
+            Ok(()) => make_validate_ok(),
+            Err((code, errors_json)) => make_validate_err(code, &errors_json),
+        }
+    })
+    .unwrap_or_else(|_| {
+        make_validate_err(
+            CODE_VALIDATE_INTERNAL,
+            &single_error_json("", "internal", "validate panicked"),
+        )
+    })
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_jsonschema_handle_drop_v1(schema_handle: i32) -> i32 {
+    std::panic::catch_unwind(|| {
+        let mut guard = table().lock().unwrap();
+        if guard.remove(schema_handle) {
+            1
+        } else {
+            0
+        }
+    })
+    .unwrap_or(0)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_jsonschema_validate_batch_v1(
+    schema_handle: i32,
+    instances: ev_bytes,
+    count_i32: i32,
+) -> ev_bytes {
+    std::panic::catch_unwind(|| {
+        let Some(compiled) = get_compiled(schema_handle) else {
+            return make_validate_err(
+                CODE_VALIDATE_INVALID_HANDLE,
+                &single_error_json("", "internal", "compiled schema handle not found"),
+            );
+        };
+
+        let buf = unsafe { bytes_as_slice(instances) };
+        if count_i32 < 0 {
+            return make_validate_err(
+                CODE_VALIDATE_BATCH_INVALID_FRAMES,
+                &single_error_json("", "internal", "instance count must be non-negative"),
+            );
+        }
+        let count = count_i32 as usize;
+
+        // Split the packed [u32_le len][bytes] frames up front so framing
+        // errors fail the whole batch before any validation runs.
+        let mut frames: Vec<&[u8]> = Vec::with_capacity(count.min(buf.len() / 4 + 1));
+        let mut off = 0usize;
+        for _ in 0..count {
+            let Some(len_b) = buf.get(off..off + 4) else {
                 return make_validate_err(
-                    CODE_VALIDATE_INSTANCE_JSON_INVALID,
-                    &single_error_json("", "json", &format!("invalid instance_json: {e}")),
+                    CODE_VALIDATE_BATCH_INVALID_FRAMES,
+                    &single_error_json("", "internal", "truncated instance frame"),
                 );
-            }
-        };
+            };
+            let len = read_u32_le(len_b) as usize;
+            off += 4;
+            let Some(end) = off.checked_add(len) else {
+                return make_validate_err(
+                    CODE_VALIDATE_BATCH_INVALID_FRAMES,
+                    &single_error_json("", "internal", "instance frame length overflow"),
+                );
+            };
+            let Some(frame) = buf.get(off..end) else {
+                return make_validate_err(
+                    CODE_VALIDATE_BATCH_INVALID_FRAMES,
+                    &single_error_json("", "internal", "truncated instance frame"),
+                );
+            };
+            frames.push(frame);
+            off = end;
+        }
+        if off != buf.len() {
+            return make_validate_err(
+                CODE_VALIDATE_BATCH_INVALID_FRAMES,
+                &single_error_json("", "internal", "trailing bytes after instance frames"),
+            );
+        }
 
-        let out = match compiled.validator.validate(&instance_val) {
-            Ok(()) => make_validate_ok(),
-            Err(iter) => {
-                let errors_json = errors_to_json(iter);
-                make_validate_err(CODE_VALIDATE_ERRORS, &errors_json)
+        let mut body: Vec<u8> = Vec::new();
+        for frame in frames {
+            match validate_instance(&compiled, frame) {
+                Ok(()) => {
+                    body.push(1);
+                    body.extend_from_slice(&0u32.to_le_bytes());
+                    body.extend_from_slice(&0u32.to_le_bytes());
+                }
+                Err((code, errors_json)) => {
+                    let errors_len = errors_json.len().min(u32::MAX as usize) as u32;
+                    body.push(0);
+                    body.extend_from_slice(&code.to_le_bytes());
+                    body.extend_from_slice(&errors_len.to_le_bytes());
+                    body.extend_from_slice(&errors_json[..errors_len as usize]);
+                }
             }
-        };
-        out
+        }
+
+        let total_len = 10usize
+            .saturating_add(body.len())
+            .min(u32::MAX as usize) as u32;
+        unsafe {
+            let out = alloc_bytes(total_len);
+            let b = bytes_as_mut_slice(out);
+            b[0] = 1;
+            b[1..5].copy_from_slice(BATCH_MAGIC);
+            b[5] = BATCH_VERSION;
+            write_u32_le(&mut b[6..10], count_i32 as u32);
+            b[10..].copy_from_slice(&body);
+            out
+        }
     })
     .unwrap_or_else(|_| {
         make_validate_err(
@@ -25,6 +25,8 @@ pub const OP_GET_V1: u32 = 2;
 pub const OP_PUT_V1: u32 = 3;
 pub const OP_DELETE_V1: u32 = 4;
 pub const OP_LIST_V1: u32 = 5;
+pub const OP_GET_MULTI_V1: u32 = 6;
+pub const OP_PUT_MULTI_V1: u32 = 7;
 
 pub fn env_bool(name: &str, default: bool) -> bool {
     std::env::var(name)
@@ -7,6 +7,7 @@ use reqwest::{
     header, Url,
 };
 use sha2::{Digest, Sha256};
+use std::sync::Mutex;
 use time::{format_description::FormatItem, macros::format_description, OffsetDateTime};
 use x07_ext_obj_native_core as objcore;
 
@@ -18,6 +19,12 @@ const REQ_VERSION: u32 = 1;
 const MAX_REQ_BYTES_DEFAULT: u32 = 1024 * 1024;
 const MAX_PUT_BYTES_DEFAULT: u32 = 16 * 1024 * 1024;
 const MAX_RESP_BYTES_DEFAULT: u32 = 32 * 1024 * 1024;
+const MULTI_PART_SIZE_DEFAULT: u32 = 8 * 1024 * 1024;
+const MULTI_PART_SIZE_MIN_GET: u32 = 64 * 1024;
+// S3 rejects multipart parts below 5 MiB (the last part excepted).
+const MULTI_PART_SIZE_MIN_PUT: u32 = 5 * 1024 * 1024;
+const MULTI_CONCURRENCY_DEFAULT: u32 = 4;
+const MULTI_CONCURRENCY_MAX: u32 = 16;
 const AWS_REGION_DEFAULT: &str = "us-east-1";
 const AWS_SERVICE: &str = "s3";
 const DATE_ONLY_FORMAT: &[FormatItem<'static>] = format_description!("[year][month][day]");
@@ -274,6 +281,21 @@ fn hmac_sha256(key: &[u8], data: &[u8]) -> Result<Vec<u8>, (u32, Vec<u8>)> {
     Ok(mac.finalize().into_bytes().to_vec())
 }
 
+// Percent-encode per the SigV4 canonical rules: everything except
+// unreserved characters, uppercase hex.
+fn aws_uri_encode(value: &str) -> String {
+    let mut out = String::with_capacity(value.len());
+    for byte in value.bytes() {
+        match byte {
+            b'A'..=b'Z' | b'a'..=b'z' | b'0'..=b'9' | b'-' | b'_' | b'.' | b'~' => {
+                out.push(byte as char)
+            }
+            _ => out.push_str(&format!("%{byte:02X}")),
+        }
+    }
+    out
+}
+
 fn signed_request(
     policy: &Policy,
     method: &str,
@@ -281,7 +303,25 @@ fn signed_request(
     body: &[u8],
     content_type: Option<&str>,
 ) -> Result<Response, (u32, Vec<u8>)> {
-    let url = object_url(&policy.endpoint, target)?;
+    signed_request_with(policy, method, target, &[], body, content_type, None)
+}
+
+fn signed_request_with(
+    policy: &Policy,
+    method: &str,
+    target: &Target,
+    query: &[(&str, &str)],
+    body: &[u8],
+    content_type: Option<&str>,
+    range: Option<&str>,
+) -> Result<Response, (u32, Vec<u8>)> {
+    let mut url = object_url(&policy.endpoint, target)?;
+    if !query.is_empty() {
+        let mut pairs = url.query_pairs_mut();
+        for (name, value) in query {
+            pairs.append_pair(name, value);
+        }
+    }
     let host = endpoint_host(&policy.endpoint)?;
     let now = OffsetDateTime::now_utc();
     let amz_date = now
@@ -294,11 +334,17 @@ fn signed_request(
         .format(DATE_ONLY_FORMAT)
         .map_err(|err| (objcore::OBJ_ERR_BAD_REQ, err.to_string().into_bytes()))?;
     let payload_hash = hex::encode(Sha256::digest(body));
+    let mut canonical_query: Vec<String> = query
+        .iter()
+        .map(|(name, value)| format!("{}={}", aws_uri_encode(name), aws_uri_encode(value)))
+        .collect();
+    canonical_query.sort();
+    let canonical_query = canonical_query.join("&");
     let canonical_headers =
         format!("host:{host}\nx-amz-content-sha256:{payload_hash}\nx-amz-date:{amz_date}\n");
     let signed_headers = "host;x-amz-content-sha256;x-amz-date";
     let canonical_request = format!(
-        "{method}\n{}\n\n{canonical_headers}\n{signed_headers}\n{payload_hash}",
+        "{method}\n{}\n{canonical_query}\n{canonical_headers}\n{signed_headers}\n{payload_hash}",
         url.path()
     );
     let credential_scope = format!(
@@ -337,7 +383,11 @@ fn signed_request(
     if let Some(content_type) = content_type {
         request = request.header(header::CONTENT_TYPE, content_type);
     }
-    if matches!(method, "PUT") {
+    // Range rides unsigned: SigV4 only covers the listed SignedHeaders.
+    if let Some(range) = range {
+        request = request.header(header::RANGE, range);
+    }
+    if matches!(method, "PUT" | "POST") {
         request = request.body(body.to_vec());
     }
     request
@@ -365,6 +415,323 @@ fn build_head_payload(response: &Response) -> Vec<u8> {
     }
 }
 
+fn content_length_of(response: &Response) -> Option<u64> {
+    response
+        .headers()
+        .get(header::CONTENT_LENGTH)?
+        .to_str()
+        .ok()?
+        .trim()
+        .parse()
+        .ok()
+}
+
+fn xml_text(body: &str, tag: &str) -> Option<String> {
+    let open = format!("<{tag}>");
+    let close = format!("</{tag}>");
+    let start = body.find(&open)? + open.len();
+    let end = body[start..].find(&close)? + start;
+    Some(body[start..end].trim().to_string())
+}
+
+// Multipart params ride at the front of the request body:
+// [part_size u32_le][concurrency u32_le], each 0 = backend default. The
+// remainder of the body (the PUT payload) is returned to the caller.
+fn multi_params(body: &[u8], min_part_size: u32) -> Result<(u32, u32, &[u8]), (u32, Vec<u8>)> {
+    if body.len() < 8 {
+        return Err((
+            objcore::OBJ_ERR_BAD_REQ,
+            b"malformed multipart params".to_vec(),
+        ));
+    }
+    let part_size = read_u32_le(body, 0).unwrap_or(0);
+    let concurrency = read_u32_le(body, 4).unwrap_or(0);
+    let part_size = if part_size == 0 {
+        MULTI_PART_SIZE_DEFAULT
+    } else {
+        part_size.max(min_part_size)
+    };
+    let concurrency = if concurrency == 0 {
+        MULTI_CONCURRENCY_DEFAULT
+    } else {
+        concurrency.min(MULTI_CONCURRENCY_MAX)
+    };
+    Ok((part_size, concurrency, &body[8..]))
+}
+
+// Ranged parallel GET: HEAD for the object size, then fetch part_size
+// byte ranges concurrently, each worker writing straight into its slice
+// of one preallocated buffer. Any part failure fails the whole fetch.
+fn get_multi(
+    policy: &Policy,
+    target: &Target,
+    part_size: u32,
+    concurrency: u32,
+) -> Result<Vec<u8>, (u32, Vec<u8>)> {
+    let head = signed_request(policy, "HEAD", target, &[], None)?;
+    if head.status().as_u16() == 404 {
+        return Err((objcore::OBJ_ERR_NOT_FOUND, b"object not found".to_vec()));
+    }
+    if !head.status().is_success() {
+        return Err((
+            objcore::OBJ_ERR_IO,
+            format!("object store HEAD failed: {}", head.status()).into_bytes(),
+        ));
+    }
+    let total = content_length_of(&head).ok_or_else(|| {
+        (
+            objcore::OBJ_ERR_IO,
+            b"object store HEAD returned no content length".to_vec(),
+        )
+    })?;
+    if total > policy.max_resp_bytes as u64 {
+        return Err((objcore::OBJ_ERR_TOO_LARGE, b"response too large".to_vec()));
+    }
+    let total = total as usize;
+    let part_size = part_size as usize;
+    let mut out = vec![0u8; total];
+    if total == 0 {
+        return Ok(out);
+    }
+
+    {
+        let mut parts: Vec<(usize, &mut [u8])> = out.chunks_mut(part_size).enumerate().collect();
+        // Workers pop from the back; reverse so parts run front to back.
+        parts.reverse();
+        let workers = (concurrency.max(1) as usize).min(parts.len());
+        let queue = Mutex::new(parts);
+        let first_err: Mutex<Option<(u32, Vec<u8>)>> = Mutex::new(None);
+        std::thread::scope(|scope| {
+            for _ in 0..workers {
+                scope.spawn(|| loop {
+                    if first_err.lock().map(|guard| guard.is_some()).unwrap_or(true) {
+                        return;
+                    }
+                    let Some((idx, chunk)) = queue.lock().ok().and_then(|mut guard| guard.pop())
+                    else {
+                        return;
+                    };
+                    let start = idx * part_size;
+                    let end = start + chunk.len() - 1;
+                    let range = format!("bytes={start}-{end}");
+                    let res =
+                        signed_request_with(policy, "GET", target, &[], &[], None, Some(&range))
+                            .and_then(|response| {
+                                if !response.status().is_success() {
+                                    return Err((
+                                        objcore::OBJ_ERR_IO,
+                                        format!(
+                                            "object store ranged GET failed: {}",
+                                            response.status()
+                                        )
+                                        .into_bytes(),
+                                    ));
+                                }
+                                let body = response.bytes().map_err(|err| {
+                                    (objcore::OBJ_ERR_IO, err.to_string().into_bytes())
+                                })?;
+                                if body.len() != chunk.len() {
+                                    return Err((
+                                        objcore::OBJ_ERR_IO,
+                                        b"ranged GET returned wrong part length".to_vec(),
+                                    ));
+                                }
+                                chunk.copy_from_slice(&body);
+                                Ok(())
+                            });
+                    if let Err(err) = res {
+                        if let Ok(mut guard) = first_err.lock() {
+                            guard.get_or_insert(err);
+                        }
+                        return;
+                    }
+                });
+            }
+        });
+        if let Some(err) = first_err.lock().ok().and_then(|mut guard| guard.take()) {
+            return Err(err);
+        }
+    }
+    Ok(out)
+}
+
+// Concurrent multipart PUT: create the upload, push part_size slices of
+// the one payload in parallel, then complete with the collected ETags.
+// A payload that fits in a single part skips the multipart protocol; any
+// failure after create aborts the upload (best effort).
+fn put_multi(
+    policy: &Policy,
+    target: &Target,
+    payload: &[u8],
+    part_size: u32,
+    concurrency: u32,
+) -> Result<(), (u32, Vec<u8>)> {
+    let part_size = part_size as usize;
+    if payload.len() <= part_size {
+        let response = signed_request(
+            policy,
+            "PUT",
+            target,
+            payload,
+            Some("application/octet-stream"),
+        )?;
+        if response.status().is_success() {
+            return Ok(());
+        }
+        return Err((
+            objcore::OBJ_ERR_IO,
+            format!("object store PUT failed: {}", response.status()).into_bytes(),
+        ));
+    }
+
+    let create = signed_request_with(policy, "POST", target, &[("uploads", "")], &[], None, None)?;
+    if !create.status().is_success() {
+        return Err((
+            objcore::OBJ_ERR_IO,
+            format!("object store multipart create failed: {}", create.status()).into_bytes(),
+        ));
+    }
+    let create_body = create
+        .text()
+        .map_err(|err| (objcore::OBJ_ERR_IO, err.to_string().into_bytes()))?;
+    let upload_id = xml_text(&create_body, "UploadId").ok_or_else(|| {
+        (
+            objcore::OBJ_ERR_IO,
+            b"multipart create returned no upload id".to_vec(),
+        )
+    })?;
+
+    let mut parts: Vec<(usize, &[u8])> = payload.chunks(part_size).enumerate().collect();
+    parts.reverse();
+    let count = parts.len();
+    let workers = (concurrency.max(1) as usize).min(count);
+    let etags: Mutex<Vec<Option<String>>> = Mutex::new(vec![None; count]);
+    let queue = Mutex::new(parts);
+    let first_err: Mutex<Option<(u32, Vec<u8>)>> = Mutex::new(None);
+    std::thread::scope(|scope| {
+        for _ in 0..workers {
+            scope.spawn(|| loop {
+                if first_err.lock().map(|guard| guard.is_some()).unwrap_or(true) {
+                    return;
+                }
+                let Some((idx, chunk)) = queue.lock().ok().and_then(|mut guard| guard.pop())
+                else {
+                    return;
+                };
+                let part_number = (idx + 1).to_string();
+                let res = signed_request_with(
+                    policy,
+                    "PUT",
+                    target,
+                    &[("partNumber", &part_number), ("uploadId", &upload_id)],
+                    chunk,
+                    Some("application/octet-stream"),
+                    None,
+                )
+                .and_then(|response| {
+                    if !response.status().is_success() {
+                        return Err((
+                            objcore::OBJ_ERR_IO,
+                            format!("object store part upload failed: {}", response.status())
+                                .into_bytes(),
+                        ));
+                    }
+                    let etag = response
+                        .headers()
+                        .get(header::ETAG)
+                        .and_then(|value| value.to_str().ok())
+                        .map(|value| value.to_string())
+                        .ok_or_else(|| {
+                            (
+                                objcore::OBJ_ERR_IO,
+                                b"part upload returned no etag".to_vec(),
+                            )
+                        })?;
+                    if let Ok(mut guard) = etags.lock() {
+                        guard[idx] = Some(etag);
+                    }
+                    Ok(())
+                });
+                if let Err(err) = res {
+                    if let Ok(mut guard) = first_err.lock() {
+                        guard.get_or_insert(err);
+                    }
+                    return;
+                }
+            });
+        }
+    });
+    if let Some(err) = first_err.lock().ok().and_then(|mut guard| guard.take()) {
+        abort_multipart(policy, target, &upload_id);
+        return Err(err);
+    }
+
+    let etags = etags.into_inner().unwrap_or_default();
+    let mut complete_xml = String::from("<CompleteMultipartUpload>");
+    for (idx, etag) in etags.iter().enumerate() {
+        let Some(etag) = etag else {
+            abort_multipart(policy, target, &upload_id);
+            return Err((
+                objcore::OBJ_ERR_IO,
+                b"part upload returned no etag".to_vec(),
+            ));
+        };
+        complete_xml.push_str(&format!(
+            "<Part><PartNumber>{}</PartNumber><ETag>{etag}</ETag></Part>",
+            idx + 1
+        ));
+    }
+    complete_xml.push_str("</CompleteMultipartUpload>");
+    let complete = signed_request_with(
+        policy,
+        "POST",
+        target,
+        &[("uploadId", &upload_id)],
+        complete_xml.as_bytes(),
+        Some("application/xml"),
+        None,
+    );
+    match complete {
+        Ok(response) if response.status().is_success() => {
+            // S3 can report a failed complete inside a 200 body.
+            let body = response.text().unwrap_or_default();
+            if body.contains("<Error>") {
+                abort_multipart(policy, target, &upload_id);
+                return Err((
+                    objcore::OBJ_ERR_IO,
+                    b"multipart complete returned an error".to_vec(),
+                ));
+            }
+            Ok(())
+        }
+        Ok(response) => {
+            abort_multipart(policy, target, &upload_id);
+            Err((
+                objcore::OBJ_ERR_IO,
+                format!("object store multipart complete failed: {}", response.status())
+                    .into_bytes(),
+            ))
+        }
+        Err(err) => {
+            abort_multipart(policy, target, &upload_id);
+            Err(err)
+        }
+    }
+}
+
+fn abort_multipart(policy: &Policy, target: &Target, upload_id: &str) {
+    // Best effort; bucket lifecycle rules are the backstop for orphans.
+    let _ = signed_request_with(
+        policy,
+        "DELETE",
+        target,
+        &[("uploadId", upload_id)],
+        &[],
+        None,
+        None,
+    );
+}
+
 fn error_bytes(op: u32, code: u32, msg: Vec<u8>) -> ev_bytes {
     objcore::alloc_return_bytes(&objcore::evobj_err(op, code, &msg))
 }
@@ -471,6 +838,25 @@ pub unsafe extern "C" fn x07_obj_s3_dispatch_v1(req: ev_bytes, _caps: ev_bytes)
                 }
             })
         }
+        objcore::OP_GET_MULTI_V1 => multi_params(parsed.body, MULTI_PART_SIZE_MIN_GET).and_then(
+            |(part_size, concurrency, rest)| {
+                if !rest.is_empty() {
+                    return Err((
+                        objcore::OBJ_ERR_BAD_REQ,
+                        b"malformed multipart get params".to_vec(),
+                    ));
+                }
+                get_multi(&policy, &target, part_size, concurrency)
+            },
+        ),
+        objcore::OP_PUT_MULTI_V1 => multi_params(parsed.body, MULTI_PART_SIZE_MIN_PUT).and_then(
+            |(part_size, concurrency, payload)| {
+                if payload.len() as u32 > policy.max_put_bytes {
+                    return Err((objcore::OBJ_ERR_TOO_LARGE, b"put body too large".to_vec()));
+                }
+                put_multi(&policy, &target, payload, part_size, concurrency).map(|()| Vec::new())
+            },
+        ),
         other => Err((
             objcore::OBJ_ERR_BAD_REQ,
             format!("unsupported object op: {other}").into_bytes(),
@@ -696,4 +1082,65 @@ mod tests {
 
         handle.join().expect("join test server");
     }
+
+    #[test]
+    fn get_multi_assembles_ranged_parts() {
+        let (endpoint, requests, handle) = start_http_server(vec![
+            "HTTP/1.1 200 OK\r\nContent-Length: 8\r\n\r\n",
+            "HTTP/1.1 206 Partial Content\r\nContent-Length: 4\r\n\r\nabcd",
+            "HTTP/1.1 206 Partial Content\r\nContent-Length: 4\r\n\r\nefgh",
+        ]);
+        let policy = test_policy(endpoint);
+        let target = parse_target(&policy, b"big/object.bin").expect("target");
+
+        // Concurrency 1 keeps the capture server's response order valid.
+        let body = get_multi(&policy, &target, 4, 1).expect("get multi");
+        assert_eq!(body, b"abcdefgh");
+
+        let head_request = requests.recv().expect("captured head request");
+        assert_eq!(head_request.method, "HEAD");
+        let first_part = requests.recv().expect("captured first ranged get");
+        assert_eq!(first_part.method, "GET");
+        assert_eq!(first_part.headers.get("range").map(String::as_str), Some("bytes=0-3"));
+        let second_part = requests.recv().expect("captured second ranged get");
+        assert_eq!(second_part.headers.get("range").map(String::as_str), Some("bytes=4-7"));
+
+        handle.join().expect("join test server");
+    }
+
+    #[test]
+    fn put_multi_uploads_parts_and_completes() {
+        let (endpoint, requests, handle) = start_http_server(vec![
+            "HTTP/1.1 200 OK\r\nContent-Length: 31\r\n\r\n<UploadId>upload-123</UploadId>",
+            "HTTP/1.1 200 OK\r\nContent-Length: 0\r\nETag: \"etag-p1\"\r\n\r\n",
+            "HTTP/1.1 200 OK\r\nContent-Length: 0\r\nETag: \"etag-p2\"\r\n\r\n",
+            "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n\r\n",
+        ]);
+        let policy = test_policy(endpoint);
+        let target = parse_target(&policy, b"big/object.bin").expect("target");
+
+        put_multi(&policy, &target, b"abcdefgh", 4, 1).expect("put multi");
+
+        let create_request = requests.recv().expect("captured create request");
+        assert_eq!(create_request.method, "POST");
+        assert!(create_request.path.contains("uploads="));
+
+        let first_part = requests.recv().expect("captured first part");
+        assert_eq!(first_part.method, "PUT");
+        assert!(first_part.path.contains("partNumber=1"));
+        assert!(first_part.path.contains("uploadId=upload-123"));
+        assert_eq!(first_part.body, b"abcd");
+        let second_part = requests.recv().expect("captured second part");
+        assert!(second_part.path.contains("partNumber=2"));
+        assert_eq!(second_part.body, b"efgh");
+
+        let complete_request = requests.recv().expect("captured complete request");
+        assert_eq!(complete_request.method, "POST");
+        assert!(complete_request.path.contains("uploadId=upload-123"));
+        let complete_xml = String::from_utf8(complete_request.body).expect("complete body utf8");
+        assert!(complete_xml.contains("<PartNumber>1</PartNumber><ETag>\"etag-p1\"</ETag>"));
+        assert!(complete_xml.contains("<PartNumber>2</PartNumber><ETag>\"etag-p2\"</ETag>"));
+
+        handle.join().expect("join test server");
+    }
 }
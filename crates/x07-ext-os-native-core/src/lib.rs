@@ -43,6 +43,8 @@ pub const CAP_ALLOW_HIDDEN: u32 = 1 << 1;
 pub const CAP_CREATE_PARENTS: u32 = 1 << 2;
 pub const CAP_OVERWRITE: u32 = 1 << 3;
 pub const CAP_ATOMIC_WRITE: u32 = 1 << 4;
+pub const CAP_PREALLOCATE: u32 = 1 << 5;
+pub const CAP_WRITE_NOCACHE: u32 = 1 << 6;
 
 pub fn cap_allow_symlinks(c: CapsV1) -> bool {
     (c.flags & CAP_ALLOW_SYMLINKS) != 0
@@ -64,6 +66,14 @@ pub fn cap_atomic_write(c: CapsV1) -> bool {
     (c.flags & CAP_ATOMIC_WRITE) != 0
 }
 
+pub fn cap_preallocate(c: CapsV1) -> bool {
+    (c.flags & CAP_PREALLOCATE) != 0
+}
+
+pub fn cap_write_nocache(c: CapsV1) -> bool {
+    (c.flags & CAP_WRITE_NOCACHE) != 0
+}
+
 pub fn read_u32_le(b: &[u8], off: usize) -> Option<u32> {
     let slice = b.get(off..off + 4)?;
     Some(u32::from_le_bytes([slice[0], slice[1], slice[2], slice[3]]))
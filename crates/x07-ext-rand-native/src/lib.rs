@@ -147,3 +147,267 @@ pub extern "C" fn x07_ext_rand_u64_v1(caps: ev_bytes) -> ev_result_bytes {
     })
     .unwrap_or_else(|_| err_bytes(RAND_ERR_IO_V1))
 }
+
+// Buffered pool mode: one OS entropy read seeds a ChaCha20 keystream
+// generator (the same counter-mode DRBG construction rand's StdRng uses),
+// which refills a large in-process buffer; rand_pool_bytes/rand_pool_u64
+// serve straight from the buffer. The caps gate is applied once at pool
+// creation and the generator is re-keyed from OS entropy every
+// reseed_interval output bytes.
+const POOL_BUF_BYTES: usize = 64 * 1024;
+const POOL_DEFAULT_RESEED_BYTES: u64 = 1 << 20;
+
+#[inline(always)]
+fn chacha_quarter(s: &mut [u32; 16], a: usize, b: usize, c: usize, d: usize) {
+    s[a] = s[a].wrapping_add(s[b]);
+    s[d] = (s[d] ^ s[a]).rotate_left(16);
+    s[c] = s[c].wrapping_add(s[d]);
+    s[b] = (s[b] ^ s[c]).rotate_left(12);
+    s[a] = s[a].wrapping_add(s[b]);
+    s[d] = (s[d] ^ s[a]).rotate_left(8);
+    s[c] = s[c].wrapping_add(s[d]);
+    s[b] = (s[b] ^ s[c]).rotate_left(7);
+}
+
+fn chacha20_block(key: &[u32; 8], counter: u64, out: &mut [u8; 64]) {
+    let mut s: [u32; 16] = [
+        0x6170_7865,
+        0x3320_646e,
+        0x7962_2d32,
+        0x6b20_6574,
+        key[0],
+        key[1],
+        key[2],
+        key[3],
+        key[4],
+        key[5],
+        key[6],
+        key[7],
+        counter as u32,
+        (counter >> 32) as u32,
+        0,
+        0,
+    ];
+    let init = s;
+    for _ in 0..10 {
+        chacha_quarter(&mut s, 0, 4, 8, 12);
+        chacha_quarter(&mut s, 1, 5, 9, 13);
+        chacha_quarter(&mut s, 2, 6, 10, 14);
+        chacha_quarter(&mut s, 3, 7, 11, 15);
+        chacha_quarter(&mut s, 0, 5, 10, 15);
+        chacha_quarter(&mut s, 1, 6, 11, 12);
+        chacha_quarter(&mut s, 2, 7, 8, 13);
+        chacha_quarter(&mut s, 3, 4, 9, 14);
+    }
+    for (i, word) in s.iter_mut().enumerate() {
+        *word = word.wrapping_add(init[i]);
+        out[i * 4..i * 4 + 4].copy_from_slice(&word.to_le_bytes());
+    }
+}
+
+struct Pool {
+    key: [u32; 8],
+    counter: u64,
+    buf: Vec<u8>,
+    pos: usize,
+    reseed_interval: u64,
+    since_reseed: u64,
+    max_bytes_per_call: u32,
+}
+
+impl Pool {
+    fn seed_key() -> Result<[u32; 8], u32> {
+        let mut seed = [0u8; 32];
+        getrandom::getrandom(&mut seed).map_err(|_| RAND_ERR_IO_V1)?;
+        let mut key = [0u32; 8];
+        for (i, word) in key.iter_mut().enumerate() {
+            *word = u32::from_le_bytes([
+                seed[i * 4],
+                seed[i * 4 + 1],
+                seed[i * 4 + 2],
+                seed[i * 4 + 3],
+            ]);
+        }
+        Ok(key)
+    }
+
+    fn open(reseed_interval: u64, max_bytes_per_call: u32) -> Result<Self, u32> {
+        Ok(Self {
+            key: Self::seed_key()?,
+            counter: 0,
+            buf: vec![0u8; POOL_BUF_BYTES],
+            // Start exhausted so the first take triggers a refill.
+            pos: POOL_BUF_BYTES,
+            reseed_interval,
+            since_reseed: 0,
+            max_bytes_per_call,
+        })
+    }
+
+    fn refill(&mut self) -> Result<(), u32> {
+        if self.since_reseed >= self.reseed_interval {
+            self.key = Self::seed_key()?;
+            self.counter = 0;
+            self.since_reseed = 0;
+        }
+        let mut block = [0u8; 64];
+        for chunk in self.buf.chunks_mut(64) {
+            chacha20_block(&self.key, self.counter, &mut block);
+            self.counter = self.counter.wrapping_add(1);
+            chunk.copy_from_slice(&block[..chunk.len()]);
+        }
+        self.pos = 0;
+        self.since_reseed += POOL_BUF_BYTES as u64;
+        Ok(())
+    }
+
+    fn take(&mut self, mut dst: &mut [u8]) -> Result<(), u32> {
+        while !dst.is_empty() {
+            if self.pos == self.buf.len() {
+                self.refill()?;
+            }
+            let n = dst.len().min(self.buf.len() - self.pos);
+            dst[..n].copy_from_slice(&self.buf[self.pos..self.pos + n]);
+            // Scrub served bytes so the buffer never holds output twice.
+            self.buf[self.pos..self.pos + n].fill(0);
+            self.pos += n;
+            dst = &mut dst[n..];
+        }
+        Ok(())
+    }
+}
+
+static POOLS: std::sync::OnceLock<std::sync::Mutex<Vec<Option<Pool>>>> =
+    std::sync::OnceLock::new();
+
+fn pools() -> &'static std::sync::Mutex<Vec<Option<Pool>>> {
+    // Handle 0 reserved as invalid.
+    POOLS.get_or_init(|| std::sync::Mutex::new(vec![None]))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_rand_pool_open_v1(
+    reseed_interval_bytes: i32,
+    caps: ev_bytes,
+) -> ev_result_bytes {
+    std::panic::catch_unwind(|| unsafe {
+        let caps = match parse_caps_v1(bytes_as_slice(caps)) {
+            Ok(caps) => caps,
+            Err(code) => return err_bytes(code),
+        };
+        if caps.flags != 0 {
+            return err_bytes(RAND_ERR_BAD_CAPS_V1);
+        }
+
+        let max = effective_max(POLICY_MAX_BYTES_PER_CALL, caps.max_bytes_per_call);
+        if max == 0 {
+            return err_bytes(RAND_ERR_DISABLED_V1);
+        }
+
+        if reseed_interval_bytes < 0 {
+            return err_bytes(RAND_ERR_BAD_ARG_V1);
+        }
+        let reseed_interval = if reseed_interval_bytes == 0 {
+            POOL_DEFAULT_RESEED_BYTES
+        } else {
+            reseed_interval_bytes as u64
+        };
+
+        let pool = match Pool::open(reseed_interval, max) {
+            Ok(p) => p,
+            Err(code) => return err_bytes(code),
+        };
+
+        let Ok(mut guard) = pools().lock() else {
+            return err_bytes(RAND_ERR_IO_V1);
+        };
+        let mut handle = 0usize;
+        for (i, slot) in guard.iter_mut().enumerate().skip(1) {
+            if slot.is_none() {
+                handle = i;
+                break;
+            }
+        }
+        if handle == 0 {
+            handle = guard.len();
+            guard.push(Some(pool));
+        } else {
+            guard[handle] = Some(pool);
+        }
+        drop(guard);
+
+        let out = alloc_bytes(4);
+        let dst = std::slice::from_raw_parts_mut(out.ptr, 4);
+        dst.copy_from_slice(&(handle as u32).to_le_bytes());
+        ok_bytes(out)
+    })
+    .unwrap_or_else(|_| err_bytes(RAND_ERR_IO_V1))
+}
+
+unsafe fn pool_bytes_impl(pool_handle: i32, n: u32) -> ev_result_bytes {
+    if pool_handle <= 0 {
+        return err_bytes(RAND_ERR_BAD_ARG_V1);
+    }
+    let Ok(mut guard) = pools().lock() else {
+        return err_bytes(RAND_ERR_IO_V1);
+    };
+    let Some(pool) = guard
+        .get_mut(pool_handle as usize)
+        .and_then(|s| s.as_mut())
+    else {
+        return err_bytes(RAND_ERR_BAD_ARG_V1);
+    };
+
+    if n > pool.max_bytes_per_call {
+        return err_bytes(RAND_ERR_BAD_ARG_V1);
+    }
+
+    let out = alloc_bytes(n);
+    if n != 0 {
+        let out_slice = std::slice::from_raw_parts_mut(out.ptr, n as usize);
+        if let Err(code) = pool.take(out_slice) {
+            return err_bytes(code);
+        }
+    }
+    ok_bytes(out)
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_rand_pool_bytes_v1(pool_handle: i32, n: i32) -> ev_result_bytes {
+    std::panic::catch_unwind(|| unsafe {
+        if n < 0 {
+            return err_bytes(RAND_ERR_BAD_ARG_V1);
+        }
+        pool_bytes_impl(pool_handle, n as u32)
+    })
+    .unwrap_or_else(|_| err_bytes(RAND_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_rand_pool_u64_v1(pool_handle: i32) -> ev_result_bytes {
+    std::panic::catch_unwind(|| unsafe { pool_bytes_impl(pool_handle, 8) })
+        .unwrap_or_else(|_| err_bytes(RAND_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_rand_pool_close_v1(pool_handle: i32) -> i32 {
+    std::panic::catch_unwind(|| {
+        if pool_handle <= 0 {
+            return 0;
+        }
+        let Ok(mut guard) = pools().lock() else {
+            return 0;
+        };
+        match guard.get_mut(pool_handle as usize) {
+            Some(slot) => {
+                if slot.take().is_some() {
+                    1
+                } else {
+                    0
+                }
+            }
+            None => 0,
+        }
+    })
+    .unwrap_or(0)
+}
@@ -34,8 +34,10 @@ const CODE_COMPILE_STACK_OVERFLOW: u32 = 8;
 const CODE_COMPILE_TOO_MANY_STATES: u32 = 9;
 const CODE_EXEC_INVALID_COMPILED: u32 = 10;
 const CODE_PARSE_TOO_MANY_CAPTURES: u32 = 11;
+const CODE_SET_INVALID_FRAMES: u32 = 12;
 
 const MAX_CAPS: usize = 32;
+const MAX_SET_PATTERNS: usize = 1024;
 
 const COMPILED_MAGIC: &[u8; 4] = b"X7RG";
 const COMPILED_VERSION: u8 = 1;
@@ -48,8 +50,18 @@ struct Compiled {
     cap_count: u32,
 }
 
+// Resident program plus its scratch caches. The blob-token entrypoints
+// clone the program and build fresh caches per call; the handle-based
+// entrypoints run with these caches under the table lock so the per-call
+// cost is the automaton run alone.
+struct Entry {
+    compiled: Compiled,
+    cache_left: regex_automata::meta::Cache,
+    cache_all: regex_automata::meta::Cache,
+}
+
 struct RegexTable {
-    entries: Vec<Option<Compiled>>,
+    entries: Vec<Option<Entry>>,
 }
 
 impl RegexTable {
@@ -61,20 +73,44 @@ impl RegexTable {
     }
 
     fn insert(&mut self, compiled: Compiled) -> Option<u32> {
+        let cache_left = compiled.re_leftmost.create_cache();
+        let cache_all = compiled.re_all.create_cache();
+        let entry = Entry {
+            compiled,
+            cache_left,
+            cache_all,
+        };
         // Deterministic handle assignment: first free slot, else append.
         for (i, slot) in self.entries.iter_mut().enumerate().skip(1) {
             if slot.is_none() {
-                *slot = Some(compiled);
+                *slot = Some(entry);
                 return Some(i as u32);
             }
         }
         let h = self.entries.len() as u32;
-        self.entries.push(Some(compiled));
+        self.entries.push(Some(entry));
         Some(h)
     }
 
     fn get(&self, h: u32) -> Option<&Compiled> {
-        self.entries.get(h as usize)?.as_ref()
+        Some(&self.entries.get(h as usize)?.as_ref()?.compiled)
+    }
+
+    fn get_mut(&mut self, h: i32) -> Option<&mut Entry> {
+        if h <= 0 {
+            return None;
+        }
+        self.entries.get_mut(h as usize)?.as_mut()
+    }
+
+    fn remove(&mut self, h: i32) -> bool {
+        if h <= 0 {
+            return false;
+        }
+        match self.entries.get_mut(h as usize) {
+            Some(slot) => slot.take().is_some(),
+            None => false,
+        }
     }
 }
 
@@ -84,6 +120,66 @@ fn table() -> &'static Mutex<RegexTable> {
     TABLE.get_or_init(|| Mutex::new(RegexTable::new()))
 }
 
+// Resident pattern set: one combined automaton over N patterns, so a
+// scan is a single pass over the text regardless of set size. Same
+// leftmost-longest semantics as the single-pattern engine, with the
+// longest-match confirm anchored to the pattern that won leftmost-first.
+struct SetEntry {
+    re_leftmost: Regex,
+    re_all: Regex,
+    cache_left: regex_automata::meta::Cache,
+    cache_all: regex_automata::meta::Cache,
+}
+
+struct SetTable {
+    entries: Vec<Option<SetEntry>>,
+}
+
+impl SetTable {
+    fn new() -> Self {
+        Self {
+            // Handle 0 reserved as invalid.
+            entries: vec![None],
+        }
+    }
+
+    fn insert(&mut self, entry: SetEntry) -> Option<u32> {
+        // Deterministic handle assignment: first free slot, else append.
+        for (i, slot) in self.entries.iter_mut().enumerate().skip(1) {
+            if slot.is_none() {
+                *slot = Some(entry);
+                return Some(i as u32);
+            }
+        }
+        let h = self.entries.len() as u32;
+        self.entries.push(Some(entry));
+        Some(h)
+    }
+
+    fn get_mut(&mut self, h: i32) -> Option<&mut SetEntry> {
+        if h <= 0 {
+            return None;
+        }
+        self.entries.get_mut(h as usize)?.as_mut()
+    }
+
+    fn remove(&mut self, h: i32) -> bool {
+        if h <= 0 {
+            return false;
+        }
+        match self.entries.get_mut(h as usize) {
+            Some(slot) => slot.take().is_some(),
+            None => false,
+        }
+    }
+}
+
+static SET_TABLE: OnceLock<Mutex<SetTable>> = OnceLock::new();
+
+fn set_table() -> &'static Mutex<SetTable> {
+    SET_TABLE.get_or_init(|| Mutex::new(SetTable::new()))
+}
+
 #[inline]
 unsafe fn bytes_as_slice<'a>(b: ev_bytes) -> &'a [u8] {
     core::slice::from_raw_parts(b.ptr as *const u8, b.len as usize)
@@ -304,40 +400,46 @@ fn find_leftmost_longest_at(
     Some((s, m_long.end()))
 }
 
-#[no_mangle]
-pub unsafe extern "C" fn x07_ext_regex_compile_opts_v1(pat: ev_bytes, opts: i32) -> ev_bytes {
-    let pat_bytes = bytes_as_slice(pat);
+fn compile_insert(pat_bytes: &[u8], opts_u32: u32) -> Result<u32, (u32, u32)> {
     let Ok(pat_str) = core::str::from_utf8(pat_bytes) else {
-        return make_err(CODE_PARSE_INVALID_ESCAPE, 0);
+        return Err((CODE_PARSE_INVALID_ESCAPE, 0));
     };
-    let opts_u32 = opts as u32;
 
     let (re_leftmost, re_all) = match build_regex_pair(pat_str, opts_u32) {
         Ok(pair) => pair,
         Err(err) => {
             if let Some(se) = err.syntax_error() {
-                let (code, pos) = map_syntax_error(se);
-                return make_err(code, pos);
+                return Err(map_syntax_error(se));
             }
-            return make_err(CODE_COMPILE_TOO_MANY_STATES, 0);
+            return Err((CODE_COMPILE_TOO_MANY_STATES, 0));
         }
     };
 
     let cap_count = re_leftmost.captures_len().saturating_sub(1);
     if cap_count > MAX_CAPS {
-        return make_err(CODE_PARSE_TOO_MANY_CAPTURES, 0);
+        return Err((CODE_PARSE_TOO_MANY_CAPTURES, 0));
     }
-    let cap_count_u32 = cap_count as u32;
 
     let compiled = Compiled {
         re_leftmost,
         re_all,
-        cap_count: cap_count_u32,
+        cap_count: cap_count as u32,
     };
 
     let mut guard = table().lock().unwrap();
-    let Some(handle) = guard.insert(compiled) else {
-        return make_err(CODE_COMPILE_TOO_MANY_STATES, 0);
+    guard
+        .insert(compiled)
+        .ok_or((CODE_COMPILE_TOO_MANY_STATES, 0))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_compile_opts_v1(pat: ev_bytes, opts: i32) -> ev_bytes {
+    let pat_bytes = bytes_as_slice(pat);
+    let opts_u32 = opts as u32;
+
+    let handle = match compile_insert(pat_bytes, opts_u32) {
+        Ok(h) => h,
+        Err((code, pos)) => return make_err(code, pos),
     };
 
     let out = alloc_bytes(COMPILED_LEN);
@@ -371,6 +473,176 @@ fn parse_compiled(doc: ev_bytes) -> Result<u32, u32> {
     }
 }
 
+// Core operation bodies shared by the blob-token and handle-based
+// entrypoints. Callers supply the scratch caches: blob entrypoints build
+// fresh ones per call, handle entrypoints reuse the caches resident in
+// the table entry.
+unsafe fn exec_core(
+    c: &Compiled,
+    hay: &[u8],
+    start_i32: i32,
+    cache_left: &mut regex_automata::meta::Cache,
+    cache_all: &mut regex_automata::meta::Cache,
+) -> ev_bytes {
+    let hay_len = hay.len();
+    let start = clamp_start(start_i32, hay_len);
+
+    let Some((s, e)) = find_leftmost_longest_at(c, hay, start, cache_left, cache_all) else {
+        return make_match_doc(false, 0, 0);
+    };
+
+    make_match_doc(true, s as u32, e as u32)
+}
+
+unsafe fn exec_caps_core(
+    c: &Compiled,
+    hay: &[u8],
+    start_i32: i32,
+    cache_left: &mut regex_automata::meta::Cache,
+    cache_all: &mut regex_automata::meta::Cache,
+) -> ev_bytes {
+    let hay_len = hay.len();
+    let start = clamp_start(start_i32, hay_len);
+
+    let Some((s, _e)) = find_leftmost_longest_at(c, hay, start, cache_left, cache_all) else {
+        return make_caps_doc(false, 0, 0, c.cap_count, None);
+    };
+
+    let input = Input::new(hay).span(s..hay_len).anchored(Anchored::Yes);
+    let mut caps = c.re_all.create_captures();
+    c.re_all.search_captures_with(cache_all, &input, &mut caps);
+    let m = caps.get_match();
+    let Some(m) = m else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+    make_caps_doc(
+        true,
+        m.start() as u32,
+        m.end() as u32,
+        c.cap_count,
+        Some(&caps),
+    )
+}
+
+unsafe fn make_x7sl_doc(rows: Vec<(u32, u32)>) -> ev_bytes {
+    let count = min(rows.len(), u32::MAX as usize) as u32;
+    let out_len = 12u32.saturating_add(count.saturating_mul(8));
+    let out = alloc_bytes(out_len);
+    let b = bytes_as_mut_slice(out);
+    b[0..4].copy_from_slice(b"X7SL");
+    write_u32_le(&mut b[4..8], 1);
+    write_u32_le(&mut b[8..12], count);
+    let mut off = 12usize;
+    for (s, l) in rows.into_iter().take(count as usize) {
+        write_u32_le(&mut b[off..off + 4], s);
+        write_u32_le(&mut b[off + 4..off + 8], l);
+        off += 8;
+    }
+    out
+}
+
+unsafe fn find_all_core(
+    c: &Compiled,
+    hay: &[u8],
+    max_matches: i32,
+    cache_left: &mut regex_automata::meta::Cache,
+    cache_all: &mut regex_automata::meta::Cache,
+) -> ev_bytes {
+    let hay_len = hay.len();
+    let limit = limit_from_i32(max_matches);
+
+    let mut rows: Vec<(u32, u32)> = Vec::new();
+    let mut pos: usize = 0;
+    while rows.len() < limit && pos <= hay_len {
+        let Some((s, e)) = find_leftmost_longest_at(c, hay, pos, cache_left, cache_all) else {
+            break;
+        };
+        let su = s as u32;
+        let eu = e as u32;
+        rows.push((su, eu.saturating_sub(su)));
+        if e > s {
+            pos = e;
+        } else {
+            pos = s.saturating_add(1);
+        }
+    }
+
+    make_x7sl_doc(rows)
+}
+
+unsafe fn split_core(
+    c: &Compiled,
+    hay: &[u8],
+    max_parts: i32,
+    cache_left: &mut regex_automata::meta::Cache,
+    cache_all: &mut regex_automata::meta::Cache,
+) -> ev_bytes {
+    let hay_len = hay.len();
+    let limit = limit_from_i32(max_parts);
+
+    let mut rows: Vec<(u32, u32)> = Vec::new();
+    let mut last_end: usize = 0;
+    let mut pos: usize = 0;
+    while rows.len().saturating_add(1) < limit && pos <= hay_len {
+        let Some((s, e)) = find_leftmost_longest_at(c, hay, pos, cache_left, cache_all) else {
+            break;
+        };
+        rows.push((last_end as u32, (s.saturating_sub(last_end)) as u32));
+        last_end = e;
+        if e > s {
+            pos = e;
+        } else {
+            pos = s.saturating_add(1);
+        }
+    }
+    rows.push((last_end as u32, (hay_len.saturating_sub(last_end)) as u32));
+
+    make_x7sl_doc(rows)
+}
+
+unsafe fn replace_all_core(
+    c: &Compiled,
+    hay: &[u8],
+    repl_s: &[u8],
+    cap_limit: i32,
+    cache_left: &mut regex_automata::meta::Cache,
+    cache_all: &mut regex_automata::meta::Cache,
+) -> ev_bytes {
+    let hay_len = hay.len();
+    let limit = limit_from_i32(cap_limit);
+
+    let mut out: Vec<u8> = Vec::with_capacity(hay_len.saturating_add(repl_s.len()));
+    let mut last_end: usize = 0;
+    let mut pos: usize = 0;
+
+    let mut replaced: usize = 0;
+    while replaced < limit && pos <= hay_len {
+        let Some((s, e)) = find_leftmost_longest_at(c, hay, pos, cache_left, cache_all) else {
+            break;
+        };
+        out.extend_from_slice(&hay[last_end..s]);
+        out.extend_from_slice(repl_s);
+        replaced = replaced.saturating_add(1);
+        last_end = e;
+        if e > s {
+            pos = e;
+        } else {
+            pos = s.saturating_add(1);
+        }
+    }
+    out.extend_from_slice(&hay[last_end..hay_len]);
+
+    if out.len() > u32::MAX as usize {
+        return make_err(CODE_COMPILE_TOO_MANY_STATES, 0);
+    }
+
+    let out_len = out.len() as u32;
+    let out_b = alloc_bytes(out_len);
+    let dst = bytes_as_mut_slice(out_b);
+    dst.copy_from_slice(&out);
+    out_b
+}
+
 #[no_mangle]
 pub unsafe extern "C" fn x07_ext_regex_exec_from_v1(
     compiled: ev_bytes,
@@ -393,18 +665,9 @@ pub unsafe extern "C" fn x07_ext_regex_exec_from_v1(
     drop(guard);
 
     let hay = bytes_as_slice(text);
-    let hay_len = hay.len();
-    let start = clamp_start(start_i32, hay_len);
-
     let mut cache_left = c.re_leftmost.create_cache();
     let mut cache_all = c.re_all.create_cache();
-
-    let Some((s, e)) = find_leftmost_longest_at(&c, hay, start, &mut cache_left, &mut cache_all)
-    else {
-        return make_match_doc(false, 0, 0);
-    };
-
-    make_match_doc(true, s as u32, e as u32)
+    exec_core(&c, hay, start_i32, &mut cache_left, &mut cache_all)
 }
 
 #[no_mangle]
@@ -429,32 +692,9 @@ pub unsafe extern "C" fn x07_ext_regex_exec_caps_from_v1(
     drop(guard);
 
     let hay = bytes_as_slice(text);
-    let hay_len = hay.len();
-    let start = clamp_start(start_i32, hay_len);
-
     let mut cache_left = c.re_leftmost.create_cache();
     let mut cache_all = c.re_all.create_cache();
-
-    let Some((s, _e)) = find_leftmost_longest_at(&c, hay, start, &mut cache_left, &mut cache_all)
-    else {
-        return make_caps_doc(false, 0, 0, c.cap_count, None);
-    };
-
-    let input = Input::new(hay).span(s..hay_len).anchored(Anchored::Yes);
-    let mut caps = c.re_all.create_captures();
-    c.re_all
-        .search_captures_with(&mut cache_all, &input, &mut caps);
-    let m = caps.get_match();
-    let Some(m) = m else {
-        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
-    };
-    make_caps_doc(
-        true,
-        m.start() as u32,
-        m.end() as u32,
-        c.cap_count,
-        Some(&caps),
-    )
+    exec_caps_core(&c, hay, start_i32, &mut cache_left, &mut cache_all)
 }
 
 #[no_mangle]
@@ -479,43 +719,9 @@ pub unsafe extern "C" fn x07_ext_regex_find_all_x7sl_v1(
     drop(guard);
 
     let hay = bytes_as_slice(text);
-    let hay_len = hay.len();
-    let limit = limit_from_i32(max_matches);
-
     let mut cache_left = c.re_leftmost.create_cache();
     let mut cache_all = c.re_all.create_cache();
-
-    let mut rows: Vec<(u32, u32)> = Vec::new();
-    let mut pos: usize = 0;
-    while rows.len() < limit && pos <= hay_len {
-        let Some((s, e)) = find_leftmost_longest_at(&c, hay, pos, &mut cache_left, &mut cache_all)
-        else {
-            break;
-        };
-        let su = s as u32;
-        let eu = e as u32;
-        rows.push((su, eu.saturating_sub(su)));
-        if e > s {
-            pos = e;
-        } else {
-            pos = s.saturating_add(1);
-        }
-    }
-
-    let count = min(rows.len(), u32::MAX as usize) as u32;
-    let out_len = 12u32.saturating_add(count.saturating_mul(8));
-    let out = alloc_bytes(out_len);
-    let b = bytes_as_mut_slice(out);
-    b[0..4].copy_from_slice(b"X7SL");
-    write_u32_le(&mut b[4..8], 1);
-    write_u32_le(&mut b[8..12], count);
-    let mut off = 12usize;
-    for (s, l) in rows.into_iter().take(count as usize) {
-        write_u32_le(&mut b[off..off + 4], s);
-        write_u32_le(&mut b[off + 4..off + 8], l);
-        off += 8;
-    }
-    out
+    find_all_core(&c, hay, max_matches, &mut cache_left, &mut cache_all)
 }
 
 #[no_mangle]
@@ -540,44 +746,9 @@ pub unsafe extern "C" fn x07_ext_regex_split_v1(
     drop(guard);
 
     let hay = bytes_as_slice(text);
-    let hay_len = hay.len();
-    let limit = limit_from_i32(max_parts);
-
     let mut cache_left = c.re_leftmost.create_cache();
     let mut cache_all = c.re_all.create_cache();
-
-    let mut rows: Vec<(u32, u32)> = Vec::new();
-    let mut last_end: usize = 0;
-    let mut pos: usize = 0;
-    while rows.len().saturating_add(1) < limit && pos <= hay_len {
-        let Some((s, e)) = find_leftmost_longest_at(&c, hay, pos, &mut cache_left, &mut cache_all)
-        else {
-            break;
-        };
-        rows.push((last_end as u32, (s.saturating_sub(last_end)) as u32));
-        last_end = e;
-        if e > s {
-            pos = e;
-        } else {
-            pos = s.saturating_add(1);
-        }
-    }
-    rows.push((last_end as u32, (hay_len.saturating_sub(last_end)) as u32));
-
-    let count = min(rows.len(), u32::MAX as usize) as u32;
-    let out_len = 12u32.saturating_add(count.saturating_mul(8));
-    let out = alloc_bytes(out_len);
-    let b = bytes_as_mut_slice(out);
-    b[0..4].copy_from_slice(b"X7SL");
-    write_u32_le(&mut b[4..8], 1);
-    write_u32_le(&mut b[8..12], count);
-    let mut off = 12usize;
-    for (s, l) in rows.into_iter().take(count as usize) {
-        write_u32_le(&mut b[off..off + 4], s);
-        write_u32_le(&mut b[off + 4..off + 8], l);
-        off += 8;
-    }
-    out
+    split_core(&c, hay, max_parts, &mut cache_left, &mut cache_all)
 }
 
 #[no_mangle]
@@ -603,42 +774,311 @@ pub unsafe extern "C" fn x07_ext_regex_replace_all_v1(
     drop(guard);
 
     let hay = bytes_as_slice(text);
-    let hay_len = hay.len();
     let repl_s = bytes_as_slice(repl);
-    let limit = limit_from_i32(cap_limit);
-
     let mut cache_left = c.re_leftmost.create_cache();
     let mut cache_all = c.re_all.create_cache();
+    replace_all_core(&c, hay, repl_s, cap_limit, &mut cache_left, &mut cache_all)
+}
 
-    let mut out: Vec<u8> = Vec::with_capacity(hay_len.saturating_add(repl_s.len()));
-    let mut last_end: usize = 0;
-    let mut pos: usize = 0;
+// Handle-based v1 API: the program stays resident in the table with its
+// scratch caches, so a hot matcher loop pays only for the automaton run.
+// Handles come from handle_compile, are invalid after handle_drop, and
+// slot numbers may be reused by later compiles.
 
-    let mut replaced: usize = 0;
-    while replaced < limit && pos <= hay_len {
-        let Some((s, e)) = find_leftmost_longest_at(&c, hay, pos, &mut cache_left, &mut cache_all)
-        else {
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_compile_v1(pat: ev_bytes, opts: i32) -> ev_bytes {
+    let pat_bytes = bytes_as_slice(pat);
+    let handle = match compile_insert(pat_bytes, opts as u32) {
+        Ok(h) => h,
+        Err((code, pos)) => return make_err(code, pos),
+    };
+
+    let out = alloc_bytes(5);
+    let b = bytes_as_mut_slice(out);
+    b[0] = 1;
+    write_u32_le(&mut b[1..5], handle);
+    out
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_exec_v1(
+    regex_handle: i32,
+    text: ev_bytes,
+    start_i32: i32,
+) -> ev_bytes {
+    let mut guard = table().lock().unwrap();
+    let Some(entry) = guard.get_mut(regex_handle) else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+    let hay = bytes_as_slice(text);
+    exec_core(
+        &entry.compiled,
+        hay,
+        start_i32,
+        &mut entry.cache_left,
+        &mut entry.cache_all,
+    )
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_exec_caps_v1(
+    regex_handle: i32,
+    text: ev_bytes,
+    start_i32: i32,
+) -> ev_bytes {
+    let mut guard = table().lock().unwrap();
+    let Some(entry) = guard.get_mut(regex_handle) else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+    let hay = bytes_as_slice(text);
+    exec_caps_core(
+        &entry.compiled,
+        hay,
+        start_i32,
+        &mut entry.cache_left,
+        &mut entry.cache_all,
+    )
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_find_all_x7sl_v1(
+    regex_handle: i32,
+    text: ev_bytes,
+    max_matches: i32,
+) -> ev_bytes {
+    let mut guard = table().lock().unwrap();
+    let Some(entry) = guard.get_mut(regex_handle) else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+    let hay = bytes_as_slice(text);
+    find_all_core(
+        &entry.compiled,
+        hay,
+        max_matches,
+        &mut entry.cache_left,
+        &mut entry.cache_all,
+    )
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_split_v1(
+    regex_handle: i32,
+    text: ev_bytes,
+    max_parts: i32,
+) -> ev_bytes {
+    let mut guard = table().lock().unwrap();
+    let Some(entry) = guard.get_mut(regex_handle) else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+    let hay = bytes_as_slice(text);
+    split_core(
+        &entry.compiled,
+        hay,
+        max_parts,
+        &mut entry.cache_left,
+        &mut entry.cache_all,
+    )
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_replace_all_v1(
+    regex_handle: i32,
+    text: ev_bytes,
+    repl: ev_bytes,
+    cap_limit: i32,
+) -> ev_bytes {
+    let mut guard = table().lock().unwrap();
+    let Some(entry) = guard.get_mut(regex_handle) else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+    let hay = bytes_as_slice(text);
+    let repl_s = bytes_as_slice(repl);
+    replace_all_core(
+        &entry.compiled,
+        hay,
+        repl_s,
+        cap_limit,
+        &mut entry.cache_left,
+        &mut entry.cache_all,
+    )
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_handle_drop_v1(regex_handle: i32) -> i32 {
+    let mut guard = table().lock().unwrap();
+    if guard.remove(regex_handle) {
+        1
+    } else {
+        0
+    }
+}
+
+// Pattern-set v1 API: N patterns compiled into one combined automaton so
+// a scan over the text is a single pass regardless of set size.
+
+fn parse_pattern_frames(b: &[u8], count: i32) -> Result<Vec<&[u8]>, ()> {
+    if count <= 0 || count as usize > MAX_SET_PATTERNS {
+        return Err(());
+    }
+    let count = count as usize;
+    let mut out = Vec::with_capacity(count);
+    let mut off = 0usize;
+    for _ in 0..count {
+        if off + 4 > b.len() {
+            return Err(());
+        }
+        let len = u32::from_le_bytes([b[off], b[off + 1], b[off + 2], b[off + 3]]) as usize;
+        off += 4;
+        if len > b.len() - off {
+            return Err(());
+        }
+        out.push(&b[off..off + len]);
+        off += len;
+    }
+    if off != b.len() {
+        return Err(());
+    }
+    Ok(out)
+}
+
+fn build_regex_set_pair(
+    patterns: &[&str],
+    opts: u32,
+) -> Result<(Regex, Regex), Box<regex_automata::meta::BuildError>> {
+    let mut b_left = Regex::builder();
+    b_left.configure(Regex::config().match_kind(MatchKind::LeftmostFirst));
+    b_left.syntax(syntax_config(opts));
+    let left = b_left.build_many(patterns).map_err(Box::new)?;
+
+    let mut b_all = Regex::builder();
+    b_all.configure(Regex::config().match_kind(MatchKind::All));
+    b_all.syntax(syntax_config(opts));
+    let all = b_all.build_many(patterns).map_err(Box::new)?;
+
+    Ok((left, all))
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_set_compile_v1(
+    pats: ev_bytes,
+    count_i32: i32,
+    opts: i32,
+) -> ev_bytes {
+    let pats_bytes = bytes_as_slice(pats);
+    let Ok(frames) = parse_pattern_frames(pats_bytes, count_i32) else {
+        return make_err(CODE_SET_INVALID_FRAMES, 0);
+    };
+
+    // Errors report the index of the failing pattern in the pos field.
+    let mut pat_strs: Vec<&str> = Vec::with_capacity(frames.len());
+    for (i, f) in frames.iter().enumerate() {
+        let Ok(s) = core::str::from_utf8(f) else {
+            return make_err(CODE_PARSE_INVALID_ESCAPE, i as u32);
+        };
+        pat_strs.push(s);
+    }
+
+    let (re_leftmost, re_all) = match build_regex_set_pair(&pat_strs, opts as u32) {
+        Ok(pair) => pair,
+        Err(err) => {
+            let idx = err.pattern().map(|p| p.as_u32()).unwrap_or(0);
+            if let Some(se) = err.syntax_error() {
+                let (code, _pos) = map_syntax_error(se);
+                return make_err(code, idx);
+            }
+            return make_err(CODE_COMPILE_TOO_MANY_STATES, idx);
+        }
+    };
+
+    let cache_left = re_leftmost.create_cache();
+    let cache_all = re_all.create_cache();
+    let entry = SetEntry {
+        re_leftmost,
+        re_all,
+        cache_left,
+        cache_all,
+    };
+
+    let mut guard = set_table().lock().unwrap();
+    let Some(handle) = guard.insert(entry) else {
+        return make_err(CODE_COMPILE_TOO_MANY_STATES, 0);
+    };
+
+    let out = alloc_bytes(5);
+    let b = bytes_as_mut_slice(out);
+    b[0] = 1;
+    write_u32_le(&mut b[1..5], handle);
+    out
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_set_scan_x7sl_v1(
+    set_handle: i32,
+    text: ev_bytes,
+    max_matches: i32,
+) -> ev_bytes {
+    let mut guard = set_table().lock().unwrap();
+    let Some(entry) = guard.get_mut(set_handle) else {
+        return make_err(CODE_EXEC_INVALID_COMPILED, 0);
+    };
+
+    let hay = bytes_as_slice(text);
+    let hay_len = hay.len();
+    let limit = limit_from_i32(max_matches);
+
+    let mut rows: Vec<(u32, u32, u32)> = Vec::new();
+    let mut pos: usize = 0;
+    while rows.len() < limit && pos <= hay_len {
+        let input = Input::new(hay).span(pos..hay_len).anchored(Anchored::No);
+        let Some(m) = entry.re_leftmost.search_with(&mut entry.cache_left, &input) else {
             break;
         };
-        out.extend_from_slice(&hay[last_end..s]);
-        out.extend_from_slice(repl_s);
-        replaced = replaced.saturating_add(1);
-        last_end = e;
+        let s = m.start();
+        let pid = m.pattern();
+
+        // Longest match for the pattern that won leftmost-first, matching
+        // the single-pattern engine's leftmost-longest semantics.
+        let input = Input::new(hay)
+            .span(s..hay_len)
+            .anchored(Anchored::Pattern(pid));
+        let e = match entry.re_all.search_with(&mut entry.cache_all, &input) {
+            Some(m_long) => m_long.end(),
+            None => m.end(),
+        };
+
+        let su = s as u32;
+        let eu = e as u32;
+        rows.push((pid.as_u32(), su, eu.saturating_sub(su)));
         if e > s {
             pos = e;
         } else {
             pos = s.saturating_add(1);
         }
     }
-    out.extend_from_slice(&hay[last_end..hay_len]);
 
-    if out.len() > u32::MAX as usize {
-        return make_err(CODE_COMPILE_TOO_MANY_STATES, 0);
+    let count = min(rows.len(), u32::MAX as usize) as u32;
+    let out_len = 12u32.saturating_add(count.saturating_mul(12));
+    let out = alloc_bytes(out_len);
+    let b = bytes_as_mut_slice(out);
+    b[0..4].copy_from_slice(b"X7SL");
+    write_u32_le(&mut b[4..8], 2);
+    write_u32_le(&mut b[8..12], count);
+    let mut off = 12usize;
+    for (p, s, l) in rows.into_iter().take(count as usize) {
+        write_u32_le(&mut b[off..off + 4], p);
+        write_u32_le(&mut b[off + 4..off + 8], s);
+        write_u32_le(&mut b[off + 8..off + 12], l);
+        off += 12;
     }
+    out
+}
 
-    let out_len = out.len() as u32;
-    let out_b = alloc_bytes(out_len);
-    let dst = bytes_as_mut_slice(out_b);
-    dst.copy_from_slice(&out);
-    out_b
+#[no_mangle]
+pub unsafe extern "C" fn x07_ext_regex_set_drop_v1(set_handle: i32) -> i32 {
+    let mut guard = set_table().lock().unwrap();
+    if guard.remove(set_handle) {
+        1
+    } else {
+        0
+    }
 }
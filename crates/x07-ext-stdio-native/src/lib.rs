@@ -323,3 +323,223 @@ pub extern "C" fn x07_ext_stdio_flush_stderr_v1() -> ev_result_i32 {
     })
     .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
 }
+
+// Concatenate packed [u32_le len][bytes] frames into one contiguous
+// buffer so the whole batch reaches the stream in a single write.
+fn concat_frames(packed: &[u8]) -> Result<Vec<u8>, u32> {
+    let mut out: Vec<u8> = Vec::with_capacity(packed.len());
+    let mut off = 0usize;
+    while off < packed.len() {
+        let len = read_u32_le(packed, off).ok_or(STDIO_ERR_TOO_LARGE_V1)? as usize;
+        off += 4;
+        let end = off.checked_add(len).ok_or(STDIO_ERR_TOO_LARGE_V1)?;
+        let frame = packed.get(off..end).ok_or(STDIO_ERR_TOO_LARGE_V1)?;
+        out.extend_from_slice(frame);
+        off = end;
+    }
+    Ok(out)
+}
+
+unsafe fn write_vec_impl(
+    slices: ev_bytes,
+    caps: ev_bytes,
+    mut sink: impl std::io::Write,
+) -> ev_result_i32 {
+    let caps = match parse_caps_v1(bytes_as_slice(caps)) {
+        Ok(caps) => caps,
+        Err(code) => return err_i32(code),
+    };
+    if caps.flags != 0 {
+        return err_i32(STDIO_ERR_BAD_CAPS_V1);
+    }
+
+    let max_write = effective_max(POLICY_MAX_WRITE_BYTES, caps.max_write_bytes) as usize;
+    if max_write == 0 {
+        return err_i32(STDIO_ERR_DISABLED_V1);
+    }
+
+    let data = match concat_frames(bytes_as_slice(slices)) {
+        Ok(v) => v,
+        Err(code) => return err_i32(code),
+    };
+    if data.len() > max_write {
+        return err_i32(STDIO_ERR_TOO_LARGE_V1);
+    }
+
+    if sink.write_all(&data).is_err() {
+        return err_i32(STDIO_ERR_IO_V1);
+    }
+    ok_i32(data.len() as i32)
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_write_vec_stdout_v1(
+    slices: ev_bytes,
+    caps: ev_bytes,
+) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe { write_vec_impl(slices, caps, std::io::stdout().lock()) })
+        .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_write_vec_stderr_v1(
+    slices: ev_bytes,
+    caps: ev_bytes,
+) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe { write_vec_impl(slices, caps, std::io::stderr().lock()) })
+        .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+// Explicit write buffer with high-watermark auto-flush. The caps gate is
+// applied once when the buffer is configured; buffered writes then cost
+// an append plus an amortized flush once the watermark is crossed.
+const BUF_DEFAULT_WATERMARK: usize = 64 * 1024;
+
+struct OutBuf {
+    enabled: bool,
+    buf: Vec<u8>,
+    watermark: usize,
+    max_write: usize,
+}
+
+impl OutBuf {
+    const fn new() -> Self {
+        Self {
+            enabled: false,
+            buf: Vec::new(),
+            watermark: BUF_DEFAULT_WATERMARK,
+            max_write: 0,
+        }
+    }
+}
+
+static STDOUT_BUF: std::sync::Mutex<OutBuf> = std::sync::Mutex::new(OutBuf::new());
+static STDERR_BUF: std::sync::Mutex<OutBuf> = std::sync::Mutex::new(OutBuf::new());
+
+unsafe fn buf_set_impl(
+    state: &std::sync::Mutex<OutBuf>,
+    watermark_bytes: i32,
+    caps: ev_bytes,
+) -> ev_result_i32 {
+    let caps = match parse_caps_v1(bytes_as_slice(caps)) {
+        Ok(caps) => caps,
+        Err(code) => return err_i32(code),
+    };
+    if caps.flags != 0 {
+        return err_i32(STDIO_ERR_BAD_CAPS_V1);
+    }
+
+    let max_write = effective_max(POLICY_MAX_WRITE_BYTES, caps.max_write_bytes) as usize;
+    if max_write == 0 {
+        return err_i32(STDIO_ERR_DISABLED_V1);
+    }
+    if watermark_bytes < 0 {
+        return err_i32(STDIO_ERR_BAD_CAPS_V1);
+    }
+    let watermark = if watermark_bytes == 0 {
+        BUF_DEFAULT_WATERMARK
+    } else {
+        watermark_bytes as usize
+    };
+
+    let Ok(mut guard) = state.lock() else {
+        return err_i32(STDIO_ERR_IO_V1);
+    };
+    guard.enabled = true;
+    guard.watermark = watermark;
+    guard.max_write = max_write;
+    ok_i32(0)
+}
+
+fn buf_flush_locked(guard: &mut OutBuf, mut sink: impl std::io::Write) -> Result<(), u32> {
+    if guard.buf.is_empty() {
+        return Ok(());
+    }
+    let res = sink.write_all(&guard.buf).and_then(|()| sink.flush());
+    // Clear even on failure so a broken stream cannot grow the buffer
+    // without bound.
+    guard.buf.clear();
+    res.map_err(|_| STDIO_ERR_IO_V1)
+}
+
+unsafe fn buf_write_impl(
+    state: &std::sync::Mutex<OutBuf>,
+    data: ev_bytes,
+    sink: impl std::io::Write,
+) -> ev_result_i32 {
+    let data = bytes_as_slice(data);
+
+    let Ok(mut guard) = state.lock() else {
+        return err_i32(STDIO_ERR_IO_V1);
+    };
+    if !guard.enabled {
+        return err_i32(STDIO_ERR_DISABLED_V1);
+    }
+    if data.len() > guard.max_write {
+        return err_i32(STDIO_ERR_TOO_LARGE_V1);
+    }
+
+    guard.buf.extend_from_slice(data);
+    if guard.buf.len() >= guard.watermark {
+        if let Err(code) = buf_flush_locked(&mut guard, sink) {
+            return err_i32(code);
+        }
+    }
+    ok_i32(data.len() as i32)
+}
+
+fn buf_flush_entry(state: &std::sync::Mutex<OutBuf>, sink: impl std::io::Write) -> ev_result_i32 {
+    let Ok(mut guard) = state.lock() else {
+        return err_i32(STDIO_ERR_IO_V1);
+    };
+    match buf_flush_locked(&mut guard, sink) {
+        Ok(()) => ok_i32(0),
+        Err(code) => err_i32(code),
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_buf_set_stdout_v1(
+    watermark_bytes: i32,
+    caps: ev_bytes,
+) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe { buf_set_impl(&STDOUT_BUF, watermark_bytes, caps) })
+        .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_buf_set_stderr_v1(
+    watermark_bytes: i32,
+    caps: ev_bytes,
+) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe { buf_set_impl(&STDERR_BUF, watermark_bytes, caps) })
+        .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_buf_write_stdout_v1(data: ev_bytes) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe {
+        buf_write_impl(&STDOUT_BUF, data, std::io::stdout().lock())
+    })
+    .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_buf_write_stderr_v1(data: ev_bytes) -> ev_result_i32 {
+    std::panic::catch_unwind(|| unsafe {
+        buf_write_impl(&STDERR_BUF, data, std::io::stderr().lock())
+    })
+    .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_buf_flush_stdout_v1() -> ev_result_i32 {
+    std::panic::catch_unwind(|| buf_flush_entry(&STDOUT_BUF, std::io::stdout().lock()))
+        .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
+
+#[no_mangle]
+pub extern "C" fn x07_ext_stdio_buf_flush_stderr_v1() -> ev_result_i32 {
+    std::panic::catch_unwind(|| buf_flush_entry(&STDERR_BUF, std::io::stderr().lock()))
+        .unwrap_or_else(|_| err_i32(STDIO_ERR_IO_V1))
+}
@@ -58,6 +58,26 @@ fn u32_le(v: u32) -> [u8; 4] {
     v.to_le_bytes()
 }
 
+// The std.os.process builders import deep stdlib module chains whose typing
+// recursion outgrows the default test-thread stack in debug builds; compile
+// on a bigger thread, like stdlib_smoke does.
+fn compile_on_big_stack(
+    program: &[u8],
+    cfg: &RunnerConfig,
+    options: x07c::compile::CompileOptions,
+) -> x07_host_runner::CompilerResult {
+    let program = program.to_vec();
+    let cfg = cfg.clone();
+    std::thread::Builder::new()
+        .name("process_abi_compile".to_string())
+        .stack_size(16 * 1024 * 1024)
+        .spawn(move || compile_program_with_options(program.as_slice(), &cfg, None, &options, &[]))
+        .expect("spawn compile thread")
+        .join()
+        .expect("join compile thread")
+        .expect("compile ok")
+}
+
 #[test]
 fn proc_caps_v1_pack_encodes_bytes() {
     let cfg = config();
@@ -66,14 +86,11 @@ fn proc_caps_v1_pack_encodes_bytes() {
         json!(["std.os.process.caps_v1.finish", 1, 2, 3, 4]),
     );
 
-    let compile = compile_program_with_options(
+    let compile = compile_on_big_stack(
         program.as_slice(),
         &cfg,
-        None,
-        &compile_options(WorldId::SolvePure),
-        &[],
-    )
-    .expect("compile ok");
+        compile_options(WorldId::SolvePure),
+    );
     assert!(
         compile.ok,
         "compile_error={:?}\nstdout:\n{}\nstderr:\n{}",
@@ -108,14 +125,11 @@ fn proc_req_v1_new_and_finish_encodes_minimal_request() {
         ]),
     );
 
-    let compile = compile_program_with_options(
+    let compile = compile_on_big_stack(
         program.as_slice(),
         &cfg,
-        None,
-        &compile_options(WorldId::SolvePure),
-        &[],
-    )
-    .expect("compile ok");
+        compile_options(WorldId::SolvePure),
+    );
     assert!(
         compile.ok,
         "compile_error={:?}\nstdout:\n{}\nstderr:\n{}",
@@ -187,14 +201,11 @@ fn proc_req_v1_builder_encodes_args_env_cwd_and_stdin() {
         ]),
     );
 
-    let compile = compile_program_with_options(
+    let compile = compile_on_big_stack(
         program.as_slice(),
         &cfg,
-        None,
-        &compile_options(WorldId::SolvePure),
-        &[],
-    )
-    .expect("compile ok");
+        compile_options(WorldId::SolvePure),
+    );
     assert!(
         compile.ok,
         "compile_error={:?}\nstdout:\n{}\nstderr:\n{}",
@@ -324,14 +335,8 @@ fn result_bytes_v1_decode_helpers_work_for_err_and_ok_docs() {
             doc
         }),
     ] {
-        let compile = compile_program_with_options(
-            program.as_slice(),
-            &cfg,
-            None,
-            &compile_options(WorldId::RunOs),
-            &[],
-        )
-        .unwrap_or_else(|e| panic!("compile ok ({name}): {e:#}"));
+        let compile =
+            compile_on_big_stack(program.as_slice(), &cfg, compile_options(WorldId::RunOs));
         assert!(
             compile.ok,
             "compile_error ({name})={:?}\nstdout:\n{}\nstderr:\n{}",
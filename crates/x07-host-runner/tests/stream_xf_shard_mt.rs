@@ -0,0 +1,175 @@
+// End-to-end coverage for the sharded stream-xf wrappers and the opt-in
+// multi-threaded executor behind them: `plugin_shard_step_v1` routes each
+// batch item to shard `key % K` and runs the shards via
+// `rt_task_create_parallel`, which dispatches to worker threads when the
+// generated C is compiled with -DX07_MT_SCHED=1 and degrades to ordinary
+// cooperative tasks otherwise. Both modes must produce the same merged
+// blob (shard order 0..K-1).
+//
+// Requires the staged native backend (`scripts/ci/ensure_stream_xf_backend.sh`).
+
+use serde_json::{json, Value};
+use x07_host_runner::{compile_program_with_options, run_artifact_file, RunnerConfig};
+use x07_worlds::WorldId;
+
+mod x07_program;
+
+fn config() -> RunnerConfig {
+    RunnerConfig {
+        world: WorldId::SolvePure,
+        fixture_fs_dir: None,
+        fixture_fs_root: None,
+        fixture_fs_latency_index: None,
+        fixture_rr_dir: None,
+        fixture_kv_dir: None,
+        fixture_kv_seed: None,
+        solve_fuel: 10_000_000,
+        max_memory_bytes: 64 * 1024 * 1024,
+        max_output_bytes: 1024 * 1024,
+        cpu_time_limit_seconds: 20,
+        debug_borrow_checks: false,
+    }
+}
+
+fn compile_options(world: WorldId) -> x07c::compile::CompileOptions {
+    x07c::compile::CompileOptions {
+        world,
+        compat: Default::default(),
+        enable_fs: false,
+        enable_rr: false,
+        enable_kv: false,
+        module_roots: Vec::new(),
+        prefer_module_roots_first: false,
+        arch_root: None,
+        emit_main: true,
+        freestanding: false,
+        optimize: true,
+        profile_fns: false,
+        contract_mode: x07c::compile::ContractMode::RuntimeTrap,
+        allow_unsafe: None,
+        allow_ffi: None,
+        allow_internal_only_heads_in_entry: true,
+        allow_non_exported_calls_in_entry: false,
+    }
+}
+
+// All payload bytes stay below 0x80 so the blobs round-trip through
+// `bytes.lit` string literals unchanged.
+fn lit(bytes: &[u8]) -> Value {
+    json!([
+        "bytes.lit",
+        String::from_utf8(bytes.to_vec()).expect("ascii-only test payload")
+    ])
+}
+
+const SHARDS: u32 = 2;
+const ITEMS: [&[u8]; 4] = [b"a", b"bb", b"ccc", b"dddd"];
+
+fn batch_blob() -> Vec<u8> {
+    let mut out = Vec::new();
+    out.extend_from_slice(&(ITEMS.len() as u32).to_le_bytes());
+    for item in ITEMS {
+        out.extend_from_slice(&(item.len() as u32).to_le_bytes());
+        out.extend_from_slice(item);
+    }
+    out
+}
+
+fn keys_blob() -> Vec<u8> {
+    let mut out = Vec::new();
+    for (i, _) in ITEMS.iter().enumerate() {
+        out.extend_from_slice(&(i as u32 % SHARDS).to_le_bytes());
+    }
+    out
+}
+
+// Mirror of the runtime merge: u32_le total count, then per shard (0..K-1),
+// in arrival order, one record per item as u32_le tag (0 = inline) +
+// u32_le record length + record bytes. `xf.frame_u32le_v1` emits u32_le
+// payload length + payload for every input item.
+fn expected_blob() -> Vec<u8> {
+    let mut out = Vec::new();
+    out.extend_from_slice(&(ITEMS.len() as u32).to_le_bytes());
+    for shard in 0..SHARDS {
+        for (i, item) in ITEMS.iter().enumerate() {
+            if i as u32 % SHARDS != shard {
+                continue;
+            }
+            out.extend_from_slice(&0u32.to_le_bytes());
+            out.extend_from_slice(&(item.len() as u32 + 4).to_le_bytes());
+            out.extend_from_slice(&(item.len() as u32).to_le_bytes());
+            out.extend_from_slice(item);
+        }
+    }
+    out
+}
+
+fn shard_program() -> Vec<u8> {
+    // xf.frame_u32le_v1: state_size 32, scratch_max 0, stateless step, so
+    // zeroed per-shard state is a valid initial state.
+    x07_program::entry(
+        &[],
+        json!([
+            "begin",
+            ["let", "states", ["bytes.alloc", 32 * SHARDS]],
+            ["let", "scratch", ["bytes.alloc", 0]],
+            ["let", "batch", lit(&batch_blob())],
+            ["let", "keys", lit(&keys_blob())],
+            ["let", "bv", ["bytes.view", "batch"]],
+            ["let", "kv", ["bytes.view", "keys"]],
+            [
+                "let",
+                "r",
+                [
+                    "__internal.stream_xf.plugin_shard_step_v1",
+                    ["bytes.lit", "x07.stream.xf"],
+                    1,
+                    ["bytes.lit", "x07_xf_frame_u32le_v1"],
+                    "states",
+                    "scratch",
+                    65536,
+                    1024,
+                    1048576,
+                    SHARDS,
+                    "bv",
+                    "kv"
+                ]
+            ],
+            ["__internal.result_bytes.unwrap_ok_v1", "r"]
+        ]),
+    )
+}
+
+fn run_shard_program(extra_cc_args: &[String]) -> Vec<u8> {
+    let cfg = config();
+    let compile = compile_program_with_options(
+        shard_program().as_slice(),
+        &cfg,
+        None,
+        &compile_options(WorldId::SolvePure),
+        extra_cc_args,
+    )
+    .expect("compile ok");
+    assert!(
+        compile.ok,
+        "compile_error={:?}\nstderr:\n{}",
+        compile.compile_error,
+        String::from_utf8_lossy(&compile.stderr)
+    );
+    let exe = compile.compiled_exe.expect("compiled exe");
+
+    let res = run_artifact_file(&cfg, &exe, b"").expect("runner ok");
+    assert!(res.ok, "trap={:?}", res.trap);
+    res.solve_output
+}
+
+#[test]
+fn shard_step_merges_in_shard_order_cooperative() {
+    assert_eq!(run_shard_program(&[]), expected_blob());
+}
+
+#[test]
+fn shard_step_merges_in_shard_order_mt_sched() {
+    let out = run_shard_program(&["-DX07_MT_SCHED=1".to_string()]);
+    assert_eq!(out, expected_blob());
+}
@@ -414,13 +414,12 @@ fn parse_f64_lexical(s: &[u8]) -> Result<f64, u32> {
     Ok(value)
 }
 
-#[no_mangle]
-pub unsafe extern "C" fn ev_math_f64_parse_v1(s: ev_bytes) -> ev_result_bytes {
-    let bs = bytes_as_slice(s);
+#[inline]
+fn parse_f64_text(bs: &[u8]) -> Result<f64, u32> {
     let bs = trim_ascii_ws(bs);
 
     if bs.is_empty() {
-        return err(SPEC_ERR_F64_PARSE_INVALID);
+        return Err(SPEC_ERR_F64_PARSE_INVALID);
     }
 
     let (sign, rest) = match bs.first().copied() {
@@ -429,22 +428,27 @@ pub unsafe extern "C" fn ev_math_f64_parse_v1(s: ev_bytes) -> ev_result_bytes {
         _ => (1, bs),
     };
     if rest.is_empty() {
-        return err(SPEC_ERR_F64_PARSE_INVALID);
+        return Err(SPEC_ERR_F64_PARSE_INVALID);
     }
 
-    let x = if rest.eq_ignore_ascii_case(b"nan") {
-        f64::NAN
+    if rest.eq_ignore_ascii_case(b"nan") {
+        Ok(f64::NAN)
     } else if rest.eq_ignore_ascii_case(b"inf") {
         if sign < 0 {
-            f64::NEG_INFINITY
+            Ok(f64::NEG_INFINITY)
         } else {
-            f64::INFINITY
+            Ok(f64::INFINITY)
         }
     } else {
-        match parse_f64_lexical(bs) {
-            Ok(v) => v,
-            Err(code) => return err(code),
-        }
+        parse_f64_lexical(bs)
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_parse_v1(s: ev_bytes) -> ev_result_bytes {
+    let x = match parse_f64_text(bytes_as_slice(s)) {
+        Ok(v) => v,
+        Err(code) => return err(code),
     };
 
     let out = alloc_bytes(8);
@@ -452,12 +456,8 @@ pub unsafe extern "C" fn ev_math_f64_parse_v1(s: ev_bytes) -> ev_result_bytes {
     ok_bytes(out)
 }
 
-#[no_mangle]
-pub unsafe extern "C" fn ev_math_f64_fmt_shortest_v1(x: ev_bytes) -> ev_bytes {
-    let v = read_f64_le(x);
-    // Avoid *all* Rust heap allocations: either use a constant string, or ryu's
-    // stack buffer for finite numbers.
-    let mut buf = ryu::Buffer::new();
+#[inline]
+fn fmt_f64_shortest<'a>(v: f64, buf: &'a mut ryu::Buffer) -> &'a str {
     let s: &str = if v.is_nan() {
         "nan"
     } else if v == f64::INFINITY {
@@ -467,10 +467,366 @@ pub unsafe extern "C" fn ev_math_f64_fmt_shortest_v1(x: ev_bytes) -> ev_bytes {
     } else {
         buf.format_finite(v)
     };
-    let s = s.strip_suffix(".0").unwrap_or(s);
+    s.strip_suffix(".0").unwrap_or(s)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_fmt_shortest_v1(x: ev_bytes) -> ev_bytes {
+    let v = read_f64_le(x);
+    // Avoid *all* Rust heap allocations: either use a constant string, or ryu's
+    // stack buffer for finite numbers.
+    let mut buf = ryu::Buffer::new();
+    let s = fmt_f64_shortest(v, &mut buf);
 
     let out = alloc_bytes(s.len() as u32);
     let dst = bytes_as_mut_slice(out);
     dst.copy_from_slice(s.as_bytes());
     out
 }
+
+// --- v2: pass-by-value scalar ABI (x07_math_abi_v2.h) ---
+//
+// f64 crosses the boundary as plain `double`. The generated runtime handles
+// byte (de)serialization and canonicalizes NaN when storing, so bytes built
+// from these results match the v1 entrypoints bit-for-bit.
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_add_v2(a: f64, b: f64) -> f64 {
+    a + b
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_sub_v2(a: f64, b: f64) -> f64 {
+    a - b
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_mul_v2(a: f64, b: f64) -> f64 {
+    a * b
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_div_v2(a: f64, b: f64) -> f64 {
+    a / b
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_neg_v2(x: f64) -> f64 {
+    -x
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_abs_v2(x: f64) -> f64 {
+    x.abs()
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_min_v2(a: f64, b: f64) -> f64 {
+    // Same rule as v1: if either is NaN => NaN; else smaller.
+    if a.is_nan() || b.is_nan() {
+        f64::NAN
+    } else {
+        a.min(b)
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_max_v2(a: f64, b: f64) -> f64 {
+    if a.is_nan() || b.is_nan() {
+        f64::NAN
+    } else {
+        a.max(b)
+    }
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_sqrt_v2(x: f64) -> f64 {
+    libm::sqrt(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_sin_v2(x: f64) -> f64 {
+    libm::sin(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_cos_v2(x: f64) -> f64 {
+    libm::cos(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_tan_v2(x: f64) -> f64 {
+    libm::tan(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_exp_v2(x: f64) -> f64 {
+    libm::exp(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_ln_v2(x: f64) -> f64 {
+    libm::log(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_pow_v2(x: f64, y: f64) -> f64 {
+    libm::pow(x, y)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_atan2_v2(y: f64, x: f64) -> f64 {
+    libm::atan2(y, x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_floor_v2(x: f64) -> f64 {
+    libm::floor(x)
+}
+
+#[no_mangle]
+pub extern "C" fn ev_math_f64_ceil_v2(x: f64) -> f64 {
+    libm::ceil(x)
+}
+
+// --- batch kernels over packed f64 arrays (x07_math_batch_abi_v1.h) ---
+//
+// Arrays are N packed little-endian f64 values (len = 8*N). The loops are
+// written as straight-line slice iterations so LLVM auto-vectorizes the
+// arithmetic ones; transcendentals go through libm per element. NaN results
+// are canonicalized on store, matching the scalar entrypoints.
+
+const EV_TRAP_MATH_BATCH_BADLEN: i32 = 9110;
+const EV_TRAP_MATH_BATCH_MISMATCH: i32 = 9111;
+
+#[inline]
+unsafe fn arr_f64_count(b: ev_bytes) -> usize {
+    if b.len % 8 != 0 {
+        ev_trap(EV_TRAP_MATH_BATCH_BADLEN);
+    }
+    (b.len / 8) as usize
+}
+
+#[inline]
+unsafe fn arr_get(b: ev_bytes, i: usize) -> f64 {
+    let s = bytes_as_slice(b);
+    let mut arr = [0u8; 8];
+    arr.copy_from_slice(&s[i * 8..i * 8 + 8]);
+    f64::from_bits(u64::from_le_bytes(arr))
+}
+
+#[inline]
+unsafe fn arr_set(b: ev_bytes, i: usize, x: f64) {
+    let s = bytes_as_mut_slice(b);
+    let bits = canonicalize_nan(x).to_bits().to_le_bytes();
+    s[i * 8..i * 8 + 8].copy_from_slice(&bits);
+}
+
+#[inline]
+unsafe fn arr_binop(a: ev_bytes, b: ev_bytes, f: impl Fn(f64, f64) -> f64) -> ev_bytes {
+    let n = arr_f64_count(a);
+    if arr_f64_count(b) != n {
+        ev_trap(EV_TRAP_MATH_BATCH_MISMATCH);
+    }
+    let out = alloc_bytes(a.len);
+    for i in 0..n {
+        arr_set(out, i, f(arr_get(a, i), arr_get(b, i)));
+    }
+    out
+}
+
+#[inline]
+unsafe fn arr_map(x: ev_bytes, f: impl Fn(f64) -> f64) -> ev_bytes {
+    let n = arr_f64_count(x);
+    let out = alloc_bytes(x.len);
+    for i in 0..n {
+        arr_set(out, i, f(arr_get(x, i)));
+    }
+    out
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_add_v1(a: ev_bytes, b: ev_bytes) -> ev_bytes {
+    arr_binop(a, b, |x, y| x + y)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_sub_v1(a: ev_bytes, b: ev_bytes) -> ev_bytes {
+    arr_binop(a, b, |x, y| x - y)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_mul_v1(a: ev_bytes, b: ev_bytes) -> ev_bytes {
+    arr_binop(a, b, |x, y| x * y)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_div_v1(a: ev_bytes, b: ev_bytes) -> ev_bytes {
+    arr_binop(a, b, |x, y| x / y)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_fma_v1(a: ev_bytes, b: ev_bytes, c: ev_bytes) -> ev_bytes {
+    let n = arr_f64_count(a);
+    if arr_f64_count(b) != n || arr_f64_count(c) != n {
+        ev_trap(EV_TRAP_MATH_BATCH_MISMATCH);
+    }
+    let out = alloc_bytes(a.len);
+    for i in 0..n {
+        arr_set(
+            out,
+            i,
+            libm::fma(arr_get(a, i), arr_get(b, i), arr_get(c, i)),
+        );
+    }
+    out
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_neg_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, |v| -v)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_abs_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, |v| v.abs())
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_sqrt_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::sqrt)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_sin_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::sin)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_cos_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::cos)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_tan_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::tan)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_exp_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::exp)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_ln_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::log)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_floor_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::floor)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_ceil_v1(x: ev_bytes) -> ev_bytes {
+    arr_map(x, libm::ceil)
+}
+
+#[inline]
+unsafe fn arr_reduce(x: ev_bytes, f: impl Fn(f64, f64) -> f64) -> ev_bytes {
+    let n = arr_f64_count(x);
+    if n == 0 {
+        ev_trap(EV_TRAP_MATH_BATCH_BADLEN);
+    }
+    let mut acc = arr_get(x, 0);
+    for i in 1..n {
+        let v = arr_get(x, i);
+        acc = if acc.is_nan() || v.is_nan() {
+            f64::NAN
+        } else {
+            f(acc, v)
+        };
+    }
+    let out = alloc_bytes(8);
+    write_f64_le(out, acc);
+    out
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_min_v1(x: ev_bytes) -> ev_bytes {
+    arr_reduce(x, f64::min)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_max_v1(x: ev_bytes) -> ev_bytes {
+    arr_reduce(x, f64::max)
+}
+
+// --- batch parse / fmt (x07_math_batch_abi_v1.h) ---
+
+const EV_TRAP_MATH_BATCH_X7SL: i32 = 9112;
+
+#[inline]
+fn u32_le_at(s: &[u8], off: usize) -> u32 {
+    let mut arr = [0u8; 4];
+    arr.copy_from_slice(&s[off..off + 4]);
+    u32::from_le_bytes(arr)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_parse_v1(
+    base: ev_bytes,
+    x7sl: ev_bytes,
+) -> ev_result_bytes {
+    let l = bytes_as_slice(x7sl);
+    if l.len() < 12 || &l[0..4] != b"X7SL" || u32_le_at(l, 4) != 1 {
+        ev_trap(EV_TRAP_MATH_BATCH_X7SL);
+    }
+    let count = u32_le_at(l, 8) as usize;
+    if l.len() as u64 != 12 + count as u64 * 8 {
+        ev_trap(EV_TRAP_MATH_BATCH_X7SL);
+    }
+    let bs = bytes_as_slice(base);
+
+    // Parse everything before allocating the output so a failing slice
+    // leaves no runtime allocation behind.
+    let mut vals: Vec<f64> = Vec::with_capacity(count);
+    for i in 0..count {
+        let start = u32_le_at(l, 12 + i * 8) as u64;
+        let len = u32_le_at(l, 16 + i * 8) as u64;
+        if start + len > bs.len() as u64 {
+            ev_trap(EV_TRAP_MATH_BATCH_X7SL);
+        }
+        match parse_f64_text(&bs[start as usize..(start + len) as usize]) {
+            Ok(v) => vals.push(v),
+            Err(code) => return err(code),
+        }
+    }
+
+    let out = alloc_bytes((count * 8) as u32);
+    for (i, v) in vals.iter().enumerate() {
+        arr_set(out, i, *v);
+    }
+    ok_bytes(out)
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_math_f64_arr_fmt_shortest_v1(x: ev_bytes) -> ev_bytes {
+    let n = arr_f64_count(x);
+    let mut buf = ryu::Buffer::new();
+    let mut text: Vec<u8> = Vec::with_capacity(n * 8);
+    for i in 0..n {
+        let s = fmt_f64_shortest(arr_get(x, i), &mut buf);
+        text.extend_from_slice(s.as_bytes());
+        text.push(b'\n');
+    }
+    if text.len() > u32::MAX as usize {
+        ev_trap(EV_TRAP_MATH_INTERNAL);
+    }
+
+    let out = alloc_bytes(text.len() as u32);
+    if !text.is_empty() {
+        bytes_as_mut_slice(out).copy_from_slice(&text);
+    }
+    out
+}
@@ -2835,7 +2835,18 @@ mod tests {
         };
 
         let cfg = base_runner_config(1024 * 1024);
-        compile_program_with_options(&program, &cfg, None, &compile_options, &[])
+        // The external os programs import deep stdlib module chains whose
+        // typing recursion outgrows the default test-thread stack in debug
+        // builds; compile on a bigger thread.
+        std::thread::Builder::new()
+            .name("os_runner_test_compile".to_string())
+            .stack_size(16 * 1024 * 1024)
+            .spawn(move || {
+                compile_program_with_options(&program, &cfg, None, &compile_options, &[])
+            })
+            .expect("spawn compile thread")
+            .join()
+            .expect("join compile thread")
             .expect("compile_program_with_options")
     }
 
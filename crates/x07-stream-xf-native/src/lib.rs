@@ -97,6 +97,26 @@ pub struct x07_stream_xf_plugin_v1 {
 
 unsafe impl Sync for x07_stream_xf_plugin_v1 {}
 
+// v2 descriptor: v1 plus an optional batched step (`base.abi_version == 2`).
+// The wrapper delivers many items per call and applies the out budgets per
+// batch; a `None` step_batch makes the wrapper loop `base.step` instead.
+#[repr(C)]
+pub struct x07_stream_xf_plugin_v2 {
+    pub base: x07_stream_xf_plugin_v1,
+    pub step_batch: Option<
+        unsafe extern "C" fn(
+            *mut c_void,
+            *mut x07_scratch_v1,
+            *const x07_bytes_view_v1,
+            u32,
+            x07_xf_emit_v1,
+            x07_xf_budget_v1,
+        ) -> i32,
+    >,
+}
+
+unsafe impl Sync for x07_stream_xf_plugin_v2 {}
+
 extern "C" {
     fn ev_bytes_alloc(len: u32) -> ev_bytes;
     fn ev_trap(code: i32) -> !;
@@ -4,6 +4,7 @@
 use chrono::offset::Offset as _;
 use chrono::TimeZone as _;
 use chrono::Utc;
+use std::sync::{Mutex, OnceLock};
 
 #[repr(C)]
 #[derive(Copy, Clone)]
@@ -153,3 +154,156 @@ pub unsafe extern "C" fn ev_time_tzdb_snapshot_id_v1() -> ev_bytes {
     dst[PREFIX.len()..].copy_from_slice(version);
     out
 }
+
+// Zone handles: resolve the tzid string once, then look offsets up by a
+// small integer. chrono-tz's compiled tables are already flattened,
+// binary-searchable transition arrays, so per-value cost through a handle
+// is the transition search itself — no per-call tzid parse.
+static ZONES: OnceLock<Mutex<Vec<Option<chrono_tz::Tz>>>> = OnceLock::new();
+
+fn zones() -> &'static Mutex<Vec<Option<chrono_tz::Tz>>> {
+    // Handle 0 reserved as invalid.
+    ZONES.get_or_init(|| Mutex::new(vec![None]))
+}
+
+fn get_zone(handle: i32) -> Option<chrono_tz::Tz> {
+    if handle <= 0 {
+        return None;
+    }
+    let guard = zones().lock().ok()?;
+    guard.get(handle as usize).copied().flatten()
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_time_tzdb_zone_open_v1(tzid: ev_bytes) -> i32 {
+    let Some(s) = tzid_as_str(tzid) else {
+        return 0;
+    };
+    let tz: chrono_tz::Tz = match s.parse() {
+        Ok(v) => v,
+        Err(_) => return 0,
+    };
+
+    let Ok(mut guard) = zones().lock() else {
+        return 0;
+    };
+    for (i, slot) in guard.iter_mut().enumerate().skip(1) {
+        if slot.is_none() {
+            *slot = Some(tz);
+            return i as i32;
+        }
+    }
+    let h = guard.len();
+    if h > i32::MAX as usize {
+        return 0;
+    }
+    guard.push(Some(tz));
+    h as i32
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_time_tzdb_zone_drop_v1(zone_handle: i32) -> i32 {
+    if zone_handle <= 0 {
+        return 0;
+    }
+    let Ok(mut guard) = zones().lock() else {
+        return 0;
+    };
+    match guard.get_mut(zone_handle as usize) {
+        Some(slot) => {
+            if slot.take().is_some() {
+                1
+            } else {
+                0
+            }
+        }
+        None => 0,
+    }
+}
+
+#[inline]
+fn zone_offset_at(tz: chrono_tz::Tz, unix_s: i64) -> Option<i32> {
+    let utc = chrono::DateTime::<Utc>::from_timestamp(unix_s, 0)?;
+    Some(
+        tz.offset_from_utc_datetime(&utc.naive_utc())
+            .fix()
+            .local_minus_utc(),
+    )
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_time_tzdb_zone_offset_duration_v1(
+    zone_handle: i32,
+    unix_s_lo: i32,
+    unix_s_hi: i32,
+) -> ev_bytes {
+    let res = std::panic::catch_unwind(|| {
+        let Some(tz) = get_zone(zone_handle) else {
+            return unsafe { duration_err(SPEC_ERR_TZDB_INVALID_TZID) };
+        };
+
+        let unix_s = i64_from_lohi(unix_s_lo, unix_s_hi);
+        match zone_offset_at(tz, unix_s) {
+            Some(offset_s) => unsafe { duration_ok(offset_s as i64, 0) },
+            None => unsafe { duration_err(SPEC_ERR_TZDB_RANGE) },
+        }
+    });
+
+    match res {
+        Ok(b) => b,
+        Err(_) => duration_err(SPEC_ERR_TZDB_INTERNAL),
+    }
+}
+
+#[no_mangle]
+pub unsafe extern "C" fn ev_time_tzdb_zone_offsets_batch_v1(
+    zone_handle: i32,
+    unix_s_packed: ev_bytes,
+) -> ev_bytes {
+    let res = std::panic::catch_unwind(|| {
+        let Some(tz) = get_zone(zone_handle) else {
+            return unsafe { duration_err(SPEC_ERR_TZDB_INVALID_TZID) };
+        };
+
+        let buf = unsafe { bytes_as_slice(unix_s_packed) };
+        if buf.len() % 8 != 0 {
+            return unsafe { duration_err(SPEC_ERR_TZDB_RANGE) };
+        }
+        let count = buf.len() / 8;
+
+        let total_len = 1usize.saturating_add(count * 4);
+        if total_len > u32::MAX as usize {
+            return unsafe { duration_err(SPEC_ERR_TZDB_RANGE) };
+        }
+        let out = unsafe { alloc_bytes(total_len as u32) };
+        let dst = unsafe { bytes_as_mut_slice(out) };
+        dst[0] = 1;
+
+        // Memo for the nearly-sorted case: the offset only changes at a
+        // transition, so a repeat of the previous timestamp's offset is
+        // decided without touching the zone tables when the value repeats.
+        let mut last: Option<(i64, i32)> = None;
+        for i in 0..count {
+            let mut ts_b = [0u8; 8];
+            ts_b.copy_from_slice(&buf[i * 8..i * 8 + 8]);
+            let unix_s = i64::from_le_bytes(ts_b);
+
+            let offset_s = match last {
+                Some((prev_ts, prev_off)) if prev_ts == unix_s => prev_off,
+                _ => match zone_offset_at(tz, unix_s) {
+                    Some(v) => v,
+                    None => return unsafe { duration_err(SPEC_ERR_TZDB_RANGE) },
+                },
+            };
+            last = Some((unix_s, offset_s));
+            dst[1 + i * 4..1 + i * 4 + 4].copy_from_slice(&offset_s.to_le_bytes());
+        }
+
+        out
+    });
+
+    match res {
+        Ok(b) => b,
+        Err(_) => duration_err(SPEC_ERR_TZDB_INTERNAL),
+    }
+}
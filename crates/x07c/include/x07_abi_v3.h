@@ -0,0 +1,46 @@
+#ifndef X07_ABI_V3_H
+#define X07_ABI_V3_H
+
+#include <stdint.h>
+
+// ABI v3 value layouts for the X07 C backend.
+// Normative spec: labs/internal-docs/spec/abi/abi-v3.md
+//
+// v3 changes `bytes` only: payloads of up to EV_BYTES_V3_SMALL_CAP bytes are
+// stored inline (no heap allocation, no header, no free on drop). Longer
+// payloads keep the v2 (ptr,len) heap representation. All other value layouts
+// are unchanged from ABI v2.
+
+#define EV_BYTES_V3_TAG_HEAP UINT32_C(0)
+#define EV_BYTES_V3_TAG_SMALL UINT32_C(1)
+
+#define EV_BYTES_V3_SMALL_CAP 16u
+
+typedef struct {
+  uint32_t tag;
+  union {
+    struct {
+      uint32_t len;
+      uint8_t data[EV_BYTES_V3_SMALL_CAP];
+    } small;
+    struct {
+      uint8_t* ptr;
+      uint32_t len;
+    } heap;
+  } repr;
+} ev_bytes_v3_t;
+
+typedef struct {
+  uint32_t tag;
+  ev_bytes_v3_t payload;
+} ev_option_bytes_v3_t;
+
+typedef struct {
+  uint32_t tag;
+  union {
+    ev_bytes_v3_t ok;
+    uint32_t err;
+  } payload;
+} ev_result_bytes_v3_t;
+
+#endif
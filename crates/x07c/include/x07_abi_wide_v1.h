@@ -0,0 +1,50 @@
+#ifndef X07_ABI_WIDE_V1_H
+#define X07_ABI_WIDE_V1_H
+
+#include <stdint.h>
+
+// Wide ABI v1 value layouts for the X07 C backend.
+// Normative spec: labs/internal-docs/spec/abi/abi-wide-v1.md
+//
+// The wide profile widens lengths, capacities, and heap offsets to 64 bits
+// so a single solve-function can own buffers larger than 4 GiB. Semantics
+// (ownership, borrowing, canonical empty values) are those of ABI v2; only
+// field widths change. The profile is opt-in and whole-program: wide and
+// narrow values never mix in one binary.
+
+typedef struct {
+  uint8_t* ptr;
+  uint64_t len;
+} ev_bytes_wide_v1_t;
+
+typedef struct {
+  uint8_t* ptr;
+  uint64_t len;
+#ifdef X07_DEBUG_BORROW
+  uint64_t aid;
+  uint64_t bid;
+  uint64_t off_bytes;
+#endif
+} ev_bytes_view_wide_v1_t;
+
+typedef struct {
+  uint8_t* data;
+  uint64_t len;
+  uint64_t cap;
+#ifdef X07_DEBUG_BORROW
+  uint64_t dbg_aid;
+#endif
+} ev_vec_u8_wide_v1_t;
+
+// Heap block header for the wide runtime profile. Mirrors the generated
+// runtime's heap_hdr_t with 64-bit sizes and offsets; sized to a multiple
+// of the 16-byte heap alignment so payloads stay aligned.
+typedef struct {
+  uint64_t size;
+  uint64_t next_off;
+  uint32_t magic;
+  uint32_t pad;
+  uint64_t req_size;
+} ev_heap_hdr_wide_v1_t;
+
+#endif
@@ -0,0 +1,30 @@
+#ifndef X07_ALLOC_ABI_V1_H
+#define X07_ALLOC_ABI_V1_H
+
+/* X07 allocator backend ABI v1.
+ *
+ * libx07_alloc.a provides a strong definition of the runtime's weak
+ * x07_custom_allocator() hook (allocator ABI v1, see
+ * docs/spec/abi/allocator-v1.md). Linking the library swaps the generated
+ * runtime's default deterministic heap for an arena whose backing pages can
+ * be transparent-huge-page-backed and/or pinned to a NUMA node.
+ *
+ * Runtime configuration (read once at startup):
+ *   X07_ALLOC_BACKEND   thp (default) | numa:<node> | off
+ *   X07_ALLOC_ARENA_CAP arena capacity in bytes (default 1 GiB)
+ *   X07_ALLOC_THP       set to 0 to skip MADV_HUGEPAGE
+ */
+
+#include "x07_abi_v2.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ev_allocator_v1_t x07_custom_allocator(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* X07_ALLOC_ABI_V1_H */
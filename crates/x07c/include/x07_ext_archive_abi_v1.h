@@ -48,6 +48,32 @@ ev_bytes x07_ext_archive_zip_extract_to_fs_v1(
     ev_bytes profile_id
 );
 
+// v1 reader-based extract variants. The callback has the same shape as the
+// runtime's io-reader vtable read fn: fill up to cap bytes at dst and
+// return the count produced, with 0 meaning end of stream. Call sites wrap
+// a runtime reader (e.g. an http or socket stream) in a callback of this
+// shape so extraction overlaps the transfer with bounded memory; caps_read
+// bounds the total bytes pulled off the stream.
+typedef uint32_t (*x07_ext_archive_read_fn_v1)(uint32_t data, uint8_t* dst, uint32_t cap);
+
+ev_bytes x07_ext_archive_tar_extract_reader_to_fs_v1(
+    ev_bytes out_root,
+    x07_ext_archive_read_fn_v1 read_fn,
+    uint32_t read_data,
+    ev_bytes caps_read,
+    ev_bytes caps_write,
+    ev_bytes profile_id
+);
+
+ev_bytes x07_ext_archive_tgz_extract_reader_to_fs_v1(
+    ev_bytes out_root,
+    x07_ext_archive_read_fn_v1 read_fn,
+    uint32_t read_data,
+    ev_bytes caps_read,
+    ev_bytes caps_write,
+    ev_bytes profile_id
+);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -29,6 +29,35 @@ ev_bytes x07_ext_db_pg_query_v1(ev_bytes req, ev_bytes caps);
 ev_bytes x07_ext_db_pg_exec_v1(ev_bytes req, ev_bytes caps);
 ev_bytes x07_ext_db_pg_close_v1(ev_bytes req, ev_bytes caps);
 
+// v1 prepared-statement entrypoints. prepare plans the SQL server-side
+// once ("X7PP" req: magic, ver u32_le=1, conn_id u32_le, flags u32_le=0,
+// sql_len u32_le, sql) and returns a stmt_id u32_le payload; stmt_query
+// ("X7PR") and stmt_exec ("X7PX") take (magic, ver, stmt_id, flags=0,
+// params_len, params_doc) and run the resident statement, skipping the
+// per-call prepare round-trip. finalize ("X7PF": magic, ver, stmt_id)
+// frees the slot; statements are dropped automatically when their
+// connection is closed. A dead or unknown stmt_id yields
+// DB_ERR_BAD_STMT (53252).
+ev_bytes x07_ext_db_pg_prepare_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_pg_stmt_query_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_pg_stmt_exec_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_pg_finalize_v1(ev_bytes req, ev_bytes caps);
+
+// v1 bulk ingestion (COPY FROM STDIN, binary format). copy_begin ("X7PC"
+// req: magic, ver u32_le=1, conn_id u32_le, flags u32_le=0, table_len
+// u32_le, table, col_count u32_le, then col_count [u32_le len][name]
+// frames) issues COPY ... WITH (FORMAT binary) and returns a copy_id
+// u32_le payload; the backend writes the PGCOPY header/trailer itself.
+// copy_write ("X7PW": magic, ver, copy_id, flags=0, data_len, data)
+// streams packed binary row tuples (u16_be field count, then i32_be
+// length + bytes per field); copy_finish ("X7PD": magic, ver, copy_id)
+// completes the load and returns the usual exec doc with rows_affected.
+// A failed or timed-out copy evicts the owning connection, which cannot
+// be resynced out of copy mode.
+ev_bytes x07_ext_db_pg_copy_begin_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_pg_copy_write_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_pg_copy_finish_v1(ev_bytes req, ev_bytes caps);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
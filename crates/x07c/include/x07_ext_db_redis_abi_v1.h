@@ -28,6 +28,17 @@ ev_bytes x07_ext_db_redis_open_v1(ev_bytes req, ev_bytes caps);
 ev_bytes x07_ext_db_redis_cmd_v1(ev_bytes req, ev_bytes caps);
 ev_bytes x07_ext_db_redis_close_v1(ev_bytes req, ev_bytes caps);
 
+// v1 pipelined batch entrypoint. The "X7RB" req (magic, ver u32_le=1,
+// flags u32_le=0, conn_id u32_le, window u32_le, count u32_le, then count
+// frames of [u32_le len][X7RV argv doc]) writes commands in chunks of
+// `window` (0 = all at once) with a single flush per chunk and reads the
+// replies back in order, collapsing count round trips into one per chunk.
+// The ok doc is a seq with one [ok bool, value-or-error-string] pair per
+// command; per-command redis errors are reported in-band so the rest of
+// the batch still completes. The batch counts as `count` commands against
+// the query budget.
+ev_bytes x07_ext_db_redis_pipeline_v1(ev_bytes req, ev_bytes caps);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
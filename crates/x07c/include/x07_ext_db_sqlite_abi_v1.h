@@ -29,6 +29,19 @@ ev_bytes x07_ext_db_sqlite_query_v1(ev_bytes req, ev_bytes caps);
 ev_bytes x07_ext_db_sqlite_exec_v1(ev_bytes req, ev_bytes caps);
 ev_bytes x07_ext_db_sqlite_close_v1(ev_bytes req, ev_bytes caps);
 
+// v1 prepared-statement entrypoints. prepare parses and plans the SQL
+// once ("X7SP" req: magic, ver u32_le=1, conn_id u32_le, flags u32_le=0,
+// sql_len u32_le, sql) and returns a stmt_id u32_le payload; stmt_query
+// ("X7SR") and stmt_exec ("X7SX") take (magic, ver, stmt_id, flags=0,
+// params_len, params_doc) and run the resident statement, paying only
+// bind + step per call. finalize ("X7SF": magic, ver, stmt_id) frees the
+// slot; statements are finalized automatically when their connection is
+// closed. A dead or unknown stmt_id yields DB_ERR_BAD_STMT (53252).
+ev_bytes x07_ext_db_sqlite_prepare_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_sqlite_stmt_query_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_sqlite_stmt_exec_v1(ev_bytes req, ev_bytes caps);
+ev_bytes x07_ext_db_sqlite_finalize_v1(ev_bytes req, ev_bytes caps);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
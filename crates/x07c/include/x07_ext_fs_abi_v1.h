@@ -57,6 +57,23 @@ ev_result_i32 x07_ext_fs_stream_write_all_v1(int32_t writer_handle, ev_bytes dat
 ev_result_i32 x07_ext_fs_stream_close_v1(int32_t writer_handle);
 int32_t x07_ext_fs_stream_drop_v1(int32_t writer_handle);
 
+// v1 mmap view API used by os.fs.view_* builtins. A view is a read-only,
+// page-cache-backed mapping of a whole file: the bytes come straight out
+// of the mapping with no copy into runtime memory, and stay valid until
+// the view is released. Views count against max_read_bytes like reads.
+ev_result_i32 x07_ext_fs_view_open_v1(ev_bytes path, ev_bytes caps);
+ev_bytes x07_ext_fs_view_bytes_v1(int32_t view_handle); // {NULL,0} on bad handle
+int32_t x07_ext_fs_view_release_v1(int32_t view_handle);
+
+// v1 streaming walk handle API used by os.fs.walk_* builtins. Entries
+// come out in the same sorted order as walk_glob_sorted_text_v1, one
+// newline-terminated line per entry and at most max_entries lines per
+// call (<=0 picks a default batch); an empty payload means the walk is
+// exhausted.
+ev_result_i32 x07_ext_fs_walk_open_v1(ev_bytes root, ev_bytes glob, ev_bytes caps);
+ev_result_bytes x07_ext_fs_walk_next_v1(int32_t walk_handle, int32_t max_entries);
+int32_t x07_ext_fs_walk_drop_v1(int32_t walk_handle);
+
 // v1 streaming read handle API used by os.fs.stream_* builtins.
 ev_result_i32 x07_ext_fs_stream_open_read_v1(ev_bytes path, ev_bytes caps);
 ev_result_bytes x07_ext_fs_stream_read_some_v1(int32_t reader_handle, int32_t max_bytes);
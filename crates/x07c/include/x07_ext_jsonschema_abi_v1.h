@@ -27,6 +27,26 @@ void ev_trap(int32_t code);
 ev_bytes x07_ext_jsonschema_compile_v1(ev_bytes schema_json);
 ev_bytes x07_ext_jsonschema_validate_v1(ev_bytes compiled, ev_bytes instance_json);
 
+// v1 handle-based API. handle_compile returns a 10-byte ok doc
+// [1]["X7JS"][ver][handle u32_le] (or the usual compile err doc); the
+// validator stays resident in the backend, so handle_validate skips the
+// per-call compiled-blob parse and table lookup by token. handle_drop
+// frees the slot (returns 1 if a validator was dropped); slot numbers
+// may be reused by later compiles.
+ev_bytes x07_ext_jsonschema_handle_compile_v1(ev_bytes schema_json);
+ev_bytes x07_ext_jsonschema_handle_validate_v1(int32_t schema_handle, ev_bytes instance_json);
+int32_t x07_ext_jsonschema_handle_drop_v1(int32_t schema_handle);
+
+// v1 batch validation. instances is count_i32 packed frames of
+// [u32_le len][instance_json]; the whole batch runs against one resident
+// validator in a single call. The ok doc is [1]["X7JB"][ver=1]
+// [count u32_le] followed by one row per instance:
+// [u8 tag][u32_le code][u32_le errors_len][errors_json], where tag 1
+// means valid (code/len 0) and tag 0 carries the same code + errors JSON
+// a single validate would return. Framing errors and a dead handle fail
+// the whole batch with the usual validate err doc.
+ev_bytes x07_ext_jsonschema_validate_batch_v1(int32_t schema_handle, ev_bytes instances, int32_t count_i32);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -24,6 +24,13 @@ ev_bytes ev_bytes_alloc(uint32_t len);
 void ev_trap(int32_t code);
 
 // v1 entrypoint used by os.obj.s3.dispatch_v1.
+//
+// Ops 6 (get_multi) and 7 (put_multi) are the concurrent multipart
+// transfers. Both carry [part_size u32_le][concurrency u32_le] at the
+// front of the request body (0 = backend default); put_multi's payload
+// follows the params. get_multi fetches byte ranges in parallel and
+// returns the assembled object; put_multi uploads part_size slices of
+// the payload concurrently through the S3 multipart upload protocol.
 ev_bytes x07_obj_s3_dispatch_v1(ev_bytes req, ev_bytes caps);
 
 #ifdef __cplusplus
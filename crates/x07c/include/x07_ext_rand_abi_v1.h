@@ -35,6 +35,19 @@ void ev_trap(int32_t code);
 ev_result_bytes x07_ext_rand_bytes_v1(int32_t n, ev_bytes caps);
 ev_result_bytes x07_ext_rand_u64_v1(ev_bytes caps);
 
+// v1 buffered pool mode. pool_open seeds a counter-mode DRBG (ChaCha20
+// keystream) from OS entropy and returns a 4-byte pool handle payload;
+// the caps gate is applied once here and the resulting per-call byte
+// limit is enforced on every pool read. pool_bytes/pool_u64 serve from a
+// large in-process buffer refilled by the DRBG, which is re-keyed from
+// OS entropy every reseed_interval_bytes output bytes (0 = backend
+// default). pool_close frees the slot (returns 1 if a pool was dropped);
+// slot numbers may be reused by later opens.
+ev_result_bytes x07_ext_rand_pool_open_v1(int32_t reseed_interval_bytes, ev_bytes caps);
+ev_result_bytes x07_ext_rand_pool_bytes_v1(int32_t pool_handle, int32_t n);
+ev_result_bytes x07_ext_rand_pool_u64_v1(int32_t pool_handle);
+int32_t x07_ext_rand_pool_close_v1(int32_t pool_handle);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
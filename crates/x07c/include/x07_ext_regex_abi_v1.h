@@ -31,6 +31,33 @@ ev_bytes x07_ext_regex_find_all_x7sl_v1(ev_bytes compiled, ev_bytes text, int32_
 ev_bytes x07_ext_regex_split_v1(ev_bytes compiled, ev_bytes text, int32_t max_parts_i32);
 ev_bytes x07_ext_regex_replace_all_v1(ev_bytes compiled, ev_bytes text, ev_bytes repl, int32_t cap_limit_i32);
 
+// v1 handle-based API. handle_compile returns a 5-byte ok doc
+// [1, handle u32_le] (or the usual 9-byte err doc); the program stays
+// resident in the backend with its scratch state, so repeated exec/find/
+// split/replace calls pay only for the automaton run — no per-call
+// token validation or cache setup. handle_drop frees the slot (returns 1
+// if a program was dropped); slot numbers may be reused by later compiles.
+ev_bytes x07_ext_regex_handle_compile_v1(ev_bytes pat, int32_t opts_u32);
+ev_bytes x07_ext_regex_handle_exec_v1(int32_t regex_handle, ev_bytes text, int32_t start_i32);
+ev_bytes x07_ext_regex_handle_exec_caps_v1(int32_t regex_handle, ev_bytes text, int32_t start_i32);
+ev_bytes x07_ext_regex_handle_find_all_x7sl_v1(int32_t regex_handle, ev_bytes text, int32_t max_matches_i32);
+ev_bytes x07_ext_regex_handle_split_v1(int32_t regex_handle, ev_bytes text, int32_t max_parts_i32);
+ev_bytes x07_ext_regex_handle_replace_all_v1(int32_t regex_handle, ev_bytes text, ev_bytes repl, int32_t cap_limit_i32);
+int32_t x07_ext_regex_handle_drop_v1(int32_t regex_handle);
+
+// v1 pattern-set API. set_compile takes count_i32 patterns framed as
+// [u32_le len][bytes] each, compiled into one combined automaton so a
+// scan is a single pass over the text regardless of set size; on ok it
+// returns [1, set_handle u32_le], on error the usual 9-byte err doc with
+// the pos field carrying the index of the failing pattern. set_scan
+// returns an X7SL doc with version 2 and 12-byte rows
+// (pattern u32_le, start u32_le, len u32_le): non-overlapping
+// leftmost-longest matches in text order, each tagged with the pattern
+// that won. set_drop frees the slot (returns 1 if a set was dropped).
+ev_bytes x07_ext_regex_set_compile_v1(ev_bytes pats, int32_t count_i32, int32_t opts_u32);
+ev_bytes x07_ext_regex_set_scan_x7sl_v1(int32_t set_handle, ev_bytes text, int32_t max_matches_i32);
+int32_t x07_ext_regex_set_drop_v1(int32_t set_handle);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
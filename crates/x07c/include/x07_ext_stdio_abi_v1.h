@@ -46,6 +46,26 @@ ev_result_i32 x07_ext_stdio_write_stderr_v1(ev_bytes data, ev_bytes caps);
 ev_result_i32 x07_ext_stdio_flush_stdout_v1(void);
 ev_result_i32 x07_ext_stdio_flush_stderr_v1(void);
 
+// v1 vectored write. slices is packed [u32_le len][bytes] frames; the
+// frames are concatenated and reach the stream as a single write, with
+// the caps gate applied once to the total byte count. Returns the total
+// bytes written.
+ev_result_i32 x07_ext_stdio_write_vec_stdout_v1(ev_bytes slices, ev_bytes caps);
+ev_result_i32 x07_ext_stdio_write_vec_stderr_v1(ev_bytes slices, ev_bytes caps);
+
+// v1 buffered writer. buf_set enables buffered mode for the stream and
+// applies the caps gate once (watermark_bytes 0 = backend default of
+// 64 KiB); buf_write then appends without per-call caps handling and
+// auto-flushes when the buffer reaches the high watermark. buf_flush
+// drains the buffer immediately. buf_write on an unconfigured stream
+// fails with the disabled error.
+ev_result_i32 x07_ext_stdio_buf_set_stdout_v1(int32_t watermark_bytes, ev_bytes caps);
+ev_result_i32 x07_ext_stdio_buf_set_stderr_v1(int32_t watermark_bytes, ev_bytes caps);
+ev_result_i32 x07_ext_stdio_buf_write_stdout_v1(ev_bytes data);
+ev_result_i32 x07_ext_stdio_buf_write_stderr_v1(ev_bytes data);
+ev_result_i32 x07_ext_stdio_buf_flush_stdout_v1(void);
+ev_result_i32 x07_ext_stdio_buf_flush_stderr_v1(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
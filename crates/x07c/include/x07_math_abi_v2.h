@@ -0,0 +1,66 @@
+#ifndef X07_MATH_ABI_V2_H
+#define X07_MATH_ABI_V2_H
+
+// X07 Math Backend ABI (v2): pass-by-value scalar fast path.
+//
+// This header is *pinned* and is intended to be included by:
+//  - the generated C produced by x07c (call sites)
+//  - the native math backend library implementation (libx07_math.a)
+//
+// v2 is an additive extension of v1 (x07_math_abi_v1.h); both symbol sets
+// ship in the same library. The arithmetic builtins cross the boundary as
+// plain `double` (and `uint32_t` where applicable), so a call costs no
+// allocation and no byte (de)serialization. The bytes encoding remains the
+// contract for everything value-shaped (parse/format, conversions, cmp),
+// which stays on v1.
+//
+// Encoding responsibilities move to the caller:
+//  - The generated runtime decodes 8-byte little-endian f64 operands before
+//    the call (trapping on wrong length) and re-encodes the result after.
+//  - When storing a result back to bytes, the caller must canonicalize NaN
+//    to the quiet NaN bit pattern 0x7ff8000000000000, so the stored bytes
+//    are bit-for-bit identical to what the v1 entrypoints produce.
+//
+// The backend functions themselves are pure: no runtime hooks, no traps.
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- f64 arithmetic ---
+
+double ev_math_f64_add_v2(double a, double b);
+double ev_math_f64_sub_v2(double a, double b);
+double ev_math_f64_mul_v2(double a, double b);
+double ev_math_f64_div_v2(double a, double b);
+
+// --- f64 unary ops ---
+
+double ev_math_f64_neg_v2(double x);
+double ev_math_f64_abs_v2(double x);
+double ev_math_f64_tan_v2(double x);
+double ev_math_f64_sqrt_v2(double x);
+double ev_math_f64_floor_v2(double x);
+double ev_math_f64_ceil_v2(double x);
+
+// --- f64 transcendentals ---
+
+double ev_math_f64_sin_v2(double x);
+double ev_math_f64_cos_v2(double x);
+double ev_math_f64_exp_v2(double x);
+double ev_math_f64_ln_v2(double x);
+double ev_math_f64_pow_v2(double x, double y);
+double ev_math_f64_atan2_v2(double y, double x);
+
+// min/max keep the v1 rule: if either operand is NaN the result is NaN,
+// otherwise the smaller/larger operand.
+double ev_math_f64_min_v2(double a, double b);
+double ev_math_f64_max_v2(double a, double b);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // X07_MATH_ABI_V2_H
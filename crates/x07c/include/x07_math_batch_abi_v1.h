@@ -0,0 +1,86 @@
+#ifndef X07_MATH_BATCH_ABI_V1_H
+#define X07_MATH_BATCH_ABI_V1_H
+
+// X07 Math Backend batch ABI (v1): kernels over packed f64 arrays.
+//
+// This header is *pinned* and is intended to be included by:
+//  - the generated C produced by x07c (call sites)
+//  - the native math backend library implementation (libx07_math.a)
+//
+// Arrays are encoded as ev_bytes holding N packed little-endian IEEE-754
+// binary64 values (len = 8*N, N >= 0). One call applies an operation across
+// the whole array, so data-parallel math pays the backend-call cost once
+// per array instead of once per element, and the backend is free to use
+// vectorized kernels internally.
+//
+// All functions below:
+//  - TRAP with EV_TRAP_MATH_BATCH_BADLEN if an input length is not a
+//    multiple of 8 (or an input is empty where noted).
+//  - TRAP with EV_TRAP_MATH_BATCH_MISMATCH if operand lengths differ.
+//  - Allocate output bytes via ev_bytes_alloc().
+//  - Canonicalize NaN results to 0x7ff8000000000000 on store, matching the
+//    scalar entrypoints.
+
+#include "x07_math_abi_v1.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// --- Trap codes (extends the math backend's reserved range) ---
+
+enum {
+  EV_TRAP_MATH_BATCH_BADLEN   = 9110,  // len not a multiple of 8 / empty
+  EV_TRAP_MATH_BATCH_MISMATCH = 9111,  // operand lengths differ
+  EV_TRAP_MATH_BATCH_X7SL     = 9112   // malformed X7SL / slice out of base
+};
+
+// --- elementwise binary ops (a.len == b.len, result same length) ---
+
+ev_bytes ev_math_f64_arr_add_v1(ev_bytes a, ev_bytes b);
+ev_bytes ev_math_f64_arr_sub_v1(ev_bytes a, ev_bytes b);
+ev_bytes ev_math_f64_arr_mul_v1(ev_bytes a, ev_bytes b);
+ev_bytes ev_math_f64_arr_div_v1(ev_bytes a, ev_bytes b);
+
+// out[i] = a[i] * b[i] + c[i], with a single rounding (fused).
+ev_bytes ev_math_f64_arr_fma_v1(ev_bytes a, ev_bytes b, ev_bytes c);
+
+// --- elementwise maps (result same length as input) ---
+
+ev_bytes ev_math_f64_arr_neg_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_abs_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_sqrt_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_sin_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_cos_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_tan_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_exp_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_ln_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_floor_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_ceil_v1(ev_bytes x);
+
+// --- reductions (input must be non-empty; result is one f64 as 8 bytes) ---
+
+// min/max keep the scalar v1 rule: if any element is NaN the result is NaN.
+ev_bytes ev_math_f64_arr_min_v1(ev_bytes x);
+ev_bytes ev_math_f64_arr_max_v1(ev_bytes x);
+
+// --- batch text interop ---
+
+// Parse every slice of `base` described by the X7SL v1 list `x7sl`
+// (docs/text/x7sl-v1.md) with the math.f64.parse_v1 grammar, returning the
+// values as one packed f64 array (8 * count bytes). Returns Err with the
+// scalar SPEC_ERR_F64_PARSE_* code of the first failing slice. Malformed
+// X7SL framing or a slice outside `base` traps EV_TRAP_MATH_BATCH_X7SL.
+ev_result_bytes ev_math_f64_arr_parse_v1(ev_bytes base, ev_bytes x7sl);
+
+// Format a packed f64 array with the math.f64.fmt_shortest_v1 rules, one
+// value per line ('\n' after each, including the last). The output never
+// contains other newlines, so std.text.ascii.split_lines_view recovers the
+// individual strings as an X7SL slice list.
+ev_bytes ev_math_f64_arr_fmt_shortest_v1(ev_bytes x);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+#endif // X07_MATH_BATCH_ABI_V1_H
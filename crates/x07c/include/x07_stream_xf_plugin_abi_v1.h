@@ -52,6 +52,10 @@ typedef struct {
   uint32_t max_scratch_bytes;
 } x07_xf_budget_v1;
 
+// Note: when the wrapper fuses composed stages, emit_commit/emit_view may
+// run the downstream stage synchronously on the emitted bytes and return its
+// error code. Plugins must treat any nonzero emit return code as fatal for
+// the current call and propagate it from step/step_batch/flush.
 typedef struct x07_xf_emit_v1 {
   void* emit_ctx;
   int32_t (*emit_alloc)(void* emit_ctx, uint32_t cap, x07_out_buf_v1* out);
@@ -107,6 +111,38 @@ typedef struct x07_stream_xf_plugin_v1 {
 #define X07_XF_FLAG_NONDET_OS_ONLY     (1u << 1)
 #define X07_XF_FLAG_CFG_CANON_JSON     (1u << 2)
 
+// --- Plugin descriptor (v2): batched step ---
+//
+// v2 extends v1 with an optional `step_batch` lifecycle function so the
+// wrapper can deliver many input items per plugin call instead of paying a
+// full dispatch + emit-callback round trip per item. A v2 plugin sets
+// `base.abi_version = 2` and keeps every v1 field valid: `base.step` remains
+// mandatory and must behave identically to `step_batch` with a single item.
+//
+// `step_batch` semantics:
+//  - `in_items`/`in_count` describe the batch; items are delivered in order
+//    and each view stays valid for the duration of the call.
+//  - The emit interface is shared across the whole batch, and the
+//    `x07_xf_budget_v1` out limits (max_out_bytes_per_step /
+//    max_out_items_per_step) are applied per *batch call*, not per item.
+//  - `emit_view` with view_kind 1 (input) resolves against the wrapper's
+//    batch input buffer, which contains every item's payload.
+//  - A NULL `step_batch` is valid; the wrapper then loops `base.step` over
+//    the items with the same shared emit interface and per-batch budgets.
+
+typedef struct x07_stream_xf_plugin_v2 {
+  x07_stream_xf_plugin_v1 base; // base.abi_version == 2
+
+  // Optional batched step (may be NULL).
+  int32_t (*step_batch)(
+    void* state,
+    x07_scratch_v1* scratch,
+    const x07_bytes_view_v1* in_items,
+    uint32_t in_count,
+    x07_xf_emit_v1 emit,
+    x07_xf_budget_v1 budget);
+} x07_stream_xf_plugin_v2;
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -40,6 +40,22 @@ ev_bytes ev_time_tzdb_offset_duration_v1(ev_bytes tzid, int32_t unix_s_lo, int32
 // Return a pinned snapshot id string like "tzdb-2025c".
 ev_bytes ev_time_tzdb_snapshot_id_v1(void);
 
+// v1 zone-handle API. zone_open resolves a tzid once and returns a small
+// positive handle (0 = invalid tzid); offset lookups through the handle
+// skip the per-call tzid parse and go straight to the binary search over
+// the zone's transition table. zone_drop frees the slot (returns 1 if a
+// zone was dropped); slot numbers may be reused by later opens.
+int32_t ev_time_tzdb_zone_open_v1(ev_bytes tzid);
+ev_bytes ev_time_tzdb_zone_offset_duration_v1(int32_t zone_handle, int32_t unix_s_lo, int32_t unix_s_hi);
+int32_t ev_time_tzdb_zone_drop_v1(int32_t zone_handle);
+
+// Batch offset lookup: unix_s_packed is a packed array of i64_le unix
+// seconds. On success the result is [u8 1] followed by one i32_le UTC
+// offset (seconds) per input value, in order; on failure it is the usual
+// 9-byte duration error doc (whole batch fails on a bad handle, a
+// misaligned input, or any out-of-range timestamp).
+ev_bytes ev_time_tzdb_zone_offsets_batch_v1(int32_t zone_handle, ev_bytes unix_s_packed);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -704,6 +704,7 @@ struct Emitter<'a> {
     out: String,
     suppress_output: bool,
     indent: usize,
+    fuel_pending: u64,
     tmp_counter: u32,
     local_count: usize,
     scopes: Vec<BTreeMap<String, VarRef>>,
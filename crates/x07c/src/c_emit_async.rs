@@ -1745,6 +1745,396 @@ impl<'a> Emitter<'a> {
                     return Ok(());
                 }
 
+                if head == "__internal.stream_xf.plugin_step_batch_v1" {
+                    if args.len() != 9 {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Parse,
+                            "__internal.stream_xf.plugin_step_batch_v1 expects 9 args".to_string(),
+                        ));
+                    }
+                    if dest.ty != Ty::ResultBytes {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            "__internal.stream_xf.plugin_step_batch_v1 returns result_bytes"
+                                .to_string(),
+                        ));
+                    }
+
+                    let backend_id = self.parse_bytes_lit_text_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 backend_id",
+                        &args[0],
+                    )?;
+                    crate::validate::validate_symbol(&backend_id)
+                        .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+                    let abi_major_i32 = self.parse_i32_lit_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 abi_major",
+                        &args[1],
+                    )?;
+                    let abi_major = u32::try_from(abi_major_i32).unwrap_or(0);
+                    if abi_major == 0 {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            "__internal.stream_xf.plugin_step_batch_v1 abi_major must be >= 1"
+                                .to_string(),
+                        ));
+                    }
+
+                    let export_symbol = self.parse_bytes_lit_text_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 export_symbol",
+                        &args[2],
+                    )?;
+                    crate::validate::validate_local_name(&export_symbol)
+                        .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+                    self.require_native_backend(&backend_id, abi_major, &export_symbol)?;
+
+                    let state_b = self.lookup_borrowed_bytes_ident_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 state",
+                        &args[3],
+                    )?;
+                    let scratch_b = self.lookup_borrowed_bytes_ident_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 scratch",
+                        &args[4],
+                    )?;
+
+                    let max_out_bytes_per_step = self.parse_i32_lit_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 max_out_bytes_per_step",
+                        &args[5],
+                    )?;
+                    let max_out_items_per_step = self.parse_i32_lit_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 max_out_items_per_step",
+                        &args[6],
+                    )?;
+                    let max_out_buf_bytes = self.parse_i32_lit_arg(
+                        "__internal.stream_xf.plugin_step_batch_v1 max_out_buf_bytes",
+                        &args[7],
+                    )?;
+                    if max_out_bytes_per_step < 0
+                        || max_out_items_per_step < 0
+                        || max_out_buf_bytes < 0
+                    {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            "__internal.stream_xf.plugin_step_batch_v1 limits must be >= 0"
+                                .to_string(),
+                        ));
+                    }
+
+                    let batch_tmp = self.alloc_local("t_xf_in_", Ty::BytesView)?;
+                    let expr_state = self.new_state();
+                    let after = self.new_state();
+                    self.line(state, format!("goto st_{expr_state};"));
+                    self.emit_expr_entry(expr_state, &args[8], batch_tmp.clone(), after)?;
+
+                    self.line(after, "rt_fuel(ctx, 1);");
+                    self.line(
+                        after,
+                        format!("extern x07_stream_xf_plugin_v1 {export_symbol};"),
+                    );
+                    self.line(after, format!(
+                        "{} = rt_stream_xf_plugin_step_batch_v1(ctx, &{export_symbol}, UINT32_C({abi_major}), {}, {}, (uint32_t){max_out_bytes_per_step}, (uint32_t){max_out_items_per_step}, (uint32_t){max_out_buf_bytes}, {});",
+                        dest.c_name,
+                        state_b.c_name,
+                        scratch_b.c_name,
+                        batch_tmp.c_name,
+                    ));
+                    self.line(after, format!("goto st_{cont};"));
+                    return Ok(());
+                }
+
+                if head == "__internal.stream_xf.plugin_chain_step_v1"
+                    || head == "__internal.stream_xf.plugin_chain_flush_v1"
+                {
+                    let is_step = head == "__internal.stream_xf.plugin_chain_step_v1";
+                    let stage_args = if is_step {
+                        args.len().checked_sub(1)
+                    } else {
+                        Some(args.len())
+                    };
+                    let n_stages = match stage_args {
+                        Some(sa) if sa >= 8 && sa % 8 == 0 => sa / 8,
+                        _ => {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                format!(
+                                    "{head} expects 8 args per stage (plus the input for step)"
+                                ),
+                            ));
+                        }
+                    };
+                    if dest.ty != Ty::ResultBytes {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            format!("{head} returns result_bytes"),
+                        ));
+                    }
+
+                    struct ChainStage {
+                        abi_major: u32,
+                        export_symbol: String,
+                        state: String,
+                        scratch: String,
+                        max_out_bytes_per_step: i32,
+                        max_out_items_per_step: i32,
+                        max_out_buf_bytes: i32,
+                    }
+                    let mut stages: Vec<ChainStage> = Vec::with_capacity(n_stages);
+                    for s in 0..n_stages {
+                        let base = s * 8;
+                        let backend_id = self
+                            .parse_bytes_lit_text_arg(&format!("{head} backend_id"), &args[base])?;
+                        crate::validate::validate_symbol(&backend_id).map_err(|message| {
+                            CompilerError::new(CompileErrorKind::Typing, message)
+                        })?;
+                        let abi_major_i32 =
+                            self.parse_i32_lit_arg(&format!("{head} abi_major"), &args[base + 1])?;
+                        let abi_major = u32::try_from(abi_major_i32).unwrap_or(0);
+                        if abi_major == 0 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} abi_major must be >= 1"),
+                            ));
+                        }
+                        let export_symbol = self.parse_bytes_lit_text_arg(
+                            &format!("{head} export_symbol"),
+                            &args[base + 2],
+                        )?;
+                        crate::validate::validate_local_name(&export_symbol).map_err(
+                            |message| CompilerError::new(CompileErrorKind::Typing, message),
+                        )?;
+
+                        self.require_native_backend(&backend_id, abi_major, &export_symbol)?;
+
+                        let state_b = self.lookup_borrowed_bytes_ident_arg(
+                            &format!("{head} state"),
+                            &args[base + 3],
+                        )?;
+                        let scratch_b = self.lookup_borrowed_bytes_ident_arg(
+                            &format!("{head} scratch"),
+                            &args[base + 4],
+                        )?;
+                        let max_out_bytes_per_step = self.parse_i32_lit_arg(
+                            &format!("{head} max_out_bytes_per_step"),
+                            &args[base + 5],
+                        )?;
+                        let max_out_items_per_step = self.parse_i32_lit_arg(
+                            &format!("{head} max_out_items_per_step"),
+                            &args[base + 6],
+                        )?;
+                        let max_out_buf_bytes = self.parse_i32_lit_arg(
+                            &format!("{head} max_out_buf_bytes"),
+                            &args[base + 7],
+                        )?;
+                        if max_out_bytes_per_step < 0
+                            || max_out_items_per_step < 0
+                            || max_out_buf_bytes < 0
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} limits must be >= 0"),
+                            ));
+                        }
+                        stages.push(ChainStage {
+                            abi_major,
+                            export_symbol,
+                            state: state_b.c_name.clone(),
+                            scratch: scratch_b.c_name.clone(),
+                            max_out_bytes_per_step,
+                            max_out_items_per_step,
+                            max_out_buf_bytes,
+                        });
+                    }
+
+                    let (call_state, input_tmp) = if is_step {
+                        let input_tmp = self.alloc_local("t_xf_in_", Ty::BytesView)?;
+                        let expr_state = self.new_state();
+                        let after = self.new_state();
+                        self.line(state, format!("goto st_{expr_state};"));
+                        self.emit_expr_entry(
+                            expr_state,
+                            &args[args.len() - 1],
+                            input_tmp.clone(),
+                            after,
+                        )?;
+                        (after, Some(input_tmp))
+                    } else {
+                        (state, None)
+                    };
+
+                    self.line(call_state, "rt_fuel(ctx, 1);");
+                    self.line(call_state, "{");
+                    for st in &stages {
+                        self.line(
+                            call_state,
+                            format!("extern x07_stream_xf_plugin_v1 {};", st.export_symbol),
+                        );
+                    }
+                    self.line(
+                        call_state,
+                        format!("rt_stream_xf_chain_stage_v1 xf_chain[{n_stages}];"),
+                    );
+                    for (i, st) in stages.iter().enumerate() {
+                        self.line(
+                            call_state,
+                            format!("xf_chain[{i}].p = &{};", st.export_symbol),
+                        );
+                        self.line(
+                            call_state,
+                            format!("xf_chain[{i}].abi_major = UINT32_C({});", st.abi_major),
+                        );
+                        self.line(call_state, format!("xf_chain[{i}].state_b = {};", st.state));
+                        self.line(
+                            call_state,
+                            format!("xf_chain[{i}].scratch_b = {};", st.scratch),
+                        );
+                        self.line(
+                            call_state,
+                            format!(
+                                "xf_chain[{i}].max_out_bytes_per_step = (uint32_t){};",
+                                st.max_out_bytes_per_step
+                            ),
+                        );
+                        self.line(
+                            call_state,
+                            format!(
+                                "xf_chain[{i}].max_out_items_per_step = (uint32_t){};",
+                                st.max_out_items_per_step
+                            ),
+                        );
+                        self.line(
+                            call_state,
+                            format!(
+                                "xf_chain[{i}].max_out_buf_bytes = (uint32_t){};",
+                                st.max_out_buf_bytes
+                            ),
+                        );
+                    }
+                    if let Some(input_tmp) = &input_tmp {
+                        self.line(call_state, format!(
+                            "{} = rt_stream_xf_plugin_chain_step_v1(ctx, xf_chain, UINT32_C({n_stages}), {});",
+                            dest.c_name,
+                            input_tmp.c_name,
+                        ));
+                    } else {
+                        self.line(call_state, format!(
+                            "{} = rt_stream_xf_plugin_chain_flush_v1(ctx, xf_chain, UINT32_C({n_stages}));",
+                            dest.c_name,
+                        ));
+                    }
+                    self.line(call_state, "}");
+                    self.line(call_state, format!("goto st_{cont};"));
+                    return Ok(());
+                }
+
+                if head == "__internal.stream_xf.plugin_shard_step_v1"
+                    || head == "__internal.stream_xf.plugin_shard_flush_v1"
+                {
+                    let is_step = head == "__internal.stream_xf.plugin_shard_step_v1";
+                    let expected_args = if is_step { 11 } else { 9 };
+                    if args.len() != expected_args {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Parse,
+                            format!("{head} expects {expected_args} args"),
+                        ));
+                    }
+                    if dest.ty != Ty::ResultBytes {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            format!("{head} returns result_bytes"),
+                        ));
+                    }
+
+                    let backend_id =
+                        self.parse_bytes_lit_text_arg(&format!("{head} backend_id"), &args[0])?;
+                    crate::validate::validate_symbol(&backend_id)
+                        .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+                    let abi_major_i32 =
+                        self.parse_i32_lit_arg(&format!("{head} abi_major"), &args[1])?;
+                    let abi_major = u32::try_from(abi_major_i32).unwrap_or(0);
+                    if abi_major == 0 {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            format!("{head} abi_major must be >= 1"),
+                        ));
+                    }
+
+                    let export_symbol =
+                        self.parse_bytes_lit_text_arg(&format!("{head} export_symbol"), &args[2])?;
+                    crate::validate::validate_local_name(&export_symbol)
+                        .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+                    self.require_native_backend(&backend_id, abi_major, &export_symbol)?;
+
+                    let states_b =
+                        self.lookup_borrowed_bytes_ident_arg(&format!("{head} states"), &args[3])?;
+                    let scratch_b =
+                        self.lookup_borrowed_bytes_ident_arg(&format!("{head} scratch"), &args[4])?;
+
+                    let max_out_bytes_per_step = self
+                        .parse_i32_lit_arg(&format!("{head} max_out_bytes_per_step"), &args[5])?;
+                    let max_out_items_per_step = self
+                        .parse_i32_lit_arg(&format!("{head} max_out_items_per_step"), &args[6])?;
+                    let max_out_buf_bytes =
+                        self.parse_i32_lit_arg(&format!("{head} max_out_buf_bytes"), &args[7])?;
+                    if max_out_bytes_per_step < 0
+                        || max_out_items_per_step < 0
+                        || max_out_buf_bytes < 0
+                    {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            format!("{head} limits must be >= 0"),
+                        ));
+                    }
+                    let shards = self.parse_i32_lit_arg(&format!("{head} shards"), &args[8])?;
+                    if shards < 1 {
+                        return Err(CompilerError::new(
+                            CompileErrorKind::Typing,
+                            format!("{head} shards must be >= 1"),
+                        ));
+                    }
+
+                    let (call_state, views) = if is_step {
+                        let batch_tmp = self.alloc_local("t_xf_in_", Ty::BytesView)?;
+                        let keys_tmp = self.alloc_local("t_xf_keys_", Ty::BytesView)?;
+                        let batch_state = self.new_state();
+                        let keys_state = self.new_state();
+                        let after = self.new_state();
+                        self.line(state, format!("goto st_{batch_state};"));
+                        self.emit_expr_entry(batch_state, &args[9], batch_tmp.clone(), keys_state)?;
+                        self.emit_expr_entry(keys_state, &args[10], keys_tmp.clone(), after)?;
+                        (after, Some((batch_tmp, keys_tmp)))
+                    } else {
+                        (state, None)
+                    };
+
+                    self.line(call_state, "rt_fuel(ctx, 1);");
+                    self.line(
+                        call_state,
+                        format!("extern x07_stream_xf_plugin_v1 {export_symbol};"),
+                    );
+                    if let Some((batch_tmp, keys_tmp)) = &views {
+                        self.line(call_state, format!(
+                            "{} = rt_stream_xf_plugin_shard_step_v1(ctx, &{export_symbol}, UINT32_C({abi_major}), {}, {}, (uint32_t){max_out_bytes_per_step}, (uint32_t){max_out_items_per_step}, (uint32_t){max_out_buf_bytes}, (uint32_t){shards}, {}, {});",
+                            dest.c_name,
+                            states_b.c_name,
+                            scratch_b.c_name,
+                            batch_tmp.c_name,
+                            keys_tmp.c_name,
+                        ));
+                    } else {
+                        self.line(call_state, format!(
+                            "{} = rt_stream_xf_plugin_shard_flush_v1(ctx, &{export_symbol}, UINT32_C({abi_major}), {}, {}, (uint32_t){max_out_bytes_per_step}, (uint32_t){max_out_items_per_step}, (uint32_t){max_out_buf_bytes}, (uint32_t){shards});",
+                            dest.c_name,
+                            states_b.c_name,
+                            scratch_b.c_name,
+                        ));
+                    }
+                    self.line(call_state, format!("goto st_{cont};"));
+                    return Ok(());
+                }
+
                 if head == "__internal.stream_xf.plugin_flush_v1" {
                     if args.len() != 8 {
                         return Err(CompilerError::new(
@@ -2388,6 +2778,51 @@ impl<'a> Emitter<'a> {
                     "math.f64.add_v1" | "math.f64.sub_v1" | "math.f64.mul_v1"
                     | "math.f64.div_v1" | "math.f64.pow_v1" | "math.f64.atan2_v1"
                     | "math.f64.min_v1" | "math.f64.max_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_MATH,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || (args[0].ty != Ty::Bytes && args[0].ty != Ty::BytesView)
+                            || (args[1].ty != Ty::Bytes && args[1].ty != Ty::BytesView)
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects (bytes_view, bytes_view)"),
+                            ));
+                        }
+                        let a = format!(
+                            "rt_math_f64_unbox(ctx, {}.ptr, {}.len)",
+                            args[0].c_name, args[0].c_name
+                        );
+                        let b = format!(
+                            "rt_math_f64_unbox(ctx, {}.ptr, {}.len)",
+                            args[1].c_name, args[1].c_name
+                        );
+                        let c_fn = match head {
+                            "math.f64.add_v1" => "ev_math_f64_add_v2",
+                            "math.f64.sub_v1" => "ev_math_f64_sub_v2",
+                            "math.f64.mul_v1" => "ev_math_f64_mul_v2",
+                            "math.f64.div_v1" => "ev_math_f64_div_v2",
+                            "math.f64.pow_v1" => "ev_math_f64_pow_v2",
+                            "math.f64.atan2_v1" => "ev_math_f64_atan2_v2",
+                            "math.f64.min_v1" => "ev_math_f64_min_v2",
+                            "math.f64.max_v1" => "ev_math_f64_max_v2",
+                            _ => unreachable!(),
+                        };
+                        self.line(
+                            state,
+                            format!("{} = rt_math_f64_box(ctx, {c_fn}({a}, {b}));", dest.c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "math.f64.arr.add_v1"
+                    | "math.f64.arr.sub_v1"
+                    | "math.f64.arr.mul_v1"
+                    | "math.f64.arr.div_v1" => {
                         self.require_native_backend(
                             native::BACKEND_ID_MATH,
                             native::ABI_MAJOR_V1,
@@ -2420,47 +2855,34 @@ impl<'a> Emitter<'a> {
                             )
                         };
                         let c_fn = match head {
-                            "math.f64.add_v1" => "ev_math_f64_add_v1",
-                            "math.f64.sub_v1" => "ev_math_f64_sub_v1",
-                            "math.f64.mul_v1" => "ev_math_f64_mul_v1",
-                            "math.f64.div_v1" => "ev_math_f64_div_v1",
-                            "math.f64.pow_v1" => "ev_math_f64_pow_v1",
-                            "math.f64.atan2_v1" => "ev_math_f64_atan2_v1",
-                            "math.f64.min_v1" => "ev_math_f64_min_v1",
-                            "math.f64.max_v1" => "ev_math_f64_max_v1",
+                            "math.f64.arr.add_v1" => "ev_math_f64_arr_add_v1",
+                            "math.f64.arr.sub_v1" => "ev_math_f64_arr_sub_v1",
+                            "math.f64.arr.mul_v1" => "ev_math_f64_arr_mul_v1",
+                            "math.f64.arr.div_v1" => "ev_math_f64_arr_div_v1",
                             _ => unreachable!(),
                         };
                         self.line(state, format!("{} = {c_fn}({a}, {b});", dest.c_name));
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "math.f64.sqrt_v1"
-                    | "math.f64.neg_v1"
-                    | "math.f64.abs_v1"
-                    | "math.f64.sin_v1"
-                    | "math.f64.cos_v1"
-                    | "math.f64.tan_v1"
-                    | "math.f64.exp_v1"
-                    | "math.f64.log_v1"
-                    | "math.f64.floor_v1"
-                    | "math.f64.ceil_v1"
-                    | "math.f64.fmt_shortest_v1"
-                    | "math.f64.to_bits_u64le_v1" => {
+                    "math.f64.arr.parse_v1" => {
                         self.require_native_backend(
                             native::BACKEND_ID_MATH,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
-                        if args.len() != 1
-                            || dest.ty != Ty::Bytes
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultBytes
                             || (args[0].ty != Ty::Bytes && args[0].ty != Ty::BytesView)
+                            || (args[1].ty != Ty::Bytes && args[1].ty != Ty::BytesView)
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                format!("{head} expects bytes_view"),
+                                "math.f64.arr.parse_v1 expects (bytes_view, bytes_view)"
+                                    .to_string(),
                             ));
                         }
-                        let x = if args[0].ty == Ty::Bytes {
+                        let base = if args[0].ty == Ty::Bytes {
                             args[0].c_name.clone()
                         } else {
                             format!(
@@ -2468,20 +2890,158 @@ impl<'a> Emitter<'a> {
                                 args[0].c_name, args[0].c_name
                             )
                         };
-                        let c_fn = match head {
-                            "math.f64.sqrt_v1" => "ev_math_f64_sqrt_v1",
-                            "math.f64.neg_v1" => "ev_math_f64_neg_v1",
-                            "math.f64.abs_v1" => "ev_math_f64_abs_v1",
-                            "math.f64.sin_v1" => "ev_math_f64_sin_v1",
-                            "math.f64.cos_v1" => "ev_math_f64_cos_v1",
-                            "math.f64.tan_v1" => "ev_math_f64_tan_v1",
-                            "math.f64.exp_v1" => "ev_math_f64_exp_v1",
-                            "math.f64.log_v1" => "ev_math_f64_ln_v1",
-                            "math.f64.floor_v1" => "ev_math_f64_floor_v1",
-                            "math.f64.ceil_v1" => "ev_math_f64_ceil_v1",
-                            "math.f64.fmt_shortest_v1" => "ev_math_f64_fmt_shortest_v1",
-                            "math.f64.to_bits_u64le_v1" => "ev_math_f64_to_bits_u64le_v1",
-                            _ => unreachable!(),
+                        let list = if args[1].ty == Ty::Bytes {
+                            args[1].c_name.clone()
+                        } else {
+                            format!(
+                                "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+                                args[1].c_name, args[1].c_name
+                            )
+                        };
+                        self.line(
+                            state,
+                            format!(
+                                "{} = ev_math_f64_arr_parse_v1({base}, {list});",
+                                dest.c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "math.f64.arr.fma_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_MATH,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 3
+                            || dest.ty != Ty::Bytes
+                            || args
+                                .iter()
+                                .any(|a| a.ty != Ty::Bytes && a.ty != Ty::BytesView)
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects (bytes_view, bytes_view, bytes_view)"),
+                            ));
+                        }
+                        let mut ops = Vec::with_capacity(3);
+                        for arg in args {
+                            ops.push(if arg.ty == Ty::Bytes {
+                                arg.c_name.clone()
+                            } else {
+                                format!(
+                                    "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+                                    arg.c_name, arg.c_name
+                                )
+                            });
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = ev_math_f64_arr_fma_v1({}, {}, {});",
+                                dest.c_name, ops[0], ops[1], ops[2]
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "math.f64.sqrt_v1" | "math.f64.neg_v1" | "math.f64.abs_v1"
+                    | "math.f64.sin_v1" | "math.f64.cos_v1" | "math.f64.tan_v1"
+                    | "math.f64.exp_v1" | "math.f64.log_v1" | "math.f64.floor_v1"
+                    | "math.f64.ceil_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_MATH,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 1
+                            || dest.ty != Ty::Bytes
+                            || (args[0].ty != Ty::Bytes && args[0].ty != Ty::BytesView)
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects bytes_view"),
+                            ));
+                        }
+                        let x = format!(
+                            "rt_math_f64_unbox(ctx, {}.ptr, {}.len)",
+                            args[0].c_name, args[0].c_name
+                        );
+                        let c_fn = match head {
+                            "math.f64.sqrt_v1" => "ev_math_f64_sqrt_v2",
+                            "math.f64.neg_v1" => "ev_math_f64_neg_v2",
+                            "math.f64.abs_v1" => "ev_math_f64_abs_v2",
+                            "math.f64.sin_v1" => "ev_math_f64_sin_v2",
+                            "math.f64.cos_v1" => "ev_math_f64_cos_v2",
+                            "math.f64.tan_v1" => "ev_math_f64_tan_v2",
+                            "math.f64.exp_v1" => "ev_math_f64_exp_v2",
+                            "math.f64.log_v1" => "ev_math_f64_ln_v2",
+                            "math.f64.floor_v1" => "ev_math_f64_floor_v2",
+                            "math.f64.ceil_v1" => "ev_math_f64_ceil_v2",
+                            _ => unreachable!(),
+                        };
+                        self.line(
+                            state,
+                            format!("{} = rt_math_f64_box(ctx, {c_fn}({x}));", dest.c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "math.f64.fmt_shortest_v1"
+                    | "math.f64.to_bits_u64le_v1"
+                    | "math.f64.arr.neg_v1"
+                    | "math.f64.arr.abs_v1"
+                    | "math.f64.arr.sqrt_v1"
+                    | "math.f64.arr.sin_v1"
+                    | "math.f64.arr.cos_v1"
+                    | "math.f64.arr.tan_v1"
+                    | "math.f64.arr.exp_v1"
+                    | "math.f64.arr.log_v1"
+                    | "math.f64.arr.floor_v1"
+                    | "math.f64.arr.ceil_v1"
+                    | "math.f64.arr.min_v1"
+                    | "math.f64.arr.max_v1"
+                    | "math.f64.arr.fmt_shortest_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_MATH,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 1
+                            || dest.ty != Ty::Bytes
+                            || (args[0].ty != Ty::Bytes && args[0].ty != Ty::BytesView)
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects bytes_view"),
+                            ));
+                        }
+                        let x = if args[0].ty == Ty::Bytes {
+                            args[0].c_name.clone()
+                        } else {
+                            format!(
+                                "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+                                args[0].c_name, args[0].c_name
+                            )
+                        };
+                        let c_fn = match head {
+                            "math.f64.fmt_shortest_v1" => "ev_math_f64_fmt_shortest_v1",
+                            "math.f64.to_bits_u64le_v1" => "ev_math_f64_to_bits_u64le_v1",
+                            "math.f64.arr.neg_v1" => "ev_math_f64_arr_neg_v1",
+                            "math.f64.arr.abs_v1" => "ev_math_f64_arr_abs_v1",
+                            "math.f64.arr.sqrt_v1" => "ev_math_f64_arr_sqrt_v1",
+                            "math.f64.arr.sin_v1" => "ev_math_f64_arr_sin_v1",
+                            "math.f64.arr.cos_v1" => "ev_math_f64_arr_cos_v1",
+                            "math.f64.arr.tan_v1" => "ev_math_f64_arr_tan_v1",
+                            "math.f64.arr.exp_v1" => "ev_math_f64_arr_exp_v1",
+                            "math.f64.arr.log_v1" => "ev_math_f64_arr_ln_v1",
+                            "math.f64.arr.floor_v1" => "ev_math_f64_arr_floor_v1",
+                            "math.f64.arr.ceil_v1" => "ev_math_f64_arr_ceil_v1",
+                            "math.f64.arr.min_v1" => "ev_math_f64_arr_min_v1",
+                            "math.f64.arr.max_v1" => "ev_math_f64_arr_max_v1",
+                            "math.f64.arr.fmt_shortest_v1" => "ev_math_f64_arr_fmt_shortest_v1",
+                            _ => unreachable!(),
                         };
                         self.line(state, format!("{} = {c_fn}({x});", dest.c_name));
                         self.line(state, format!("goto st_{cont};"));
@@ -3023,6 +3583,48 @@ impl<'a> Emitter<'a> {
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
+                    "view.find_u8" => {
+                        if args.len() != 2
+                            || dest.ty != Ty::I32
+                            || args[0].ty != Ty::BytesView
+                            || args[1].ty != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "view.find_u8 expects (bytes_view, i32)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = rt_view_find_u8(ctx, {}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "view.find_sub" => {
+                        if args.len() != 2
+                            || dest.ty != Ty::I32
+                            || args[0].ty != Ty::BytesView
+                            || args[1].ty != Ty::BytesView
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "view.find_sub expects (bytes_view, bytes_view)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = rt_view_find_sub(ctx, {}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
                     "await" | "task.join.bytes" => {
                         if args.len() != 1
                             || dest.ty != Ty::Bytes
@@ -4418,339 +5020,1321 @@ impl<'a> Emitter<'a> {
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.archive.tar_extract_to_fs_v1" => {
+                    "os.fs.view_open_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::BACKEND_ID_EXT_FS,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.archive.tar_extract_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.fs.view_open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if args.len() != 5
-                            || dest.ty != Ty::Bytes
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
                             || args[0].ty != Ty::Bytes
                             || args[1].ty != Ty::Bytes
-                            || args[2].ty != Ty::Bytes
-                            || args[3].ty != Ty::Bytes
-                            || args[4].ty != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.archive.tar_extract_to_fs_v1 expects (bytes out_root, bytes tar_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                                "os.fs.view_open_v1 expects (bytes path, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_archive_tar_extract_to_fs_v1({}, {}, {}, {}, {});",
-                                dest.c_name,
-                                args[0].c_name,
-                                args[1].c_name,
-                                args[2].c_name,
-                                args[3].c_name,
-                                args[4].c_name
+                                "{} = x07_ext_fs_view_open_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.archive.tgz_extract_to_fs_v1" => {
+                    "os.fs.view_bytes_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::BACKEND_ID_EXT_FS,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.archive.tgz_extract_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.fs.view_bytes_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if args.len() != 5
-                            || dest.ty != Ty::Bytes
-                            || args[0].ty != Ty::Bytes
-                            || args[1].ty != Ty::Bytes
-                            || args[2].ty != Ty::Bytes
-                            || args[3].ty != Ty::Bytes
-                            || args[4].ty != Ty::Bytes
-                        {
+                        if args.len() != 1 || dest.ty != Ty::Bytes || args[0].ty != Ty::I32 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.archive.tgz_extract_to_fs_v1 expects (bytes out_root, bytes tgz_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                                "os.fs.view_bytes_v1 expects i32 view_handle".to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_archive_tgz_extract_to_fs_v1({}, {}, {}, {}, {});",
-                                dest.c_name,
-                                args[0].c_name,
-                                args[1].c_name,
-                                args[2].c_name,
-                                args[3].c_name,
-                                args[4].c_name
+                                "{} = x07_ext_fs_view_bytes_v1((int32_t){});",
+                                dest.c_name, args[0].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.archive.zip_extract_to_fs_v1" => {
+                    "os.fs.view_release_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::BACKEND_ID_EXT_FS,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.archive.zip_extract_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.fs.view_release_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if args.len() != 5
-                            || dest.ty != Ty::Bytes
+                        if args.len() != 1 || dest.ty != Ty::I32 || args[0].ty != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.view_release_v1 expects i32 view_handle".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_fs_view_release_v1((int32_t){});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.fs.walk_open_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_FS,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.fs.walk_open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 3
+                            || dest.ty != Ty::ResultI32
                             || args[0].ty != Ty::Bytes
                             || args[1].ty != Ty::Bytes
                             || args[2].ty != Ty::Bytes
-                            || args[3].ty != Ty::Bytes
-                            || args[4].ty != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.archive.zip_extract_to_fs_v1 expects (bytes out_root, bytes zip_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                                "os.fs.walk_open_v1 expects (bytes root, bytes glob, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_archive_zip_extract_to_fs_v1({}, {}, {}, {}, {});",
-                                dest.c_name,
-                                args[0].c_name,
-                                args[1].c_name,
-                                args[2].c_name,
-                                args[3].c_name,
-                                args[4].c_name
+                                "{} = x07_ext_fs_walk_open_v1({}, {}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name, args[2].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.stdio.read_line_v1" => {
+                    "os.fs.walk_next_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_STDIO,
+                            native::BACKEND_ID_EXT_FS,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.stdio.read_line_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.fs.walk_next_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if args.len() != 1 || dest.ty != Ty::ResultBytes || args[0].ty != Ty::Bytes
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultBytes
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.stdio.read_line_v1 expects (bytes caps)".to_string(),
+                                "os.fs.walk_next_v1 expects (i32 walk_handle, i32 max_entries)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_fs_walk_next_v1((int32_t){}, (int32_t){});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.fs.walk_drop_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_FS,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.fs.walk_drop_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::I32 || args[0].ty != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.walk_drop_v1 expects i32 walk_handle".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_fs_walk_drop_v1((int32_t){});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.archive.tar_extract_to_fs_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.archive.tar_extract_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 5
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                            || args[2].ty != Ty::Bytes
+                            || args[3].ty != Ty::Bytes
+                            || args[4].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.tar_extract_to_fs_v1 expects (bytes out_root, bytes tar_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_archive_tar_extract_to_fs_v1({}, {}, {}, {}, {});",
+                                dest.c_name,
+                                args[0].c_name,
+                                args[1].c_name,
+                                args[2].c_name,
+                                args[3].c_name,
+                                args[4].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.archive.tgz_extract_to_fs_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.archive.tgz_extract_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 5
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                            || args[2].ty != Ty::Bytes
+                            || args[3].ty != Ty::Bytes
+                            || args[4].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.tgz_extract_to_fs_v1 expects (bytes out_root, bytes tgz_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_archive_tgz_extract_to_fs_v1({}, {}, {}, {}, {});",
+                                dest.c_name,
+                                args[0].c_name,
+                                args[1].c_name,
+                                args[2].c_name,
+                                args[3].c_name,
+                                args[4].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.archive.zip_extract_to_fs_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.archive.zip_extract_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 5
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                            || args[2].ty != Ty::Bytes
+                            || args[3].ty != Ty::Bytes
+                            || args[4].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.zip_extract_to_fs_v1 expects (bytes out_root, bytes zip_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_archive_zip_extract_to_fs_v1({}, {}, {}, {}, {});",
+                                dest.c_name,
+                                args[0].c_name,
+                                args[1].c_name,
+                                args[2].c_name,
+                                args[3].c_name,
+                                args[4].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.archive.tar_extract_reader_to_fs_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.archive.tar_extract_reader_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 5
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Iface
+                            || args[2].ty != Ty::Bytes
+                            || args[3].ty != Ty::Bytes
+                            || args[4].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.tar_extract_reader_to_fs_v1 expects (bytes out_root, iface reader, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = rt_os_archive_tar_extract_reader(ctx, {}, {}, {}, {}, {});",
+                                dest.c_name,
+                                args[0].c_name,
+                                args[1].c_name,
+                                args[2].c_name,
+                                args[3].c_name,
+                                args[4].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.archive.tgz_extract_reader_to_fs_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_ARCHIVE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.archive.tgz_extract_reader_to_fs_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 5
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Iface
+                            || args[2].ty != Ty::Bytes
+                            || args[3].ty != Ty::Bytes
+                            || args[4].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.tgz_extract_reader_to_fs_v1 expects (bytes out_root, iface reader, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = rt_os_archive_tgz_extract_reader(ctx, {}, {}, {}, {}, {});",
+                                dest.c_name,
+                                args[0].c_name,
+                                args[1].c_name,
+                                args[2].c_name,
+                                args[3].c_name,
+                                args[4].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.read_line_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.read_line_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::ResultBytes || args[0].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.read_line_v1 expects (bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_read_line_v1({});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.write_stdout_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.write_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.write_stdout_v1 expects (bytes data, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_write_stdout_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.write_stderr_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.write_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.write_stderr_v1 expects (bytes data, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_write_stderr_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.flush_stdout_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.flush_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if !args.is_empty() || dest.ty != Ty::ResultI32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.flush_stdout_v1 expects 0 args".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!("{} = x07_ext_stdio_flush_stdout_v1();", dest.c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.flush_stderr_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.flush_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if !args.is_empty() || dest.ty != Ty::ResultI32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.flush_stderr_v1 expects 0 args".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!("{} = x07_ext_stdio_flush_stderr_v1();", dest.c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.write_vec_stdout_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.write_vec_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.write_vec_stdout_v1 expects (bytes slices, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_write_vec_stdout_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.write_vec_stderr_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.write_vec_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.write_vec_stderr_v1 expects (bytes slices, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_write_vec_stderr_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.buf_set_stdout_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.buf_set_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.buf_set_stdout_v1 expects (i32 watermark_bytes, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_buf_set_stdout_v1((int32_t){}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.buf_set_stderr_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.buf_set_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultI32
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.buf_set_stderr_v1 expects (i32 watermark_bytes, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_buf_set_stderr_v1((int32_t){}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.buf_write_stdout_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.buf_write_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::ResultI32 || args[0].ty != Ty::Bytes {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.buf_write_stdout_v1 expects bytes data"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_buf_write_stdout_v1({});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.buf_write_stderr_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.buf_write_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::ResultI32 || args[0].ty != Ty::Bytes {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.buf_write_stderr_v1 expects bytes data"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_stdio_buf_write_stderr_v1({});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.buf_flush_stdout_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.buf_flush_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if !args.is_empty() || dest.ty != Ty::ResultI32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.buf_flush_stdout_v1 expects 0 args".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!("{} = x07_ext_stdio_buf_flush_stdout_v1();", dest.c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.stdio.buf_flush_stderr_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_STDIO,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.stdio.buf_flush_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if !args.is_empty() || dest.ty != Ty::ResultI32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.stdio.buf_flush_stderr_v1 expects 0 args".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!("{} = x07_ext_stdio_buf_flush_stderr_v1();", dest.c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.rand.bytes_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_RAND,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.rand.bytes_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultBytes
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.bytes_v1 expects (i32 n, bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_rand_bytes_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.rand.u64_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_RAND,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.rand.u64_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::ResultBytes || args[0].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.u64_v1 expects (bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!("{} = x07_ext_rand_u64_v1({});", dest.c_name, args[0].c_name),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.rand.pool_open_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_RAND,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.rand.pool_open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultBytes
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_open_v1 expects (i32 reseed_interval_bytes, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_rand_pool_open_v1((int32_t){}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.rand.pool_bytes_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_RAND,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.rand.pool_bytes_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::ResultBytes
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_bytes_v1 expects (i32 pool_handle, i32 n)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_rand_pool_bytes_v1((int32_t){}, (int32_t){});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.rand.pool_u64_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_RAND,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.rand.pool_u64_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::ResultBytes || args[0].ty != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_u64_v1 expects i32 pool_handle".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_rand_pool_u64_v1((int32_t){});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.rand.pool_close_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_RAND,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.rand.pool_close_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 1 || dest.ty != Ty::I32 || args[0].ty != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_close_v1 expects i32 pool_handle".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_rand_pool_close_v1((int32_t){});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.db.sqlite.open_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.db.sqlite.open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.open_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_db_sqlite_open_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.db.sqlite.query_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.db.sqlite.query_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.query_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_db_sqlite_query_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.db.sqlite.exec_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.db.sqlite.exec_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.exec_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_db_sqlite_exec_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.db.sqlite.close_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.db.sqlite.close_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.close_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_db_sqlite_close_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.db.sqlite.prepare_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.db.sqlite.prepare_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.prepare_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_stdio_read_line_v1({});",
-                                dest.c_name, args[0].c_name
+                                "{} = x07_ext_db_sqlite_prepare_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.stdio.write_stdout_v1" => {
+                    "os.db.sqlite.stmt_query_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_STDIO,
+                            native::BACKEND_ID_EXT_DB_SQLITE,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.stdio.write_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.sqlite.stmt_query_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
-                            || dest.ty != Ty::ResultI32
+                            || dest.ty != Ty::Bytes
                             || args[0].ty != Ty::Bytes
                             || args[1].ty != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.stdio.write_stdout_v1 expects (bytes data, bytes caps)"
+                                "os.db.sqlite.stmt_query_v1 expects (bytes req, bytes caps)"
                                     .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_stdio_write_stdout_v1({}, {});",
+                                "{} = x07_ext_db_sqlite_stmt_query_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.stdio.write_stderr_v1" => {
+                    "os.db.sqlite.stmt_exec_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_STDIO,
+                            native::BACKEND_ID_EXT_DB_SQLITE,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.stdio.write_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.sqlite.stmt_exec_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
-                            || dest.ty != Ty::ResultI32
+                            || dest.ty != Ty::Bytes
                             || args[0].ty != Ty::Bytes
                             || args[1].ty != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.stdio.write_stderr_v1 expects (bytes data, bytes caps)"
+                                "os.db.sqlite.stmt_exec_v1 expects (bytes req, bytes caps)"
                                     .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_stdio_write_stderr_v1({}, {});",
+                                "{} = x07_ext_db_sqlite_stmt_exec_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.stdio.flush_stdout_v1" => {
+                    "os.db.sqlite.finalize_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_STDIO,
+                            native::BACKEND_ID_EXT_DB_SQLITE,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.stdio.flush_stdout_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.sqlite.finalize_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if !args.is_empty() || dest.ty != Ty::ResultI32 {
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.stdio.flush_stdout_v1 expects 0 args".to_string(),
+                                "os.db.sqlite.finalize_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
-                            format!("{} = x07_ext_stdio_flush_stdout_v1();", dest.c_name),
+                            format!(
+                                "{} = x07_ext_db_sqlite_finalize_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.stdio.flush_stderr_v1" => {
+                    "os.db.pg.open_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_STDIO,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.stdio.flush_stderr_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if !args.is_empty() || dest.ty != Ty::ResultI32 {
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.stdio.flush_stderr_v1 expects 0 args".to_string(),
+                                "os.db.pg.open_v1 expects (bytes req, bytes caps)".to_string(),
                             ));
                         }
                         self.line(
                             state,
-                            format!("{} = x07_ext_stdio_flush_stderr_v1();", dest.c_name),
+                            format!(
+                                "{} = x07_ext_db_pg_open_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.rand.bytes_v1" => {
+                    "os.db.pg.query_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_RAND,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.rand.bytes_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.query_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
-                            || dest.ty != Ty::ResultBytes
-                            || args[0].ty != Ty::I32
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
                             || args[1].ty != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.rand.bytes_v1 expects (i32 n, bytes caps)".to_string(),
+                                "os.db.pg.query_v1 expects (bytes req, bytes caps)".to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_rand_bytes_v1({}, {});",
+                                "{} = x07_ext_db_pg_query_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.rand.u64_v1" => {
+                    "os.db.pg.exec_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_RAND,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.rand.u64_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.exec_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
-                        if args.len() != 1 || dest.ty != Ty::ResultBytes || args[0].ty != Ty::Bytes
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.rand.u64_v1 expects (bytes caps)".to_string(),
+                                "os.db.pg.exec_v1 expects (bytes req, bytes caps)".to_string(),
                             ));
                         }
                         self.line(
                             state,
-                            format!("{} = x07_ext_rand_u64_v1({});", dest.c_name, args[0].c_name),
+                            format!(
+                                "{} = x07_ext_db_pg_exec_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.sqlite.open_v1" => {
+                    "os.db.pg.close_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.sqlite.open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.close_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4760,29 +6344,29 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.open_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.close_v1 expects (bytes req, bytes caps)".to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_sqlite_open_v1({}, {});",
+                                "{} = x07_ext_db_pg_close_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.sqlite.query_v1" => {
+                    "os.db.pg.copy_begin_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.sqlite.query_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.copy_begin_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4792,29 +6376,30 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.query_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.copy_begin_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_sqlite_query_v1({}, {});",
+                                "{} = x07_ext_db_pg_copy_begin_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.sqlite.exec_v1" => {
+                    "os.db.pg.copy_write_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.sqlite.exec_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.copy_write_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4824,29 +6409,30 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.exec_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.copy_write_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_sqlite_exec_v1({}, {});",
+                                "{} = x07_ext_db_pg_copy_write_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.sqlite.close_v1" => {
+                    "os.db.pg.copy_finish_v1" => {
                         self.require_native_backend(
-                            native::BACKEND_ID_EXT_DB_SQLITE,
+                            native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
                             head,
                         )?;
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.sqlite.close_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.copy_finish_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4856,20 +6442,21 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.close_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.copy_finish_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_sqlite_close_v1({}, {});",
+                                "{} = x07_ext_db_pg_copy_finish_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.pg.open_v1" => {
+                    "os.db.pg.prepare_v1" => {
                         self.require_native_backend(
                             native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
@@ -4878,7 +6465,7 @@ impl<'a> Emitter<'a> {
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.pg.open_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.prepare_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4888,20 +6475,21 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.pg.open_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.prepare_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_pg_open_v1({}, {});",
+                                "{} = x07_ext_db_pg_prepare_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.pg.query_v1" => {
+                    "os.db.pg.stmt_query_v1" => {
                         self.require_native_backend(
                             native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
@@ -4910,7 +6498,7 @@ impl<'a> Emitter<'a> {
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.pg.query_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.stmt_query_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4920,20 +6508,21 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.pg.query_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.stmt_query_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_pg_query_v1({}, {});",
+                                "{} = x07_ext_db_pg_stmt_query_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.pg.exec_v1" => {
+                    "os.db.pg.stmt_exec_v1" => {
                         self.require_native_backend(
                             native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
@@ -4942,7 +6531,7 @@ impl<'a> Emitter<'a> {
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.pg.exec_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.stmt_exec_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4952,20 +6541,21 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.pg.exec_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.stmt_exec_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_pg_exec_v1({}, {});",
+                                "{} = x07_ext_db_pg_stmt_exec_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
-                    "os.db.pg.close_v1" => {
+                    "os.db.pg.finalize_v1" => {
                         self.require_native_backend(
                             native::BACKEND_ID_EXT_DB_PG,
                             native::ABI_MAJOR_V1,
@@ -4974,7 +6564,7 @@ impl<'a> Emitter<'a> {
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Unsupported,
-                                "os.db.pg.close_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                                "os.db.pg.finalize_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
                             ));
                         }
                         if args.len() != 2
@@ -4984,13 +6574,14 @@ impl<'a> Emitter<'a> {
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.pg.close_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.db.pg.finalize_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
                             ));
                         }
                         self.line(
                             state,
                             format!(
-                                "{} = x07_ext_db_pg_close_v1({}, {});",
+                                "{} = x07_ext_db_pg_finalize_v1({}, {});",
                                 dest.c_name, args[0].c_name, args[1].c_name
                             ),
                         );
@@ -5253,6 +6844,39 @@ impl<'a> Emitter<'a> {
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
+                    "os.db.redis.pipeline_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_EXT_DB_REDIS,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if !self.options.world.is_standalone_only() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Unsupported,
+                                "os.db.redis.pipeline_v1 is only available in standalone worlds (run-os, run-os-sandboxed)".to_string(),
+                            ));
+                        }
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::Bytes
+                            || args[1].ty != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.redis.pipeline_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = x07_ext_db_redis_pipeline_v1({}, {});",
+                                dest.c_name, args[0].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
                     "os.env.get" => {
                         if !self.options.world.is_standalone_only() {
                             return Err(CompilerError::new(
@@ -5427,6 +7051,107 @@ impl<'a> Emitter<'a> {
                         self.line(state, format!("goto st_{cont};"));
                         return Ok(());
                     }
+                    "os.time.tzdb_zone_open_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_TIME,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 1 || dest.ty != Ty::I32 || args[0].ty != Ty::BytesView {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_zone_open_v1 expects bytes_view tzid and returns i32"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = ev_time_tzdb_zone_open_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+                                dest.c_name, args[0].c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.time.tzdb_zone_offset_duration_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_TIME,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 3
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::I32
+                            || args[2].ty != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_zone_offset_duration_v1 expects (i32 zone_handle, i32 unix_s_lo, i32 unix_s_hi) and returns bytes"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = ev_time_tzdb_zone_offset_duration_v1((int32_t){}, (int32_t){}, (int32_t){});",
+                                dest.c_name, args[0].c_name, args[1].c_name, args[2].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.time.tzdb_zone_drop_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_TIME,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 1 || dest.ty != Ty::I32 || args[0].ty != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_zone_drop_v1 expects i32 zone_handle and returns i32"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = ev_time_tzdb_zone_drop_v1((int32_t){});",
+                                dest.c_name, args[0].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
+                    "os.time.tzdb_zone_offsets_batch_v1" => {
+                        self.require_native_backend(
+                            native::BACKEND_ID_TIME,
+                            native::ABI_MAJOR_V1,
+                            head,
+                        )?;
+                        if args.len() != 2
+                            || dest.ty != Ty::Bytes
+                            || args[0].ty != Ty::I32
+                            || args[1].ty != Ty::BytesView
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_zone_offsets_batch_v1 expects (i32 zone_handle, bytes_view unix_s_packed) and returns bytes"
+                                    .to_string(),
+                            ));
+                        }
+                        self.line(
+                            state,
+                            format!(
+                                "{} = ev_time_tzdb_zone_offsets_batch_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+                                dest.c_name, args[0].c_name, args[1].c_name, args[1].c_name
+                            ),
+                        );
+                        self.line(state, format!("goto st_{cont};"));
+                        return Ok(());
+                    }
                     "process.set_exit_code_v1" => {
                         if args.len() != 1 || args[0].ty != Ty::I32 || dest.ty != Ty::I32 {
                             return Err(CompilerError::new(
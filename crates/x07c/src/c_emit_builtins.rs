@@ -506,7 +506,7 @@ impl<'a> Emitter<'a> {
     ) -> Result<(), CompilerError> {
         let prev_ptr = self.current_ptr.replace(expr.ptr().to_string());
         let out = (|| {
-            self.line("rt_fuel(ctx, 1);");
+            self.fuel_charge(1);
             match expr {
                 Expr::Int { value: i, .. } => {
                     if dest_ty != Ty::I32 {
@@ -668,59 +668,59 @@ impl<'a> Emitter<'a> {
             "bytes.as_mut_ptr" => self.emit_bytes_as_mut_ptr_to(args, dest_ty, dest),
 
             "math.f64.add_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_add_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_add_v2", args, dest_ty, dest)
             }
             "math.f64.sub_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_sub_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_sub_v2", args, dest_ty, dest)
             }
             "math.f64.mul_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_mul_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_mul_v2", args, dest_ty, dest)
             }
             "math.f64.div_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_div_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_div_v2", args, dest_ty, dest)
             }
             "math.f64.pow_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_pow_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_pow_v2", args, dest_ty, dest)
             }
             "math.f64.atan2_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_atan2_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_atan2_v2", args, dest_ty, dest)
             }
             "math.f64.min_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_min_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_min_v2", args, dest_ty, dest)
             }
             "math.f64.max_v1" => {
-                self.emit_math_f64_binop_to(head, "ev_math_f64_max_v1", args, dest_ty, dest)
+                self.emit_math_f64_binop_to(head, "ev_math_f64_max_v2", args, dest_ty, dest)
             }
 
             "math.f64.sqrt_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_sqrt_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_sqrt_v2", args, dest_ty, dest)
             }
             "math.f64.neg_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_neg_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_neg_v2", args, dest_ty, dest)
             }
             "math.f64.abs_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_abs_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_abs_v2", args, dest_ty, dest)
             }
             "math.f64.sin_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_sin_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_sin_v2", args, dest_ty, dest)
             }
             "math.f64.cos_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_cos_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_cos_v2", args, dest_ty, dest)
             }
             "math.f64.tan_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_tan_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_tan_v2", args, dest_ty, dest)
             }
             "math.f64.exp_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_exp_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_exp_v2", args, dest_ty, dest)
             }
             "math.f64.log_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_ln_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_ln_v2", args, dest_ty, dest)
             }
             "math.f64.floor_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_floor_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_floor_v2", args, dest_ty, dest)
             }
             "math.f64.ceil_v1" => {
-                self.emit_math_f64_unop_to(head, "ev_math_f64_ceil_v1", args, dest_ty, dest)
+                self.emit_math_f64_scalar_unop_to(head, "ev_math_f64_ceil_v2", args, dest_ty, dest)
             }
             "math.f64.fmt_shortest_v1" => {
                 self.emit_math_f64_unop_to(head, "ev_math_f64_fmt_shortest_v1", args, dest_ty, dest)
@@ -735,6 +735,64 @@ impl<'a> Emitter<'a> {
                 dest_ty,
                 dest,
             ),
+
+            "math.f64.arr.add_v1" => {
+                self.emit_math_f64_arr_binop_to(head, "ev_math_f64_arr_add_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.sub_v1" => {
+                self.emit_math_f64_arr_binop_to(head, "ev_math_f64_arr_sub_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.mul_v1" => {
+                self.emit_math_f64_arr_binop_to(head, "ev_math_f64_arr_mul_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.div_v1" => {
+                self.emit_math_f64_arr_binop_to(head, "ev_math_f64_arr_div_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.fma_v1" => self.emit_math_f64_arr_fma_to(args, dest_ty, dest),
+            "math.f64.arr.neg_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_neg_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.abs_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_abs_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.sqrt_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_sqrt_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.sin_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_sin_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.cos_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_cos_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.tan_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_tan_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.exp_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_exp_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.log_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_ln_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.floor_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_floor_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.ceil_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_ceil_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.min_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_min_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.max_v1" => {
+                self.emit_math_f64_unop_to(head, "ev_math_f64_arr_max_v1", args, dest_ty, dest)
+            }
+            "math.f64.arr.fmt_shortest_v1" => self.emit_math_f64_unop_to(
+                head,
+                "ev_math_f64_arr_fmt_shortest_v1",
+                args,
+                dest_ty,
+                dest,
+            ),
+            "math.f64.arr.parse_v1" => self.emit_math_f64_arr_parse_to(args, dest_ty, dest),
             "json.jcs.canon_doc_v1" => self.emit_json_jcs_canon_doc_v1_to(args, dest_ty, dest),
 
             "regex.compile_opts_v1" => self.emit_regex_compile_opts_v1_to(args, dest_ty, dest),
@@ -743,9 +801,37 @@ impl<'a> Emitter<'a> {
             "regex.find_all_x7sl_v1" => self.emit_regex_find_all_x7sl_v1_to(args, dest_ty, dest),
             "regex.split_v1" => self.emit_regex_split_v1_to(args, dest_ty, dest),
             "regex.replace_all_v1" => self.emit_regex_replace_all_v1_to(args, dest_ty, dest),
+            "regex.set_compile_v1" => self.emit_regex_set_compile_v1_to(args, dest_ty, dest),
+            "regex.set_scan_x7sl_v1" => self.emit_regex_set_scan_x7sl_v1_to(args, dest_ty, dest),
+            "regex.set_drop_v1" => self.emit_regex_set_drop_v1_to(args, dest_ty, dest),
+            "regex.handle_compile_v1" => self.emit_regex_handle_compile_v1_to(args, dest_ty, dest),
+            "regex.handle_exec_v1" => self.emit_regex_handle_exec_v1_to(args, dest_ty, dest),
+            "regex.handle_exec_caps_v1" => {
+                self.emit_regex_handle_exec_caps_v1_to(args, dest_ty, dest)
+            }
+            "regex.handle_find_all_x7sl_v1" => {
+                self.emit_regex_handle_find_all_x7sl_v1_to(args, dest_ty, dest)
+            }
+            "regex.handle_split_v1" => self.emit_regex_handle_split_v1_to(args, dest_ty, dest),
+            "regex.handle_replace_all_v1" => {
+                self.emit_regex_handle_replace_all_v1_to(args, dest_ty, dest)
+            }
+            "regex.handle_drop_v1" => self.emit_regex_handle_drop_v1_to(args, dest_ty, dest),
 
             "jsonschema.compile_v1" => self.emit_jsonschema_compile_v1_to(args, dest_ty, dest),
             "jsonschema.validate_v1" => self.emit_jsonschema_validate_v1_to(args, dest_ty, dest),
+            "jsonschema.handle_compile_v1" => {
+                self.emit_jsonschema_handle_compile_v1_to(args, dest_ty, dest)
+            }
+            "jsonschema.handle_validate_v1" => {
+                self.emit_jsonschema_handle_validate_v1_to(args, dest_ty, dest)
+            }
+            "jsonschema.handle_drop_v1" => {
+                self.emit_jsonschema_handle_drop_v1_to(args, dest_ty, dest)
+            }
+            "jsonschema.validate_batch_v1" => {
+                self.emit_jsonschema_validate_batch_v1_to(args, dest_ty, dest)
+            }
 
             "bytes.view" => self.emit_bytes_view_to(args, dest_ty, dest),
             "bytes.subview" => self.emit_bytes_subview_to(args, dest_ty, dest),
@@ -756,6 +842,8 @@ impl<'a> Emitter<'a> {
             "view.as_ptr" => self.emit_view_as_ptr_to(args, dest_ty, dest),
             "view.eq" => self.emit_view_eq_to(args, dest_ty, dest),
             "view.cmp_range" => self.emit_view_cmp_range_to(args, dest_ty, dest),
+            "view.find_u8" => self.emit_view_find_u8_to(args, dest_ty, dest),
+            "view.find_sub" => self.emit_view_find_sub_to(args, dest_ty, dest),
 
             "std.brand.erase_bytes_v1" => {
                 self.emit_std_brand_erase_bytes_v1_to(args, dest_ty, dest)
@@ -795,6 +883,21 @@ impl<'a> Emitter<'a> {
             "__internal.stream_xf.plugin_step_v1" => {
                 self.emit_internal_stream_xf_plugin_step_v1_to(args, dest_ty, dest)
             }
+            "__internal.stream_xf.plugin_step_batch_v1" => {
+                self.emit_internal_stream_xf_plugin_step_batch_v1_to(args, dest_ty, dest)
+            }
+            "__internal.stream_xf.plugin_chain_step_v1" => {
+                self.emit_internal_stream_xf_plugin_chain_v1_to(args, dest_ty, dest, true)
+            }
+            "__internal.stream_xf.plugin_chain_flush_v1" => {
+                self.emit_internal_stream_xf_plugin_chain_v1_to(args, dest_ty, dest, false)
+            }
+            "__internal.stream_xf.plugin_shard_step_v1" => {
+                self.emit_internal_stream_xf_plugin_shard_v1_to(args, dest_ty, dest, true)
+            }
+            "__internal.stream_xf.plugin_shard_flush_v1" => {
+                self.emit_internal_stream_xf_plugin_shard_v1_to(args, dest_ty, dest, false)
+            }
             "__internal.stream_xf.plugin_flush_v1" => {
                 self.emit_internal_stream_xf_plugin_flush_v1_to(args, dest_ty, dest)
             }
@@ -921,6 +1024,12 @@ impl<'a> Emitter<'a> {
                 self.emit_os_fs_walk_glob_sorted_text_v1_to(args, dest_ty, dest)
             }
             "os.fs.stat_v1" => self.emit_os_fs_stat_v1_to(args, dest_ty, dest),
+            "os.fs.walk_open_v1" => self.emit_os_fs_walk_open_v1_to(args, dest_ty, dest),
+            "os.fs.walk_next_v1" => self.emit_os_fs_walk_next_v1_to(args, dest_ty, dest),
+            "os.fs.walk_drop_v1" => self.emit_os_fs_walk_drop_v1_to(args, dest_ty, dest),
+            "os.fs.view_open_v1" => self.emit_os_fs_view_open_v1_to(args, dest_ty, dest),
+            "os.fs.view_bytes_v1" => self.emit_os_fs_view_bytes_v1_to(args, dest_ty, dest),
+            "os.fs.view_release_v1" => self.emit_os_fs_view_release_v1_to(args, dest_ty, dest),
 
             "os.archive.tar_extract_to_fs_v1" => {
                 self.emit_os_archive_tar_extract_to_fs_v1_to(args, dest_ty, dest)
@@ -931,6 +1040,12 @@ impl<'a> Emitter<'a> {
             "os.archive.zip_extract_to_fs_v1" => {
                 self.emit_os_archive_zip_extract_to_fs_v1_to(args, dest_ty, dest)
             }
+            "os.archive.tar_extract_reader_to_fs_v1" => {
+                self.emit_os_archive_tar_extract_reader_to_fs_v1_to(args, dest_ty, dest)
+            }
+            "os.archive.tgz_extract_reader_to_fs_v1" => {
+                self.emit_os_archive_tgz_extract_reader_to_fs_v1_to(args, dest_ty, dest)
+            }
 
             "os.stdio.read_line_v1" => self.emit_os_stdio_read_line_v1_to(args, dest_ty, dest),
             "os.stdio.write_stdout_v1" => {
@@ -945,18 +1060,63 @@ impl<'a> Emitter<'a> {
             "os.stdio.flush_stderr_v1" => {
                 self.emit_os_stdio_flush_stderr_v1_to(args, dest_ty, dest)
             }
+            "os.stdio.write_vec_stdout_v1" => {
+                self.emit_os_stdio_write_vec_stdout_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.write_vec_stderr_v1" => {
+                self.emit_os_stdio_write_vec_stderr_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.buf_set_stdout_v1" => {
+                self.emit_os_stdio_buf_set_stdout_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.buf_set_stderr_v1" => {
+                self.emit_os_stdio_buf_set_stderr_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.buf_write_stdout_v1" => {
+                self.emit_os_stdio_buf_write_stdout_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.buf_write_stderr_v1" => {
+                self.emit_os_stdio_buf_write_stderr_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.buf_flush_stdout_v1" => {
+                self.emit_os_stdio_buf_flush_stdout_v1_to(args, dest_ty, dest)
+            }
+            "os.stdio.buf_flush_stderr_v1" => {
+                self.emit_os_stdio_buf_flush_stderr_v1_to(args, dest_ty, dest)
+            }
 
             "os.rand.bytes_v1" => self.emit_os_rand_bytes_v1_to(args, dest_ty, dest),
             "os.rand.u64_v1" => self.emit_os_rand_u64_v1_to(args, dest_ty, dest),
+            "os.rand.pool_open_v1" => self.emit_os_rand_pool_open_v1_to(args, dest_ty, dest),
+            "os.rand.pool_bytes_v1" => self.emit_os_rand_pool_bytes_v1_to(args, dest_ty, dest),
+            "os.rand.pool_u64_v1" => self.emit_os_rand_pool_u64_v1_to(args, dest_ty, dest),
+            "os.rand.pool_close_v1" => self.emit_os_rand_pool_close_v1_to(args, dest_ty, dest),
 
             "os.db.sqlite.open_v1" => self.emit_os_db_sqlite_open_v1_to(args, dest_ty, dest),
             "os.db.sqlite.query_v1" => self.emit_os_db_sqlite_query_v1_to(args, dest_ty, dest),
             "os.db.sqlite.exec_v1" => self.emit_os_db_sqlite_exec_v1_to(args, dest_ty, dest),
             "os.db.sqlite.close_v1" => self.emit_os_db_sqlite_close_v1_to(args, dest_ty, dest),
+            "os.db.sqlite.prepare_v1" => self.emit_os_db_sqlite_prepare_v1_to(args, dest_ty, dest),
+            "os.db.sqlite.stmt_query_v1" => {
+                self.emit_os_db_sqlite_stmt_query_v1_to(args, dest_ty, dest)
+            }
+            "os.db.sqlite.stmt_exec_v1" => {
+                self.emit_os_db_sqlite_stmt_exec_v1_to(args, dest_ty, dest)
+            }
+            "os.db.sqlite.finalize_v1" => {
+                self.emit_os_db_sqlite_finalize_v1_to(args, dest_ty, dest)
+            }
             "os.db.pg.open_v1" => self.emit_os_db_pg_open_v1_to(args, dest_ty, dest),
             "os.db.pg.query_v1" => self.emit_os_db_pg_query_v1_to(args, dest_ty, dest),
             "os.db.pg.exec_v1" => self.emit_os_db_pg_exec_v1_to(args, dest_ty, dest),
             "os.db.pg.close_v1" => self.emit_os_db_pg_close_v1_to(args, dest_ty, dest),
+            "os.db.pg.copy_begin_v1" => self.emit_os_db_pg_copy_begin_v1_to(args, dest_ty, dest),
+            "os.db.pg.copy_write_v1" => self.emit_os_db_pg_copy_write_v1_to(args, dest_ty, dest),
+            "os.db.pg.copy_finish_v1" => self.emit_os_db_pg_copy_finish_v1_to(args, dest_ty, dest),
+            "os.db.pg.prepare_v1" => self.emit_os_db_pg_prepare_v1_to(args, dest_ty, dest),
+            "os.db.pg.stmt_query_v1" => self.emit_os_db_pg_stmt_query_v1_to(args, dest_ty, dest),
+            "os.db.pg.stmt_exec_v1" => self.emit_os_db_pg_stmt_exec_v1_to(args, dest_ty, dest),
+            "os.db.pg.finalize_v1" => self.emit_os_db_pg_finalize_v1_to(args, dest_ty, dest),
             "os.db.mysql.open_v1" => self.emit_os_db_mysql_open_v1_to(args, dest_ty, dest),
             "os.db.mysql.query_v1" => self.emit_os_db_mysql_query_v1_to(args, dest_ty, dest),
             "os.db.mysql.exec_v1" => self.emit_os_db_mysql_exec_v1_to(args, dest_ty, dest),
@@ -964,6 +1124,7 @@ impl<'a> Emitter<'a> {
             "os.db.redis.open_v1" => self.emit_os_db_redis_open_v1_to(args, dest_ty, dest),
             "os.db.redis.cmd_v1" => self.emit_os_db_redis_cmd_v1_to(args, dest_ty, dest),
             "os.db.redis.close_v1" => self.emit_os_db_redis_close_v1_to(args, dest_ty, dest),
+            "os.db.redis.pipeline_v1" => self.emit_os_db_redis_pipeline_v1_to(args, dest_ty, dest),
             "os.obj.s3.dispatch_v1" => self.emit_os_obj_s3_dispatch_v1_to(args, dest_ty, dest),
             "os.env.get" => self.emit_os_env_get_to(args, dest_ty, dest),
             "os.time.now_unix_ms" => self.emit_os_time_now_unix_ms_to(args, dest_ty, dest),
@@ -979,6 +1140,18 @@ impl<'a> Emitter<'a> {
             "os.time.tzdb_snapshot_id_v1" => {
                 self.emit_os_time_tzdb_snapshot_id_v1_to(args, dest_ty, dest)
             }
+            "os.time.tzdb_zone_open_v1" => {
+                self.emit_os_time_tzdb_zone_open_v1_to(args, dest_ty, dest)
+            }
+            "os.time.tzdb_zone_offset_duration_v1" => {
+                self.emit_os_time_tzdb_zone_offset_duration_v1_to(args, dest_ty, dest)
+            }
+            "os.time.tzdb_zone_drop_v1" => {
+                self.emit_os_time_tzdb_zone_drop_v1_to(args, dest_ty, dest)
+            }
+            "os.time.tzdb_zone_offsets_batch_v1" => {
+                self.emit_os_time_tzdb_zone_offsets_batch_v1_to(args, dest_ty, dest)
+            }
             "process.set_exit_code_v1" => {
                 self.emit_process_set_exit_code_v1_to(args, dest_ty, dest)
             }
@@ -2947,20 +3120,50 @@ Use a signed comparison like `(>= x 0)` when checking for negatives, or remove t
                 format!("{head} expects (bytes_view, bytes_view)"),
             ));
         }
-        let a_expr = format!(
-            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
-            a.c_name, a.c_name
-        );
-        let b_expr = format!(
-            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
-            b.c_name, b.c_name
-        );
-        self.line(&format!("{dest} = {c_fn}({a_expr}, {b_expr});"));
+        let a_expr = format!("rt_math_f64_unbox(ctx, {}.ptr, {}.len)", a.c_name, a.c_name);
+        let b_expr = format!("rt_math_f64_unbox(ctx, {}.ptr, {}.len)", b.c_name, b.c_name);
+        self.line(&format!(
+            "{dest} = rt_math_f64_box(ctx, {c_fn}({a_expr}, {b_expr}));"
+        ));
         self.release_temp_view_borrow(&a)?;
         self.release_temp_view_borrow(&b)?;
         Ok(())
     }
 
+    pub(super) fn emit_math_f64_scalar_unop_to(
+        &mut self,
+        head: &str,
+        c_fn: &str,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(native::BACKEND_ID_MATH, native::ABI_MAJOR_V1, head)?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                format!("{head} expects 1 arg"),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} returns bytes"),
+            ));
+        }
+        let x = self.emit_expr_as_bytes_view(&args[0])?;
+        if x.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} expects bytes_view"),
+            ));
+        }
+        let x_expr = format!("rt_math_f64_unbox(ctx, {}.ptr, {}.len)", x.c_name, x.c_name);
+        self.line(&format!("{dest} = rt_math_f64_box(ctx, {c_fn}({x_expr}));"));
+        self.release_temp_view_borrow(&x)?;
+        Ok(())
+    }
+
     pub(super) fn emit_math_f64_unop_to(
         &mut self,
         head: &str,
@@ -2998,6 +3201,149 @@ Use a signed comparison like `(>= x 0)` when checking for negatives, or remove t
         Ok(())
     }
 
+    pub(super) fn emit_math_f64_arr_binop_to(
+        &mut self,
+        head: &str,
+        c_fn: &str,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(native::BACKEND_ID_MATH, native::ABI_MAJOR_V1, head)?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                format!("{head} expects 2 args"),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} returns bytes"),
+            ));
+        }
+        let a = self.emit_expr_as_bytes_view(&args[0])?;
+        let b = self.emit_expr_as_bytes_view(&args[1])?;
+        if a.ty != Ty::BytesView || b.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} expects (bytes_view, bytes_view)"),
+            ));
+        }
+        let a_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            a.c_name, a.c_name
+        );
+        let b_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            b.c_name, b.c_name
+        );
+        self.line(&format!("{dest} = {c_fn}({a_expr}, {b_expr});"));
+        self.release_temp_view_borrow(&a)?;
+        self.release_temp_view_borrow(&b)?;
+        Ok(())
+    }
+
+    pub(super) fn emit_math_f64_arr_fma_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_MATH,
+            native::ABI_MAJOR_V1,
+            "math.f64.arr.fma_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "math.f64.arr.fma_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "math.f64.arr.fma_v1 returns bytes".to_string(),
+            ));
+        }
+        let a = self.emit_expr_as_bytes_view(&args[0])?;
+        let b = self.emit_expr_as_bytes_view(&args[1])?;
+        let c = self.emit_expr_as_bytes_view(&args[2])?;
+        if a.ty != Ty::BytesView || b.ty != Ty::BytesView || c.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "math.f64.arr.fma_v1 expects (bytes_view, bytes_view, bytes_view)".to_string(),
+            ));
+        }
+        let a_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            a.c_name, a.c_name
+        );
+        let b_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            b.c_name, b.c_name
+        );
+        let c_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            c.c_name, c.c_name
+        );
+        self.line(&format!(
+            "{dest} = ev_math_f64_arr_fma_v1({a_expr}, {b_expr}, {c_expr});"
+        ));
+        self.release_temp_view_borrow(&a)?;
+        self.release_temp_view_borrow(&b)?;
+        self.release_temp_view_borrow(&c)?;
+        Ok(())
+    }
+
+    pub(super) fn emit_math_f64_arr_parse_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_MATH,
+            native::ABI_MAJOR_V1,
+            "math.f64.arr.parse_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "math.f64.arr.parse_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "math.f64.arr.parse_v1 returns result_bytes".to_string(),
+            ));
+        }
+        let base = self.emit_expr_as_bytes_view(&args[0])?;
+        let list = self.emit_expr_as_bytes_view(&args[1])?;
+        if base.ty != Ty::BytesView || list.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "math.f64.arr.parse_v1 expects (bytes_view, bytes_view)".to_string(),
+            ));
+        }
+        let base_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            base.c_name, base.c_name
+        );
+        let list_expr = format!(
+            "(bytes_t){{ .ptr = {}.ptr, .len = {}.len }}",
+            list.c_name, list.c_name
+        );
+        self.line(&format!(
+            "{dest} = ev_math_f64_arr_parse_v1({base_expr}, {list_expr});"
+        ));
+        self.release_temp_view_borrow(&base)?;
+        self.release_temp_view_borrow(&list)?;
+        Ok(())
+    }
+
     pub(super) fn emit_math_f64_parse_to(
         &mut self,
         args: &[Expr],
@@ -4774,85 +5120,76 @@ Use a signed comparison like `(>= x 0)` when checking for negatives, or remove t
         Ok(())
     }
 
-    pub(super) fn emit_regex_compile_opts_v1_to(
+    pub(super) fn emit_view_find_u8_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_native_backend(
-            native::BACKEND_ID_EXT_REGEX,
-            native::ABI_MAJOR_V1,
-            "regex.compile_opts_v1",
-        )?;
         if args.len() != 2 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "regex.compile_opts_v1 expects 2 args".to_string(),
+                "view.find_u8 expects 2 args".to_string(),
             ));
         }
-        if dest_ty != Ty::Bytes {
+        if dest_ty != Ty::I32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "regex.compile_opts_v1 returns bytes".to_string(),
+                "view.find_u8 returns i32".to_string(),
             ));
         }
-        let pat = self.emit_expr(&args[0])?;
-        let opts = self.emit_expr(&args[1])?;
-        if pat.ty != Ty::BytesView || opts.ty != Ty::I32 {
+        let v = self.emit_expr(&args[0])?;
+        let c = self.emit_expr(&args[1])?;
+        if v.ty != Ty::BytesView || c.ty != Ty::I32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "regex.compile_opts_v1 expects (bytes_view pat, i32 opts)".to_string(),
+                "view.find_u8 expects (bytes_view, i32)".to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_regex_compile_opts_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
-            pat.c_name, pat.c_name, opts.c_name
+            "{dest} = rt_view_find_u8(ctx, {}, {});",
+            v.c_name, c.c_name
         ));
+        self.release_temp_view_borrow(&v)?;
         Ok(())
     }
 
-    pub(super) fn emit_regex_exec_from_v1_to(
+    pub(super) fn emit_view_find_sub_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_native_backend(
-            native::BACKEND_ID_EXT_REGEX,
-            native::ABI_MAJOR_V1,
-            "regex.exec_from_v1",
-        )?;
-        if args.len() != 3 {
+        if args.len() != 2 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "regex.exec_from_v1 expects 3 args".to_string(),
+                "view.find_sub expects 2 args".to_string(),
             ));
         }
-        if dest_ty != Ty::Bytes {
+        if dest_ty != Ty::I32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "regex.exec_from_v1 returns bytes".to_string(),
+                "view.find_sub returns i32".to_string(),
             ));
         }
-        let compiled = self.emit_expr(&args[0])?;
-        let text = self.emit_expr(&args[1])?;
-        let start = self.emit_expr(&args[2])?;
-        if compiled.ty != Ty::BytesView || text.ty != Ty::BytesView || start.ty != Ty::I32 {
+        let hay = self.emit_expr(&args[0])?;
+        let needle = self.emit_expr(&args[1])?;
+        if hay.ty != Ty::BytesView || needle.ty != Ty::BytesView {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "regex.exec_from_v1 expects (bytes_view compiled, bytes_view text, i32 start)"
-                    .to_string(),
+                "view.find_sub expects (bytes_view, bytes_view)".to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_regex_exec_from_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
-            compiled.c_name, compiled.c_name, text.c_name, text.c_name, start.c_name
+            "{dest} = rt_view_find_sub(ctx, {}, {});",
+            hay.c_name, needle.c_name
         ));
+        self.release_temp_view_borrow(&hay)?;
+        self.release_temp_view_borrow(&needle)?;
         Ok(())
     }
 
-    pub(super) fn emit_regex_exec_caps_from_v1_to(
+    pub(super) fn emit_regex_compile_opts_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
@@ -4861,18 +5198,96 @@ Use a signed comparison like `(>= x 0)` when checking for negatives, or remove t
         self.require_native_backend(
             native::BACKEND_ID_EXT_REGEX,
             native::ABI_MAJOR_V1,
-            "regex.exec_caps_from_v1",
+            "regex.compile_opts_v1",
         )?;
-        if args.len() != 3 {
+        if args.len() != 2 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "regex.exec_caps_from_v1 expects 3 args".to_string(),
+                "regex.compile_opts_v1 expects 2 args".to_string(),
             ));
         }
         if dest_ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "regex.exec_caps_from_v1 returns bytes".to_string(),
+                "regex.compile_opts_v1 returns bytes".to_string(),
+            ));
+        }
+        let pat = self.emit_expr(&args[0])?;
+        let opts = self.emit_expr(&args[1])?;
+        if pat.ty != Ty::BytesView || opts.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.compile_opts_v1 expects (bytes_view pat, i32 opts)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_compile_opts_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            pat.c_name, pat.c_name, opts.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_exec_from_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.exec_from_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.exec_from_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.exec_from_v1 returns bytes".to_string(),
+            ));
+        }
+        let compiled = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let start = self.emit_expr(&args[2])?;
+        if compiled.ty != Ty::BytesView || text.ty != Ty::BytesView || start.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.exec_from_v1 expects (bytes_view compiled, bytes_view text, i32 start)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_exec_from_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            compiled.c_name, compiled.c_name, text.c_name, text.c_name, start.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_exec_caps_from_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.exec_caps_from_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.exec_caps_from_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.exec_caps_from_v1 returns bytes".to_string(),
             ));
         }
         let compiled = self.emit_expr(&args[0])?;
@@ -5015,81 +5430,661 @@ Use a signed comparison like `(>= x 0)` when checking for negatives, or remove t
         Ok(())
     }
 
-    pub(super) fn emit_jsonschema_compile_v1_to(
+    pub(super) fn emit_regex_handle_compile_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
         self.require_native_backend(
-            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::BACKEND_ID_EXT_REGEX,
             native::ABI_MAJOR_V1,
-            "jsonschema.compile_v1",
+            "regex.handle_compile_v1",
         )?;
-        if args.len() != 1 {
+        if args.len() != 2 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "jsonschema.compile_v1 expects 1 arg".to_string(),
+                "regex.handle_compile_v1 expects 2 args".to_string(),
             ));
         }
         if dest_ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "jsonschema.compile_v1 returns bytes".to_string(),
+                "regex.handle_compile_v1 returns bytes".to_string(),
             ));
         }
-        let schema_json = self.emit_expr(&args[0])?;
-        if schema_json.ty != Ty::BytesView {
+        let pat = self.emit_expr(&args[0])?;
+        let opts = self.emit_expr(&args[1])?;
+        if pat.ty != Ty::BytesView || opts.ty != Ty::I32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "jsonschema.compile_v1 expects bytes_view schema_json".to_string(),
+                "regex.handle_compile_v1 expects (bytes_view pat, i32 opts)"
+                    .to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_jsonschema_compile_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
-            schema_json.c_name, schema_json.c_name
+            "{dest} = x07_ext_regex_handle_compile_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            pat.c_name, pat.c_name, opts.c_name
         ));
         Ok(())
     }
 
-    pub(super) fn emit_jsonschema_validate_v1_to(
+    pub(super) fn emit_regex_handle_exec_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
         self.require_native_backend(
-            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::BACKEND_ID_EXT_REGEX,
             native::ABI_MAJOR_V1,
-            "jsonschema.validate_v1",
+            "regex.handle_exec_v1",
         )?;
-        if args.len() != 2 {
+        if args.len() != 3 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "jsonschema.validate_v1 expects 2 args".to_string(),
+                "regex.handle_exec_v1 expects 3 args".to_string(),
             ));
         }
         if dest_ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "jsonschema.validate_v1 returns bytes".to_string(),
+                "regex.handle_exec_v1 returns bytes".to_string(),
             ));
         }
-        let compiled = self.emit_expr(&args[0])?;
-        let instance_json = self.emit_expr(&args[1])?;
-        if compiled.ty != Ty::BytesView || instance_json.ty != Ty::BytesView {
+        let regex_handle = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let start = self.emit_expr(&args[2])?;
+        if regex_handle.ty != Ty::I32
+            || text.ty != Ty::BytesView
+            || start.ty != Ty::I32
+        {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "jsonschema.validate_v1 expects (bytes_view compiled, bytes_view instance_json)"
+                "regex.handle_exec_v1 expects (i32 regex_handle, bytes_view text, i32 start)"
                     .to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_jsonschema_validate_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
-            compiled.c_name,
-            compiled.c_name,
-            instance_json.c_name,
-            instance_json.c_name
+            "{dest} = x07_ext_regex_handle_exec_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            regex_handle.c_name, text.c_name, text.c_name, start.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_handle_exec_caps_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.handle_exec_caps_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.handle_exec_caps_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_exec_caps_v1 returns bytes".to_string(),
+            ));
+        }
+        let regex_handle = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let start = self.emit_expr(&args[2])?;
+        if regex_handle.ty != Ty::I32
+            || text.ty != Ty::BytesView
+            || start.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_exec_caps_v1 expects (i32 regex_handle, bytes_view text, i32 start)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_handle_exec_caps_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            regex_handle.c_name, text.c_name, text.c_name, start.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_handle_find_all_x7sl_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.handle_find_all_x7sl_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.handle_find_all_x7sl_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_find_all_x7sl_v1 returns bytes".to_string(),
+            ));
+        }
+        let regex_handle = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let max_matches = self.emit_expr(&args[2])?;
+        if regex_handle.ty != Ty::I32
+            || text.ty != Ty::BytesView
+            || max_matches.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_find_all_x7sl_v1 expects (i32 regex_handle, bytes_view text, i32 max_matches)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_handle_find_all_x7sl_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            regex_handle.c_name, text.c_name, text.c_name, max_matches.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_handle_split_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.handle_split_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.handle_split_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_split_v1 returns bytes".to_string(),
+            ));
+        }
+        let regex_handle = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let max_parts = self.emit_expr(&args[2])?;
+        if regex_handle.ty != Ty::I32
+            || text.ty != Ty::BytesView
+            || max_parts.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_split_v1 expects (i32 regex_handle, bytes_view text, i32 max_parts)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_handle_split_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            regex_handle.c_name, text.c_name, text.c_name, max_parts.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_handle_replace_all_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.handle_replace_all_v1",
+        )?;
+        if args.len() != 4 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.handle_replace_all_v1 expects 4 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_replace_all_v1 returns bytes".to_string(),
+            ));
+        }
+        let regex_handle = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let repl = self.emit_expr(&args[2])?;
+        let cap_limit = self.emit_expr(&args[3])?;
+        if regex_handle.ty != Ty::I32
+            || text.ty != Ty::BytesView
+            || repl.ty != Ty::BytesView
+            || cap_limit.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_replace_all_v1 expects (i32 regex_handle, bytes_view text, bytes_view repl, i32 cap_limit)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_handle_replace_all_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            regex_handle.c_name,
+            text.c_name,
+            text.c_name,
+            repl.c_name,
+            repl.c_name,
+            cap_limit.c_name,
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_handle_drop_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.handle_drop_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.handle_drop_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_drop_v1 returns i32".to_string(),
+            ));
+        }
+        let regex_handle = self.emit_expr(&args[0])?;
+        if regex_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.handle_drop_v1 expects i32 regex_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_handle_drop_v1((int32_t){});",
+            regex_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_set_compile_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.set_compile_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.set_compile_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.set_compile_v1 returns bytes".to_string(),
+            ));
+        }
+        let pats = self.emit_expr(&args[0])?;
+        let count = self.emit_expr(&args[1])?;
+        let opts = self.emit_expr(&args[2])?;
+        if pats.ty != Ty::BytesView
+            || count.ty != Ty::I32
+            || opts.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.set_compile_v1 expects (bytes_view pats, i32 count, i32 opts)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_set_compile_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){}, (int32_t){});",
+            pats.c_name, pats.c_name, count.c_name, opts.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_set_scan_x7sl_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.set_scan_x7sl_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.set_scan_x7sl_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.set_scan_x7sl_v1 returns bytes".to_string(),
+            ));
+        }
+        let set_handle = self.emit_expr(&args[0])?;
+        let text = self.emit_expr(&args[1])?;
+        let max_matches = self.emit_expr(&args[2])?;
+        if set_handle.ty != Ty::I32
+            || text.ty != Ty::BytesView
+            || max_matches.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.set_scan_x7sl_v1 expects (i32 set_handle, bytes_view text, i32 max_matches)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_set_scan_x7sl_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            set_handle.c_name, text.c_name, text.c_name, max_matches.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_regex_set_drop_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_REGEX,
+            native::ABI_MAJOR_V1,
+            "regex.set_drop_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "regex.set_drop_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.set_drop_v1 returns i32".to_string(),
+            ));
+        }
+        let set_handle = self.emit_expr(&args[0])?;
+        if set_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "regex.set_drop_v1 expects i32 set_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_regex_set_drop_v1((int32_t){});",
+            set_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_jsonschema_compile_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::ABI_MAJOR_V1,
+            "jsonschema.compile_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "jsonschema.compile_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.compile_v1 returns bytes".to_string(),
+            ));
+        }
+        let schema_json = self.emit_expr(&args[0])?;
+        if schema_json.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.compile_v1 expects bytes_view schema_json".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_jsonschema_compile_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+            schema_json.c_name, schema_json.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_jsonschema_validate_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::ABI_MAJOR_V1,
+            "jsonschema.validate_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "jsonschema.validate_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.validate_v1 returns bytes".to_string(),
+            ));
+        }
+        let compiled = self.emit_expr(&args[0])?;
+        let instance_json = self.emit_expr(&args[1])?;
+        if compiled.ty != Ty::BytesView || instance_json.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.validate_v1 expects (bytes_view compiled, bytes_view instance_json)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_jsonschema_validate_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+            compiled.c_name,
+            compiled.c_name,
+            instance_json.c_name,
+            instance_json.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_jsonschema_handle_compile_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::ABI_MAJOR_V1,
+            "jsonschema.handle_compile_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "jsonschema.handle_compile_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.handle_compile_v1 returns bytes".to_string(),
+            ));
+        }
+        let schema_json = self.emit_expr(&args[0])?;
+        if schema_json.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.handle_compile_v1 expects bytes_view schema_json"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_jsonschema_handle_compile_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+            schema_json.c_name, schema_json.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_jsonschema_handle_validate_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::ABI_MAJOR_V1,
+            "jsonschema.handle_validate_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "jsonschema.handle_validate_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.handle_validate_v1 returns bytes".to_string(),
+            ));
+        }
+        let schema_handle = self.emit_expr(&args[0])?;
+        let instance_json = self.emit_expr(&args[1])?;
+        if schema_handle.ty != Ty::I32
+            || instance_json.ty != Ty::BytesView
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.handle_validate_v1 expects (i32 schema_handle, bytes_view instance_json)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_jsonschema_handle_validate_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+            schema_handle.c_name, instance_json.c_name, instance_json.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_jsonschema_handle_drop_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::ABI_MAJOR_V1,
+            "jsonschema.handle_drop_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "jsonschema.handle_drop_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.handle_drop_v1 returns i32".to_string(),
+            ));
+        }
+        let schema_handle = self.emit_expr(&args[0])?;
+        if schema_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.handle_drop_v1 expects i32 schema_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_jsonschema_handle_drop_v1((int32_t){});",
+            schema_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_jsonschema_validate_batch_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_JSONSCHEMA,
+            native::ABI_MAJOR_V1,
+            "jsonschema.validate_batch_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "jsonschema.validate_batch_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.validate_batch_v1 returns bytes".to_string(),
+            ));
+        }
+        let schema_handle = self.emit_expr(&args[0])?;
+        let instances = self.emit_expr(&args[1])?;
+        let count = self.emit_expr(&args[2])?;
+        if schema_handle.ty != Ty::I32
+            || instances.ty != Ty::BytesView
+            || count.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "jsonschema.validate_batch_v1 expects (i32 schema_handle, bytes_view instances, i32 count)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_jsonschema_validate_batch_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }}, (int32_t){});",
+            schema_handle.c_name, instances.c_name, instances.c_name, count.c_name
         ));
         Ok(())
     }
@@ -74,6 +74,7 @@ impl<'a> Emitter<'a> {
         self.line("uint64_t fuel_excl;");
         self.line("uint64_t alloc_calls_excl;");
         self.line("uint64_t alloc_bytes_excl;");
+        self.line("uint64_t cycles_excl;");
         self.indent -= 1;
         self.line("} x07_profile_fn_acc_t;");
         self.line("typedef struct {");
@@ -82,13 +83,47 @@ impl<'a> Emitter<'a> {
         self.line("uint64_t fuel_start;");
         self.line("uint64_t alloc_calls_start;");
         self.line("uint64_t alloc_bytes_start;");
+        self.line("uint64_t cycles_start;");
         self.line("uint64_t child_fuel;");
         self.line("uint64_t child_alloc_calls;");
         self.line("uint64_t child_alloc_bytes;");
+        self.line("uint64_t child_cycles;");
         self.indent -= 1;
         self.line("} x07_profile_fn_frame_t;");
 
+        // Raw cycle counter for the optional wall-clock dimension
+        // (X07_PROFILE_CYCLES=1). Cycle readings are inherently
+        // non-deterministic, so they are gated separately from the
+        // deterministic fuel/alloc counters and never affect program
+        // behavior — only the dump.
+        self.line("static inline uint64_t x07_profile_cycles_now(void) {");
+        self.indent += 1;
+        self.line("#if defined(__x86_64__) || defined(_M_X64)");
+        self.line("uint32_t lo, hi;");
+        self.line("__asm__ __volatile__(\"rdtsc\" : \"=a\"(lo), \"=d\"(hi));");
+        self.line("return ((uint64_t)hi << 32) | (uint64_t)lo;");
+        self.line("#elif defined(__aarch64__)");
+        self.line("uint64_t v;");
+        self.line("__asm__ __volatile__(\"mrs %0, cntvct_el0\" : \"=r\"(v));");
+        self.line("return v;");
+        self.line("#else");
+        self.line("// clock_gettime fallback; the dump labels the unit accordingly.");
+        self.line("struct timespec ts;");
+        self.line("(void)clock_gettime(CLOCK_MONOTONIC, &ts);");
+        self.line("return (uint64_t)ts.tv_sec * UINT64_C(1000000000) + (uint64_t)ts.tv_nsec;");
+        self.line("#endif");
+        self.indent -= 1;
+        self.line("}");
+        self.line("#if defined(__x86_64__) || defined(_M_X64)");
+        self.line("#define X07_PROFILE_CYCLES_UNIT \"tsc\"");
+        self.line("#elif defined(__aarch64__)");
+        self.line("#define X07_PROFILE_CYCLES_UNIT \"cntvct\"");
+        self.line("#else");
+        self.line("#define X07_PROFILE_CYCLES_UNIT \"ns\"");
+        self.line("#endif");
+
         self.line("static uint8_t x07_profile_enabled = 0;");
+        self.line("static uint8_t x07_profile_cycles_enabled = 0;");
         self.line("static x07_profile_fn_acc_t x07_profile_fn_acc[X07_PROFILE_FN_COUNT];");
         self.line("static x07_profile_fn_frame_t x07_profile_stack[X07_PROFILE_STACK_CAP];");
         self.line("static uint32_t x07_profile_stack_len = 0;");
@@ -110,6 +145,8 @@ impl<'a> Emitter<'a> {
         self.line("const char* v = getenv(\"X07_PROFILE\");");
         self.line("if (!v || !v[0] || v[0] == '0') return;");
         self.line("x07_profile_enabled = 1;");
+        self.line("const char* c = getenv(\"X07_PROFILE_CYCLES\");");
+        self.line("if (c && c[0] && c[0] != '0') x07_profile_cycles_enabled = 1;");
         self.indent -= 1;
         self.line("}");
 
@@ -127,6 +164,8 @@ impl<'a> Emitter<'a> {
         self.line("fr->child_fuel = 0;");
         self.line("fr->child_alloc_calls = 0;");
         self.line("fr->child_alloc_bytes = 0;");
+        self.line("fr->child_cycles = 0;");
+        self.line("fr->cycles_start = x07_profile_cycles_enabled ? x07_profile_cycles_now() : 0;");
         self.indent -= 1;
         self.line("}");
 
@@ -147,6 +186,14 @@ impl<'a> Emitter<'a> {
         );
         self.line("uint64_t alloc_calls_excl = (alloc_calls_delta > fr.child_alloc_calls) ? (alloc_calls_delta - fr.child_alloc_calls) : 0;");
         self.line("uint64_t alloc_bytes_excl = (alloc_bytes_delta > fr.child_alloc_bytes) ? (alloc_bytes_delta - fr.child_alloc_bytes) : 0;");
+        self.line("uint64_t cycles_delta = 0;");
+        self.line("if (x07_profile_cycles_enabled) {");
+        self.indent += 1;
+        self.line("cycles_delta = x07_profile_cycles_now() - fr.cycles_start;");
+        self.line("uint64_t cycles_excl = (cycles_delta > fr.child_cycles) ? (cycles_delta - fr.child_cycles) : 0;");
+        self.line("x07_profile_fn_acc[fr.fn_id].cycles_excl += cycles_excl;");
+        self.indent -= 1;
+        self.line("}");
         self.line("x07_profile_fn_acc[fr.fn_id].fuel_excl += fuel_excl;");
         self.line("x07_profile_fn_acc[fr.fn_id].alloc_calls_excl += alloc_calls_excl;");
         self.line("x07_profile_fn_acc[fr.fn_id].alloc_bytes_excl += alloc_bytes_excl;");
@@ -158,6 +205,7 @@ impl<'a> Emitter<'a> {
         self.line("parent->child_fuel += fuel_delta;");
         self.line("parent->child_alloc_calls += alloc_calls_delta;");
         self.line("parent->child_alloc_bytes += alloc_bytes_delta;");
+        self.line("parent->child_cycles += cycles_delta;");
         self.indent -= 1;
         self.line("}");
         self.indent -= 1;
@@ -167,16 +215,24 @@ impl<'a> Emitter<'a> {
         self.indent += 1;
         self.line("if (!x07_profile_enabled) return;");
         self.line(
-            "fprintf(stderr, \"{\\\"schema_version\\\":\\\"x07.profile.fn@0.1.0\\\",\\\"units\\\":{\\\"time\\\":\\\"fuel\\\"},\\\"functions\\\":[\");",
+            "fprintf(stderr, \"{\\\"schema_version\\\":\\\"x07.profile.fn@0.1.1\\\",\\\"units\\\":{\\\"time\\\":\\\"fuel\\\"\");",
+        );
+        self.line(
+            "if (x07_profile_cycles_enabled) fprintf(stderr, \",\\\"cycles\\\":\\\"\" X07_PROFILE_CYCLES_UNIT \"\\\"\");",
         );
+        self.line("fprintf(stderr, \"},\\\"functions\\\":[\");");
         self.line("int first = 1;");
         self.line("for (uint32_t i = 0; i < X07_PROFILE_FN_COUNT; i++) {");
         self.indent += 1;
         self.line("if (x07_profile_fn_acc[i].calls == 0) continue;");
         self.line("if (!first) fprintf(stderr, \",\");");
         self.line(
-            "fprintf(stderr, \"{\\\"fn\\\":\\\"%s\\\",\\\"calls\\\":%\" PRIu64 \",\\\"fuel_excl\\\":%\" PRIu64 \",\\\"alloc_calls_excl\\\":%\" PRIu64 \",\\\"alloc_bytes_excl\\\":%\" PRIu64 \"}\", x07_profile_fn_names[i], x07_profile_fn_acc[i].calls, x07_profile_fn_acc[i].fuel_excl, x07_profile_fn_acc[i].alloc_calls_excl, x07_profile_fn_acc[i].alloc_bytes_excl);",
+            "fprintf(stderr, \"{\\\"fn\\\":\\\"%s\\\",\\\"calls\\\":%\" PRIu64 \",\\\"fuel_excl\\\":%\" PRIu64 \",\\\"alloc_calls_excl\\\":%\" PRIu64 \",\\\"alloc_bytes_excl\\\":%\" PRIu64 \"\", x07_profile_fn_names[i], x07_profile_fn_acc[i].calls, x07_profile_fn_acc[i].fuel_excl, x07_profile_fn_acc[i].alloc_calls_excl, x07_profile_fn_acc[i].alloc_bytes_excl);",
+        );
+        self.line(
+            "if (x07_profile_cycles_enabled) fprintf(stderr, \",\\\"cycles_excl\\\":%\" PRIu64 \"\", x07_profile_fn_acc[i].cycles_excl);",
         );
+        self.line("fprintf(stderr, \"}\");");
         self.line("first = 0;");
         self.indent -= 1;
         self.line("}");
@@ -217,6 +273,11 @@ impl<'a> Emitter<'a> {
             program_uses_head(self.program, "__internal.bytes.alloc_aligned_v1")
                 || program_uses_head(self.program, "__internal.stream_xf.plugin_init_v1")
                 || program_uses_head(self.program, "__internal.stream_xf.plugin_step_v1")
+                || program_uses_head(self.program, "__internal.stream_xf.plugin_step_batch_v1")
+                || program_uses_head(self.program, "__internal.stream_xf.plugin_chain_step_v1")
+                || program_uses_head(self.program, "__internal.stream_xf.plugin_chain_flush_v1")
+                || program_uses_head(self.program, "__internal.stream_xf.plugin_shard_step_v1")
+                || program_uses_head(self.program, "__internal.stream_xf.plugin_shard_flush_v1")
                 || program_uses_head(self.program, "__internal.stream_xf.plugin_flush_v1");
 
         let uses_ext_obj_s3 = program_uses_head(self.program, "os.obj.s3.dispatch_v1");
@@ -656,6 +717,15 @@ impl<'a> Emitter<'a> {
         if self.suppress_output {
             return;
         }
+        if self.fuel_pending != 0 && line_is_fuel_boundary(s) {
+            let n = self.fuel_pending;
+            self.fuel_pending = 0;
+            self.raw_line(&format!("rt_fuel(ctx, {n});"));
+        }
+        self.raw_line(s);
+    }
+
+    fn raw_line(&mut self, s: &str) {
         for _ in 0..self.indent {
             self.out.push_str("  ");
         }
@@ -663,6 +733,19 @@ impl<'a> Emitter<'a> {
         self.out.push('\n');
     }
 
+    // Accumulates a fuel charge for a straight-line expression node. The
+    // pending total is emitted as a single rt_fuel call just before the next
+    // control-flow boundary line, so tight expression sequences pay one
+    // decrement-and-check per basic block instead of one per node. Charged
+    // totals are identical to per-node charging; only the trap point for
+    // exhaustion coarsens to block granularity.
+    pub(super) fn fuel_charge(&mut self, n: u64) {
+        if self.suppress_output {
+            return;
+        }
+        self.fuel_pending += n;
+    }
+
     pub(super) fn open_block(&mut self) {
         self.line("{");
         self.indent += 1;
@@ -674,6 +757,34 @@ impl<'a> Emitter<'a> {
     }
 }
 
+// Lines at which pending fuel charges must be flushed: anything that opens or
+// closes a block, transfers control, is a jump target, or observes the fuel
+// counter (budget scopes, profiling). Conservative over-matching only costs a
+// smaller batch, never correctness.
+fn line_is_fuel_boundary(s: &str) -> bool {
+    let t = s.trim_start();
+    if t.contains('{') || t.contains('}') {
+        return true;
+    }
+    t.starts_with("if ")
+        || t.starts_with("if(")
+        || t.starts_with("for ")
+        || t.starts_with("for(")
+        || t.starts_with("while ")
+        || t.starts_with("while(")
+        || t.starts_with("switch")
+        || t.starts_with("return")
+        || t.starts_with("break")
+        || t.starts_with("continue")
+        || t.starts_with("goto ")
+        || t.starts_with("case ")
+        || t.starts_with("default:")
+        || t.ends_with(':')
+        || t.contains("rt_fuel(")
+        || t.contains("rt_budget_scope_")
+        || t.contains("x07_profile_")
+}
+
 impl<'a> Emitter<'a> {
     pub(super) fn new(program: &'a Program, options: CompileOptions) -> Self {
         let mut fn_c_names = BTreeMap::new();
@@ -695,6 +806,7 @@ impl<'a> Emitter<'a> {
             out: String::new(),
             suppress_output: false,
             indent: 0,
+            fuel_pending: 0,
             tmp_counter: 0,
             local_count: 0,
             scopes: vec![BTreeMap::new()],
@@ -2088,9 +2200,25 @@ char* getenv(const char* name);
 int snprintf(char* s, size_t n, const char* fmt, ...);
 #endif
 
+// Large-memory profile: raises the default heap cap to just under the
+// 4 GiB ceiling imposed by the 32-bit heap offsets. Datasets beyond that
+// need the wide ABI profile (x07_abi_wide_v1.h), which widens lengths and
+// heap headers to 64 bits and is specified but not yet emitted.
+#ifndef X07_LARGE_MEM
+#define X07_LARGE_MEM 0
+#endif
+
 #ifndef X07_MEM_CAP
+#if X07_LARGE_MEM
+#define X07_MEM_CAP (3840u * 1024u * 1024u)
+#else
 #define X07_MEM_CAP (64u * 1024u * 1024u)
 #endif
+#endif
+
+#if (X07_MEM_CAP) > 4026531840u
+#error "X07_MEM_CAP exceeds the 32-bit heap offset range; this needs the wide ABI profile"
+#endif
 
 #ifndef X07_FUEL_INIT
 #define X07_FUEL_INIT 50000000ULL
@@ -2110,18 +2238,67 @@ int snprintf(char* s, size_t n, const char* fmt, ...);
 
 #define X07_ENABLE_STREAMING_FILE_IO (X07_ENABLE_FS || X07_ENABLE_RR || X07_ENABLE_KV)
 
+// Opt-in epoch arena: while a mem epoch is active, allocations are pointer
+// bumps out of a region carved from the top of the heap, and
+// rt_mem_epoch_reset reclaims the whole region in O(1). Allocations made
+// under rt_mem_epoch_pause (runtime metadata, cross-epoch state) still use
+// the general heap. Programs enabling this must not hold epoch-scoped
+// pointers across rt_mem_epoch_reset.
+#ifndef X07_EPOCH_ARENA
+#define X07_EPOCH_ARENA 0
+#endif
+
+#if X07_EPOCH_ARENA
+#ifndef X07_EPOCH_ARENA_CAP
+#define X07_EPOCH_ARENA_CAP (X07_MEM_CAP / 2u)
+#endif
+#endif
+
+// Opt-in multi-threaded executor for parallel-safe spawned tasks. Tasks
+// submitted via rt_task_create_parallel run on worker threads with
+// per-worker deques (work stealing) and per-worker heaps (no allocator
+// contention); completions are published to the cooperative scheduler in
+// submission order, so observable join ordering matches the
+// single-threaded schedule. Contract: a parallel task's poll must complete
+// in one call (no sleep/join/channel blocking) and must allocate only
+// through the ctx it is polled with; internal allocations it does not free
+// are leaked into the worker heap.
+#ifndef X07_MT_SCHED
+#define X07_MT_SCHED 0
+#endif
+
+#if X07_MT_SCHED
+#ifdef X07_FREESTANDING
+#error "X07_MT_SCHED requires a hosted build"
+#endif
+#include <pthread.h>
+#ifndef X07_MT_WORKERS
+#define X07_MT_WORKERS 4u
+#endif
+#ifndef X07_MT_WORKER_HEAP_CAP
+#define X07_MT_WORKER_HEAP_CAP (X07_MEM_CAP / (4u * (X07_MT_WORKERS)))
+#endif
+#ifndef X07_MT_JOB_CAP
+#define X07_MT_JOB_CAP 1024u
+#endif
+#endif
+
 #ifdef X07_FREESTANDING
 #if X07_ENABLE_FS || X07_ENABLE_RR || X07_ENABLE_KV
 #error "X07_FREESTANDING requires X07_ENABLE_FS/RR/KV=0"
 #endif
 #endif
 
+// X07_DEBUG_BORROW bookkeeping starts at these capacities and grows on
+// demand, so the caps are sizing hints rather than hard limits. Killed
+// records are recycled through free lists, keeping the tables proportional
+// to the live set instead of the allocation total.
 #ifdef X07_DEBUG_BORROW
 #ifndef X07_DBG_ALLOC_CAP
-#define X07_DBG_ALLOC_CAP 65536u
+#define X07_DBG_ALLOC_CAP 4096u
 #endif
 #ifndef X07_DBG_BORROW_CAP
-#define X07_DBG_BORROW_CAP 65536u
+#define X07_DBG_BORROW_CAP 4096u
 #endif
 #endif
 
@@ -2213,8 +2390,25 @@ static __attribute__((noreturn)) void rt_trap_path(const char* msg, const char*
 typedef uint32_t (*rt_ext_io_reader_read_fn_t)(uint32_t data, uint8_t* dst, uint32_t cap);
 typedef void (*rt_ext_io_reader_drop_fn_t)(uint32_t data);
 
+// Scatter-read extension (vtable v2). The backend fills the vecs in order
+// and returns the total byte count; it must fill a vec completely before
+// touching the next one, may stop early, and returns 0 only at EOF. A
+// backend should only keep filling past its first chunk while more data is
+// immediately available, so blocking semantics match a single read call.
+typedef struct {
+  uint8_t* ptr;
+  uint32_t cap;
+} rt_ext_io_vec_t;
+
+typedef uint32_t (*rt_ext_io_reader_read_vec_fn_t)(
+  uint32_t data,
+  rt_ext_io_vec_t* vecs,
+  uint32_t vec_count
+);
+
 typedef struct {
   rt_ext_io_reader_read_fn_t read;
+  rt_ext_io_reader_read_vec_fn_t read_vec;
   rt_ext_io_reader_drop_fn_t drop;
 } rt_ext_io_reader_vtable_t;
 
@@ -2225,15 +2419,16 @@ static uint32_t rt_ext_io_reader_vtables_len = 0;
 
 // External packages register IO reader vtables at runtime to enable `iface` streaming
 // through `io.read` / `bufread.*` without adding new builtins.
-uint32_t x07_rt_register_io_reader_vtable_v1(
+uint32_t x07_rt_register_io_reader_vtable_v2(
   rt_ext_io_reader_read_fn_t read,
+  rt_ext_io_reader_read_vec_fn_t read_vec,
   rt_ext_io_reader_drop_fn_t drop
 ) {
   if (!read) return 0;
 
   for (uint32_t i = 0; i < rt_ext_io_reader_vtables_len; i++) {
     rt_ext_io_reader_vtable_t* vt = &rt_ext_io_reader_vtables[i];
-    if (vt->read == read && vt->drop == drop) {
+    if (vt->read == read && vt->read_vec == read_vec && vt->drop == drop) {
       return RT_IFACE_VTABLE_EXT_IO_READER_MIN + i;
     }
   }
@@ -2243,6 +2438,7 @@ uint32_t x07_rt_register_io_reader_vtable_v1(
 
   rt_ext_io_reader_vtable_t* vt = &rt_ext_io_reader_vtables[rt_ext_io_reader_vtables_len];
   vt->read = read;
+  vt->read_vec = read_vec;
   vt->drop = drop;
 
   uint32_t id = RT_IFACE_VTABLE_EXT_IO_READER_MIN + rt_ext_io_reader_vtables_len;
@@ -2250,6 +2446,13 @@ uint32_t x07_rt_register_io_reader_vtable_v1(
   return id;
 }
 
+uint32_t x07_rt_register_io_reader_vtable_v1(
+  rt_ext_io_reader_read_fn_t read,
+  rt_ext_io_reader_drop_fn_t drop
+) {
+  return x07_rt_register_io_reader_vtable_v2(read, NULL, drop);
+}
+
 static uint32_t rt_ext_io_reader_read_into(uint32_t vtable, uint32_t data, uint8_t* dst, uint32_t cap) {
   if (vtable < RT_IFACE_VTABLE_EXT_IO_READER_MIN || vtable > RT_IFACE_VTABLE_EXT_IO_READER_MAX) {
     rt_trap("ext io reader invalid vtable");
@@ -2269,6 +2472,49 @@ static uint32_t rt_ext_io_reader_read_into(uint32_t vtable, uint32_t data, uint8
   return got;
 }
 
+static uint32_t rt_ext_io_reader_read_vec_into(
+  uint32_t vtable,
+  uint32_t data,
+  rt_ext_io_vec_t* vecs,
+  uint32_t vec_count
+) {
+  if (vtable < RT_IFACE_VTABLE_EXT_IO_READER_MIN || vtable > RT_IFACE_VTABLE_EXT_IO_READER_MAX) {
+    rt_trap("ext io reader invalid vtable");
+  }
+  uint32_t idx = vtable - RT_IFACE_VTABLE_EXT_IO_READER_MIN;
+  if (idx >= rt_ext_io_reader_vtables_len) {
+    rt_trap("ext io reader unregistered vtable");
+  }
+  rt_ext_io_reader_vtable_t* vt = &rt_ext_io_reader_vtables[idx];
+  uint64_t total_cap = 0;
+  for (uint32_t i = 0; i < vec_count; i++) {
+    total_cap += (uint64_t)vecs[i].cap;
+  }
+  if (vt->read_vec) {
+    uint32_t got = vt->read_vec(data, vecs, vec_count);
+    if ((uint64_t)got > total_cap) {
+      rt_trap("ext io reader returned too many bytes");
+    }
+    return got;
+  }
+  if (!vt->read) {
+    rt_trap("ext io reader missing read fn");
+  }
+  // v1 backend: sequential single reads, stopping at the first short read so
+  // blocking semantics match a lone read call.
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < vec_count; i++) {
+    if (vecs[i].cap == 0) continue;
+    uint32_t got = vt->read(data, vecs[i].ptr, vecs[i].cap);
+    if (got > vecs[i].cap) {
+      rt_trap("ext io reader returned too many bytes");
+    }
+    total += got;
+    if (got < vecs[i].cap) break;
+  }
+  return total;
+}
+
 typedef struct {
   bytes_t key;
   bytes_t val;
@@ -2333,15 +2579,22 @@ typedef struct {
   uint32_t ticks;
 } kv_latency_entry_t;
 
+// Heap allocator is fixed-capacity and deterministic.
+// Small blocks are served from size-class segregated free lists (exact-size
+// LIFO bins, O(1) alloc/free); everything else uses a singly-linked free list
+// of blocks (sorted by address) with coalescing. Bins are populated lazily by
+// carving exact-size blocks out of the large list, and a block stays bin-sized
+// for its lifetime, so steady-state small churn never walks the large list.
+#define RT_HEAP_ALIGN UINT32_C(16)
+#define RT_HEAP_SMALL_CLASSES UINT32_C(16)
+
 typedef struct {
   uint8_t* mem;
   uint32_t cap;
   uint32_t free_head;
+  uint32_t small_heads[RT_HEAP_SMALL_CLASSES];
 } heap_t;
 
-// Heap allocator is fixed-capacity and deterministic.
-// It uses a singly-linked free list of blocks (sorted by address) with coalescing.
-#define RT_HEAP_ALIGN UINT32_C(16)
 #define RT_HEAP_MAGIC_FREE UINT32_C(0x45564f46) // "X07F"
 #define RT_HEAP_MAGIC_USED UINT32_C(0x45564f55) // "X07U"
 #define RT_HEAP_NULL_OFF UINT32_MAX
@@ -2357,6 +2610,16 @@ static uint32_t rt_heap_align_u32(uint32_t x) {
   return (x + (RT_HEAP_ALIGN - 1u)) & ~(RT_HEAP_ALIGN - 1u);
 }
 
+// Maps a total block size (header included, multiple of RT_HEAP_ALIGN) to its
+// small-class index, or RT_HEAP_SMALL_CLASSES if the block takes the large path.
+static uint32_t rt_heap_small_class(uint32_t block_size) {
+  uint32_t hdr = (uint32_t)sizeof(heap_hdr_t);
+  if (block_size < hdr + RT_HEAP_ALIGN) return RT_HEAP_SMALL_CLASSES;
+  uint32_t cls = (block_size - hdr) / RT_HEAP_ALIGN - 1u;
+  if (cls >= RT_HEAP_SMALL_CLASSES) return RT_HEAP_SMALL_CLASSES;
+  return cls;
+}
+
 typedef struct {
   uint64_t alloc_calls;
   uint64_t realloc_calls;
@@ -2386,19 +2649,32 @@ __attribute__((weak)) allocator_v1_t x07_custom_allocator(void) {
 }
 
 #ifdef X07_DEBUG_BORROW
+// Slot records for the debug-borrow tables. alloc_id / borrow_id are
+// monotonically increasing and never reused, so a stale id from a freed
+// record can never resolve to a recycled slot. An id of 0 marks a free
+// slot; next_free then links the free list (slot index + 1, 0 = end).
 typedef struct {
+  uint64_t alloc_id;
   uint8_t* base_ptr;
   uint32_t size_bytes;
-  uint32_t alive;
+  uint32_t next_free;
   uint64_t borrow_id;
 } dbg_alloc_rec_t;
 
 typedef struct {
+  uint64_t borrow_id;
   uint64_t alloc_id;
   uint32_t off_bytes;
   uint32_t len_bytes;
-  uint32_t active;
+  uint32_t next_free;
 } dbg_borrow_rec_t;
+
+// Open-addressing index entry mapping an id to its slot. id == 0 marks an
+// empty cell; id == UINT64_MAX marks a tombstone left by removal.
+typedef struct {
+  uint64_t id;
+  uint32_t slot;
+} dbg_idx_ent_t;
 #endif
 
 typedef struct {
@@ -2445,14 +2721,31 @@ typedef struct {
   // Epoch id for mem_stats tracking (0 means "not started yet").
   uint32_t mem_epoch_id;
   mem_stats_t mem_stats;
+#if X07_EPOCH_ARENA
+  uint8_t* arena_base;
+  uint32_t arena_cap;
+  uint32_t arena_used;
+#endif
 #ifdef X07_DEBUG_BORROW
   dbg_alloc_rec_t* dbg_allocs;
   uint32_t dbg_allocs_len;
   uint32_t dbg_allocs_cap;
+  uint32_t dbg_allocs_free;
+  dbg_idx_ent_t* dbg_alloc_idx;
+  uint32_t dbg_alloc_idx_cap;
+  uint32_t dbg_alloc_idx_used;
+  uint32_t dbg_alloc_live;
+  uint64_t dbg_next_alloc_id;
 
   dbg_borrow_rec_t* dbg_borrows;
   uint32_t dbg_borrows_len;
   uint32_t dbg_borrows_cap;
+  uint32_t dbg_borrows_free;
+  dbg_idx_ent_t* dbg_borrow_idx;
+  uint32_t dbg_borrow_idx_cap;
+  uint32_t dbg_borrow_idx_used;
+  uint32_t dbg_borrow_live;
+  uint64_t dbg_next_borrow_id;
 
   uint64_t dbg_borrow_violations;
 #endif
@@ -2585,10 +2878,57 @@ bytes_t ev_math_f64_from_i32_v1(int32_t x);
 result_i32_t ev_math_f64_to_i32_trunc_v1(bytes_t x);
 bytes_t ev_math_f64_to_bits_u64le_v1(bytes_t x);
 
+// Native math backend entrypoints, pass-by-value scalar ABI v2
+// (x07_math_abi_v2.h; shipped in the same libx07_math.*).
+double ev_math_f64_add_v2(double a, double b);
+double ev_math_f64_sub_v2(double a, double b);
+double ev_math_f64_mul_v2(double a, double b);
+double ev_math_f64_div_v2(double a, double b);
+double ev_math_f64_neg_v2(double x);
+double ev_math_f64_abs_v2(double x);
+double ev_math_f64_min_v2(double a, double b);
+double ev_math_f64_max_v2(double a, double b);
+double ev_math_f64_sqrt_v2(double x);
+double ev_math_f64_sin_v2(double x);
+double ev_math_f64_cos_v2(double x);
+double ev_math_f64_tan_v2(double x);
+double ev_math_f64_exp_v2(double x);
+double ev_math_f64_ln_v2(double x);
+double ev_math_f64_pow_v2(double x, double y);
+double ev_math_f64_atan2_v2(double y, double x);
+double ev_math_f64_floor_v2(double x);
+double ev_math_f64_ceil_v2(double x);
+
+// Native math backend batch entrypoints over packed f64 arrays
+// (x07_math_batch_abi_v1.h; shipped in the same libx07_math.*).
+bytes_t ev_math_f64_arr_add_v1(bytes_t a, bytes_t b);
+bytes_t ev_math_f64_arr_sub_v1(bytes_t a, bytes_t b);
+bytes_t ev_math_f64_arr_mul_v1(bytes_t a, bytes_t b);
+bytes_t ev_math_f64_arr_div_v1(bytes_t a, bytes_t b);
+bytes_t ev_math_f64_arr_fma_v1(bytes_t a, bytes_t b, bytes_t c);
+bytes_t ev_math_f64_arr_neg_v1(bytes_t x);
+bytes_t ev_math_f64_arr_abs_v1(bytes_t x);
+bytes_t ev_math_f64_arr_sqrt_v1(bytes_t x);
+bytes_t ev_math_f64_arr_sin_v1(bytes_t x);
+bytes_t ev_math_f64_arr_cos_v1(bytes_t x);
+bytes_t ev_math_f64_arr_tan_v1(bytes_t x);
+bytes_t ev_math_f64_arr_exp_v1(bytes_t x);
+bytes_t ev_math_f64_arr_ln_v1(bytes_t x);
+bytes_t ev_math_f64_arr_floor_v1(bytes_t x);
+bytes_t ev_math_f64_arr_ceil_v1(bytes_t x);
+bytes_t ev_math_f64_arr_min_v1(bytes_t x);
+bytes_t ev_math_f64_arr_max_v1(bytes_t x);
+result_bytes_t ev_math_f64_arr_parse_v1(bytes_t base, bytes_t x7sl);
+bytes_t ev_math_f64_arr_fmt_shortest_v1(bytes_t x);
+
 // Native time backend entrypoints (linked from deps/x07/libx07_time.*).
 uint32_t ev_time_tzdb_is_valid_tzid_v1(bytes_t tzid);
 bytes_t ev_time_tzdb_offset_duration_v1(bytes_t tzid, int32_t unix_s_lo, int32_t unix_s_hi);
 bytes_t ev_time_tzdb_snapshot_id_v1(void);
+int32_t ev_time_tzdb_zone_open_v1(bytes_t tzid);
+bytes_t ev_time_tzdb_zone_offset_duration_v1(int32_t zone_handle, int32_t unix_s_lo, int32_t unix_s_hi);
+int32_t ev_time_tzdb_zone_drop_v1(int32_t zone_handle);
+bytes_t ev_time_tzdb_zone_offsets_batch_v1(int32_t zone_handle, bytes_t unix_s_packed);
 
 // Native ext-fs backend entrypoints (linked from deps/x07/libx07_ext_fs.*).
 result_bytes_t x07_ext_fs_read_all_v1(bytes_t path, bytes_t caps);
@@ -2609,11 +2949,20 @@ result_i32_t x07_ext_fs_stream_open_read_v1(bytes_t path, bytes_t caps);
 result_bytes_t x07_ext_fs_stream_read_some_v1(int32_t reader_handle, int32_t max_bytes);
 result_i32_t x07_ext_fs_stream_close_read_v1(int32_t reader_handle);
 int32_t x07_ext_fs_stream_drop_read_v1(int32_t reader_handle);
+result_i32_t x07_ext_fs_walk_open_v1(bytes_t root, bytes_t glob, bytes_t caps);
+result_bytes_t x07_ext_fs_walk_next_v1(int32_t walk_handle, int32_t max_entries);
+int32_t x07_ext_fs_walk_drop_v1(int32_t walk_handle);
+result_i32_t x07_ext_fs_view_open_v1(bytes_t path, bytes_t caps);
+bytes_t x07_ext_fs_view_bytes_v1(int32_t view_handle);
+int32_t x07_ext_fs_view_release_v1(int32_t view_handle);
 
 // Native ext-archive backend entrypoints (linked from deps/x07/libx07_ext_archive.*).
 bytes_t x07_ext_archive_tar_extract_to_fs_v1(bytes_t out_root, bytes_t tar_path, bytes_t caps_read, bytes_t caps_write, bytes_t profile_id);
 bytes_t x07_ext_archive_tgz_extract_to_fs_v1(bytes_t out_root, bytes_t tgz_path, bytes_t caps_read, bytes_t caps_write, bytes_t profile_id);
 bytes_t x07_ext_archive_zip_extract_to_fs_v1(bytes_t out_root, bytes_t zip_path, bytes_t caps_read, bytes_t caps_write, bytes_t profile_id);
+typedef uint32_t (*x07_ext_archive_read_fn_v1)(uint32_t data, uint8_t* dst, uint32_t cap);
+bytes_t x07_ext_archive_tar_extract_reader_to_fs_v1(bytes_t out_root, x07_ext_archive_read_fn_v1 read_fn, uint32_t read_data, bytes_t caps_read, bytes_t caps_write, bytes_t profile_id);
+bytes_t x07_ext_archive_tgz_extract_reader_to_fs_v1(bytes_t out_root, x07_ext_archive_read_fn_v1 read_fn, uint32_t read_data, bytes_t caps_read, bytes_t caps_write, bytes_t profile_id);
 
 // Native ext-stdio backend entrypoints (linked from deps/x07/libx07_ext_stdio.*).
 result_bytes_t x07_ext_stdio_read_line_v1(bytes_t caps);
@@ -2621,22 +2970,45 @@ result_i32_t x07_ext_stdio_write_stdout_v1(bytes_t data, bytes_t caps);
 result_i32_t x07_ext_stdio_write_stderr_v1(bytes_t data, bytes_t caps);
 result_i32_t x07_ext_stdio_flush_stdout_v1(void);
 result_i32_t x07_ext_stdio_flush_stderr_v1(void);
+result_i32_t x07_ext_stdio_write_vec_stdout_v1(bytes_t slices, bytes_t caps);
+result_i32_t x07_ext_stdio_write_vec_stderr_v1(bytes_t slices, bytes_t caps);
+result_i32_t x07_ext_stdio_buf_set_stdout_v1(int32_t watermark_bytes, bytes_t caps);
+result_i32_t x07_ext_stdio_buf_set_stderr_v1(int32_t watermark_bytes, bytes_t caps);
+result_i32_t x07_ext_stdio_buf_write_stdout_v1(bytes_t data);
+result_i32_t x07_ext_stdio_buf_write_stderr_v1(bytes_t data);
+result_i32_t x07_ext_stdio_buf_flush_stdout_v1(void);
+result_i32_t x07_ext_stdio_buf_flush_stderr_v1(void);
 
 // Native ext-rand backend entrypoints (linked from deps/x07/libx07_ext_rand.*).
 result_bytes_t x07_ext_rand_bytes_v1(int32_t n, bytes_t caps);
 result_bytes_t x07_ext_rand_u64_v1(bytes_t caps);
+result_bytes_t x07_ext_rand_pool_open_v1(int32_t reseed_interval_bytes, bytes_t caps);
+result_bytes_t x07_ext_rand_pool_bytes_v1(int32_t pool_handle, int32_t n);
+result_bytes_t x07_ext_rand_pool_u64_v1(int32_t pool_handle);
+int32_t x07_ext_rand_pool_close_v1(int32_t pool_handle);
 
 // Native ext-db-sqlite backend entrypoints (linked from deps/x07/libx07_ext_db_sqlite.*).
 bytes_t x07_ext_db_sqlite_open_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_sqlite_query_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_sqlite_exec_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_sqlite_close_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_sqlite_prepare_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_sqlite_stmt_query_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_sqlite_stmt_exec_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_sqlite_finalize_v1(bytes_t req, bytes_t caps);
 
 // Native ext-db-pg backend entrypoints (linked from deps/x07/libx07_ext_db_pg.*).
 bytes_t x07_ext_db_pg_open_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_pg_query_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_pg_exec_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_pg_close_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_copy_begin_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_copy_write_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_copy_finish_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_prepare_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_stmt_query_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_stmt_exec_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_pg_finalize_v1(bytes_t req, bytes_t caps);
 
 // Native ext-db-mysql backend entrypoints (linked from deps/x07/libx07_ext_db_mysql.*).
 bytes_t x07_ext_db_mysql_open_v1(bytes_t req, bytes_t caps);
@@ -2648,6 +3020,7 @@ bytes_t x07_ext_db_mysql_close_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_redis_open_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_redis_cmd_v1(bytes_t req, bytes_t caps);
 bytes_t x07_ext_db_redis_close_v1(bytes_t req, bytes_t caps);
+bytes_t x07_ext_db_redis_pipeline_v1(bytes_t req, bytes_t caps);
 
 // --- X07_EXT_OBJ_S3_START
 // Native ext-obj-s3 backend entrypoint (linked from deps/x07/libx07_ext_obj_s3.*).
@@ -2661,10 +3034,24 @@ bytes_t x07_ext_regex_exec_caps_from_v1(bytes_t compiled, bytes_t text, int32_t
 bytes_t x07_ext_regex_find_all_x7sl_v1(bytes_t compiled, bytes_t text, int32_t max_matches_i32);
 bytes_t x07_ext_regex_split_v1(bytes_t compiled, bytes_t text, int32_t max_parts_i32);
 bytes_t x07_ext_regex_replace_all_v1(bytes_t compiled, bytes_t text, bytes_t repl, int32_t cap_limit_i32);
+bytes_t x07_ext_regex_set_compile_v1(bytes_t pats, int32_t count, int32_t opts);
+bytes_t x07_ext_regex_set_scan_x7sl_v1(int32_t set_handle, bytes_t text, int32_t max_matches);
+int32_t x07_ext_regex_set_drop_v1(int32_t set_handle);
+bytes_t x07_ext_regex_handle_compile_v1(bytes_t pat, int32_t opts);
+bytes_t x07_ext_regex_handle_exec_v1(int32_t regex_handle, bytes_t text, int32_t start);
+bytes_t x07_ext_regex_handle_exec_caps_v1(int32_t regex_handle, bytes_t text, int32_t start);
+bytes_t x07_ext_regex_handle_find_all_x7sl_v1(int32_t regex_handle, bytes_t text, int32_t max_matches);
+bytes_t x07_ext_regex_handle_split_v1(int32_t regex_handle, bytes_t text, int32_t max_parts);
+bytes_t x07_ext_regex_handle_replace_all_v1(int32_t regex_handle, bytes_t text, bytes_t repl, int32_t cap_limit);
+int32_t x07_ext_regex_handle_drop_v1(int32_t regex_handle);
 
 // Native ext-jsonschema backend entrypoints (linked from deps/x07/libx07_ext_jsonschema.*).
 bytes_t x07_ext_jsonschema_compile_v1(bytes_t schema_json);
 bytes_t x07_ext_jsonschema_validate_v1(bytes_t compiled, bytes_t instance_json);
+bytes_t x07_ext_jsonschema_handle_compile_v1(bytes_t schema_json);
+bytes_t x07_ext_jsonschema_handle_validate_v1(int32_t schema_handle, bytes_t instance_json);
+int32_t x07_ext_jsonschema_handle_drop_v1(int32_t schema_handle);
+bytes_t x07_ext_jsonschema_validate_batch_v1(int32_t schema_handle, bytes_t instances, int32_t count);
 
 #ifdef X07_STANDALONE
 static uint32_t rt_os_process_poll_all(ctx_t* ctx, int poll_timeout_ms);
@@ -2747,14 +3134,136 @@ static void rt_write_u32_le(uint8_t* p, uint32_t x) {
   p[3] = (uint8_t)((x >> 24) & UINT32_C(0xFF));
 }
 
+// Vectorized byte kernels (equality, find-byte, find-subsequence). The widest
+// kernel available at compile time is selected from the target's predefined
+// macros (AVX2 > SSE2 > NEON > scalar). Every kernel computes the same result,
+// so program-observable behavior does not depend on which one is picked.
+#ifndef X07_FREESTANDING
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define X07_SIMD_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define X07_SIMD_SSE2 1
+#elif defined(__ARM_NEON) || defined(__aarch64__)
+#include <arm_neon.h>
+#define X07_SIMD_NEON 1
+#endif
+#endif
+
+#define RT_FIND_NONE UINT32_MAX
+
+static uint32_t rt_memeq(const uint8_t* a, const uint8_t* b, uint32_t n) {
+  uint32_t i = 0;
+#if defined(X07_SIMD_AVX2)
+  while (n - i >= 32u) {
+    __m256i va = _mm256_loadu_si256((const __m256i*)(a + i));
+    __m256i vb = _mm256_loadu_si256((const __m256i*)(b + i));
+    if ((uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(va, vb)) != UINT32_C(0xFFFFFFFF)) {
+      return UINT32_C(0);
+    }
+    i += 32u;
+  }
+#elif defined(X07_SIMD_SSE2)
+  while (n - i >= 16u) {
+    __m128i va = _mm_loadu_si128((const __m128i*)(a + i));
+    __m128i vb = _mm_loadu_si128((const __m128i*)(b + i));
+    if ((uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(va, vb)) != UINT32_C(0xFFFF)) {
+      return UINT32_C(0);
+    }
+    i += 16u;
+  }
+#elif defined(X07_SIMD_NEON)
+  while (n - i >= 16u) {
+    uint8x16_t va = vld1q_u8(a + i);
+    uint8x16_t vb = vld1q_u8(b + i);
+    if (vminvq_u8(vceqq_u8(va, vb)) != 0xFFu) return UINT32_C(0);
+    i += 16u;
+  }
+#endif
+  if (i < n && memcmp(a + i, b + i, n - i) != 0) return UINT32_C(0);
+  return UINT32_C(1);
+}
+
+static uint32_t rt_find_u8(const uint8_t* p, uint32_t n, uint8_t c) {
+  uint32_t i = 0;
+#if defined(X07_SIMD_AVX2)
+  __m256i vc = _mm256_set1_epi8((char)c);
+  while (n - i >= 32u && i < n) {
+    __m256i v = _mm256_loadu_si256((const __m256i*)(p + i));
+    uint32_t mask = (uint32_t)_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, vc));
+    if (mask != 0) return i + (uint32_t)__builtin_ctz(mask);
+    i += 32u;
+  }
+#elif defined(X07_SIMD_SSE2)
+  __m128i vc = _mm_set1_epi8((char)c);
+  while (n - i >= 16u && i < n) {
+    __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+    uint32_t mask = (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(v, vc));
+    if (mask != 0) return i + (uint32_t)__builtin_ctz(mask);
+    i += 16u;
+  }
+#elif defined(X07_SIMD_NEON)
+  uint8x16_t vc = vdupq_n_u8(c);
+  while (n - i >= 16u && i < n) {
+    if (vmaxvq_u8(vceqq_u8(vld1q_u8(p + i), vc)) != 0) {
+      for (uint32_t j = i; j < i + 16u; j++) {
+        if (p[j] == c) return j;
+      }
+    }
+    i += 16u;
+  }
+#endif
+  for (; i < n; i++) {
+    if (p[i] == c) return i;
+  }
+  return RT_FIND_NONE;
+}
+
+static uint32_t rt_find_sub(
+    const uint8_t* hay,
+    uint32_t hay_len,
+    const uint8_t* needle,
+    uint32_t needle_len
+) {
+  if (needle_len == 0) return UINT32_C(0);
+  if (needle_len > hay_len) return RT_FIND_NONE;
+  uint32_t last = hay_len - needle_len;
+  uint32_t i = 0;
+  while (i <= last) {
+    uint32_t hit = rt_find_u8(hay + i, last - i + 1u, needle[0]);
+    if (hit == RT_FIND_NONE) return RT_FIND_NONE;
+    i += hit;
+    if (rt_memeq(hay + i, needle, needle_len)) return i;
+    i += 1u;
+  }
+  return RT_FIND_NONE;
+}
+
 static void rt_heap_init(ctx_t* ctx) {
   if (!ctx->heap.mem) rt_trap("heap mem is NULL");
   uint32_t cap = ctx->heap.cap;
   cap &= ~(RT_HEAP_ALIGN - 1u);
   if (cap < (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN) rt_trap("heap too small");
+#if X07_EPOCH_ARENA
+  {
+    uint32_t arena_cap = (uint32_t)(X07_EPOCH_ARENA_CAP) & ~(RT_HEAP_ALIGN - 1u);
+    if (arena_cap == 0 || arena_cap >= cap ||
+        cap - arena_cap < (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN) {
+      rt_trap("heap too small for epoch arena");
+    }
+    cap -= arena_cap;
+    ctx->arena_base = ctx->heap.mem + cap;
+    ctx->arena_cap = arena_cap;
+    ctx->arena_used = 0;
+  }
+#endif
   ctx->heap.cap = cap;
 
   ctx->heap.free_head = 0;
+  for (uint32_t i = 0; i < RT_HEAP_SMALL_CLASSES; i++) {
+    ctx->heap.small_heads[i] = RT_HEAP_NULL_OFF;
+  }
   heap_hdr_t* h = (heap_hdr_t*)(ctx->heap.mem);
   h->size = cap;
   h->next_off = RT_HEAP_NULL_OFF;
@@ -2782,20 +3291,24 @@ static uint32_t rt_heap_is_pow2_u32(uint32_t x) {
   return x != 0 && (x & (x - 1u)) == 0;
 }
 
-static void* rt_heap_alloc(ctx_t* ctx, uint32_t size, uint32_t align) {
-  if (size == 0) return (void*)ctx->heap.mem;
-  if (align == 0) rt_trap("alloc align=0");
-  if (!rt_heap_is_pow2_u32(align)) rt_trap("alloc align not pow2");
-  if (align > RT_HEAP_ALIGN) rt_trap("alloc align too large");
+#if X07_EPOCH_ARENA
+static uint32_t rt_arena_contains(ctx_t* ctx, void* ptr) {
+  uint8_t* p = (uint8_t*)ptr;
+  return p >= ctx->arena_base && p < ctx->arena_base + ctx->arena_cap;
+}
 
+static void* rt_arena_alloc(ctx_t* ctx, uint32_t size) {
   uint32_t payload = rt_heap_align_u32(size);
-  uint32_t need = (uint32_t)sizeof(heap_hdr_t) + payload;
-  need = rt_heap_align_u32(need);
-  if (need < (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN) {
-    need = (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN;
-  }
-  if (need > ctx->heap.cap) return NULL;
+  if (payload < size) return NULL;
+  if (payload > ctx->arena_cap - ctx->arena_used) return NULL;
+  void* ptr = (void*)(ctx->arena_base + ctx->arena_used);
+  ctx->arena_used += payload;
+  memset(ptr, 0, payload);
+  return ptr;
+}
+#endif
 
+static void* rt_heap_large_scan(ctx_t* ctx, uint32_t need, uint32_t size, uint32_t payload) {
   uint32_t prev_off = RT_HEAP_NULL_OFF;
   uint32_t off = ctx->heap.free_head;
   while (off != RT_HEAP_NULL_OFF) {
@@ -2847,19 +3360,7 @@ static void* rt_heap_alloc(ctx_t* ctx, uint32_t size, uint32_t align) {
   return NULL;
 }
 
-static void rt_heap_free(ctx_t* ctx, void* ptr) {
-  if (!ptr) return;
-  if ((uint8_t*)ptr == ctx->heap.mem) return;
-  uint8_t* p = (uint8_t*)ptr;
-  if (p < ctx->heap.mem + (uint32_t)sizeof(heap_hdr_t)) rt_trap("free oob");
-  heap_hdr_t* h = (heap_hdr_t*)(p - (uint32_t)sizeof(heap_hdr_t));
-  uint32_t off = rt_heap_off_of(ctx, h);
-  if (h->magic != RT_HEAP_MAGIC_USED) rt_trap("double free or corrupt heap");
-  uint32_t size = h->size;
-  if (size < (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN) rt_trap("free corrupt size");
-  if ((size & (RT_HEAP_ALIGN - 1u)) != 0) rt_trap("free corrupt size");
-  if (off > ctx->heap.cap || ctx->heap.cap - off < size) rt_trap("free oob");
-
+static void rt_heap_large_insert(ctx_t* ctx, uint32_t off, heap_hdr_t* h) {
   // Insert into free list (sorted by address).
   uint32_t prev_off = RT_HEAP_NULL_OFF;
   uint32_t cur_off = ctx->heap.free_head;
@@ -2899,10 +3400,118 @@ static void rt_heap_free(ctx_t* ctx, void* ptr) {
   }
 }
 
+// Drains every small bin back into the sorted large list. Returns 1 if any
+// block moved.
+static uint32_t rt_heap_small_flush(ctx_t* ctx) {
+  uint32_t moved = 0;
+  for (uint32_t cls = 0; cls < RT_HEAP_SMALL_CLASSES; cls++) {
+    uint32_t off = ctx->heap.small_heads[cls];
+    ctx->heap.small_heads[cls] = RT_HEAP_NULL_OFF;
+    while (off != RT_HEAP_NULL_OFF) {
+      heap_hdr_t* h = rt_heap_hdr_at(ctx, off);
+      if (h->magic != RT_HEAP_MAGIC_FREE) rt_trap("heap small bin corrupt");
+      uint32_t next = h->next_off;
+      rt_heap_large_insert(ctx, off, h);
+      off = next;
+      moved = 1;
+    }
+  }
+  return moved;
+}
+
+static void* rt_heap_alloc(ctx_t* ctx, uint32_t size, uint32_t align) {
+  if (size == 0) return (void*)ctx->heap.mem;
+  if (align == 0) rt_trap("alloc align=0");
+  if (!rt_heap_is_pow2_u32(align)) rt_trap("alloc align not pow2");
+  if (align > RT_HEAP_ALIGN) rt_trap("alloc align too large");
+
+  uint32_t payload = rt_heap_align_u32(size);
+  uint32_t need = (uint32_t)sizeof(heap_hdr_t) + payload;
+  need = rt_heap_align_u32(need);
+  if (need < (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN) {
+    need = (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN;
+  }
+#if X07_EPOCH_ARENA
+  // Epoch-scoped allocations are pointer bumps; the general heap is the
+  // fallback when the arena is full (those blocks keep headers and free
+  // individually as before).
+  if (ctx->mem_epoch_id != 0) {
+    void* arena_ptr = rt_arena_alloc(ctx, size);
+    if (arena_ptr) return arena_ptr;
+  }
+#endif
+
+  if (need > ctx->heap.cap) return NULL;
+
+  // Small path: pop an exact-size block from the class bin.
+  uint32_t cls = rt_heap_small_class(need);
+  if (cls < RT_HEAP_SMALL_CLASSES && ctx->heap.small_heads[cls] != RT_HEAP_NULL_OFF) {
+    uint32_t off = ctx->heap.small_heads[cls];
+    heap_hdr_t* h = rt_heap_hdr_at(ctx, off);
+    if (h->magic != RT_HEAP_MAGIC_FREE) rt_trap("heap small bin corrupt");
+    if (h->size != need) rt_trap("heap small bin corrupt");
+    ctx->heap.small_heads[cls] = h->next_off;
+
+    h->next_off = ctx->mem_epoch_id;
+    h->magic = RT_HEAP_MAGIC_USED;
+    h->req_size = size;
+
+    void* ptr = (void*)(ctx->heap.mem + off + (uint32_t)sizeof(heap_hdr_t));
+    memset(ptr, 0, payload);
+    return ptr;
+  }
+
+  void* ptr = rt_heap_large_scan(ctx, need, size, payload);
+  if (ptr) return ptr;
+
+  // Large path exhausted: return bin blocks to the large list (with
+  // coalescing) and rescan once, so segregated storage never makes an
+  // allocation fail that the flat allocator could have served.
+  if (rt_heap_small_flush(ctx)) {
+    return rt_heap_large_scan(ctx, need, size, payload);
+  }
+  return NULL;
+}
+
+static void rt_heap_free(ctx_t* ctx, void* ptr) {
+  if (!ptr) return;
+  if ((uint8_t*)ptr == ctx->heap.mem) return;
+#if X07_EPOCH_ARENA
+  // Arena blocks are reclaimed wholesale at rt_mem_epoch_reset.
+  if (rt_arena_contains(ctx, ptr)) return;
+#endif
+  uint8_t* p = (uint8_t*)ptr;
+  if (p < ctx->heap.mem + (uint32_t)sizeof(heap_hdr_t)) rt_trap("free oob");
+  heap_hdr_t* h = (heap_hdr_t*)(p - (uint32_t)sizeof(heap_hdr_t));
+  uint32_t off = rt_heap_off_of(ctx, h);
+  if (h->magic != RT_HEAP_MAGIC_USED) rt_trap("double free or corrupt heap");
+  uint32_t size = h->size;
+  if (size < (uint32_t)sizeof(heap_hdr_t) + RT_HEAP_ALIGN) rt_trap("free corrupt size");
+  if ((size & (RT_HEAP_ALIGN - 1u)) != 0) rt_trap("free corrupt size");
+  if (off > ctx->heap.cap || ctx->heap.cap - off < size) rt_trap("free oob");
+
+  // Small path: push onto the class bin (LIFO, no coalescing).
+  uint32_t cls = rt_heap_small_class(size);
+  if (cls < RT_HEAP_SMALL_CLASSES) {
+    h->magic = RT_HEAP_MAGIC_FREE;
+    h->next_off = ctx->heap.small_heads[cls];
+    h->req_size = 0;
+    ctx->heap.small_heads[cls] = off;
+    return;
+  }
+
+  rt_heap_large_insert(ctx, off, h);
+}
+
 static void rt_mem_epoch_reset(ctx_t* ctx) {
   ctx->mem_epoch_id += 1;
   if (ctx->mem_epoch_id == 0) ctx->mem_epoch_id = 1;
 
+#if X07_EPOCH_ARENA
+  // The epoch is a watermark: dropping it frees every arena block in O(1).
+  ctx->arena_used = 0;
+#endif
+
   ctx->mem_stats.alloc_calls = 0;
   ctx->mem_stats.realloc_calls = 0;
   ctx->mem_stats.free_calls = 0;
@@ -3050,7 +3659,13 @@ static void rt_free(ctx_t* ctx, void* ptr, uint32_t size, uint32_t align) {
   if (size == 0) return;
   uint32_t is_epoch = 1;
   uint32_t strict = ctx->allocator_is_custom ? 0 : 1;
-  if (!ctx->allocator_is_custom && (uint8_t*)ptr != ctx->heap.mem) {
+  // Arena blocks are headerless and always current-epoch; skip the header
+  // inspection for them.
+  if (!ctx->allocator_is_custom && (uint8_t*)ptr != ctx->heap.mem
+#if X07_EPOCH_ARENA
+      && !rt_arena_contains(ctx, ptr)
+#endif
+  ) {
     uint8_t* p = (uint8_t*)ptr;
     if (p < ctx->heap.mem + (uint32_t)sizeof(heap_hdr_t)) rt_trap("free oob");
     heap_hdr_t* h = (heap_hdr_t*)(p - (uint32_t)sizeof(heap_hdr_t));
@@ -3075,93 +3690,329 @@ static void rt_mem_free_all(ctx_t* ctx) {
 }
 
 #ifdef X07_DEBUG_BORROW
-static void rt_dbg_init(ctx_t* ctx) {
-  ctx->dbg_allocs_len = 0;
-  ctx->dbg_allocs_cap = X07_DBG_ALLOC_CAP;
-  ctx->dbg_allocs =
-      (dbg_alloc_rec_t*)rt_alloc(
-          ctx,
-          ctx->dbg_allocs_cap * (uint32_t)sizeof(dbg_alloc_rec_t),
-          (uint32_t)_Alignof(dbg_alloc_rec_t)
-      );
-
-  ctx->dbg_borrows_len = 0;
-  ctx->dbg_borrows_cap = X07_DBG_BORROW_CAP;
-  ctx->dbg_borrows =
-      (dbg_borrow_rec_t*)rt_alloc(
-          ctx,
-          ctx->dbg_borrows_cap * (uint32_t)sizeof(dbg_borrow_rec_t),
-          (uint32_t)_Alignof(dbg_borrow_rec_t)
-      );
-
-  ctx->dbg_borrow_violations = 0;
+// Debug-borrow bookkeeping. Records live in slot arrays that grow on demand;
+// killed slots are recycled through an intrusive free list. Lookups by id go
+// through open-addressing index tables (linear probing, power-of-two caps),
+// so register/kill/check are O(1) instead of scanning the allocation history.
+// Ids are monotonically increasing and never reused: a stale id misses the
+// index and is reported as a violation, which subsumes the old alive/active
+// flags.
+#define RT_DBG_ID_TOMBSTONE UINT64_MAX
+
+static uint32_t rt_dbg_idx_hash(uint64_t id) {
+  return (uint32_t)((id * UINT64_C(11400714819323198485)) >> 32);
+}
+
+// Returns slot + 1, or 0 when id is absent.
+static uint32_t rt_dbg_idx_lookup(const dbg_idx_ent_t* tab, uint32_t cap, uint64_t id) {
+  if (!tab || cap == 0 || id == 0) return 0;
+  uint32_t mask = cap - 1;
+  uint32_t idx = rt_dbg_idx_hash(id) & mask;
+  uint32_t start = idx;
+  for (;;) {
+    const dbg_idx_ent_t* e = &tab[idx];
+    if (e->id == id) return e->slot + 1;
+    if (e->id == 0) return 0;
+    idx = (idx + 1) & mask;
+    if (idx == start) return 0;
+  }
 }
 
-static uint64_t rt_dbg_borrow_acquire(
-    ctx_t* ctx,
-    uint64_t alloc_id,
-    uint32_t off_bytes,
-    uint32_t len_bytes
-);
-
-static uint64_t rt_dbg_alloc_register(ctx_t* ctx, uint8_t* base_ptr, uint32_t size_bytes) {
-  if (size_bytes == 0) return 0;
-  if (!ctx->dbg_allocs || ctx->dbg_allocs_cap == 0) return 0;
-  if (ctx->dbg_allocs_len >= ctx->dbg_allocs_cap) {
-    ctx->dbg_borrow_violations += 1;
-    return 0;
+// Inserts id -> slot; the caller guarantees free room and a unique id.
+// Returns 1 when the entry consumed an empty cell (vs reusing a tombstone),
+// i.e. the amount the caller must add to its used counter.
+static uint32_t rt_dbg_idx_insert(dbg_idx_ent_t* tab, uint32_t cap, uint64_t id, uint32_t slot) {
+  uint32_t mask = cap - 1;
+  uint32_t idx = rt_dbg_idx_hash(id) & mask;
+  for (;;) {
+    dbg_idx_ent_t* e = &tab[idx];
+    if (e->id == 0 || e->id == RT_DBG_ID_TOMBSTONE) {
+      uint32_t fresh = (e->id == 0) ? 1u : 0u;
+      e->id = id;
+      e->slot = slot;
+      return fresh;
+    }
+    idx = (idx + 1) & mask;
   }
-  uint32_t idx = ctx->dbg_allocs_len++;
-  dbg_alloc_rec_t* rec = &ctx->dbg_allocs[idx];
-  rec->base_ptr = base_ptr;
-  rec->size_bytes = size_bytes;
-  rec->alive = 1;
-  rec->borrow_id = rt_dbg_borrow_acquire(ctx, (uint64_t)idx + 1, 0, size_bytes);
-  return (uint64_t)idx + 1;
 }
 
-static void rt_dbg_alloc_kill(ctx_t* ctx, uint64_t alloc_id) {
-  if (alloc_id == 0) return;
-  uint64_t idx = alloc_id - 1;
-  if (!ctx->dbg_allocs || idx >= (uint64_t)ctx->dbg_allocs_len) {
-    ctx->dbg_borrow_violations += 1;
-    return;
+static void rt_dbg_idx_remove(dbg_idx_ent_t* tab, uint32_t cap, uint64_t id) {
+  if (!tab || cap == 0) return;
+  uint32_t mask = cap - 1;
+  uint32_t idx = rt_dbg_idx_hash(id) & mask;
+  uint32_t start = idx;
+  for (;;) {
+    dbg_idx_ent_t* e = &tab[idx];
+    if (e->id == id) {
+      e->id = RT_DBG_ID_TOMBSTONE;
+      return;
+    }
+    if (e->id == 0) return;
+    idx = (idx + 1) & mask;
+    if (idx == start) return;
   }
-  ctx->dbg_allocs[idx].alive = 0;
 }
 
-static uint64_t rt_dbg_alloc_find(
+static void rt_dbg_idx_rehash(
     ctx_t* ctx,
-    uint8_t* ptr,
-    uint32_t len_bytes,
-    uint32_t* out_off_bytes
+    dbg_idx_ent_t** tab,
+    uint32_t* cap,
+    uint32_t* used,
+    uint32_t live,
+    uint32_t min_cap
 ) {
-  if (out_off_bytes) *out_off_bytes = 0;
+  uint32_t new_cap = min_cap;
+  while (new_cap < (live + 1u) * 2u) {
+    if (new_cap > UINT32_MAX / 2) break;
+    new_cap *= 2u;
+  }
+  dbg_idx_ent_t* fresh = (dbg_idx_ent_t*)rt_alloc(
+      ctx,
+      new_cap * (uint32_t)sizeof(dbg_idx_ent_t),
+      (uint32_t)_Alignof(dbg_idx_ent_t)
+  );
+  memset(fresh, 0, (size_t)new_cap * sizeof(dbg_idx_ent_t));
+  for (uint32_t i = 0; i < *cap; i++) {
+    dbg_idx_ent_t* e = &(*tab)[i];
+    if (e->id == 0 || e->id == RT_DBG_ID_TOMBSTONE) continue;
+    (void)rt_dbg_idx_insert(fresh, new_cap, e->id, e->slot);
+  }
+  if (*tab && *cap) {
+    rt_free(
+        ctx,
+        *tab,
+        *cap * (uint32_t)sizeof(dbg_idx_ent_t),
+        (uint32_t)_Alignof(dbg_idx_ent_t)
+    );
+  }
+  *tab = fresh;
+  *cap = new_cap;
+  *used = live;
+}
+
+// Keeps load (occupied + tombstones) at or below half the table; rehashing
+// drops tombstones and doubles only when the live set itself is the cause.
+static void rt_dbg_idx_ensure(
+    ctx_t* ctx,
+    dbg_idx_ent_t** tab,
+    uint32_t* cap,
+    uint32_t* used,
+    uint32_t live
+) {
+  if (*tab && (*used + 1u) * 2u <= *cap) return;
+  rt_dbg_idx_rehash(ctx, tab, cap, used, live, *cap ? *cap : 16u);
+}
+
+static void rt_dbg_allocs_ensure_cap(ctx_t* ctx, uint32_t need) {
+  if (need <= ctx->dbg_allocs_cap) return;
+  dbg_alloc_rec_t* old_items = ctx->dbg_allocs;
+  uint32_t old_cap = ctx->dbg_allocs_cap;
+  uint32_t old_bytes_total = old_cap * (uint32_t)sizeof(dbg_alloc_rec_t);
+  uint32_t new_cap = ctx->dbg_allocs_cap ? ctx->dbg_allocs_cap : X07_DBG_ALLOC_CAP;
+  while (new_cap < need) {
+    if (new_cap > UINT32_MAX / 2) {
+      new_cap = need;
+      break;
+    }
+    new_cap *= 2;
+  }
+  dbg_alloc_rec_t* items = (dbg_alloc_rec_t*)rt_alloc_realloc(
+    ctx,
+    old_items,
+    old_bytes_total,
+    new_cap * (uint32_t)sizeof(dbg_alloc_rec_t),
+    (uint32_t)_Alignof(dbg_alloc_rec_t)
+  );
+  if (old_items && ctx->dbg_allocs_len) {
+    uint32_t bytes = ctx->dbg_allocs_len * (uint32_t)sizeof(dbg_alloc_rec_t);
+    memcpy(items, old_items, bytes);
+    rt_mem_on_memcpy(ctx, bytes);
+  }
+  if (old_items && old_bytes_total) {
+    rt_free(ctx, old_items, old_bytes_total, (uint32_t)_Alignof(dbg_alloc_rec_t));
+  }
+  ctx->dbg_allocs = items;
+  ctx->dbg_allocs_cap = new_cap;
+}
+
+static void rt_dbg_borrows_ensure_cap(ctx_t* ctx, uint32_t need) {
+  if (need <= ctx->dbg_borrows_cap) return;
+  dbg_borrow_rec_t* old_items = ctx->dbg_borrows;
+  uint32_t old_cap = ctx->dbg_borrows_cap;
+  uint32_t old_bytes_total = old_cap * (uint32_t)sizeof(dbg_borrow_rec_t);
+  uint32_t new_cap = ctx->dbg_borrows_cap ? ctx->dbg_borrows_cap : X07_DBG_BORROW_CAP;
+  while (new_cap < need) {
+    if (new_cap > UINT32_MAX / 2) {
+      new_cap = need;
+      break;
+    }
+    new_cap *= 2;
+  }
+  dbg_borrow_rec_t* items = (dbg_borrow_rec_t*)rt_alloc_realloc(
+    ctx,
+    old_items,
+    old_bytes_total,
+    new_cap * (uint32_t)sizeof(dbg_borrow_rec_t),
+    (uint32_t)_Alignof(dbg_borrow_rec_t)
+  );
+  if (old_items && ctx->dbg_borrows_len) {
+    uint32_t bytes = ctx->dbg_borrows_len * (uint32_t)sizeof(dbg_borrow_rec_t);
+    memcpy(items, old_items, bytes);
+    rt_mem_on_memcpy(ctx, bytes);
+  }
+  if (old_items && old_bytes_total) {
+    rt_free(ctx, old_items, old_bytes_total, (uint32_t)_Alignof(dbg_borrow_rec_t));
+  }
+  ctx->dbg_borrows = items;
+  ctx->dbg_borrows_cap = new_cap;
+}
+
+static uint32_t rt_dbg_alloc_slot_acquire(ctx_t* ctx) {
+  if (ctx->dbg_allocs_free) {
+    uint32_t slot = ctx->dbg_allocs_free - 1;
+    ctx->dbg_allocs_free = ctx->dbg_allocs[slot].next_free;
+    return slot;
+  }
+  rt_dbg_allocs_ensure_cap(ctx, ctx->dbg_allocs_len + 1);
+  return ctx->dbg_allocs_len++;
+}
+
+static uint32_t rt_dbg_borrow_slot_acquire(ctx_t* ctx) {
+  if (ctx->dbg_borrows_free) {
+    uint32_t slot = ctx->dbg_borrows_free - 1;
+    ctx->dbg_borrows_free = ctx->dbg_borrows[slot].next_free;
+    return slot;
+  }
+  rt_dbg_borrows_ensure_cap(ctx, ctx->dbg_borrows_len + 1);
+  return ctx->dbg_borrows_len++;
+}
+
+static void rt_dbg_init(ctx_t* ctx) {
+  ctx->dbg_allocs = NULL;
+  ctx->dbg_allocs_len = 0;
+  ctx->dbg_allocs_cap = 0;
+  ctx->dbg_allocs_free = 0;
+  ctx->dbg_alloc_idx = NULL;
+  ctx->dbg_alloc_idx_cap = 0;
+  ctx->dbg_alloc_idx_used = 0;
+  ctx->dbg_alloc_live = 0;
+  ctx->dbg_next_alloc_id = 1;
+
+  ctx->dbg_borrows = NULL;
+  ctx->dbg_borrows_len = 0;
+  ctx->dbg_borrows_cap = 0;
+  ctx->dbg_borrows_free = 0;
+  ctx->dbg_borrow_idx = NULL;
+  ctx->dbg_borrow_idx_cap = 0;
+  ctx->dbg_borrow_idx_used = 0;
+  ctx->dbg_borrow_live = 0;
+  ctx->dbg_next_borrow_id = 1;
+
+  rt_dbg_allocs_ensure_cap(ctx, X07_DBG_ALLOC_CAP);
+  rt_dbg_borrows_ensure_cap(ctx, X07_DBG_BORROW_CAP);
+
+  ctx->dbg_borrow_violations = 0;
+}
+
+static uint64_t rt_dbg_borrow_acquire(
+    ctx_t* ctx,
+    uint64_t alloc_id,
+    uint32_t off_bytes,
+    uint32_t len_bytes
+);
+
+static uint64_t rt_dbg_alloc_register(ctx_t* ctx, uint8_t* base_ptr, uint32_t size_bytes) {
+  if (size_bytes == 0) return 0;
+  if (!ctx->dbg_allocs || ctx->dbg_allocs_cap == 0) return 0;
+  uint32_t slot = rt_dbg_alloc_slot_acquire(ctx);
+  uint64_t id = ctx->dbg_next_alloc_id++;
+  dbg_alloc_rec_t* rec = &ctx->dbg_allocs[slot];
+  rec->alloc_id = id;
+  rec->base_ptr = base_ptr;
+  rec->size_bytes = size_bytes;
+  rec->next_free = 0;
+  rec->borrow_id = 0;
+  rt_dbg_idx_ensure(
+      ctx,
+      &ctx->dbg_alloc_idx,
+      &ctx->dbg_alloc_idx_cap,
+      &ctx->dbg_alloc_idx_used,
+      ctx->dbg_alloc_live
+  );
+  ctx->dbg_alloc_idx_used +=
+      rt_dbg_idx_insert(ctx->dbg_alloc_idx, ctx->dbg_alloc_idx_cap, id, slot);
+  ctx->dbg_alloc_live += 1;
+  // Acquiring the implicit whole-range borrow may grow the borrow tables;
+  // re-derive the record pointer afterwards.
+  uint64_t bid = rt_dbg_borrow_acquire(ctx, id, 0, size_bytes);
+  ctx->dbg_allocs[slot].borrow_id = bid;
+  return id;
+}
+
+static void rt_dbg_borrow_release(ctx_t* ctx, uint64_t borrow_id);
+
+static void rt_dbg_alloc_kill(ctx_t* ctx, uint64_t alloc_id) {
+  if (alloc_id == 0) return;
+  uint32_t slot1 = rt_dbg_idx_lookup(ctx->dbg_alloc_idx, ctx->dbg_alloc_idx_cap, alloc_id);
+  if (slot1 == 0) {
+    ctx->dbg_borrow_violations += 1;
+    return;
+  }
+  uint32_t slot = slot1 - 1;
+  dbg_alloc_rec_t* rec = &ctx->dbg_allocs[slot];
+  uint64_t bid = rec->borrow_id;
+  rt_dbg_idx_remove(ctx->dbg_alloc_idx, ctx->dbg_alloc_idx_cap, alloc_id);
+  ctx->dbg_alloc_live -= 1;
+  rec->alloc_id = 0;
+  rec->borrow_id = 0;
+  rec->next_free = ctx->dbg_allocs_free;
+  ctx->dbg_allocs_free = slot + 1;
+  // Retire the implicit whole-range borrow so long-running programs do not
+  // accumulate dead borrow records.
+  if (bid != 0) rt_dbg_borrow_release(ctx, bid);
+}
+
+static uint64_t rt_dbg_alloc_find(
+    ctx_t* ctx,
+    uint8_t* ptr,
+    uint32_t len_bytes,
+    uint32_t* out_off_bytes
+) {
+  if (out_off_bytes) *out_off_bytes = 0;
   if (len_bytes == 0) return 0;
   if (!ctx->dbg_allocs) {
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
   uintptr_t p = (uintptr_t)ptr;
-  // Search newest-to-oldest so re-used pointers resolve to the latest allocation record.
-  for (uint32_t i = ctx->dbg_allocs_len; i > 0; i--) {
-    uint32_t idx = i - 1;
-    dbg_alloc_rec_t* rec = &ctx->dbg_allocs[idx];
+  // Only live records are kept, so the scan covers the live set rather than
+  // the full allocation history; prefer the highest id so a re-used pointer
+  // resolves to the latest record.
+  uint64_t best_id = 0;
+  uint32_t best_off = 0;
+  uint32_t best_size = 0;
+  for (uint32_t slot = 0; slot < ctx->dbg_allocs_len; slot++) {
+    dbg_alloc_rec_t* rec = &ctx->dbg_allocs[slot];
+    if (rec->alloc_id == 0) continue;
     uintptr_t base = (uintptr_t)rec->base_ptr;
     uintptr_t end = base + (uintptr_t)rec->size_bytes;
     if (end < base) continue;
-    if (p >= base && p < end) {
-      uint32_t off = (uint32_t)(p - base);
-      if (off > rec->size_bytes || rec->size_bytes - off < len_bytes) {
-        ctx->dbg_borrow_violations += 1;
-        return 0;
-      }
-      if (out_off_bytes) *out_off_bytes = off;
-      return (uint64_t)idx + 1;
+    if (p >= base && p < end && rec->alloc_id > best_id) {
+      best_id = rec->alloc_id;
+      best_off = (uint32_t)(p - base);
+      best_size = rec->size_bytes;
     }
   }
-  ctx->dbg_borrow_violations += 1;
-  return 0;
+  if (best_id == 0) {
+    ctx->dbg_borrow_violations += 1;
+    return 0;
+  }
+  if (best_off > best_size || best_size - best_off < len_bytes) {
+    ctx->dbg_borrow_violations += 1;
+    return 0;
+  }
+  if (out_off_bytes) *out_off_bytes = best_off;
+  return best_id;
 }
 
 static uint64_t rt_dbg_alloc_try_find(
@@ -3174,31 +4025,35 @@ static uint64_t rt_dbg_alloc_try_find(
   if (len_bytes == 0) return 0;
   if (!ctx->dbg_allocs) return 0;
   uintptr_t p = (uintptr_t)ptr;
-  // Search newest-to-oldest so re-used pointers resolve to the latest allocation record.
-  for (uint32_t i = ctx->dbg_allocs_len; i > 0; i--) {
-    uint32_t idx = i - 1;
-    dbg_alloc_rec_t* rec = &ctx->dbg_allocs[idx];
+  uint64_t best_id = 0;
+  uint32_t best_off = 0;
+  uint32_t best_size = 0;
+  for (uint32_t slot = 0; slot < ctx->dbg_allocs_len; slot++) {
+    dbg_alloc_rec_t* rec = &ctx->dbg_allocs[slot];
+    if (rec->alloc_id == 0) continue;
     uintptr_t base = (uintptr_t)rec->base_ptr;
     uintptr_t end = base + (uintptr_t)rec->size_bytes;
     if (end < base) continue;
-    if (p >= base && p < end) {
-      uint32_t off = (uint32_t)(p - base);
-      if (off > rec->size_bytes || rec->size_bytes - off < len_bytes) return 0;
-      if (out_off_bytes) *out_off_bytes = off;
-      return (uint64_t)idx + 1;
+    if (p >= base && p < end && rec->alloc_id > best_id) {
+      best_id = rec->alloc_id;
+      best_off = (uint32_t)(p - base);
+      best_size = rec->size_bytes;
     }
   }
-  return 0;
+  if (best_id == 0) return 0;
+  if (best_off > best_size || best_size - best_off < len_bytes) return 0;
+  if (out_off_bytes) *out_off_bytes = best_off;
+  return best_id;
 }
 
 static uint64_t rt_dbg_alloc_borrow_id(ctx_t* ctx, uint64_t alloc_id) {
   if (alloc_id == 0) return 0;
-  uint64_t idx = alloc_id - 1;
-  if (!ctx->dbg_allocs || idx >= (uint64_t)ctx->dbg_allocs_len) {
+  uint32_t slot1 = rt_dbg_idx_lookup(ctx->dbg_alloc_idx, ctx->dbg_alloc_idx_cap, alloc_id);
+  if (slot1 == 0) {
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
-  uint64_t bid = ctx->dbg_allocs[idx].borrow_id;
+  uint64_t bid = ctx->dbg_allocs[slot1 - 1].borrow_id;
   if (bid == 0) {
     ctx->dbg_borrow_violations += 1;
     return 0;
@@ -3217,16 +4072,12 @@ static uint64_t rt_dbg_borrow_acquire(
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
-  uint64_t aidx = alloc_id - 1;
-  if (!ctx->dbg_allocs || aidx >= (uint64_t)ctx->dbg_allocs_len) {
-    ctx->dbg_borrow_violations += 1;
-    return 0;
-  }
-  dbg_alloc_rec_t* a = &ctx->dbg_allocs[aidx];
-  if (!a->alive) {
+  uint32_t aslot1 = rt_dbg_idx_lookup(ctx->dbg_alloc_idx, ctx->dbg_alloc_idx_cap, alloc_id);
+  if (aslot1 == 0) {
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
+  dbg_alloc_rec_t* a = &ctx->dbg_allocs[aslot1 - 1];
   if (off_bytes > a->size_bytes || a->size_bytes - off_bytes < len_bytes) {
     ctx->dbg_borrow_violations += 1;
     return 0;
@@ -3235,27 +4086,42 @@ static uint64_t rt_dbg_borrow_acquire(
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
-  if (ctx->dbg_borrows_len >= ctx->dbg_borrows_cap) {
-    ctx->dbg_borrow_violations += 1;
-    return 0;
-  }
-  uint32_t idx = ctx->dbg_borrows_len++;
-  dbg_borrow_rec_t* b = &ctx->dbg_borrows[idx];
+  uint32_t slot = rt_dbg_borrow_slot_acquire(ctx);
+  uint64_t id = ctx->dbg_next_borrow_id++;
+  dbg_borrow_rec_t* b = &ctx->dbg_borrows[slot];
+  b->borrow_id = id;
   b->alloc_id = alloc_id;
   b->off_bytes = off_bytes;
   b->len_bytes = len_bytes;
-  b->active = 1;
-  return (uint64_t)idx + 1;
+  b->next_free = 0;
+  rt_dbg_idx_ensure(
+      ctx,
+      &ctx->dbg_borrow_idx,
+      &ctx->dbg_borrow_idx_cap,
+      &ctx->dbg_borrow_idx_used,
+      ctx->dbg_borrow_live
+  );
+  ctx->dbg_borrow_idx_used +=
+      rt_dbg_idx_insert(ctx->dbg_borrow_idx, ctx->dbg_borrow_idx_cap, id, slot);
+  ctx->dbg_borrow_live += 1;
+  return id;
 }
 
 static void rt_dbg_borrow_release(ctx_t* ctx, uint64_t borrow_id) {
   if (borrow_id == 0) return;
-  uint64_t idx = borrow_id - 1;
-  if (!ctx->dbg_borrows || idx >= (uint64_t)ctx->dbg_borrows_len) {
+  uint32_t slot1 = rt_dbg_idx_lookup(ctx->dbg_borrow_idx, ctx->dbg_borrow_idx_cap, borrow_id);
+  if (slot1 == 0) {
     ctx->dbg_borrow_violations += 1;
     return;
   }
-  ctx->dbg_borrows[idx].active = 0;
+  uint32_t slot = slot1 - 1;
+  dbg_borrow_rec_t* b = &ctx->dbg_borrows[slot];
+  rt_dbg_idx_remove(ctx->dbg_borrow_idx, ctx->dbg_borrow_idx_cap, borrow_id);
+  ctx->dbg_borrow_live -= 1;
+  b->borrow_id = 0;
+  b->alloc_id = 0;
+  b->next_free = ctx->dbg_borrows_free;
+  ctx->dbg_borrows_free = slot + 1;
 }
 
 static uint32_t rt_dbg_borrow_check(
@@ -3269,31 +4135,25 @@ static uint32_t rt_dbg_borrow_check(
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
-  uint64_t idx = borrow_id - 1;
-  if (!ctx->dbg_borrows || idx >= (uint64_t)ctx->dbg_borrows_len) {
-    ctx->dbg_borrow_violations += 1;
-    return 0;
-  }
-  dbg_borrow_rec_t* b = &ctx->dbg_borrows[idx];
-  if (!b->active) {
+  uint32_t bslot1 = rt_dbg_idx_lookup(ctx->dbg_borrow_idx, ctx->dbg_borrow_idx_cap, borrow_id);
+  if (bslot1 == 0) {
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
+  dbg_borrow_rec_t* b = &ctx->dbg_borrows[bslot1 - 1];
   uint64_t alloc_id = b->alloc_id;
   if (alloc_id == 0) {
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
-  uint64_t aidx = alloc_id - 1;
-  if (!ctx->dbg_allocs || aidx >= (uint64_t)ctx->dbg_allocs_len) {
-    ctx->dbg_borrow_violations += 1;
-    return 0;
-  }
-  dbg_alloc_rec_t* a = &ctx->dbg_allocs[aidx];
-  if (!a->alive) {
+  // A freed allocation has left the index, so a use-after-free surfaces here
+  // as a lookup miss.
+  uint32_t aslot1 = rt_dbg_idx_lookup(ctx->dbg_alloc_idx, ctx->dbg_alloc_idx_cap, alloc_id);
+  if (aslot1 == 0) {
     ctx->dbg_borrow_violations += 1;
     return 0;
   }
+  dbg_alloc_rec_t* a = &ctx->dbg_allocs[aslot1 - 1];
   if (off_bytes < b->off_bytes) {
     ctx->dbg_borrow_violations += 1;
     return 0;
@@ -3360,6 +4220,33 @@ __attribute__((noreturn)) void ev_trap(int32_t code) {
   rt_trap(NULL);
 }
 
+// Math ABI v2 helpers: decode an 8-byte little-endian f64 operand for a
+// pass-by-value backend call, and re-encode the double result as runtime
+// bytes. Boxing canonicalizes NaN to the quiet NaN bit pattern
+// 0x7ff8000000000000 so the stored bytes match the v1 entrypoints
+// bit-for-bit.
+static double rt_math_f64_unbox(ctx_t* ctx, const uint8_t* ptr, uint32_t len) {
+  (void)ctx;
+  if (len != 8) rt_trap("math.f64: operand is not 8 bytes");
+  uint64_t bits = 0;
+  for (uint32_t i = 0; i < 8; i++) bits |= (uint64_t)ptr[i] << (8 * i);
+  double x;
+  memcpy(&x, &bits, 8);
+  return x;
+}
+
+static bytes_t rt_math_f64_box(ctx_t* ctx, double x) {
+  uint64_t bits;
+  memcpy(&bits, &x, 8);
+  if ((bits & UINT64_C(0x7ff0000000000000)) == UINT64_C(0x7ff0000000000000) &&
+      (bits & UINT64_C(0x000fffffffffffff)) != 0) {
+    bits = UINT64_C(0x7ff8000000000000);
+  }
+  bytes_t out = rt_bytes_alloc(ctx, 8);
+  for (uint32_t i = 0; i < 8; i++) out.ptr[i] = (uint8_t)(bits >> (8 * i));
+  return out;
+}
+
 static bytes_t rt_bytes_from_literal(ctx_t* ctx, const uint8_t* ptr, uint32_t len) {
   bytes_t out = rt_bytes_alloc(ctx, len);
   if (len != 0) {
@@ -3409,7 +4296,11 @@ static void rt_bytes_drop(ctx_t* ctx, bytes_t* b) {
 #endif
   uint32_t size = b->len;
   // Heap allocator stores the requested size in the allocation header; use it for exact accounting.
-  if (ctx->allocator.free == rt_default_free) {
+  if (ctx->allocator.free == rt_default_free
+#if X07_EPOCH_ARENA
+      && !rt_arena_contains(ctx, b->ptr)
+#endif
+  ) {
     heap_hdr_t* h = (heap_hdr_t*)(b->ptr - (uint32_t)sizeof(heap_hdr_t));
     if (h->magic != RT_HEAP_MAGIC_USED) rt_trap("bytes.drop corrupt header");
     if (h->req_size == 0) rt_trap("bytes.drop corrupt header");
@@ -3456,14 +4347,9 @@ static bytes_t rt_view_to_bytes(ctx_t* ctx, bytes_view_t v) {
 #ifdef X07_DEBUG_BORROW
 static uint32_t rt_dbg_bytes_check(ctx_t* ctx, bytes_t b) {
   if (b.len == 0) return 1;
-  uint64_t aid = rt_dbg_alloc_find(ctx, b.ptr, b.len, NULL);
-  if (aid == 0) return 0;
-  dbg_alloc_rec_t* a = &ctx->dbg_allocs[aid - 1];
-  if (!a->alive) {
-    ctx->dbg_borrow_violations += 1;
-    return 0;
-  }
-  return 1;
+  // rt_dbg_alloc_find only resolves live records; a freed or unknown range
+  // has already been counted as a violation by the failed find.
+  return rt_dbg_alloc_find(ctx, b.ptr, b.len, NULL) != 0 ? UINT32_C(1) : UINT32_C(0);
 }
 #endif
 
@@ -3558,7 +4444,7 @@ static uint32_t rt_bytes_eq(ctx_t* ctx, bytes_t a, bytes_t b) {
 #ifdef X07_DEBUG_BORROW
   // rt_dbg_bytes_check already ran above.
 #endif
-  if (memcmp(a.ptr, b.ptr, a.len) == 0) return UINT32_C(1);
+  if (rt_memeq(a.ptr, b.ptr, a.len)) return UINT32_C(1);
 
 mismatch:
   ctx->last_bytes_eq_valid = 1;
@@ -3652,6 +4538,27 @@ static uint32_t rt_view_get_u8(ctx_t* ctx, bytes_view_t v, uint32_t idx) {
   return (uint32_t)v.ptr[idx];
 }
 
+static uint32_t rt_view_find_u8(ctx_t* ctx, bytes_view_t v, uint32_t c) {
+#ifdef X07_DEBUG_BORROW
+  if (v.len && !rt_dbg_borrow_check(ctx, v.bid, v.off_bytes, v.len)) return RT_FIND_NONE;
+#else
+  (void)ctx;
+#endif
+  return rt_find_u8(v.ptr, v.len, (uint8_t)c);
+}
+
+static uint32_t rt_view_find_sub(ctx_t* ctx, bytes_view_t hay, bytes_view_t needle) {
+#ifdef X07_DEBUG_BORROW
+  if (hay.len && !rt_dbg_borrow_check(ctx, hay.bid, hay.off_bytes, hay.len)) return RT_FIND_NONE;
+  if (needle.len && !rt_dbg_borrow_check(ctx, needle.bid, needle.off_bytes, needle.len)) {
+    return RT_FIND_NONE;
+  }
+#else
+  (void)ctx;
+#endif
+  return rt_find_sub(hay.ptr, hay.len, needle.ptr, needle.len);
+}
+
 static bytes_view_t rt_view_slice(ctx_t* ctx, bytes_view_t v, uint32_t start, uint32_t len) {
   if (start > v.len) rt_trap("view.slice oob");
   if (len > v.len - start) rt_trap("view.slice oob");
@@ -3678,7 +4585,7 @@ static uint32_t rt_view_eq(ctx_t* ctx, bytes_view_t a, bytes_view_t b) {
   if (!rt_dbg_borrow_check(ctx, a.bid, a.off_bytes, a.len)) return UINT32_C(0);
   if (!rt_dbg_borrow_check(ctx, b.bid, b.off_bytes, b.len)) return UINT32_C(0);
 #endif
-  if (memcmp(a.ptr, b.ptr, a.len) == 0) return UINT32_C(1);
+  if (rt_memeq(a.ptr, b.ptr, a.len)) return UINT32_C(1);
 
 mismatch:
   a_prefix_len =
@@ -3736,6 +4643,7 @@ static uint32_t rt_view_cmp_range(
 #define RT_WAIT_CHAN_RECV UINT32_C(4)
 #define RT_WAIT_OS_PROC_JOIN UINT32_C(5)
 #define RT_WAIT_OS_PROC_EXIT UINT32_C(6)
+#define RT_WAIT_MT_DONE UINT32_C(7)
 
 #define RT_TRACE_SWITCH UINT64_C(1)
 #define RT_TRACE_BLOCK UINT64_C(2)
@@ -4200,7 +5108,259 @@ static uint64_t rt_timer_peek_wake(ctx_t* ctx) {
   return ctx->sched_timers[0].wake_time;
 }
 
+#if X07_MT_SCHED
+#if X07_EPOCH_ARENA
+#error "X07_MT_SCHED is incompatible with X07_EPOCH_ARENA"
+#endif
+
+#define RT_MT_JOB_QUEUED UINT32_C(1)
+#define RT_MT_JOB_DONE UINT32_C(2)
+#define RT_MT_JOB_DRAINED UINT32_C(3)
+
+typedef struct {
+  uint32_t state;
+  uint32_t task_id;
+  uint32_t worker;
+  uint32_t (*poll)(ctx_t* ctx, void* fut, rt_task_out_t* out);
+  void* fut;
+  rt_task_out_t out;  // payload lives in the running worker's heap
+} rt_mt_job_t;
+
+typedef struct {
+  pthread_t thread;
+  ctx_t ctx;
+  uint32_t deque[X07_MT_JOB_CAP];
+  uint32_t top;
+  uint32_t bot;
+  rt_task_out_t retire[X07_MT_JOB_CAP];
+  uint32_t retire_len;
+} rt_mt_worker_t;
+
+static rt_mt_worker_t rt_mt_workers[X07_MT_WORKERS];
+static rt_mt_job_t rt_mt_jobs[X07_MT_JOB_CAP];
+static uint64_t rt_mt_submit_seq = 0;
+static uint64_t rt_mt_drain_seq = 0;
+static uint32_t rt_mt_started = 0;
+static uint32_t rt_mt_rr = 0;
+static pthread_mutex_t rt_mt_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t rt_mt_work_cv = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t rt_mt_done_cv = PTHREAD_COND_INITIALIZER;
+
+// Owner pops newest work from the bottom of its own deque; thieves take
+// oldest from the top of a victim's. All deque/job state is guarded by
+// rt_mt_lock, which is touched only at job boundaries; job execution runs
+// lock-free against the worker's own heap.
+static uint32_t rt_mt_take_job(uint32_t self) {
+  rt_mt_worker_t* w = &rt_mt_workers[self];
+  if (w->bot != w->top) {
+    w->bot = (w->bot + X07_MT_JOB_CAP - 1u) % X07_MT_JOB_CAP;
+    return w->deque[w->bot];
+  }
+  for (uint32_t i = 1; i < X07_MT_WORKERS; i++) {
+    rt_mt_worker_t* v = &rt_mt_workers[(self + i) % X07_MT_WORKERS];
+    if (v->top != v->bot) {
+      uint32_t slot = v->deque[v->top];
+      v->top = (v->top + 1u) % X07_MT_JOB_CAP;
+      return slot;
+    }
+  }
+  return UINT32_MAX;
+}
+
+static void* rt_mt_worker_main(void* arg) {
+  rt_mt_worker_t* w = (rt_mt_worker_t*)arg;
+  uint32_t self = (uint32_t)(w - rt_mt_workers);
+  pthread_mutex_lock(&rt_mt_lock);
+  for (;;) {
+    // Free outputs the main thread has drained; only the owner touches
+    // this worker's heap, so dropping here cannot race a thief.
+    while (w->retire_len) {
+      w->retire_len -= 1;
+      rt_task_out_drop(&w->ctx, &w->retire[w->retire_len]);
+    }
+    uint32_t slot = rt_mt_take_job(self);
+    if (slot == UINT32_MAX) {
+      pthread_cond_wait(&rt_mt_work_cv, &rt_mt_lock);
+      continue;
+    }
+    rt_mt_job_t* job = &rt_mt_jobs[slot];
+    job->worker = self;
+    pthread_mutex_unlock(&rt_mt_lock);
+
+    // Fresh per-task fuel budget so fuel exhaustion does not depend on
+    // which worker a task was stolen by.
+    w->ctx.fuel = w->ctx.fuel_init;
+    rt_task_out_t out = rt_task_out_empty(&w->ctx);
+    uint32_t done = job->poll(&w->ctx, job->fut, &out);
+    if (!done) rt_trap("mt task blocked (parallel poll must complete in one call)");
+
+    pthread_mutex_lock(&rt_mt_lock);
+    job->out = out;
+    job->state = RT_MT_JOB_DONE;
+    pthread_cond_broadcast(&rt_mt_done_cv);
+  }
+  return NULL;
+}
+
+static void rt_mt_start(ctx_t* ctx) {
+  if (rt_mt_started) return;
+  rt_mt_started = 1;
+  // Initialize every worker before starting any thread: a running worker
+  // scans all deques when stealing.
+  for (uint32_t i = 0; i < X07_MT_WORKERS; i++) {
+    rt_mt_worker_t* w = &rt_mt_workers[i];
+    memset(&w->ctx, 0, sizeof(w->ctx));
+    w->ctx.fuel_init = (uint64_t)(X07_FUEL_INIT);
+    w->ctx.fuel = w->ctx.fuel_init;
+    w->ctx.heap.mem =
+        (uint8_t*)rt_alloc(ctx, (uint32_t)(X07_MT_WORKER_HEAP_CAP), RT_HEAP_ALIGN);
+    w->ctx.heap.cap = (uint32_t)(X07_MT_WORKER_HEAP_CAP);
+    rt_heap_init(&w->ctx);
+    rt_allocator_init(&w->ctx);
+    w->top = 0;
+    w->bot = 0;
+    w->retire_len = 0;
+  }
+  for (uint32_t i = 0; i < X07_MT_WORKERS; i++) {
+    rt_mt_worker_t* w = &rt_mt_workers[i];
+    if (pthread_create(&w->thread, NULL, rt_mt_worker_main, w) != 0) {
+      rt_trap("mt worker spawn failed");
+    }
+  }
+}
+
+// Publishes finished jobs to the cooperative scheduler strictly in
+// submission order: outputs are copied into the main heap, the task is
+// marked done, and joiners are woken exactly as in rt_sched_step. This
+// keeps observable join ordering identical to the single-threaded
+// schedule regardless of how jobs were stolen.
+static void rt_mt_drain(ctx_t* ctx) {
+  for (;;) {
+    pthread_mutex_lock(&rt_mt_lock);
+    uint32_t slot = (uint32_t)(rt_mt_drain_seq % (uint64_t)(X07_MT_JOB_CAP));
+    rt_mt_job_t* job = &rt_mt_jobs[slot];
+    if (rt_mt_drain_seq == rt_mt_submit_seq || job->state != RT_MT_JOB_DONE) {
+      pthread_mutex_unlock(&rt_mt_lock);
+      return;
+    }
+    uint32_t task_id = job->task_id;
+    uint32_t worker = job->worker;
+    rt_task_out_t wout = job->out;
+    pthread_mutex_unlock(&rt_mt_lock);
+
+    rt_task_out_t out = rt_task_out_empty(ctx);
+    if (wout.kind == RT_TASK_OUT_KIND_BYTES) {
+      out.kind = RT_TASK_OUT_KIND_BYTES;
+      out.payload.bytes = rt_bytes_alloc(ctx, wout.payload.bytes.len);
+      if (wout.payload.bytes.len) {
+        memcpy(out.payload.bytes.ptr, wout.payload.bytes.ptr, wout.payload.bytes.len);
+        rt_mem_on_memcpy(ctx, wout.payload.bytes.len);
+      }
+    } else if (wout.kind == RT_TASK_OUT_KIND_RESULT_BYTES) {
+      out.kind = RT_TASK_OUT_KIND_RESULT_BYTES;
+      out.payload.result_bytes.tag = wout.payload.result_bytes.tag;
+      if (wout.payload.result_bytes.tag) {
+        bytes_t src = wout.payload.result_bytes.payload.ok;
+        out.payload.result_bytes.payload.ok = rt_bytes_alloc(ctx, src.len);
+        if (src.len) {
+          memcpy(out.payload.result_bytes.payload.ok.ptr, src.ptr, src.len);
+          rt_mem_on_memcpy(ctx, src.len);
+        }
+      } else {
+        out.payload.result_bytes.payload.err = wout.payload.result_bytes.payload.err;
+      }
+    } else {
+      rt_trap("mt task out invalid kind");
+    }
+
+    rt_task_t* t = rt_task_ptr(ctx, task_id);
+    t->done = 1;
+    t->wait_kind = RT_WAIT_NONE;
+    t->out = out;
+    t->out_taken = 0;
+    if (t->drop && t->fut) {
+      t->drop(ctx, t->fut);
+    }
+    t->drop = NULL;
+    t->fut = NULL;
+    rt_sched_trace_event(ctx, RT_TRACE_COMPLETE, (uint64_t)task_id, ctx->sched_now_ticks);
+
+    uint32_t wt = t->join_wait_head;
+    t->join_wait_head = 0;
+    t->join_wait_tail = 0;
+    while (wt != 0) {
+      rt_task_t* waiter = rt_task_ptr(ctx, wt);
+      uint32_t next = waiter->wait_next;
+      waiter->wait_next = 0;
+      rt_sched_wake(ctx, wt, RT_WAIT_JOIN, task_id);
+      wt = next;
+    }
+
+    pthread_mutex_lock(&rt_mt_lock);
+    job->state = RT_MT_JOB_DRAINED;
+    if (worker != UINT32_MAX) {
+      rt_mt_worker_t* wk = &rt_mt_workers[worker];
+      wk->retire[wk->retire_len++] = wout;
+    }
+    rt_mt_drain_seq += 1;
+    pthread_cond_broadcast(&rt_mt_work_cv);
+    pthread_cond_broadcast(&rt_mt_done_cv);
+    pthread_mutex_unlock(&rt_mt_lock);
+  }
+}
+
+static void rt_mt_submit(
+    ctx_t* ctx,
+    uint32_t task_id,
+    uint32_t (*poll)(ctx_t* ctx, void* fut, rt_task_out_t* out),
+    void* fut
+) {
+  pthread_mutex_lock(&rt_mt_lock);
+  while (rt_mt_submit_seq - rt_mt_drain_seq >= (uint64_t)(X07_MT_JOB_CAP)) {
+    pthread_cond_wait(&rt_mt_done_cv, &rt_mt_lock);
+    pthread_mutex_unlock(&rt_mt_lock);
+    rt_mt_drain(ctx);
+    pthread_mutex_lock(&rt_mt_lock);
+  }
+  uint32_t slot = (uint32_t)(rt_mt_submit_seq % (uint64_t)(X07_MT_JOB_CAP));
+  rt_mt_submit_seq += 1;
+  rt_mt_job_t* job = &rt_mt_jobs[slot];
+  job->state = RT_MT_JOB_QUEUED;
+  job->task_id = task_id;
+  job->worker = UINT32_MAX;
+  job->poll = poll;
+  job->fut = fut;
+  rt_mt_worker_t* w = &rt_mt_workers[rt_mt_rr % X07_MT_WORKERS];
+  rt_mt_rr += 1;
+  w->deque[w->bot] = slot;
+  w->bot = (w->bot + 1u) % X07_MT_JOB_CAP;
+  pthread_cond_broadcast(&rt_mt_work_cv);
+  pthread_mutex_unlock(&rt_mt_lock);
+}
+
+static uint32_t rt_mt_wait_any(ctx_t* ctx) {
+  pthread_mutex_lock(&rt_mt_lock);
+  if (rt_mt_drain_seq == rt_mt_submit_seq) {
+    pthread_mutex_unlock(&rt_mt_lock);
+    return UINT32_C(0);
+  }
+  uint32_t slot = (uint32_t)(rt_mt_drain_seq % (uint64_t)(X07_MT_JOB_CAP));
+  while (rt_mt_jobs[slot].state != RT_MT_JOB_DONE) {
+    pthread_cond_wait(&rt_mt_done_cv, &rt_mt_lock);
+  }
+  pthread_mutex_unlock(&rt_mt_lock);
+  rt_mt_drain(ctx);
+  return UINT32_C(1);
+}
+#endif
+
 static uint32_t rt_sched_step(ctx_t* ctx) {
+#if X07_MT_SCHED
+  // Completing an already-finished MT job counts as progress even when it
+  // leaves nothing runnable: a joiner may be blocked on exactly that task.
+  uint64_t mt_drained_before = rt_mt_drain_seq;
+  rt_mt_drain(ctx);
+#endif
   uint32_t task_id = rt_ready_pop(ctx);
   if (task_id != 0) {
     rt_task_t* t = rt_task_ptr(ctx, task_id);
@@ -4285,6 +5445,10 @@ static uint32_t rt_sched_step(ctx_t* ctx) {
   }
 
   if (rt_os_process_poll_all(ctx, 50)) return UINT32_C(1);
+#if X07_MT_SCHED
+  if (rt_mt_drain_seq != mt_drained_before) return UINT32_C(1);
+  if (rt_mt_wait_any(ctx)) return UINT32_C(1);
+#endif
   return UINT32_C(0);
 }
 
@@ -4321,6 +5485,37 @@ static uint32_t rt_task_spawn(ctx_t* ctx, uint32_t task_id) {
   return task_id;
 }
 
+// Spawn a parallel-safe task. Under X07_MT_SCHED the task runs on a worker
+// thread and completes when the scheduler drains it (in submission order);
+// otherwise it degrades to an ordinary cooperative task.
+static uint32_t rt_task_create_parallel(
+    ctx_t* ctx,
+    uint32_t (*poll)(ctx_t* ctx, void* fut, rt_task_out_t* out),
+    void (*drop)(ctx_t* ctx, void* fut),
+    void* fut
+) {
+#if X07_MT_SCHED
+  rt_mt_start(ctx);
+  rt_sched_tasks_ensure_cap(ctx, ctx->sched_tasks_len + 1);
+  uint32_t task_id = ctx->sched_tasks_len + 1;
+  rt_task_t* t = &ctx->sched_tasks[task_id - 1];
+  memset(t, 0, sizeof(*t));
+  t->alive = 1;
+  t->poll = poll;
+  t->drop = drop;
+  t->fut = fut;
+  t->out = rt_task_out_empty(ctx);
+  t->out_taken = 0;
+  t->wait_kind = RT_WAIT_MT_DONE;
+  ctx->sched_tasks_len += 1;
+  ctx->sched_stats.tasks_spawned += 1;
+  rt_mt_submit(ctx, task_id, poll, fut);
+  return task_id;
+#else
+  return rt_task_create(ctx, poll, drop, fut);
+#endif
+}
+
 static uint32_t rt_task_cancel(ctx_t* ctx, uint32_t task_id) {
   rt_task_t* t = rt_task_ptr(ctx, task_id);
   if (t->done) return UINT32_C(0);
@@ -5699,7 +6894,8 @@ static bytes_t rt_iface_io_read_block(ctx_t* ctx, iface_t reader, uint32_t max)
   }
 
   bytes_t chunk = rt_bytes_alloc(ctx, max);
-  uint32_t got = rt_ext_io_reader_read_into(reader.vtable, reader.data, chunk.ptr, max);
+  rt_ext_io_vec_t vec = { chunk.ptr, max };
+  uint32_t got = rt_ext_io_reader_read_vec_into(reader.vtable, reader.data, &vec, 1);
   if (got == 0) {
     rt_bytes_drop(ctx, &chunk);
     return rt_bytes_empty(ctx);
@@ -5759,7 +6955,8 @@ static uint32_t rt_bufread_fill_poll(ctx_t* ctx, uint32_t br_id, bytes_view_t* o
   iface_t reader = br->reader;
   if (reader.vtable != RT_IFACE_VTABLE_IO_READER) {
     uint32_t cap = br->buf.len;
-    uint32_t got = rt_ext_io_reader_read_into(reader.vtable, reader.data, br->buf.ptr, cap);
+    rt_ext_io_vec_t vec = { br->buf.ptr, cap };
+    uint32_t got = rt_ext_io_reader_read_vec_into(reader.vtable, reader.data, &vec, 1);
     br->direct_bytes = 0;
     br->start = 0;
     br->end = got;
@@ -5863,7 +7060,8 @@ static bytes_view_t rt_bufread_fill_block(ctx_t* ctx, uint32_t br_id) {
     iface_t reader = br->reader;
     if (reader.vtable != RT_IFACE_VTABLE_IO_READER) {
       uint32_t cap = br->buf.len;
-      uint32_t got = rt_ext_io_reader_read_into(reader.vtable, reader.data, br->buf.ptr, cap);
+      rt_ext_io_vec_t vec = { br->buf.ptr, cap };
+      uint32_t got = rt_ext_io_reader_read_vec_into(reader.vtable, reader.data, &vec, 1);
       br->direct_bytes = 0;
       br->start = 0;
       br->end = got;
@@ -6177,7 +7375,7 @@ static uint32_t rt_fs_latency_ticks(ctx_t* ctx, bytes_view_t path) {
     bytes_t p = ctx->fs_latency_entries[i].path;
     if (p.len != path.len) continue;
     if (p.len == 0) return ctx->fs_latency_entries[i].ticks;
-    if (memcmp(p.ptr, path.ptr, p.len) == 0) return ctx->fs_latency_entries[i].ticks;
+    if (rt_memeq(p.ptr, path.ptr, p.len)) return ctx->fs_latency_entries[i].ticks;
   }
   return ctx->fs_latency_default_ticks;
 }
@@ -7289,7 +8487,7 @@ static uint32_t rt_kv_find(ctx_t* ctx, bytes_view_t key) {
     bytes_t k = ctx->kv_items[i].key;
     if (k.len != key.len) continue;
     if (k.len == 0) return i;
-    if (memcmp(k.ptr, key.ptr, k.len) == 0) return i;
+    if (rt_memeq(k.ptr, key.ptr, k.len)) return i;
   }
   return UINT32_MAX;
 }
@@ -7432,7 +8630,7 @@ static uint32_t rt_kv_latency_ticks(ctx_t* ctx, bytes_view_t key) {
     bytes_t k = ctx->kv_latency_entries[i].key;
     if (k.len != key.len) continue;
     if (k.len == 0) return ctx->kv_latency_entries[i].ticks;
-    if (memcmp(k.ptr, key.ptr, k.len) == 0) return ctx->kv_latency_entries[i].ticks;
+    if (rt_memeq(k.ptr, key.ptr, k.len)) return ctx->kv_latency_entries[i].ticks;
   }
   return ctx->kv_latency_default_ticks;
 }
@@ -7638,48 +8836,27 @@ static vec_u8_t rt_vec_u8_set(ctx_t* ctx, vec_u8_t v, uint32_t idx, uint32_t val
   return v;
 }
 
-static vec_u8_t rt_vec_u8_push(ctx_t* ctx, vec_u8_t v, uint32_t val) {
-  if (v.len == v.cap) {
-    uint8_t* old_data = v.cap ? v.data : NULL;
-    uint32_t old_cap = v.cap;
-    uint32_t new_cap = v.cap ? (v.cap * 2) : 1;
-    uint8_t* data = (uint8_t*)rt_alloc_realloc(
-        ctx,
-        old_data,
-        old_cap,
-        new_cap,
-        1
-    );
-    if (v.data && v.len) {
-      memcpy(data, v.data, v.len);
-      rt_mem_on_memcpy(ctx, v.len);
-    }
-#ifdef X07_DEBUG_BORROW
-    rt_dbg_alloc_kill(ctx, v.dbg_aid);
-    v.dbg_aid = rt_dbg_alloc_register(ctx, data, new_cap);
+// Geometric vec growth factor (new_cap = old_cap * NUM / DEN, minimum +1).
+// Overridable at build time for workloads that want tighter or looser
+// amortization; pre-sizing via vec_u8.with_capacity / vec_u8.reserve_exact
+// avoids growth copies entirely.
+#ifndef X07_VEC_GROWTH_NUM
+#define X07_VEC_GROWTH_NUM 2u
+#endif
+#ifndef X07_VEC_GROWTH_DEN
+#define X07_VEC_GROWTH_DEN 1u
 #endif
-    if (old_data && old_cap) {
-      rt_free(ctx, old_data, old_cap, 1);
-    }
-    v.data = data;
-    v.cap = new_cap;
-  }
-  v.data[v.len++] = (uint8_t)(val & UINT32_C(0xFF));
-  return v;
-}
-
-static vec_u8_t rt_vec_u8_reserve_exact(ctx_t* ctx, vec_u8_t v, uint32_t additional) {
-  if (additional > UINT32_MAX - v.len) rt_trap("vec_u8.reserve_exact overflow");
-  uint32_t need = v.len + additional;
-  if (need <= v.cap) return v;
 
+// Reallocates v's storage to exactly new_cap (>= v.len) and moves the live
+// prefix. Single grow+copy site shared by push/extend/reserve paths.
+static vec_u8_t rt_vec_u8_grow_to(ctx_t* ctx, vec_u8_t v, uint32_t new_cap) {
   uint8_t* old_data = v.cap ? v.data : NULL;
   uint32_t old_cap = v.cap;
   uint8_t* data = (uint8_t*)rt_alloc_realloc(
       ctx,
       old_data,
       old_cap,
-      need,
+      new_cap,
       1
   );
   if (v.data && v.len) {
@@ -7688,51 +8865,52 @@ static vec_u8_t rt_vec_u8_reserve_exact(ctx_t* ctx, vec_u8_t v, uint32_t additio
   }
 #ifdef X07_DEBUG_BORROW
   rt_dbg_alloc_kill(ctx, v.dbg_aid);
-  v.dbg_aid = rt_dbg_alloc_register(ctx, data, need);
+  v.dbg_aid = rt_dbg_alloc_register(ctx, data, new_cap);
 #endif
   if (old_data && old_cap) {
     rt_free(ctx, old_data, old_cap, 1);
   }
   v.data = data;
-  v.cap = need;
+  v.cap = new_cap;
   return v;
 }
 
-static vec_u8_t rt_vec_u8_extend_zeroes(ctx_t* ctx, vec_u8_t v, uint32_t n) {
+// Next geometric capacity holding at least `need`.
+static uint32_t rt_vec_grow_cap(uint32_t cap, uint32_t need) {
+  uint32_t new_cap = cap ? cap : 1;
+  while (new_cap < need) {
+    uint64_t next =
+        ((uint64_t)new_cap * (uint64_t)X07_VEC_GROWTH_NUM) / (uint64_t)X07_VEC_GROWTH_DEN;
+    if (next <= (uint64_t)new_cap) next = (uint64_t)new_cap + 1u;
+    if (next > (uint64_t)UINT32_MAX) {
+      new_cap = need;
+      break;
+    }
+    new_cap = (uint32_t)next;
+  }
+  return new_cap;
+}
+
+static vec_u8_t rt_vec_u8_push(ctx_t* ctx, vec_u8_t v, uint32_t val) {
+  if (v.len == v.cap) {
+    v = rt_vec_u8_grow_to(ctx, v, rt_vec_grow_cap(v.cap, v.len + 1));
+  }
+  v.data[v.len++] = (uint8_t)(val & UINT32_C(0xFF));
+  return v;
+}
+
+static vec_u8_t rt_vec_u8_reserve_exact(ctx_t* ctx, vec_u8_t v, uint32_t additional) {
+  if (additional > UINT32_MAX - v.len) rt_trap("vec_u8.reserve_exact overflow");
+  uint32_t need = v.len + additional;
+  if (need <= v.cap) return v;
+  return rt_vec_u8_grow_to(ctx, v, need);
+}
+
+static vec_u8_t rt_vec_u8_extend_zeroes(ctx_t* ctx, vec_u8_t v, uint32_t n) {
   if (n > UINT32_MAX - v.len) rt_trap("vec_u8.extend_zeroes overflow");
   uint32_t need = v.len + n;
   if (need > v.cap) {
-    uint8_t* old_data = v.cap ? v.data : NULL;
-    uint32_t old_cap = v.cap;
-    uint32_t new_cap = v.cap ? v.cap : 1;
-    while (new_cap < need) {
-      if (new_cap > UINT32_MAX / 2) {
-        new_cap = need;
-        break;
-      }
-      new_cap *= 2;
-    }
-
-    uint8_t* data = (uint8_t*)rt_alloc_realloc(
-        ctx,
-        old_data,
-        old_cap,
-        new_cap,
-        1
-    );
-    if (v.data && v.len) {
-      memcpy(data, v.data, v.len);
-      rt_mem_on_memcpy(ctx, v.len);
-    }
-#ifdef X07_DEBUG_BORROW
-    rt_dbg_alloc_kill(ctx, v.dbg_aid);
-    v.dbg_aid = rt_dbg_alloc_register(ctx, data, new_cap);
-#endif
-    if (old_data && old_cap) {
-      rt_free(ctx, old_data, old_cap, 1);
-    }
-    v.data = data;
-    v.cap = new_cap;
+    v = rt_vec_u8_grow_to(ctx, v, rt_vec_grow_cap(v.cap, need));
   }
 
   if (n) {
@@ -7749,37 +8927,7 @@ static vec_u8_t rt_vec_u8_extend_bytes(ctx_t* ctx, vec_u8_t v, bytes_view_t b) {
   if (b.len > UINT32_MAX - v.len) rt_trap("vec_u8.extend_bytes overflow");
   uint32_t need = v.len + b.len;
   if (need > v.cap) {
-    uint8_t* old_data = v.cap ? v.data : NULL;
-    uint32_t old_cap = v.cap;
-    uint32_t new_cap = v.cap ? v.cap : 1;
-    while (new_cap < need) {
-      if (new_cap > UINT32_MAX / 2) {
-        new_cap = need;
-        break;
-      }
-      new_cap *= 2;
-    }
-
-    uint8_t* data = (uint8_t*)rt_alloc_realloc(
-        ctx,
-        old_data,
-        old_cap,
-        new_cap,
-        1
-    );
-    if (v.data && v.len) {
-      memcpy(data, v.data, v.len);
-      rt_mem_on_memcpy(ctx, v.len);
-    }
-#ifdef X07_DEBUG_BORROW
-    rt_dbg_alloc_kill(ctx, v.dbg_aid);
-    v.dbg_aid = rt_dbg_alloc_register(ctx, data, new_cap);
-#endif
-    if (old_data && old_cap) {
-      rt_free(ctx, old_data, old_cap, 1);
-    }
-    v.data = data;
-    v.cap = new_cap;
+    v = rt_vec_u8_grow_to(ctx, v, rt_vec_grow_cap(v.cap, need));
   }
 
   if (b.len) {
@@ -8911,6 +10059,11 @@ static bytes_t rt_json_jcs_canon_doc_v1(
 // - __internal.bytes.alloc_aligned_v1
 // - __internal.stream_xf.plugin_init_v1
 // - __internal.stream_xf.plugin_step_v1
+// - __internal.stream_xf.plugin_step_batch_v1
+// - __internal.stream_xf.plugin_chain_step_v1
+// - __internal.stream_xf.plugin_chain_flush_v1
+// - __internal.stream_xf.plugin_shard_step_v1
+// - __internal.stream_xf.plugin_shard_flush_v1
 // - __internal.stream_xf.plugin_flush_v1
 //
 // Output blob format (bytes):
@@ -8930,6 +10083,7 @@ static bytes_t rt_json_jcs_canon_doc_v1(
 //
 #define RT_XF_ABI_TAG_X7XF UINT32_C(0x46584637) // 'X7XF'
 #define RT_XF_ABI_VERSION_1 UINT32_C(1)
+#define RT_XF_ABI_VERSION_2 UINT32_C(2)
 
 #define RT_XF_E_CFG_TOO_LARGE UINT32_C(110)
 #define RT_XF_E_CFG_NON_CANON UINT32_C(111)
@@ -8940,6 +10094,7 @@ static bytes_t rt_json_jcs_canon_doc_v1(
 #define RT_XF_E_EMIT_LEN_GT_CAP UINT32_C(116)
 #define RT_XF_E_PLUGIN_INVALID UINT32_C(117)
 #define RT_XF_E_VIEW_NOT_ALLOWED UINT32_C(118)
+#define RT_XF_E_BATCH_INVALID UINT32_C(119)
 
 typedef bytes_t ev_bytes;
 
@@ -9010,6 +10165,18 @@ typedef struct {
   void (*drop)(void* state);
 } x07_stream_xf_plugin_v1;
 
+typedef struct {
+  x07_stream_xf_plugin_v1 base; // base.abi_version == 2
+  int32_t (*step_batch)(
+    void* state,
+    x07_scratch_v1* scratch,
+    const x07_bytes_view_v1* in_items,
+    uint32_t in_count,
+    x07_xf_emit_v1 emit,
+    x07_xf_budget_v1 budget
+  );
+} x07_stream_xf_plugin_v2;
+
 static bytes_t rt_bytes_alloc_aligned(ctx_t* ctx, uint32_t len, uint32_t align) {
   if (len == 0) return rt_bytes_empty(ctx);
   if (align == 0) align = 1;
@@ -9024,6 +10191,19 @@ static bytes_t rt_bytes_alloc_aligned(ctx_t* ctx, uint32_t len, uint32_t align)
   return out;
 }
 
+// One stage of a fused plugin chain (see rt_stream_xf_plugin_chain_step_v1).
+typedef struct {
+  const x07_stream_xf_plugin_v1* p;
+  uint32_t abi_major;
+  bytes_t state_b;
+  bytes_t scratch_b;
+  uint32_t max_out_bytes_per_step;
+  uint32_t max_out_items_per_step;
+  uint32_t max_out_buf_bytes;
+} rt_stream_xf_chain_stage_v1;
+
+struct rt_stream_xf_chain_run_s;
+
 typedef struct {
   ctx_t* ctx;
   vec_u8_t out;
@@ -9040,8 +10220,20 @@ typedef struct {
   const uint8_t* scratch_ptr;
   uint32_t scratch_len;
   uint32_t allow_emit_view;
+  // Fused chaining: when forward_mode is set, committed buffers and emitted
+  // views are fed straight into stage chain_next's step instead of being
+  // buffered into the out blob.
+  uint32_t forward_mode;
+  struct rt_stream_xf_chain_run_s* chain;
+  uint32_t chain_next;
 } rt_stream_xf_emit_ctx_v1;
 
+static int32_t rt_stream_xf_chain_feed(
+    struct rt_stream_xf_chain_run_s* run,
+    uint32_t stage,
+    const uint8_t* ptr,
+    uint32_t len);
+
 static void rt_stream_xf_emit_ctx_init(
     ctx_t* ctx,
     rt_stream_xf_emit_ctx_v1* e,
@@ -9120,6 +10312,15 @@ static int32_t rt_stream_xf_emit_commit_v1(void* emit_ctx, const x07_out_buf_v1*
   if (out->len > out->cap) return (int32_t)RT_XF_E_EMIT_LEN_GT_CAP;
   if (out->len > (uint32_t)INT32_MAX) return (int32_t)RT_XF_E_OUT_INVALID;
 
+  if (e->forward_mode) {
+    // Fused chain: hand the committed buffer to the next stage as its step
+    // input; the bytes are read in place and never re-buffered.
+    int32_t frc = rt_stream_xf_chain_feed(e->chain, e->chain_next, out->ptr, out->len);
+    rt_bytes_drop(e->ctx, &e->pending);
+    e->pending_active = 0;
+    return frc;
+  }
+
   // Append: u32 tag(0=inline), u32 len, then payload bytes.
   uint32_t hdr_off = e->out.len;
   e->out = rt_vec_u8_extend_zeroes(e->ctx, e->out, 8);
@@ -9197,6 +10398,16 @@ static int32_t rt_stream_xf_emit_view_v1(void* emit_ctx, const uint8_t* ptr, uin
     off = (uint32_t)d;
   }
 
+  if (e->forward_mode) {
+    // Fused chain: pass-through stages forward the borrowed range directly;
+    // the next stage reads the original bytes with no copy.
+    int32_t frc = rt_stream_xf_chain_feed(e->chain, e->chain_next, ptr, len);
+    if (frc != 0) return frc;
+    e->emit_items += 1;
+    e->emit_bytes += len;
+    return 0;
+  }
+
   uint32_t hdr_off = e->out.len;
   e->out = rt_vec_u8_extend_zeroes(e->ctx, e->out, 12);
   rt_write_u32_le(e->out.data + hdr_off, view_kind);
@@ -9230,7 +10441,9 @@ static uint32_t rt_stream_xf_validate_plugin(
 ) {
   if (!p) return RT_XF_E_PLUGIN_INVALID;
   if (p->abi_tag != RT_XF_ABI_TAG_X7XF) return RT_XF_E_PLUGIN_INVALID;
-  if (p->abi_version != RT_XF_ABI_VERSION_1) return RT_XF_E_PLUGIN_INVALID;
+  if (p->abi_version != RT_XF_ABI_VERSION_1 && p->abi_version != RT_XF_ABI_VERSION_2) {
+    return RT_XF_E_PLUGIN_INVALID;
+  }
   if (abi_major != p->abi_version) return RT_XF_E_PLUGIN_INVALID;
   if (!p->plugin_id || p->plugin_id[0] == 0) return RT_XF_E_PLUGIN_INVALID;
   if (!p->init || !p->step || !p->flush) return RT_XF_E_PLUGIN_INVALID;
@@ -9455,6 +10668,171 @@ static result_bytes_t rt_stream_xf_plugin_step_v1(
   return rt_stream_xf_result_ok(out_b);
 }
 
+// Decodes a batch blob
+//   u32_le count, then count times: u32_le len + payload bytes
+// (the same record framing as the inline records of the output blob) into a
+// freshly allocated view array. Returns 0 and sets *views_b/*count_out on
+// success; RT_XF_E_BATCH_INVALID on malformed framing.
+static uint32_t rt_stream_xf_decode_batch_v1(
+    ctx_t* ctx,
+    bytes_view_t batch,
+    bytes_t* views_b,
+    uint32_t* count_out
+) {
+  if (batch.len < 4) return RT_XF_E_BATCH_INVALID;
+  uint32_t in_count = rt_read_u32_le(batch.ptr);
+  // Each record carries at least a 4-byte length header.
+  if (in_count > (batch.len - 4) / 4) return RT_XF_E_BATCH_INVALID;
+  if (in_count > (uint32_t)(UINT32_MAX / sizeof(x07_bytes_view_v1))) {
+    return RT_XF_E_BATCH_INVALID;
+  }
+
+  *views_b = rt_bytes_alloc_aligned(ctx, in_count * (uint32_t)sizeof(x07_bytes_view_v1), 16);
+  x07_bytes_view_v1* views = (x07_bytes_view_v1*)views_b->ptr;
+  uint32_t pos = 4;
+  for (uint32_t i = 0; i < in_count; i++) {
+    if (batch.len - pos < 4) {
+      rt_bytes_drop(ctx, views_b);
+      return RT_XF_E_BATCH_INVALID;
+    }
+    uint32_t item_len = rt_read_u32_le(batch.ptr + pos);
+    pos += 4;
+    if (item_len > batch.len - pos) {
+      rt_bytes_drop(ctx, views_b);
+      return RT_XF_E_BATCH_INVALID;
+    }
+    views[i].ptr = batch.ptr + pos;
+    views[i].len = item_len;
+    pos += item_len;
+  }
+  if (pos != batch.len) {
+    rt_bytes_drop(ctx, views_b);
+    return RT_XF_E_BATCH_INVALID;
+  }
+  *count_out = in_count;
+  return 0;
+}
+
+// Runs a validated plugin over an item array with one shared emit context:
+// one step_batch call for v2 plugins that provide it, otherwise a step loop.
+// Budgets apply across the whole run. `in_ptr`/`in_len` is the buffer that
+// emit_view kind 1 offsets resolve against. Allocates from `ctx`, which under
+// X07_MT_SCHED may be a worker's heap.
+static result_bytes_t rt_stream_xf_run_views_v1(
+    ctx_t* ctx,
+    const x07_stream_xf_plugin_v1* p,
+    uint8_t* state_ptr,
+    uint32_t state_len,
+    uint8_t* scratch_ptr,
+    uint32_t scratch_len,
+    uint32_t max_out_bytes_per_step,
+    uint32_t max_out_items_per_step,
+    uint32_t max_out_buf_bytes,
+    const x07_bytes_view_v1* views,
+    uint32_t in_count,
+    const uint8_t* in_ptr,
+    uint32_t in_len
+) {
+  rt_stream_xf_emit_ctx_v1 emit_ctx;
+  rt_stream_xf_emit_ctx_init(ctx, &emit_ctx, max_out_bytes_per_step, max_out_items_per_step, max_out_buf_bytes);
+  emit_ctx.in_ptr = in_ptr;
+  emit_ctx.in_len = in_len;
+  emit_ctx.scratch_ptr = scratch_ptr;
+  emit_ctx.scratch_len = scratch_len;
+  emit_ctx.allow_emit_view = 1;
+  x07_xf_emit_v1 emit;
+  emit.emit_ctx = (void*)&emit_ctx;
+  emit.emit_alloc = rt_stream_xf_emit_alloc_v1;
+  emit.emit_commit = rt_stream_xf_emit_commit_v1;
+  emit.emit_view = rt_stream_xf_emit_view_v1;
+
+  x07_scratch_v1 scratch;
+  scratch.ptr = scratch_ptr;
+  scratch.cap = scratch_len;
+  scratch.used = 0;
+
+  x07_xf_budget_v1 budget;
+  budget.max_out_bytes_per_step = max_out_bytes_per_step;
+  budget.max_out_items_per_step = max_out_items_per_step;
+  budget.max_out_buf_bytes = max_out_buf_bytes;
+  budget.max_state_bytes = state_len;
+  budget.max_cfg_bytes = 0;
+  budget.max_scratch_bytes = scratch_len;
+
+  int32_t (*step_batch)(void*, x07_scratch_v1*, const x07_bytes_view_v1*, uint32_t, x07_xf_emit_v1, x07_xf_budget_v1) = NULL;
+  if (p->abi_version == RT_XF_ABI_VERSION_2) {
+    step_batch = ((const x07_stream_xf_plugin_v2*)p)->step_batch;
+  }
+
+  int32_t rc = 0;
+  if (step_batch) {
+    rc = step_batch(state_ptr, &scratch, views, in_count, emit, budget);
+  } else {
+    for (uint32_t i = 0; i < in_count; i++) {
+      rc = p->step(state_ptr, &scratch, views[i], emit, budget);
+      if (rc != 0) break;
+      if (emit_ctx.pending_active) {
+        rt_stream_xf_emit_ctx_drop(ctx, &emit_ctx);
+        return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+      }
+    }
+  }
+
+  if (rc != 0) {
+    uint32_t err_code = rt_stream_xf_norm_err_code(rc);
+    rt_stream_xf_emit_ctx_drop(ctx, &emit_ctx);
+    return rt_stream_xf_result_err(err_code);
+  }
+  if (emit_ctx.pending_active) {
+    rt_stream_xf_emit_ctx_drop(ctx, &emit_ctx);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+
+  if (emit_ctx.out.len < 4) {
+    rt_stream_xf_emit_ctx_drop(ctx, &emit_ctx);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  rt_write_u32_le(emit_ctx.out.data, emit_ctx.out_count);
+  bytes_t out_b = rt_vec_u8_into_bytes(ctx, &emit_ctx.out);
+  if (out_b.len < 4 || out_b.len > (uint32_t)INT32_MAX) {
+    rt_bytes_drop(ctx, &out_b);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  return rt_stream_xf_result_ok(out_b);
+}
+
+// Batched step: budgets apply per batch call; the out blob is identical
+// whether the plugin provides step_batch or the wrapper loops step.
+static result_bytes_t rt_stream_xf_plugin_step_batch_v1(
+    ctx_t* ctx,
+    const x07_stream_xf_plugin_v1* p,
+    uint32_t abi_major,
+    bytes_t state_b,
+    bytes_t scratch_b,
+    uint32_t max_out_bytes_per_step,
+    uint32_t max_out_items_per_step,
+    uint32_t max_out_buf_bytes,
+    bytes_view_t batch
+) {
+  uint32_t v = rt_stream_xf_validate_plugin(p, abi_major, state_b, scratch_b);
+  if (v) return rt_stream_xf_result_err(v);
+
+  bytes_t views_b;
+  uint32_t in_count = 0;
+  v = rt_stream_xf_decode_batch_v1(ctx, batch, &views_b, &in_count);
+  if (v) return rt_stream_xf_result_err(v);
+
+  result_bytes_t r = rt_stream_xf_run_views_v1(
+      ctx, p,
+      state_b.ptr, state_b.len,
+      scratch_b.ptr, scratch_b.len,
+      max_out_bytes_per_step, max_out_items_per_step, max_out_buf_bytes,
+      (const x07_bytes_view_v1*)views_b.ptr, in_count,
+      batch.ptr, batch.len);
+  rt_bytes_drop(ctx, &views_b);
+  return r;
+}
+
 static result_bytes_t rt_stream_xf_plugin_flush_v1(
     ctx_t* ctx,
     const x07_stream_xf_plugin_v1* p,
@@ -9518,6 +10896,445 @@ static result_bytes_t rt_stream_xf_plugin_flush_v1(
   return rt_stream_xf_result_ok(out_b);
 }
 
+// Fused plugin chains: stage i's committed buffers (and forwarded views) are
+// fed straight into stage i+1's step as input views, so intermediate items are
+// never re-buffered into an out blob — an N-stage chain touches each byte
+// once. Only the last stage buffers emissions, producing the usual out blob.
+// Per-stage out budgets apply per chain call; errors are sticky and the first
+// normalized error code (from any stage) is returned.
+
+typedef struct {
+  x07_scratch_v1 scratch;
+  rt_stream_xf_emit_ctx_v1 emit;
+  x07_xf_emit_v1 iface;
+  x07_xf_budget_v1 budget;
+} rt_stream_xf_chain_slot_v1;
+
+typedef struct rt_stream_xf_chain_run_s {
+  ctx_t* ctx;
+  const rt_stream_xf_chain_stage_v1* stages;
+  uint32_t n;
+  rt_stream_xf_chain_slot_v1* slots;
+  uint32_t failed;
+} rt_stream_xf_chain_run_t;
+
+static int32_t rt_stream_xf_chain_feed(
+    struct rt_stream_xf_chain_run_s* run,
+    uint32_t stage,
+    const uint8_t* ptr,
+    uint32_t len
+) {
+  if (!run || stage >= run->n) return (int32_t)RT_XF_E_OUT_INVALID;
+  if (run->failed) return (int32_t)run->failed;
+  rt_stream_xf_chain_slot_v1* slot = &run->slots[stage];
+  const rt_stream_xf_chain_stage_v1* st = &run->stages[stage];
+
+  slot->emit.in_ptr = ptr;
+  slot->emit.in_len = len;
+  x07_bytes_view_v1 in;
+  in.ptr = ptr;
+  in.len = len;
+
+  int32_t rc = st->p->step(st->state_b.ptr, &slot->scratch, in, slot->iface, slot->budget);
+  if (rc == 0 && slot->emit.pending_active) rc = (int32_t)RT_XF_E_OUT_INVALID;
+  if (rc != 0) {
+    uint32_t code = rt_stream_xf_norm_err_code(rc);
+    if (!run->failed) run->failed = code;
+    return (int32_t)code;
+  }
+  return 0;
+}
+
+static uint32_t rt_stream_xf_chain_setup(
+    ctx_t* ctx,
+    const rt_stream_xf_chain_stage_v1* stages,
+    uint32_t n,
+    rt_stream_xf_chain_run_t* run,
+    bytes_t* slots_b
+) {
+  if (n == 0 || n > (uint32_t)(UINT32_MAX / sizeof(rt_stream_xf_chain_slot_v1))) {
+    return RT_XF_E_PLUGIN_INVALID;
+  }
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t v = rt_stream_xf_validate_plugin(
+        stages[i].p, stages[i].abi_major, stages[i].state_b, stages[i].scratch_b);
+    if (v) return v;
+  }
+
+  *slots_b = rt_bytes_alloc_aligned(ctx, n * (uint32_t)sizeof(rt_stream_xf_chain_slot_v1), 16);
+  run->ctx = ctx;
+  run->stages = stages;
+  run->n = n;
+  run->slots = (rt_stream_xf_chain_slot_v1*)slots_b->ptr;
+  run->failed = 0;
+
+  for (uint32_t i = 0; i < n; i++) {
+    rt_stream_xf_chain_slot_v1* slot = &run->slots[i];
+    rt_stream_xf_emit_ctx_init(
+        ctx, &slot->emit,
+        stages[i].max_out_bytes_per_step,
+        stages[i].max_out_items_per_step,
+        stages[i].max_out_buf_bytes);
+    slot->emit.scratch_ptr = stages[i].scratch_b.ptr;
+    slot->emit.scratch_len = stages[i].scratch_b.len;
+    slot->emit.allow_emit_view = 1;
+    if (i + 1 < n) {
+      slot->emit.forward_mode = 1;
+      slot->emit.chain = run;
+      slot->emit.chain_next = i + 1;
+    }
+    slot->iface.emit_ctx = (void*)&slot->emit;
+    slot->iface.emit_alloc = rt_stream_xf_emit_alloc_v1;
+    slot->iface.emit_commit = rt_stream_xf_emit_commit_v1;
+    slot->iface.emit_view = rt_stream_xf_emit_view_v1;
+
+    slot->scratch.ptr = stages[i].scratch_b.ptr;
+    slot->scratch.cap = stages[i].scratch_b.len;
+    slot->scratch.used = 0;
+
+    slot->budget.max_out_bytes_per_step = stages[i].max_out_bytes_per_step;
+    slot->budget.max_out_items_per_step = stages[i].max_out_items_per_step;
+    slot->budget.max_out_buf_bytes = stages[i].max_out_buf_bytes;
+    slot->budget.max_state_bytes = stages[i].state_b.len;
+    slot->budget.max_cfg_bytes = 0;
+    slot->budget.max_scratch_bytes = stages[i].scratch_b.len;
+  }
+  return 0;
+}
+
+static void rt_stream_xf_chain_teardown(
+    ctx_t* ctx,
+    rt_stream_xf_chain_run_t* run,
+    bytes_t* slots_b
+) {
+  for (uint32_t i = 0; i < run->n; i++) {
+    rt_stream_xf_emit_ctx_drop(ctx, &run->slots[i].emit);
+  }
+  rt_bytes_drop(ctx, slots_b);
+}
+
+static result_bytes_t rt_stream_xf_chain_finalize(
+    ctx_t* ctx,
+    rt_stream_xf_chain_run_t* run,
+    bytes_t* slots_b,
+    int32_t rc
+) {
+  if (run->failed) {
+    uint32_t code = run->failed;
+    rt_stream_xf_chain_teardown(ctx, run, slots_b);
+    return rt_stream_xf_result_err(code);
+  }
+  if (rc != 0) {
+    uint32_t code = rt_stream_xf_norm_err_code(rc);
+    rt_stream_xf_chain_teardown(ctx, run, slots_b);
+    return rt_stream_xf_result_err(code);
+  }
+
+  rt_stream_xf_emit_ctx_v1* last = &run->slots[run->n - 1].emit;
+  if (last->pending_active || last->out.len < 4) {
+    rt_stream_xf_chain_teardown(ctx, run, slots_b);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  rt_write_u32_le(last->out.data, last->out_count);
+  bytes_t out_b = rt_vec_u8_into_bytes(ctx, &last->out);
+  rt_stream_xf_chain_teardown(ctx, run, slots_b);
+  if (out_b.len < 4 || out_b.len > (uint32_t)INT32_MAX) {
+    rt_bytes_drop(ctx, &out_b);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  return rt_stream_xf_result_ok(out_b);
+}
+
+static result_bytes_t rt_stream_xf_plugin_chain_step_v1(
+    ctx_t* ctx,
+    const rt_stream_xf_chain_stage_v1* stages,
+    uint32_t n,
+    bytes_view_t input
+) {
+  rt_stream_xf_chain_run_t run;
+  bytes_t slots_b;
+  uint32_t v = rt_stream_xf_chain_setup(ctx, stages, n, &run, &slots_b);
+  if (v) return rt_stream_xf_result_err(v);
+
+  int32_t rc = rt_stream_xf_chain_feed(&run, 0, input.ptr, input.len);
+  return rt_stream_xf_chain_finalize(ctx, &run, &slots_b, rc);
+}
+
+// Flushes the chain front to back: stage i's flush emissions are forwarded
+// through the remaining stages before stage i+1 itself is flushed, so
+// ordering matches running the stages unfused.
+static result_bytes_t rt_stream_xf_plugin_chain_flush_v1(
+    ctx_t* ctx,
+    const rt_stream_xf_chain_stage_v1* stages,
+    uint32_t n
+) {
+  rt_stream_xf_chain_run_t run;
+  bytes_t slots_b;
+  uint32_t v = rt_stream_xf_chain_setup(ctx, stages, n, &run, &slots_b);
+  if (v) return rt_stream_xf_result_err(v);
+
+  int32_t rc = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    rt_stream_xf_chain_slot_v1* slot = &run.slots[i];
+    rc = stages[i].p->flush(stages[i].state_b.ptr, &slot->scratch, slot->iface, slot->budget);
+    if (rc == 0 && slot->emit.pending_active) rc = (int32_t)RT_XF_E_OUT_INVALID;
+    if (rc != 0 || run.failed) break;
+  }
+  return rt_stream_xf_chain_finalize(ctx, &run, &slots_b, rc);
+}
+
+// Parallel sharded execution: K independent plugin states (packed into one
+// bytes buffer, state_size apart; scratch likewise) process a partitioned
+// batch. Each item is routed to shard `key % K` by its caller-supplied u32
+// partition key, order is preserved within a shard, shards run as parallel
+// tasks (worker threads under X07_MT_SCHED, cooperatively otherwise), and
+// emissions are merged in shard order 0..K-1 — so the merged blob is
+// deterministic regardless of how shards are scheduled. Out budgets apply
+// per shard run; the first failing shard (in shard order) wins.
+
+typedef struct {
+  const x07_stream_xf_plugin_v1* p;
+  uint8_t* state_ptr;
+  uint32_t state_len;
+  uint8_t* scratch_ptr;
+  uint32_t scratch_len;
+  uint32_t max_out_bytes_per_step;
+  uint32_t max_out_items_per_step;
+  uint32_t max_out_buf_bytes;
+  const x07_bytes_view_v1* items;
+  uint32_t item_count;
+  const uint8_t* in_ptr;
+  uint32_t in_len;
+} rt_stream_xf_shard_fut_t;
+
+static uint32_t rt_stream_xf_shard_poll(ctx_t* ctx, void* fut, rt_task_out_t* out) {
+  rt_stream_xf_shard_fut_t* f = (rt_stream_xf_shard_fut_t*)fut;
+  result_bytes_t r = rt_stream_xf_run_views_v1(
+      ctx, f->p,
+      f->state_ptr, f->state_len,
+      f->scratch_ptr, f->scratch_len,
+      f->max_out_bytes_per_step, f->max_out_items_per_step, f->max_out_buf_bytes,
+      f->items, f->item_count,
+      f->in_ptr, f->in_len);
+  out->kind = RT_TASK_OUT_KIND_RESULT_BYTES;
+  out->payload.result_bytes = r;
+  return 1;
+}
+
+// Validates the packed shard state/scratch layout and returns the per-shard
+// slices via compound literals in the caller.
+static uint32_t rt_stream_xf_shard_validate(
+    const x07_stream_xf_plugin_v1* p,
+    uint32_t abi_major,
+    bytes_t states_b,
+    bytes_t scratch_b,
+    uint32_t shards
+) {
+  if (!p) return RT_XF_E_PLUGIN_INVALID;
+  if (shards == 0 || shards > (uint32_t)INT32_MAX) return RT_XF_E_PLUGIN_INVALID;
+  if (p->state_size != 0 && shards > UINT32_MAX / p->state_size) return RT_XF_E_PLUGIN_INVALID;
+  if (states_b.len != shards * p->state_size) return RT_XF_E_PLUGIN_INVALID;
+  if (p->scratch_max != 0 && shards > UINT32_MAX / p->scratch_max) return RT_XF_E_PLUGIN_INVALID;
+  if (scratch_b.len != shards * p->scratch_max) return RT_XF_E_PLUGIN_INVALID;
+  for (uint32_t k = 0; k < shards; k++) {
+    bytes_t st;
+    st.ptr = states_b.ptr + (size_t)k * p->state_size;
+    st.len = p->state_size;
+    bytes_t sc;
+    sc.ptr = scratch_b.ptr + (size_t)k * p->scratch_max;
+    sc.len = p->scratch_max;
+    uint32_t v = rt_stream_xf_validate_plugin(p, abi_major, st, sc);
+    if (v) return v;
+  }
+  return 0;
+}
+
+static result_bytes_t rt_stream_xf_plugin_shard_step_v1(
+    ctx_t* ctx,
+    const x07_stream_xf_plugin_v1* p,
+    uint32_t abi_major,
+    bytes_t states_b,
+    bytes_t scratch_b,
+    uint32_t max_out_bytes_per_step,
+    uint32_t max_out_items_per_step,
+    uint32_t max_out_buf_bytes,
+    uint32_t shards,
+    bytes_view_t batch,
+    bytes_view_t keys
+) {
+  uint32_t v = rt_stream_xf_shard_validate(p, abi_major, states_b, scratch_b, shards);
+  if (v) return rt_stream_xf_result_err(v);
+
+  bytes_t views_b;
+  uint32_t in_count = 0;
+  v = rt_stream_xf_decode_batch_v1(ctx, batch, &views_b, &in_count);
+  if (v) return rt_stream_xf_result_err(v);
+  if (keys.len != in_count * 4 || in_count > UINT32_MAX / 4) {
+    rt_bytes_drop(ctx, &views_b);
+    return rt_stream_xf_result_err(RT_XF_E_BATCH_INVALID);
+  }
+
+  const x07_bytes_view_v1* views = (const x07_bytes_view_v1*)views_b.ptr;
+
+  // counts / starts / cursor, task ids, per-shard futs, shard-sorted items.
+  bytes_t tabs_b = rt_bytes_alloc_aligned(ctx, shards * 16, 16);
+  uint32_t* counts = (uint32_t*)tabs_b.ptr;
+  uint32_t* starts = counts + shards;
+  uint32_t* cursor = starts + shards;
+  uint32_t* task_ids = cursor + shards;
+  memset(tabs_b.ptr, 0, tabs_b.len);
+  bytes_t futs_b = rt_bytes_alloc_aligned(ctx, shards * (uint32_t)sizeof(rt_stream_xf_shard_fut_t), 16);
+  rt_stream_xf_shard_fut_t* futs = (rt_stream_xf_shard_fut_t*)futs_b.ptr;
+  bytes_t sorted_b = rt_bytes_alloc_aligned(ctx, in_count * (uint32_t)sizeof(x07_bytes_view_v1), 16);
+  x07_bytes_view_v1* sorted = (x07_bytes_view_v1*)sorted_b.ptr;
+
+  for (uint32_t i = 0; i < in_count; i++) {
+    counts[rt_read_u32_le(keys.ptr + (size_t)i * 4) % shards] += 1;
+  }
+  {
+    uint32_t acc = 0;
+    for (uint32_t k = 0; k < shards; k++) {
+      starts[k] = acc;
+      cursor[k] = acc;
+      acc += counts[k];
+    }
+  }
+  for (uint32_t i = 0; i < in_count; i++) {
+    uint32_t k = rt_read_u32_le(keys.ptr + (size_t)i * 4) % shards;
+    sorted[cursor[k]] = views[i];
+    cursor[k] += 1;
+  }
+
+  for (uint32_t k = 0; k < shards; k++) {
+    task_ids[k] = 0;
+    if (counts[k] == 0) continue;
+    rt_stream_xf_shard_fut_t* f = &futs[k];
+    f->p = p;
+    f->state_ptr = states_b.ptr + (size_t)k * p->state_size;
+    f->state_len = p->state_size;
+    f->scratch_ptr = scratch_b.ptr + (size_t)k * p->scratch_max;
+    f->scratch_len = p->scratch_max;
+    f->max_out_bytes_per_step = max_out_bytes_per_step;
+    f->max_out_items_per_step = max_out_items_per_step;
+    f->max_out_buf_bytes = max_out_buf_bytes;
+    f->items = sorted + starts[k];
+    f->item_count = counts[k];
+    f->in_ptr = batch.ptr;
+    f->in_len = batch.len;
+    task_ids[k] = rt_task_create_parallel(ctx, rt_stream_xf_shard_poll, NULL, f);
+  }
+
+  // Join and merge in shard order; every spawned shard is joined even after
+  // an error so task slots and worker outputs are reclaimed.
+  vec_u8_t out = rt_vec_u8_new(ctx, 4);
+  out = rt_vec_u8_extend_zeroes(ctx, out, 4);
+  uint64_t total_count = 0;
+  uint32_t first_err = 0;
+  for (uint32_t k = 0; k < shards; k++) {
+    if (task_ids[k] == 0) continue;
+    result_bytes_t r = rt_task_join_result_bytes_block(ctx, task_ids[k]);
+    if (r.tag == 0) {
+      if (first_err == 0) first_err = r.payload.err;
+      continue;
+    }
+    bytes_t shard_out = r.payload.ok;
+    if (first_err == 0) {
+      if (shard_out.len < 4) {
+        first_err = RT_XF_E_OUT_INVALID;
+      } else {
+        total_count += (uint64_t)rt_read_u32_le(shard_out.ptr);
+        uint32_t body_len = shard_out.len - 4;
+        if (body_len != 0) {
+          uint32_t pos = out.len;
+          out = rt_vec_u8_extend_zeroes(ctx, out, body_len);
+          memcpy(out.data + pos, shard_out.ptr + 4, body_len);
+          rt_mem_on_memcpy(ctx, body_len);
+        }
+      }
+    }
+    rt_bytes_drop(ctx, &shard_out);
+  }
+
+  rt_bytes_drop(ctx, &sorted_b);
+  rt_bytes_drop(ctx, &futs_b);
+  rt_bytes_drop(ctx, &tabs_b);
+  rt_bytes_drop(ctx, &views_b);
+
+  if (first_err == 0 && total_count > (uint64_t)INT32_MAX) first_err = RT_XF_E_OUT_INVALID;
+  if (first_err) {
+    rt_vec_u8_drop(ctx, &out);
+    return rt_stream_xf_result_err(first_err);
+  }
+  rt_write_u32_le(out.data, (uint32_t)total_count);
+  bytes_t out_b = rt_vec_u8_into_bytes(ctx, &out);
+  if (out_b.len < 4 || out_b.len > (uint32_t)INT32_MAX) {
+    rt_bytes_drop(ctx, &out_b);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  return rt_stream_xf_result_ok(out_b);
+}
+
+// Flushes every shard state in shard order (sequentially; flush work is
+// small compared to the steady-state step stream) and merges the emissions
+// into one blob.
+static result_bytes_t rt_stream_xf_plugin_shard_flush_v1(
+    ctx_t* ctx,
+    const x07_stream_xf_plugin_v1* p,
+    uint32_t abi_major,
+    bytes_t states_b,
+    bytes_t scratch_b,
+    uint32_t max_out_bytes_per_step,
+    uint32_t max_out_items_per_step,
+    uint32_t max_out_buf_bytes,
+    uint32_t shards
+) {
+  uint32_t v = rt_stream_xf_shard_validate(p, abi_major, states_b, scratch_b, shards);
+  if (v) return rt_stream_xf_result_err(v);
+
+  vec_u8_t out = rt_vec_u8_new(ctx, 4);
+  out = rt_vec_u8_extend_zeroes(ctx, out, 4);
+  uint64_t total_count = 0;
+  for (uint32_t k = 0; k < shards; k++) {
+    bytes_t st;
+    st.ptr = states_b.ptr + (size_t)k * p->state_size;
+    st.len = p->state_size;
+    bytes_t sc;
+    sc.ptr = scratch_b.ptr + (size_t)k * p->scratch_max;
+    sc.len = p->scratch_max;
+    result_bytes_t r = rt_stream_xf_plugin_flush_v1(
+        ctx, p, abi_major, st, sc,
+        max_out_bytes_per_step, max_out_items_per_step, max_out_buf_bytes);
+    if (r.tag == 0) {
+      rt_vec_u8_drop(ctx, &out);
+      return rt_stream_xf_result_err(r.payload.err);
+    }
+    bytes_t shard_out = r.payload.ok;
+    if (shard_out.len >= 4) {
+      total_count += (uint64_t)rt_read_u32_le(shard_out.ptr);
+      uint32_t body_len = shard_out.len - 4;
+      if (body_len != 0) {
+        uint32_t pos = out.len;
+        out = rt_vec_u8_extend_zeroes(ctx, out, body_len);
+        memcpy(out.data + pos, shard_out.ptr + 4, body_len);
+        rt_mem_on_memcpy(ctx, body_len);
+      }
+    }
+    rt_bytes_drop(ctx, &shard_out);
+  }
+
+  if (total_count > (uint64_t)INT32_MAX) {
+    rt_vec_u8_drop(ctx, &out);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  rt_write_u32_le(out.data, (uint32_t)total_count);
+  bytes_t out_b = rt_vec_u8_into_bytes(ctx, &out);
+  if (out_b.len < 4 || out_b.len > (uint32_t)INT32_MAX) {
+    rt_bytes_drop(ctx, &out_b);
+    return rt_stream_xf_result_err(RT_XF_E_OUT_INVALID);
+  }
+  return rt_stream_xf_result_ok(out_b);
+}
+
 // --- X07_STREAM_XF_PLUGIN_END
 
 struct rt_scratch_u8_fixed_s {
@@ -10047,15 +11864,7 @@ static void rt_vec_value_reserve_exact_in_place(ctx_t* ctx, vec_value_t* v, uint
 }
 
 static void rt_vec_value_grow_for_push(ctx_t* ctx, vec_value_t* v, uint32_t need) {
-  uint32_t new_cap = v->cap ? v->cap : 1;
-  while (new_cap < need) {
-    if (new_cap > UINT32_MAX / 2) {
-      new_cap = need;
-      break;
-    }
-    new_cap *= 2;
-  }
-  rt_vec_value_grow_exact(ctx, v, new_cap);
+  rt_vec_value_grow_exact(ctx, v, rt_vec_grow_cap(v->cap, need));
 }
 
 static uint32_t rt_vec_value_push_raw(ctx_t* ctx, vec_value_t* v, const void* x) {
@@ -10896,6 +12705,14 @@ static void rt_ctx_cleanup(ctx_t* ctx) {
       (uint32_t)_Alignof(dbg_borrow_rec_t)
     );
   }
+  if (ctx->dbg_borrow_idx && ctx->dbg_borrow_idx_cap) {
+    rt_free(
+      ctx,
+      ctx->dbg_borrow_idx,
+      ctx->dbg_borrow_idx_cap * (uint32_t)sizeof(dbg_idx_ent_t),
+      (uint32_t)_Alignof(dbg_idx_ent_t)
+    );
+  }
   if (ctx->dbg_allocs && ctx->dbg_allocs_cap) {
     rt_free(
       ctx,
@@ -10904,12 +12721,30 @@ static void rt_ctx_cleanup(ctx_t* ctx) {
       (uint32_t)_Alignof(dbg_alloc_rec_t)
     );
   }
+  if (ctx->dbg_alloc_idx && ctx->dbg_alloc_idx_cap) {
+    rt_free(
+      ctx,
+      ctx->dbg_alloc_idx,
+      ctx->dbg_alloc_idx_cap * (uint32_t)sizeof(dbg_idx_ent_t),
+      (uint32_t)_Alignof(dbg_idx_ent_t)
+    );
+  }
   ctx->dbg_borrows = NULL;
   ctx->dbg_borrows_len = 0;
   ctx->dbg_borrows_cap = 0;
+  ctx->dbg_borrows_free = 0;
+  ctx->dbg_borrow_idx = NULL;
+  ctx->dbg_borrow_idx_cap = 0;
+  ctx->dbg_borrow_idx_used = 0;
+  ctx->dbg_borrow_live = 0;
   ctx->dbg_allocs = NULL;
   ctx->dbg_allocs_len = 0;
   ctx->dbg_allocs_cap = 0;
+  ctx->dbg_allocs_free = 0;
+  ctx->dbg_alloc_idx = NULL;
+  ctx->dbg_alloc_idx_cap = 0;
+  ctx->dbg_alloc_idx_used = 0;
+  ctx->dbg_alloc_live = 0;
 #endif
 
   rt_os_process_cleanup(ctx);
@@ -329,6 +329,360 @@ impl<'a> Emitter<'a> {
         Ok(())
     }
 
+    pub(super) fn emit_internal_stream_xf_plugin_step_batch_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        if args.len() != 9 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "__internal.stream_xf.plugin_step_batch_v1 expects 9 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "__internal.stream_xf.plugin_step_batch_v1 returns result_bytes".to_string(),
+            ));
+        }
+
+        let backend_id = self.parse_bytes_lit_text_arg(
+            "__internal.stream_xf.plugin_step_batch_v1 backend_id",
+            &args[0],
+        )?;
+        crate::validate::validate_symbol(&backend_id)
+            .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+        let abi_major_i32 = self.parse_i32_lit_arg(
+            "__internal.stream_xf.plugin_step_batch_v1 abi_major",
+            &args[1],
+        )?;
+        let abi_major = u32::try_from(abi_major_i32).unwrap_or(0);
+        if abi_major == 0 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "__internal.stream_xf.plugin_step_batch_v1 abi_major must be >= 1".to_string(),
+            ));
+        }
+        let export_symbol = self.parse_bytes_lit_text_arg(
+            "__internal.stream_xf.plugin_step_batch_v1 export_symbol",
+            &args[2],
+        )?;
+        crate::validate::validate_local_name(&export_symbol)
+            .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+        self.require_native_backend(&backend_id, abi_major, &export_symbol)?;
+
+        let state_b = self.lookup_borrowed_bytes_ident_arg(
+            "__internal.stream_xf.plugin_step_batch_v1 state",
+            &args[3],
+        )?;
+        let scratch_b = self.lookup_borrowed_bytes_ident_arg(
+            "__internal.stream_xf.plugin_step_batch_v1 scratch",
+            &args[4],
+        )?;
+        let max_out_bytes_per_step = self.emit_expr(&args[5])?;
+        let max_out_items_per_step = self.emit_expr(&args[6])?;
+        let max_out_buf_bytes = self.emit_expr(&args[7])?;
+        let batch = self.emit_expr(&args[8])?;
+        if max_out_bytes_per_step.ty != Ty::I32
+            || max_out_items_per_step.ty != Ty::I32
+            || max_out_buf_bytes.ty != Ty::I32
+            || batch.ty != Ty::BytesView
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "__internal.stream_xf.plugin_step_batch_v1 arg types mismatch".to_string(),
+            ));
+        }
+
+        self.line(&format!("extern x07_stream_xf_plugin_v1 {export_symbol};"));
+        self.line(&format!(
+            "{dest} = rt_stream_xf_plugin_step_batch_v1(ctx, &{export_symbol}, UINT32_C({abi_major}), {}, {}, (uint32_t){}, (uint32_t){}, (uint32_t){}, {});",
+            state_b.c_name,
+            scratch_b.c_name,
+            max_out_bytes_per_step.c_name,
+            max_out_items_per_step.c_name,
+            max_out_buf_bytes.c_name,
+            batch.c_name,
+        ));
+
+        self.release_temp_view_borrow(&batch)?;
+        Ok(())
+    }
+
+    // Shared emitter for __internal.stream_xf.plugin_chain_step_v1 (with a
+    // trailing input view) and __internal.stream_xf.plugin_chain_flush_v1.
+    // Stages are flat groups of 8 args:
+    //   backend_id, abi_major, export_symbol, state, scratch,
+    //   max_out_bytes_per_step, max_out_items_per_step, max_out_buf_bytes
+    pub(super) fn emit_internal_stream_xf_plugin_chain_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+        is_step: bool,
+    ) -> Result<(), CompilerError> {
+        let head = if is_step {
+            "__internal.stream_xf.plugin_chain_step_v1"
+        } else {
+            "__internal.stream_xf.plugin_chain_flush_v1"
+        };
+        let stage_args = if is_step {
+            args.len().checked_sub(1)
+        } else {
+            Some(args.len())
+        };
+        let n_stages = match stage_args {
+            Some(sa) if sa >= 8 && sa % 8 == 0 => sa / 8,
+            _ => {
+                return Err(CompilerError::new(
+                    CompileErrorKind::Parse,
+                    format!("{head} expects 8 args per stage (plus the input for step)"),
+                ));
+            }
+        };
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} returns result_bytes"),
+            ));
+        }
+
+        struct ChainStage {
+            abi_major: u32,
+            export_symbol: String,
+            state: String,
+            scratch: String,
+            max_out_bytes_per_step: String,
+            max_out_items_per_step: String,
+            max_out_buf_bytes: String,
+        }
+        let mut stages: Vec<ChainStage> = Vec::with_capacity(n_stages);
+        for s in 0..n_stages {
+            let base = s * 8;
+            let backend_id =
+                self.parse_bytes_lit_text_arg(&format!("{head} backend_id"), &args[base])?;
+            crate::validate::validate_symbol(&backend_id)
+                .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+            let abi_major_i32 =
+                self.parse_i32_lit_arg(&format!("{head} abi_major"), &args[base + 1])?;
+            let abi_major = u32::try_from(abi_major_i32).unwrap_or(0);
+            if abi_major == 0 {
+                return Err(CompilerError::new(
+                    CompileErrorKind::Typing,
+                    format!("{head} abi_major must be >= 1"),
+                ));
+            }
+            let export_symbol =
+                self.parse_bytes_lit_text_arg(&format!("{head} export_symbol"), &args[base + 2])?;
+            crate::validate::validate_local_name(&export_symbol)
+                .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+            self.require_native_backend(&backend_id, abi_major, &export_symbol)?;
+
+            let state_b =
+                self.lookup_borrowed_bytes_ident_arg(&format!("{head} state"), &args[base + 3])?;
+            let scratch_b =
+                self.lookup_borrowed_bytes_ident_arg(&format!("{head} scratch"), &args[base + 4])?;
+            let max_out_bytes_per_step = self.emit_expr(&args[base + 5])?;
+            let max_out_items_per_step = self.emit_expr(&args[base + 6])?;
+            let max_out_buf_bytes = self.emit_expr(&args[base + 7])?;
+            if max_out_bytes_per_step.ty != Ty::I32
+                || max_out_items_per_step.ty != Ty::I32
+                || max_out_buf_bytes.ty != Ty::I32
+            {
+                return Err(CompilerError::new(
+                    CompileErrorKind::Typing,
+                    format!("{head} arg types mismatch"),
+                ));
+            }
+            stages.push(ChainStage {
+                abi_major,
+                export_symbol,
+                state: state_b.c_name.clone(),
+                scratch: scratch_b.c_name.clone(),
+                max_out_bytes_per_step: max_out_bytes_per_step.c_name.clone(),
+                max_out_items_per_step: max_out_items_per_step.c_name.clone(),
+                max_out_buf_bytes: max_out_buf_bytes.c_name.clone(),
+            });
+        }
+
+        let input = if is_step {
+            let input = self.emit_expr(&args[args.len() - 1])?;
+            if input.ty != Ty::BytesView {
+                return Err(CompilerError::new(
+                    CompileErrorKind::Typing,
+                    format!("{head} expects bytes_view input"),
+                ));
+            }
+            Some(input)
+        } else {
+            None
+        };
+
+        self.line("{");
+        for st in &stages {
+            self.line(&format!(
+                "extern x07_stream_xf_plugin_v1 {};",
+                st.export_symbol
+            ));
+        }
+        self.line(&format!(
+            "rt_stream_xf_chain_stage_v1 xf_chain[{n_stages}];"
+        ));
+        for (i, st) in stages.iter().enumerate() {
+            self.line(&format!("xf_chain[{i}].p = &{};", st.export_symbol));
+            self.line(&format!(
+                "xf_chain[{i}].abi_major = UINT32_C({});",
+                st.abi_major
+            ));
+            self.line(&format!("xf_chain[{i}].state_b = {};", st.state));
+            self.line(&format!("xf_chain[{i}].scratch_b = {};", st.scratch));
+            self.line(&format!(
+                "xf_chain[{i}].max_out_bytes_per_step = (uint32_t){};",
+                st.max_out_bytes_per_step
+            ));
+            self.line(&format!(
+                "xf_chain[{i}].max_out_items_per_step = (uint32_t){};",
+                st.max_out_items_per_step
+            ));
+            self.line(&format!(
+                "xf_chain[{i}].max_out_buf_bytes = (uint32_t){};",
+                st.max_out_buf_bytes
+            ));
+        }
+        if let Some(input) = &input {
+            self.line(&format!(
+                "{dest} = rt_stream_xf_plugin_chain_step_v1(ctx, xf_chain, UINT32_C({n_stages}), {});",
+                input.c_name
+            ));
+        } else {
+            self.line(&format!(
+                "{dest} = rt_stream_xf_plugin_chain_flush_v1(ctx, xf_chain, UINT32_C({n_stages}));"
+            ));
+        }
+        self.line("}");
+
+        if let Some(input) = input {
+            self.release_temp_view_borrow(&input)?;
+        }
+        Ok(())
+    }
+
+    // Shared emitter for __internal.stream_xf.plugin_shard_step_v1 (with
+    // trailing batch + keys views) and
+    // __internal.stream_xf.plugin_shard_flush_v1. `states`/`scratch` pack
+    // one slice per shard, state_size/scratch_max apart.
+    pub(super) fn emit_internal_stream_xf_plugin_shard_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+        is_step: bool,
+    ) -> Result<(), CompilerError> {
+        let head = if is_step {
+            "__internal.stream_xf.plugin_shard_step_v1"
+        } else {
+            "__internal.stream_xf.plugin_shard_flush_v1"
+        };
+        let expected_args = if is_step { 11 } else { 9 };
+        if args.len() != expected_args {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                format!("{head} expects {expected_args} args"),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} returns result_bytes"),
+            ));
+        }
+
+        let backend_id = self.parse_bytes_lit_text_arg(&format!("{head} backend_id"), &args[0])?;
+        crate::validate::validate_symbol(&backend_id)
+            .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+        let abi_major_i32 = self.parse_i32_lit_arg(&format!("{head} abi_major"), &args[1])?;
+        let abi_major = u32::try_from(abi_major_i32).unwrap_or(0);
+        if abi_major == 0 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} abi_major must be >= 1"),
+            ));
+        }
+        let export_symbol =
+            self.parse_bytes_lit_text_arg(&format!("{head} export_symbol"), &args[2])?;
+        crate::validate::validate_local_name(&export_symbol)
+            .map_err(|message| CompilerError::new(CompileErrorKind::Typing, message))?;
+
+        self.require_native_backend(&backend_id, abi_major, &export_symbol)?;
+
+        let states_b = self.lookup_borrowed_bytes_ident_arg(&format!("{head} states"), &args[3])?;
+        let scratch_b =
+            self.lookup_borrowed_bytes_ident_arg(&format!("{head} scratch"), &args[4])?;
+        let max_out_bytes_per_step = self.emit_expr(&args[5])?;
+        let max_out_items_per_step = self.emit_expr(&args[6])?;
+        let max_out_buf_bytes = self.emit_expr(&args[7])?;
+        let shards = self.emit_expr(&args[8])?;
+        if max_out_bytes_per_step.ty != Ty::I32
+            || max_out_items_per_step.ty != Ty::I32
+            || max_out_buf_bytes.ty != Ty::I32
+            || shards.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                format!("{head} arg types mismatch"),
+            ));
+        }
+
+        let views = if is_step {
+            let batch = self.emit_expr(&args[9])?;
+            let keys = self.emit_expr(&args[10])?;
+            if batch.ty != Ty::BytesView || keys.ty != Ty::BytesView {
+                return Err(CompilerError::new(
+                    CompileErrorKind::Typing,
+                    format!("{head} expects bytes_view batch and keys"),
+                ));
+            }
+            Some((batch, keys))
+        } else {
+            None
+        };
+
+        self.line(&format!("extern x07_stream_xf_plugin_v1 {export_symbol};"));
+        if let Some((batch, keys)) = &views {
+            self.line(&format!(
+                "{dest} = rt_stream_xf_plugin_shard_step_v1(ctx, &{export_symbol}, UINT32_C({abi_major}), {}, {}, (uint32_t){}, (uint32_t){}, (uint32_t){}, (uint32_t){}, {}, {});",
+                states_b.c_name,
+                scratch_b.c_name,
+                max_out_bytes_per_step.c_name,
+                max_out_items_per_step.c_name,
+                max_out_buf_bytes.c_name,
+                shards.c_name,
+                batch.c_name,
+                keys.c_name,
+            ));
+        } else {
+            self.line(&format!(
+                "{dest} = rt_stream_xf_plugin_shard_flush_v1(ctx, &{export_symbol}, UINT32_C({abi_major}), {}, {}, (uint32_t){}, (uint32_t){}, (uint32_t){}, (uint32_t){});",
+                states_b.c_name,
+                scratch_b.c_name,
+                max_out_bytes_per_step.c_name,
+                max_out_items_per_step.c_name,
+                max_out_buf_bytes.c_name,
+                shards.c_name,
+            ));
+        }
+
+        if let Some((batch, keys)) = views {
+            self.release_temp_view_borrow(&keys)?;
+            self.release_temp_view_borrow(&batch)?;
+        }
+        Ok(())
+    }
+
     pub(super) fn emit_internal_stream_xf_plugin_flush_v1_to(
         &mut self,
         args: &[Expr],
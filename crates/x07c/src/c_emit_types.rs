@@ -1158,7 +1158,9 @@ impl InferCtx {
                     }
                     "math.f64.add_v1" | "math.f64.sub_v1" | "math.f64.mul_v1"
                     | "math.f64.div_v1" | "math.f64.pow_v1" | "math.f64.atan2_v1"
-                    | "math.f64.min_v1" | "math.f64.max_v1" => {
+                    | "math.f64.min_v1" | "math.f64.max_v1" | "math.f64.arr.add_v1"
+                    | "math.f64.arr.sub_v1" | "math.f64.arr.mul_v1"
+                    | "math.f64.arr.div_v1" => {
                         if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
@@ -1188,7 +1190,20 @@ impl InferCtx {
                     | "math.f64.floor_v1"
                     | "math.f64.ceil_v1"
                     | "math.f64.fmt_shortest_v1"
-                    | "math.f64.to_bits_u64le_v1" => {
+                    | "math.f64.to_bits_u64le_v1"
+                    | "math.f64.arr.neg_v1"
+                    | "math.f64.arr.abs_v1"
+                    | "math.f64.arr.sqrt_v1"
+                    | "math.f64.arr.sin_v1"
+                    | "math.f64.arr.cos_v1"
+                    | "math.f64.arr.tan_v1"
+                    | "math.f64.arr.exp_v1"
+                    | "math.f64.arr.log_v1"
+                    | "math.f64.arr.floor_v1"
+                    | "math.f64.arr.ceil_v1"
+                    | "math.f64.arr.min_v1"
+                    | "math.f64.arr.max_v1"
+                    | "math.f64.arr.fmt_shortest_v1" => {
                         if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
@@ -1204,6 +1219,44 @@ impl InferCtx {
                         }
                         Ok(Ty::Bytes.into())
                     }
+                    "math.f64.arr.parse_v1" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "math.f64.arr.parse_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        for arg in args {
+                            let t = self.infer(arg)?;
+                            if t != Ty::Bytes && t != Ty::BytesView {
+                                return Err(CompilerError::new(
+                                    CompileErrorKind::Typing,
+                                    "math.f64.arr.parse_v1 expects (bytes_view, bytes_view)"
+                                        .to_string(),
+                                ));
+                            }
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "math.f64.arr.fma_v1" => {
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "math.f64.arr.fma_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        for arg in args {
+                            let t = self.infer(arg)?;
+                            if t != Ty::Bytes && t != Ty::BytesView {
+                                return Err(CompilerError::new(
+                                    CompileErrorKind::Typing,
+                                    "math.f64.arr.fma_v1 expects (bytes_view, bytes_view, bytes_view)"
+                                        .to_string(),
+                                ));
+                            }
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
                     "math.f64.parse_v1" => {
                         if args.len() != 1 {
                             return Err(CompilerError::new(
@@ -1808,6 +1861,40 @@ impl InferCtx {
                         }
                         Ok(Ty::I32.into())
                     }
+                    "view.find_u8" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "view.find_u8 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "view.find_u8 expects (bytes_view, i32)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "view.find_sub" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "view.find_sub expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::BytesView
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "view.find_sub expects (bytes_view, bytes_view)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
                     "fs.read" => {
                         if !self.options.enable_fs {
                             return Err(CompilerError::new(
@@ -2265,6 +2352,110 @@ impl InferCtx {
                         }
                         Ok(Ty::ResultBytes.into())
                     }
+                    "os.fs.view_open_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.fs.view_open_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.view_open_v1 expects (bytes path, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultI32.into())
+                    }
+                    "os.fs.view_bytes_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.fs.view_bytes_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.view_bytes_v1 expects i32 view_handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.fs.view_release_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.fs.view_release_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.view_release_v1 expects i32 view_handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "os.fs.walk_open_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.fs.walk_open_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                            || self.infer(&args[2])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.walk_open_v1 expects (bytes root, bytes glob, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultI32.into())
+                    }
+                    "os.fs.walk_next_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.fs.walk_next_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.walk_next_v1 expects (i32 walk_handle, i32 max_entries)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "os.fs.walk_drop_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.fs.walk_drop_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.fs.walk_drop_v1 expects i32 walk_handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
                     "os.archive.tar_extract_to_fs_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 5 {
@@ -2319,6 +2510,48 @@ impl InferCtx {
                         }
                         Ok(Ty::Bytes.into())
                     }
+                    "os.archive.tar_extract_reader_to_fs_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 5 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.archive.tar_extract_reader_to_fs_v1 expects 5 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Iface
+                            || self.infer(&args[2])? != Ty::Bytes
+                            || self.infer(&args[3])? != Ty::Bytes
+                            || self.infer(&args[4])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.tar_extract_reader_to_fs_v1 expects (bytes out_root, iface reader, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.archive.tgz_extract_reader_to_fs_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 5 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.archive.tgz_extract_reader_to_fs_v1 expects 5 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Iface
+                            || self.infer(&args[2])? != Ty::Bytes
+                            || self.infer(&args[3])? != Ty::Bytes
+                            || self.infer(&args[4])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.archive.tgz_extract_reader_to_fs_v1 expects (bytes out_root, iface reader, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
                     "os.stdio.read_line_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 1 {
@@ -2391,132 +2624,400 @@ impl InferCtx {
                         }
                         Ok(Ty::ResultI32.into())
                     }
-                    "os.rand.bytes_v1" => {
+                    "os.stdio.write_vec_stdout_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.rand.bytes_v1 expects 2 args".to_string(),
+                                "os.stdio.write_vec_stdout_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::Bytes {
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.rand.bytes_v1 expects (i32 n, bytes caps)".to_string(),
+                                "os.stdio.write_vec_stdout_v1 expects (bytes slices, bytes caps)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::ResultBytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.rand.u64_v1" => {
+                    "os.stdio.write_vec_stderr_v1" => {
                         self.require_standalone_only(head)?;
-                        if args.len() != 1 {
+                        if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.rand.u64_v1 expects 1 arg".to_string(),
+                                "os.stdio.write_vec_stderr_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes {
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.rand.u64_v1 expects (bytes caps)".to_string(),
+                                "os.stdio.write_vec_stderr_v1 expects (bytes slices, bytes caps)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::ResultBytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.db.sqlite.open_v1" => {
+                    "os.stdio.buf_set_stdout_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.db.sqlite.open_v1 expects 2 args".to_string(),
+                                "os.stdio.buf_set_stdout_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
-                        {
+                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::Bytes {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.open_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.stdio.buf_set_stdout_v1 expects (i32 watermark_bytes, bytes caps)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::Bytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.db.sqlite.query_v1" => {
+                    "os.stdio.buf_set_stderr_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.db.sqlite.query_v1 expects 2 args".to_string(),
+                                "os.stdio.buf_set_stderr_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
-                        {
+                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::Bytes {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.query_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.stdio.buf_set_stderr_v1 expects (i32 watermark_bytes, bytes caps)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::Bytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.db.sqlite.exec_v1" => {
+                    "os.stdio.buf_write_stdout_v1" => {
                         self.require_standalone_only(head)?;
-                        if args.len() != 2 {
+                        if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.db.sqlite.exec_v1 expects 2 args".to_string(),
+                                "os.stdio.buf_write_stdout_v1 expects 1 arg".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
-                        {
+                        if self.infer(&args[0])? != Ty::Bytes {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.exec_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.stdio.buf_write_stdout_v1 expects bytes data"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::Bytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.db.sqlite.close_v1" => {
+                    "os.stdio.buf_write_stderr_v1" => {
                         self.require_standalone_only(head)?;
-                        if args.len() != 2 {
+                        if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.db.sqlite.close_v1 expects 2 args".to_string(),
+                                "os.stdio.buf_write_stderr_v1 expects 1 arg".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
-                        {
+                        if self.infer(&args[0])? != Ty::Bytes {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.db.sqlite.close_v1 expects (bytes req, bytes caps)".to_string(),
+                                "os.stdio.buf_write_stderr_v1 expects bytes data"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::Bytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.db.pg.open_v1" => {
+                    "os.stdio.buf_flush_stdout_v1" => {
                         self.require_standalone_only(head)?;
-                        if args.len() != 2 {
+                        if !args.is_empty() {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.db.pg.open_v1 expects 2 args".to_string(),
+                                "os.stdio.buf_flush_stdout_v1 expects 0 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
-                        {
+                        Ok(Ty::ResultI32.into())
+                    }
+                    "os.stdio.buf_flush_stderr_v1" => {
+                        self.require_standalone_only(head)?;
+                        if !args.is_empty() {
                             return Err(CompilerError::new(
-                                CompileErrorKind::Typing,
-                                "os.db.pg.open_v1 expects (bytes req, bytes caps)".to_string(),
+                                CompileErrorKind::Parse,
+                                "os.stdio.buf_flush_stderr_v1 expects 0 args".to_string(),
                             ));
                         }
-                        Ok(Ty::Bytes.into())
+                        Ok(Ty::ResultI32.into())
                     }
-                    "os.db.pg.query_v1" => {
+                    "os.rand.bytes_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.db.pg.query_v1 expects 2 args".to_string(),
+                                "os.rand.bytes_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
+                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::Bytes {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.bytes_v1 expects (i32 n, bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "os.rand.u64_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.rand.u64_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.u64_v1 expects (bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "os.rand.pool_open_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.rand.pool_open_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::Bytes {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_open_v1 expects (i32 reseed_interval_bytes, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "os.rand.pool_bytes_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.rand.pool_bytes_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 || self.infer(&args[1])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_bytes_v1 expects (i32 pool_handle, i32 n)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "os.rand.pool_u64_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.rand.pool_u64_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_u64_v1 expects i32 pool_handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "os.rand.pool_close_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.rand.pool_close_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.rand.pool_close_v1 expects i32 pool_handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "os.db.sqlite.open_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.open_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.open_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.query_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.query_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.query_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.exec_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.exec_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.exec_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.close_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.close_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.close_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.prepare_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.prepare_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.prepare_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.stmt_query_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.stmt_query_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.stmt_query_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.stmt_exec_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.stmt_exec_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.stmt_exec_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.sqlite.finalize_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.sqlite.finalize_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.sqlite.finalize_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.open_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.open_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.open_v1 expects (bytes req, bytes caps)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.query_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.query_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes || self.infer(&args[1])? != Ty::Bytes
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
@@ -2559,6 +3060,139 @@ impl InferCtx {
                         }
                         Ok(Ty::Bytes.into())
                     }
+                    "os.db.pg.copy_begin_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.copy_begin_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.copy_begin_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.copy_write_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.copy_write_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.copy_write_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.copy_finish_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.copy_finish_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.copy_finish_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.prepare_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.prepare_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.prepare_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.stmt_query_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.stmt_query_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.stmt_query_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.stmt_exec_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.stmt_exec_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.stmt_exec_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.db.pg.finalize_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.pg.finalize_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.pg.finalize_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
                     "os.db.mysql.open_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 2 {
@@ -2678,6 +3312,25 @@ impl InferCtx {
                         }
                         Ok(Ty::Bytes.into())
                     }
+                    "os.db.redis.pipeline_v1" => {
+                        self.require_standalone_only(head)?;
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.db.redis.pipeline_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::Bytes
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.db.redis.pipeline_v1 expects (bytes req, bytes caps)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
                     "os.obj.s3.dispatch_v1" => {
                         self.require_standalone_only(head)?;
                         if args.len() != 2 {
@@ -2758,45 +3411,114 @@ impl InferCtx {
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "os.time.tzdb_is_valid_tzid_v1" => {
+                    "os.time.tzdb_is_valid_tzid_v1" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.time.tzdb_is_valid_tzid_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_is_valid_tzid_v1 expects bytes_view tzid".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "os.time.tzdb_offset_duration_v1" => {
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.time.tzdb_offset_duration_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::I32
+                            || self.infer(&args[2])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_offset_duration_v1 expects (bytes_view tzid, i32 unix_s_lo, i32 unix_s_hi)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.time.tzdb_snapshot_id_v1" => {
+                        if !args.is_empty() {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.time.tzdb_snapshot_id_v1 expects 0 args".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "os.time.tzdb_zone_open_v1" => {
                         if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.time.tzdb_is_valid_tzid_v1 expects 1 arg".to_string(),
+                                "os.time.tzdb_zone_open_v1 expects 1 arg".to_string(),
                             ));
                         }
                         if self.infer(&args[0])? != Ty::BytesView {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.time.tzdb_is_valid_tzid_v1 expects bytes_view tzid".to_string(),
+                                "os.time.tzdb_zone_open_v1 expects bytes_view tzid"
+                                    .to_string(),
                             ));
                         }
                         Ok(Ty::I32.into())
                     }
-                    "os.time.tzdb_offset_duration_v1" => {
+                    "os.time.tzdb_zone_offset_duration_v1" => {
                         if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.time.tzdb_offset_duration_v1 expects 3 args".to_string(),
+                                "os.time.tzdb_zone_offset_duration_v1 expects 3 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
+                        if self.infer(&args[0])? != Ty::I32
                             || self.infer(&args[1])? != Ty::I32
                             || self.infer(&args[2])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "os.time.tzdb_offset_duration_v1 expects (bytes_view tzid, i32 unix_s_lo, i32 unix_s_hi)"
+                                "os.time.tzdb_zone_offset_duration_v1 expects (i32 zone_handle, i32 unix_s_lo, i32 unix_s_hi)"
                                     .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "os.time.tzdb_snapshot_id_v1" => {
-                        if !args.is_empty() {
+                    "os.time.tzdb_zone_drop_v1" => {
+                        if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "os.time.tzdb_snapshot_id_v1 expects 0 args".to_string(),
+                                "os.time.tzdb_zone_drop_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_zone_drop_v1 expects i32 zone_handle"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "os.time.tzdb_zone_offsets_batch_v1" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "os.time.tzdb_zone_offsets_batch_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32
+                            || self.infer(&args[1])? != Ty::BytesView
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "os.time.tzdb_zone_offsets_batch_v1 expects (i32 zone_handle, bytes_view unix_s_packed)"
+                                    .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
@@ -4359,273 +5081,524 @@ impl InferCtx {
                         if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "chan.bytes.try_recv expects 1 arg".to_string(),
+                                "chan.bytes.try_recv expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "chan.bytes.try_recv expects i32 chan handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "chan.bytes.close" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "chan.bytes.close expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "chan.bytes.close expects i32 chan handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "codec.read_u32_le" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "codec.read_u32_le expects 2 args".to_string(),
+                            ));
+                        }
+                        let b = self.infer(&args[0])?;
+                        if (b != Ty::Bytes && b != Ty::BytesView)
+                            || self.infer(&args[1])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "codec.read_u32_le expects (bytes_view, i32)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "codec.write_u32_le" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "codec.write_u32_le expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "codec.write_u32_le expects i32".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "fmt.u32_to_dec" | "fmt.s32_to_dec" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                format!("{head} expects 1 arg"),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects i32"),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "parse.u32_dec" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "parse.u32_dec expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "parse.u32_dec expects bytes_view".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "parse.u32_dec_at" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "parse.u32_dec_at expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "parse.u32_dec_at expects (bytes_view, i32)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "prng.lcg_next_u32" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "prng.lcg_next_u32 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::I32 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "prng.lcg_next_u32 expects i32".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "regex.compile_opts_v1" => {
+                        if args.len() != 2 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "regex.compile_opts_v1 expects 2 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "regex.compile_opts_v1 expects (bytes_view, i32)".to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "regex.exec_from_v1" => {
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "regex.exec_from_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "regex.exec_from_v1 expects (bytes_view, bytes_view, i32)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "regex.exec_caps_from_v1" => {
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "regex.exec_caps_from_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "regex.exec_caps_from_v1 expects (bytes_view, bytes_view, i32)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::Bytes.into())
+                    }
+                    "regex.find_all_x7sl_v1" => {
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "regex.find_all_x7sl_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "regex.find_all_x7sl_v1 expects (bytes_view, bytes_view, i32)"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(TyInfo::branded(
+                            Ty::Bytes,
+                            "std.text.slices.x7sl_v1".to_string(),
+                        ))
+                    }
+                    "regex.split_v1" => {
+                        if args.len() != 3 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "regex.split_v1 expects 3 args".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "regex.split_v1 expects (bytes_view, bytes_view, i32)".to_string(),
+                            ));
+                        }
+                        Ok(TyInfo::branded(
+                            Ty::Bytes,
+                            "std.text.slices.x7sl_v1".to_string(),
+                        ))
+                    }
+                    "regex.replace_all_v1" => {
+                        if args.len() != 4 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "regex.replace_all_v1 expects 4 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::I32 {
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::BytesView
+                            || self.infer(&args[3])? != Ty::I32
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "chan.bytes.try_recv expects i32 chan handle".to_string(),
+                                "regex.replace_all_v1 expects (bytes_view, bytes_view, bytes_view, i32)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::ResultBytes.into())
+                        Ok(Ty::Bytes.into())
                     }
-                    "chan.bytes.close" => {
-                        if args.len() != 1 {
+                    "regex.handle_compile_v1" => {
+                        if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "chan.bytes.close expects 1 arg".to_string(),
+                                "regex.handle_compile_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::I32 {
+                        if self.infer(&args[0])? != Ty::BytesView
+                            || self.infer(&args[1])? != Ty::I32
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "chan.bytes.close expects i32 chan handle".to_string(),
+                                "regex.handle_compile_v1 expects (bytes_view pat, i32 opts)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::I32.into())
+                        Ok(Ty::Bytes.into())
                     }
-                    "codec.read_u32_le" => {
-                        if args.len() != 2 {
+                    "regex.handle_exec_v1" => {
+                        if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "codec.read_u32_le expects 2 args".to_string(),
+                                "regex.handle_exec_v1 expects 3 args".to_string(),
                             ));
                         }
-                        let b = self.infer(&args[0])?;
-                        if (b != Ty::Bytes && b != Ty::BytesView)
-                            || self.infer(&args[1])? != Ty::I32
+                        if self.infer(&args[0])? != Ty::I32
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "codec.read_u32_le expects (bytes_view, i32)".to_string(),
+                                "regex.handle_exec_v1 expects (i32 regex_handle, bytes_view text, i32 start)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::I32.into())
+                        Ok(Ty::Bytes.into())
                     }
-                    "codec.write_u32_le" => {
-                        if args.len() != 1 {
+                    "regex.handle_exec_caps_v1" => {
+                        if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "codec.write_u32_le expects 1 arg".to_string(),
+                                "regex.handle_exec_caps_v1 expects 3 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::I32 {
+                        if self.infer(&args[0])? != Ty::I32
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "codec.write_u32_le expects i32".to_string(),
+                                "regex.handle_exec_caps_v1 expects (i32 regex_handle, bytes_view text, i32 start)"
+                                    .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "fmt.u32_to_dec" | "fmt.s32_to_dec" => {
-                        if args.len() != 1 {
+                    "regex.handle_find_all_x7sl_v1" => {
+                        if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                format!("{head} expects 1 arg"),
+                                "regex.handle_find_all_x7sl_v1 expects 3 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::I32 {
+                        if self.infer(&args[0])? != Ty::I32
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                format!("{head} expects i32"),
+                                "regex.handle_find_all_x7sl_v1 expects (i32 regex_handle, bytes_view text, i32 max_matches)"
+                                    .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "parse.u32_dec" => {
-                        if args.len() != 1 {
+                    "regex.handle_split_v1" => {
+                        if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "parse.u32_dec expects 1 arg".to_string(),
+                                "regex.handle_split_v1 expects 3 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView {
+                        if self.infer(&args[0])? != Ty::I32
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
+                        {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "parse.u32_dec expects bytes_view".to_string(),
+                                "regex.handle_split_v1 expects (i32 regex_handle, bytes_view text, i32 max_parts)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::I32.into())
+                        Ok(Ty::Bytes.into())
                     }
-                    "parse.u32_dec_at" => {
-                        if args.len() != 2 {
+                    "regex.handle_replace_all_v1" => {
+                        if args.len() != 4 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "parse.u32_dec_at expects 2 args".to_string(),
+                                "regex.handle_replace_all_v1 expects 4 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
-                            || self.infer(&args[1])? != Ty::I32
+                        if self.infer(&args[0])? != Ty::I32
+                            || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::BytesView
+                            || self.infer(&args[3])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "parse.u32_dec_at expects (bytes_view, i32)".to_string(),
+                                "regex.handle_replace_all_v1 expects (i32 regex_handle, bytes_view text, bytes_view repl, i32 cap_limit)"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::I32.into())
+                        Ok(Ty::Bytes.into())
                     }
-                    "prng.lcg_next_u32" => {
+                    "regex.handle_drop_v1" => {
                         if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "prng.lcg_next_u32 expects 1 arg".to_string(),
+                                "regex.handle_drop_v1 expects 1 arg".to_string(),
                             ));
                         }
                         if self.infer(&args[0])? != Ty::I32 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "prng.lcg_next_u32 expects i32".to_string(),
+                                "regex.handle_drop_v1 expects i32 regex_handle".to_string(),
                             ));
                         }
                         Ok(Ty::I32.into())
                     }
-                    "regex.compile_opts_v1" => {
-                        if args.len() != 2 {
+                    "regex.set_compile_v1" => {
+                        if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "regex.compile_opts_v1 expects 2 args".to_string(),
+                                "regex.set_compile_v1 expects 3 args".to_string(),
                             ));
                         }
                         if self.infer(&args[0])? != Ty::BytesView
                             || self.infer(&args[1])? != Ty::I32
+                            || self.infer(&args[2])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "regex.compile_opts_v1 expects (bytes_view, i32)".to_string(),
+                                "regex.set_compile_v1 expects (bytes_view pats, i32 count, i32 opts)"
+                                    .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "regex.exec_from_v1" => {
+                    "regex.set_scan_x7sl_v1" => {
                         if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "regex.exec_from_v1 expects 3 args".to_string(),
+                                "regex.set_scan_x7sl_v1 expects 3 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
+                        if self.infer(&args[0])? != Ty::I32
                             || self.infer(&args[1])? != Ty::BytesView
                             || self.infer(&args[2])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "regex.exec_from_v1 expects (bytes_view, bytes_view, i32)"
+                                "regex.set_scan_x7sl_v1 expects (i32 set_handle, bytes_view text, i32 max_matches)"
                                     .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "regex.exec_caps_from_v1" => {
-                        if args.len() != 3 {
+                    "regex.set_drop_v1" => {
+                        if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "regex.exec_caps_from_v1 expects 3 args".to_string(),
+                                "regex.set_drop_v1 expects 1 arg".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
-                            || self.infer(&args[1])? != Ty::BytesView
-                            || self.infer(&args[2])? != Ty::I32
-                        {
+                        if self.infer(&args[0])? != Ty::I32 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "regex.exec_caps_from_v1 expects (bytes_view, bytes_view, i32)"
-                                    .to_string(),
+                                "regex.set_drop_v1 expects i32 set_handle".to_string(),
+                            ));
+                        }
+                        Ok(Ty::I32.into())
+                    }
+                    "jsonschema.compile_v1" => {
+                        if args.len() != 1 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "jsonschema.compile_v1 expects 1 arg".to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::BytesView {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "jsonschema.compile_v1 expects bytes_view".to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "regex.find_all_x7sl_v1" => {
-                        if args.len() != 3 {
+                    "jsonschema.validate_v1" => {
+                        if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "regex.find_all_x7sl_v1 expects 3 args".to_string(),
+                                "jsonschema.validate_v1 expects 2 args".to_string(),
                             ));
                         }
                         if self.infer(&args[0])? != Ty::BytesView
                             || self.infer(&args[1])? != Ty::BytesView
-                            || self.infer(&args[2])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "regex.find_all_x7sl_v1 expects (bytes_view, bytes_view, i32)"
-                                    .to_string(),
+                                "jsonschema.validate_v1 expects (bytes_view, bytes_view)".to_string(),
                             ));
                         }
-                        Ok(TyInfo::branded(
-                            Ty::Bytes,
-                            "std.text.slices.x7sl_v1".to_string(),
-                        ))
+                        Ok(Ty::Bytes.into())
                     }
-                    "regex.split_v1" => {
-                        if args.len() != 3 {
+                    "jsonschema.handle_compile_v1" => {
+                        if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "regex.split_v1 expects 3 args".to_string(),
+                                "jsonschema.handle_compile_v1 expects 1 arg".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
-                            || self.infer(&args[1])? != Ty::BytesView
-                            || self.infer(&args[2])? != Ty::I32
-                        {
+                        if self.infer(&args[0])? != Ty::BytesView {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "regex.split_v1 expects (bytes_view, bytes_view, i32)".to_string(),
+                                "jsonschema.handle_compile_v1 expects bytes_view schema_json"
+                                    .to_string(),
                             ));
                         }
-                        Ok(TyInfo::branded(
-                            Ty::Bytes,
-                            "std.text.slices.x7sl_v1".to_string(),
-                        ))
+                        Ok(Ty::Bytes.into())
                     }
-                    "regex.replace_all_v1" => {
-                        if args.len() != 4 {
+                    "jsonschema.handle_validate_v1" => {
+                        if args.len() != 2 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "regex.replace_all_v1 expects 4 args".to_string(),
+                                "jsonschema.handle_validate_v1 expects 2 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
+                        if self.infer(&args[0])? != Ty::I32
                             || self.infer(&args[1])? != Ty::BytesView
-                            || self.infer(&args[2])? != Ty::BytesView
-                            || self.infer(&args[3])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "regex.replace_all_v1 expects (bytes_view, bytes_view, bytes_view, i32)"
+                                "jsonschema.handle_validate_v1 expects (i32 schema_handle, bytes_view instance_json)"
                                     .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
                     }
-                    "jsonschema.compile_v1" => {
+                    "jsonschema.handle_drop_v1" => {
                         if args.len() != 1 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "jsonschema.compile_v1 expects 1 arg".to_string(),
+                                "jsonschema.handle_drop_v1 expects 1 arg".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView {
+                        if self.infer(&args[0])? != Ty::I32 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "jsonschema.compile_v1 expects bytes_view".to_string(),
+                                "jsonschema.handle_drop_v1 expects i32 schema_handle"
+                                    .to_string(),
                             ));
                         }
-                        Ok(Ty::Bytes.into())
+                        Ok(Ty::I32.into())
                     }
-                    "jsonschema.validate_v1" => {
-                        if args.len() != 2 {
+                    "jsonschema.validate_batch_v1" => {
+                        if args.len() != 3 {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Parse,
-                                "jsonschema.validate_v1 expects 2 args".to_string(),
+                                "jsonschema.validate_batch_v1 expects 3 args".to_string(),
                             ));
                         }
-                        if self.infer(&args[0])? != Ty::BytesView
+                        if self.infer(&args[0])? != Ty::I32
                             || self.infer(&args[1])? != Ty::BytesView
+                            || self.infer(&args[2])? != Ty::I32
                         {
                             return Err(CompilerError::new(
                                 CompileErrorKind::Typing,
-                                "jsonschema.validate_v1 expects (bytes_view, bytes_view)".to_string(),
+                                "jsonschema.validate_batch_v1 expects (i32 schema_handle, bytes_view instances, i32 count)"
+                                    .to_string(),
                             ));
                         }
                         Ok(Ty::Bytes.into())
@@ -5740,6 +6713,112 @@ impl InferCtx {
                         }
                         Ok(Ty::ResultBytes.into())
                     }
+                    "__internal.stream_xf.plugin_step_batch_v1" => {
+                        if args.len() != 9 {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                "__internal.stream_xf.plugin_step_batch_v1 expects 9 args"
+                                    .to_string(),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::I32
+                            || self.infer(&args[2])? != Ty::Bytes
+                            || self.infer(&args[3])? != Ty::Bytes
+                            || self.infer(&args[4])? != Ty::Bytes
+                            || self.infer(&args[5])? != Ty::I32
+                            || self.infer(&args[6])? != Ty::I32
+                            || self.infer(&args[7])? != Ty::I32
+                            || self.infer(&args[8])? != Ty::BytesView
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                "__internal.stream_xf.plugin_step_batch_v1 arg types mismatch"
+                                    .to_string(),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "__internal.stream_xf.plugin_chain_step_v1"
+                    | "__internal.stream_xf.plugin_chain_flush_v1" => {
+                        let is_step = head == "__internal.stream_xf.plugin_chain_step_v1";
+                        let stage_args = if is_step {
+                            args.len().checked_sub(1)
+                        } else {
+                            Some(args.len())
+                        };
+                        let n_stages = match stage_args {
+                            Some(sa) if sa >= 8 && sa % 8 == 0 => sa / 8,
+                            _ => {
+                                return Err(CompilerError::new(
+                                    CompileErrorKind::Parse,
+                                    format!(
+                                        "{head} expects 8 args per stage (plus the input for step)"
+                                    ),
+                                ));
+                            }
+                        };
+                        for s in 0..n_stages {
+                            let base = s * 8;
+                            if self.infer(&args[base])? != Ty::Bytes
+                                || self.infer(&args[base + 1])? != Ty::I32
+                                || self.infer(&args[base + 2])? != Ty::Bytes
+                                || self.infer(&args[base + 3])? != Ty::Bytes
+                                || self.infer(&args[base + 4])? != Ty::Bytes
+                                || self.infer(&args[base + 5])? != Ty::I32
+                                || self.infer(&args[base + 6])? != Ty::I32
+                                || self.infer(&args[base + 7])? != Ty::I32
+                            {
+                                return Err(CompilerError::new(
+                                    CompileErrorKind::Typing,
+                                    format!("{head} arg types mismatch"),
+                                ));
+                            }
+                        }
+                        if is_step && self.infer(&args[args.len() - 1])? != Ty::BytesView {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects bytes_view input"),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
+                    "__internal.stream_xf.plugin_shard_step_v1"
+                    | "__internal.stream_xf.plugin_shard_flush_v1" => {
+                        let is_step = head == "__internal.stream_xf.plugin_shard_step_v1";
+                        let expected_args = if is_step { 11 } else { 9 };
+                        if args.len() != expected_args {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Parse,
+                                format!("{head} expects {expected_args} args"),
+                            ));
+                        }
+                        if self.infer(&args[0])? != Ty::Bytes
+                            || self.infer(&args[1])? != Ty::I32
+                            || self.infer(&args[2])? != Ty::Bytes
+                            || self.infer(&args[3])? != Ty::Bytes
+                            || self.infer(&args[4])? != Ty::Bytes
+                            || self.infer(&args[5])? != Ty::I32
+                            || self.infer(&args[6])? != Ty::I32
+                            || self.infer(&args[7])? != Ty::I32
+                            || self.infer(&args[8])? != Ty::I32
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} arg types mismatch"),
+                            ));
+                        }
+                        if is_step
+                            && (self.infer(&args[9])? != Ty::BytesView
+                                || self.infer(&args[10])? != Ty::BytesView)
+                        {
+                            return Err(CompilerError::new(
+                                CompileErrorKind::Typing,
+                                format!("{head} expects bytes_view batch and keys"),
+                            ));
+                        }
+                        Ok(Ty::ResultBytes.into())
+                    }
                     "__internal.stream_xf.plugin_flush_v1" => {
                         if args.len() != 8 {
                             return Err(CompilerError::new(
@@ -1751,6 +1751,243 @@ impl<'a> Emitter<'a> {
         Ok(())
     }
 
+    pub(super) fn emit_os_fs_view_open_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.fs.view_open_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_FS,
+            native::ABI_MAJOR_V1,
+            "os.fs.view_open_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.fs.view_open_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.view_open_v1 returns result_i32".to_string(),
+            ));
+        }
+        let path = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if path.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.view_open_v1 expects (bytes path, bytes caps)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_fs_view_open_v1({}, {});",
+            path.c_name, caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_fs_view_bytes_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.fs.view_bytes_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_FS,
+            native::ABI_MAJOR_V1,
+            "os.fs.view_bytes_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.fs.view_bytes_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.view_bytes_v1 returns bytes".to_string(),
+            ));
+        }
+        let view_handle = self.emit_expr(&args[0])?;
+        if view_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.view_bytes_v1 expects i32 view_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_fs_view_bytes_v1((int32_t){});",
+            view_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_fs_view_release_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.fs.view_release_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_FS,
+            native::ABI_MAJOR_V1,
+            "os.fs.view_release_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.fs.view_release_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.view_release_v1 returns i32".to_string(),
+            ));
+        }
+        let view_handle = self.emit_expr(&args[0])?;
+        if view_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.view_release_v1 expects i32 view_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_fs_view_release_v1((int32_t){});",
+            view_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_fs_walk_open_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.fs.walk_open_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_FS,
+            native::ABI_MAJOR_V1,
+            "os.fs.walk_open_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.fs.walk_open_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.walk_open_v1 returns result_i32".to_string(),
+            ));
+        }
+        let root = self.emit_expr(&args[0])?;
+        let glob = self.emit_expr(&args[1])?;
+        let caps = self.emit_expr(&args[2])?;
+        if root.ty != Ty::Bytes
+            || glob.ty != Ty::Bytes
+            || caps.ty != Ty::Bytes
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.walk_open_v1 expects (bytes root, bytes glob, bytes caps)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_fs_walk_open_v1({}, {}, {});",
+            root.c_name, glob.c_name, caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_fs_walk_next_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.fs.walk_next_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_FS,
+            native::ABI_MAJOR_V1,
+            "os.fs.walk_next_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.fs.walk_next_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.walk_next_v1 returns result_bytes".to_string(),
+            ));
+        }
+        let walk_handle = self.emit_expr(&args[0])?;
+        let max_entries = self.emit_expr(&args[1])?;
+        if walk_handle.ty != Ty::I32 || max_entries.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.walk_next_v1 expects (i32 walk_handle, i32 max_entries)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_fs_walk_next_v1((int32_t){}, (int32_t){});",
+            walk_handle.c_name, max_entries.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_fs_walk_drop_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.fs.walk_drop_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_FS,
+            native::ABI_MAJOR_V1,
+            "os.fs.walk_drop_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.fs.walk_drop_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.walk_drop_v1 returns i32".to_string(),
+            ));
+        }
+        let walk_handle = self.emit_expr(&args[0])?;
+        if walk_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.fs.walk_drop_v1 expects i32 walk_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_fs_walk_drop_v1((int32_t){});",
+            walk_handle.c_name
+        ));
+        Ok(())
+    }
+
     pub(super) fn emit_os_archive_tar_extract_to_fs_v1_to(
         &mut self,
         args: &[Expr],
@@ -1839,240 +2076,634 @@ impl<'a> Emitter<'a> {
         {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.archive.tgz_extract_to_fs_v1 expects (bytes out_root, bytes tgz_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                "os.archive.tgz_extract_to_fs_v1 expects (bytes out_root, bytes tgz_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_archive_tgz_extract_to_fs_v1({}, {}, {}, {}, {});",
+            out_root.c_name,
+            tgz_path.c_name,
+            caps_read.c_name,
+            caps_write.c_name,
+            profile_id.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_archive_zip_extract_to_fs_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.archive.zip_extract_to_fs_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_ARCHIVE,
+            native::ABI_MAJOR_V1,
+            "os.archive.zip_extract_to_fs_v1",
+        )?;
+        if args.len() != 5 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.archive.zip_extract_to_fs_v1 expects 5 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.archive.zip_extract_to_fs_v1 returns bytes".to_string(),
+            ));
+        }
+        let out_root = self.emit_expr(&args[0])?;
+        let zip_path = self.emit_expr(&args[1])?;
+        let caps_read = self.emit_expr(&args[2])?;
+        let caps_write = self.emit_expr(&args[3])?;
+        let profile_id = self.emit_expr(&args[4])?;
+        if out_root.ty != Ty::Bytes
+            || zip_path.ty != Ty::Bytes
+            || caps_read.ty != Ty::Bytes
+            || caps_write.ty != Ty::Bytes
+            || profile_id.ty != Ty::Bytes
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.archive.zip_extract_to_fs_v1 expects (bytes out_root, bytes zip_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_archive_zip_extract_to_fs_v1({}, {}, {}, {}, {});",
+            out_root.c_name,
+            zip_path.c_name,
+            caps_read.c_name,
+            caps_write.c_name,
+            profile_id.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_archive_tar_extract_reader_to_fs_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.archive.tar_extract_reader_to_fs_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_ARCHIVE,
+            native::ABI_MAJOR_V1,
+            "os.archive.tar_extract_reader_to_fs_v1",
+        )?;
+        if args.len() != 5 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.archive.tar_extract_reader_to_fs_v1 expects 5 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.archive.tar_extract_reader_to_fs_v1 returns bytes".to_string(),
+            ));
+        }
+        let out_root = self.emit_expr(&args[0])?;
+        let reader = self.emit_expr(&args[1])?;
+        let caps_read = self.emit_expr(&args[2])?;
+        let caps_write = self.emit_expr(&args[3])?;
+        let profile_id = self.emit_expr(&args[4])?;
+        if out_root.ty != Ty::Bytes
+            || reader.ty != Ty::Iface
+            || caps_read.ty != Ty::Bytes
+            || caps_write.ty != Ty::Bytes
+            || profile_id.ty != Ty::Bytes
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.archive.tar_extract_reader_to_fs_v1 expects (bytes out_root, iface reader, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = rt_os_archive_tar_extract_reader(ctx, {}, {}, {}, {}, {});",
+            out_root.c_name,
+            reader.c_name,
+            caps_read.c_name,
+            caps_write.c_name,
+            profile_id.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_archive_tgz_extract_reader_to_fs_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.archive.tgz_extract_reader_to_fs_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_ARCHIVE,
+            native::ABI_MAJOR_V1,
+            "os.archive.tgz_extract_reader_to_fs_v1",
+        )?;
+        if args.len() != 5 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.archive.tgz_extract_reader_to_fs_v1 expects 5 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.archive.tgz_extract_reader_to_fs_v1 returns bytes".to_string(),
+            ));
+        }
+        let out_root = self.emit_expr(&args[0])?;
+        let reader = self.emit_expr(&args[1])?;
+        let caps_read = self.emit_expr(&args[2])?;
+        let caps_write = self.emit_expr(&args[3])?;
+        let profile_id = self.emit_expr(&args[4])?;
+        if out_root.ty != Ty::Bytes
+            || reader.ty != Ty::Iface
+            || caps_read.ty != Ty::Bytes
+            || caps_write.ty != Ty::Bytes
+            || profile_id.ty != Ty::Bytes
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.archive.tgz_extract_reader_to_fs_v1 expects (bytes out_root, iface reader, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = rt_os_archive_tgz_extract_reader(ctx, {}, {}, {}, {}, {});",
+            out_root.c_name,
+            reader.c_name,
+            caps_read.c_name,
+            caps_write.c_name,
+            profile_id.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_read_line_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.read_line_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.read_line_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.read_line_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.read_line_v1 returns result_bytes".to_string(),
+            ));
+        }
+        let caps = self.emit_expr(&args[0])?;
+        if caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.read_line_v1 expects (bytes caps)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_stdio_read_line_v1({});",
+            caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_write_stdout_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.write_stdout_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.write_stdout_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.write_stdout_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_stdout_v1 returns result_i32".to_string(),
+            ));
+        }
+        let data = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if data.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_stdout_v1 expects (bytes data, bytes caps)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_stdio_write_stdout_v1({}, {});",
+            data.c_name, caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_write_stderr_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.write_stderr_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.write_stderr_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.write_stderr_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_stderr_v1 returns result_i32".to_string(),
+            ));
+        }
+        let data = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if data.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_stderr_v1 expects (bytes data, bytes caps)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_stdio_write_stderr_v1({}, {});",
+            data.c_name, caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_flush_stdout_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.flush_stdout_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.flush_stdout_v1",
+        )?;
+        if !args.is_empty() {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.flush_stdout_v1 expects 0 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.flush_stdout_v1 returns result_i32".to_string(),
+            ));
+        }
+        self.line(&format!("{dest} = x07_ext_stdio_flush_stdout_v1();"));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_flush_stderr_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.flush_stderr_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.flush_stderr_v1",
+        )?;
+        if !args.is_empty() {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.flush_stderr_v1 expects 0 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.flush_stderr_v1 returns result_i32".to_string(),
+            ));
+        }
+        self.line(&format!("{dest} = x07_ext_stdio_flush_stderr_v1();"));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_write_vec_stdout_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.write_vec_stdout_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.write_vec_stdout_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.write_vec_stdout_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_vec_stdout_v1 returns result_i32".to_string(),
+            ));
+        }
+        let slices = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if slices.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_vec_stdout_v1 expects (bytes slices, bytes caps)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_stdio_write_vec_stdout_v1({}, {});",
+            slices.c_name, caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_stdio_write_vec_stderr_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.stdio.write_vec_stderr_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_STDIO,
+            native::ABI_MAJOR_V1,
+            "os.stdio.write_vec_stderr_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.stdio.write_vec_stderr_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultI32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_vec_stderr_v1 returns result_i32".to_string(),
+            ));
+        }
+        let slices = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if slices.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.stdio.write_vec_stderr_v1 expects (bytes slices, bytes caps)"
+                    .to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_archive_tgz_extract_to_fs_v1({}, {}, {}, {}, {});",
-            out_root.c_name,
-            tgz_path.c_name,
-            caps_read.c_name,
-            caps_write.c_name,
-            profile_id.c_name
+            "{dest} = x07_ext_stdio_write_vec_stderr_v1({}, {});",
+            slices.c_name, caps.c_name
         ));
         Ok(())
     }
 
-    pub(super) fn emit_os_archive_zip_extract_to_fs_v1_to(
+    pub(super) fn emit_os_stdio_buf_set_stdout_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_standalone_only("os.archive.zip_extract_to_fs_v1")?;
+        self.require_standalone_only("os.stdio.buf_set_stdout_v1")?;
         self.require_native_backend(
-            native::BACKEND_ID_EXT_ARCHIVE,
+            native::BACKEND_ID_EXT_STDIO,
             native::ABI_MAJOR_V1,
-            "os.archive.zip_extract_to_fs_v1",
+            "os.stdio.buf_set_stdout_v1",
         )?;
-        if args.len() != 5 {
+        if args.len() != 2 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "os.archive.zip_extract_to_fs_v1 expects 5 args".to_string(),
+                "os.stdio.buf_set_stdout_v1 expects 2 args".to_string(),
             ));
         }
-        if dest_ty != Ty::Bytes {
+        if dest_ty != Ty::ResultI32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.archive.zip_extract_to_fs_v1 returns bytes".to_string(),
+                "os.stdio.buf_set_stdout_v1 returns result_i32".to_string(),
             ));
         }
-        let out_root = self.emit_expr(&args[0])?;
-        let zip_path = self.emit_expr(&args[1])?;
-        let caps_read = self.emit_expr(&args[2])?;
-        let caps_write = self.emit_expr(&args[3])?;
-        let profile_id = self.emit_expr(&args[4])?;
-        if out_root.ty != Ty::Bytes
-            || zip_path.ty != Ty::Bytes
-            || caps_read.ty != Ty::Bytes
-            || caps_write.ty != Ty::Bytes
-            || profile_id.ty != Ty::Bytes
-        {
+        let watermark_bytes = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if watermark_bytes.ty != Ty::I32 || caps.ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.archive.zip_extract_to_fs_v1 expects (bytes out_root, bytes zip_path, bytes caps_read, bytes caps_write, bytes profile_id)".to_string(),
+                "os.stdio.buf_set_stdout_v1 expects (i32 watermark_bytes, bytes caps)"
+                    .to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_archive_zip_extract_to_fs_v1({}, {}, {}, {}, {});",
-            out_root.c_name,
-            zip_path.c_name,
-            caps_read.c_name,
-            caps_write.c_name,
-            profile_id.c_name
+            "{dest} = x07_ext_stdio_buf_set_stdout_v1((int32_t){}, {});",
+            watermark_bytes.c_name, caps.c_name
         ));
         Ok(())
     }
 
-    pub(super) fn emit_os_stdio_read_line_v1_to(
+    pub(super) fn emit_os_stdio_buf_set_stderr_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_standalone_only("os.stdio.read_line_v1")?;
+        self.require_standalone_only("os.stdio.buf_set_stderr_v1")?;
         self.require_native_backend(
             native::BACKEND_ID_EXT_STDIO,
             native::ABI_MAJOR_V1,
-            "os.stdio.read_line_v1",
+            "os.stdio.buf_set_stderr_v1",
         )?;
-        if args.len() != 1 {
+        if args.len() != 2 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "os.stdio.read_line_v1 expects 1 arg".to_string(),
+                "os.stdio.buf_set_stderr_v1 expects 2 args".to_string(),
             ));
         }
-        if dest_ty != Ty::ResultBytes {
+        if dest_ty != Ty::ResultI32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.read_line_v1 returns result_bytes".to_string(),
+                "os.stdio.buf_set_stderr_v1 returns result_i32".to_string(),
             ));
         }
-        let caps = self.emit_expr(&args[0])?;
-        if caps.ty != Ty::Bytes {
+        let watermark_bytes = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if watermark_bytes.ty != Ty::I32 || caps.ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.read_line_v1 expects (bytes caps)".to_string(),
+                "os.stdio.buf_set_stderr_v1 expects (i32 watermark_bytes, bytes caps)"
+                    .to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_stdio_read_line_v1({});",
-            caps.c_name
+            "{dest} = x07_ext_stdio_buf_set_stderr_v1((int32_t){}, {});",
+            watermark_bytes.c_name, caps.c_name
         ));
         Ok(())
     }
 
-    pub(super) fn emit_os_stdio_write_stdout_v1_to(
+    pub(super) fn emit_os_stdio_buf_write_stdout_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_standalone_only("os.stdio.write_stdout_v1")?;
+        self.require_standalone_only("os.stdio.buf_write_stdout_v1")?;
         self.require_native_backend(
             native::BACKEND_ID_EXT_STDIO,
             native::ABI_MAJOR_V1,
-            "os.stdio.write_stdout_v1",
+            "os.stdio.buf_write_stdout_v1",
         )?;
-        if args.len() != 2 {
+        if args.len() != 1 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "os.stdio.write_stdout_v1 expects 2 args".to_string(),
+                "os.stdio.buf_write_stdout_v1 expects 1 arg".to_string(),
             ));
         }
         if dest_ty != Ty::ResultI32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.write_stdout_v1 returns result_i32".to_string(),
+                "os.stdio.buf_write_stdout_v1 returns result_i32".to_string(),
             ));
         }
         let data = self.emit_expr(&args[0])?;
-        let caps = self.emit_expr(&args[1])?;
-        if data.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+        if data.ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.write_stdout_v1 expects (bytes data, bytes caps)".to_string(),
+                "os.stdio.buf_write_stdout_v1 expects bytes data".to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_stdio_write_stdout_v1({}, {});",
-            data.c_name, caps.c_name
+            "{dest} = x07_ext_stdio_buf_write_stdout_v1({});",
+            data.c_name
         ));
         Ok(())
     }
 
-    pub(super) fn emit_os_stdio_write_stderr_v1_to(
+    pub(super) fn emit_os_stdio_buf_write_stderr_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_standalone_only("os.stdio.write_stderr_v1")?;
+        self.require_standalone_only("os.stdio.buf_write_stderr_v1")?;
         self.require_native_backend(
             native::BACKEND_ID_EXT_STDIO,
             native::ABI_MAJOR_V1,
-            "os.stdio.write_stderr_v1",
+            "os.stdio.buf_write_stderr_v1",
         )?;
-        if args.len() != 2 {
+        if args.len() != 1 {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "os.stdio.write_stderr_v1 expects 2 args".to_string(),
+                "os.stdio.buf_write_stderr_v1 expects 1 arg".to_string(),
             ));
         }
         if dest_ty != Ty::ResultI32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.write_stderr_v1 returns result_i32".to_string(),
+                "os.stdio.buf_write_stderr_v1 returns result_i32".to_string(),
             ));
         }
         let data = self.emit_expr(&args[0])?;
-        let caps = self.emit_expr(&args[1])?;
-        if data.ty != Ty::Bytes || caps.ty != Ty::Bytes {
+        if data.ty != Ty::Bytes {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.write_stderr_v1 expects (bytes data, bytes caps)".to_string(),
+                "os.stdio.buf_write_stderr_v1 expects bytes data".to_string(),
             ));
         }
         self.line(&format!(
-            "{dest} = x07_ext_stdio_write_stderr_v1({}, {});",
-            data.c_name, caps.c_name
+            "{dest} = x07_ext_stdio_buf_write_stderr_v1({});",
+            data.c_name
         ));
         Ok(())
     }
 
-    pub(super) fn emit_os_stdio_flush_stdout_v1_to(
+    pub(super) fn emit_os_stdio_buf_flush_stdout_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_standalone_only("os.stdio.flush_stdout_v1")?;
+        self.require_standalone_only("os.stdio.buf_flush_stdout_v1")?;
         self.require_native_backend(
             native::BACKEND_ID_EXT_STDIO,
             native::ABI_MAJOR_V1,
-            "os.stdio.flush_stdout_v1",
+            "os.stdio.buf_flush_stdout_v1",
         )?;
         if !args.is_empty() {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "os.stdio.flush_stdout_v1 expects 0 args".to_string(),
+                "os.stdio.buf_flush_stdout_v1 expects 0 args".to_string(),
             ));
         }
         if dest_ty != Ty::ResultI32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.flush_stdout_v1 returns result_i32".to_string(),
+                "os.stdio.buf_flush_stdout_v1 returns result_i32".to_string(),
             ));
         }
-        self.line(&format!("{dest} = x07_ext_stdio_flush_stdout_v1();"));
+        self.line(&format!("{dest} = x07_ext_stdio_buf_flush_stdout_v1();"));
         Ok(())
     }
 
-    pub(super) fn emit_os_stdio_flush_stderr_v1_to(
+    pub(super) fn emit_os_stdio_buf_flush_stderr_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
-        self.require_standalone_only("os.stdio.flush_stderr_v1")?;
+        self.require_standalone_only("os.stdio.buf_flush_stderr_v1")?;
         self.require_native_backend(
             native::BACKEND_ID_EXT_STDIO,
             native::ABI_MAJOR_V1,
-            "os.stdio.flush_stderr_v1",
+            "os.stdio.buf_flush_stderr_v1",
         )?;
         if !args.is_empty() {
             return Err(CompilerError::new(
                 CompileErrorKind::Parse,
-                "os.stdio.flush_stderr_v1 expects 0 args".to_string(),
+                "os.stdio.buf_flush_stderr_v1 expects 0 args".to_string(),
             ));
         }
         if dest_ty != Ty::ResultI32 {
             return Err(CompilerError::new(
                 CompileErrorKind::Typing,
-                "os.stdio.flush_stderr_v1 returns result_i32".to_string(),
+                "os.stdio.buf_flush_stderr_v1 returns result_i32".to_string(),
             ));
         }
-        self.line(&format!("{dest} = x07_ext_stdio_flush_stderr_v1();"));
+        self.line(&format!("{dest} = x07_ext_stdio_buf_flush_stderr_v1();"));
         Ok(())
     }
 
@@ -2150,6 +2781,161 @@ impl<'a> Emitter<'a> {
         Ok(())
     }
 
+    pub(super) fn emit_os_rand_pool_open_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.rand.pool_open_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_RAND,
+            native::ABI_MAJOR_V1,
+            "os.rand.pool_open_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.rand.pool_open_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_open_v1 returns result_bytes".to_string(),
+            ));
+        }
+        let reseed_interval_bytes = self.emit_expr(&args[0])?;
+        let caps = self.emit_expr(&args[1])?;
+        if reseed_interval_bytes.ty != Ty::I32 || caps.ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_open_v1 expects (i32 reseed_interval_bytes, bytes caps)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_rand_pool_open_v1((int32_t){}, {});",
+            reseed_interval_bytes.c_name, caps.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_rand_pool_bytes_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.rand.pool_bytes_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_RAND,
+            native::ABI_MAJOR_V1,
+            "os.rand.pool_bytes_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.rand.pool_bytes_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_bytes_v1 returns result_bytes".to_string(),
+            ));
+        }
+        let pool_handle = self.emit_expr(&args[0])?;
+        let n = self.emit_expr(&args[1])?;
+        if pool_handle.ty != Ty::I32 || n.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_bytes_v1 expects (i32 pool_handle, i32 n)".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_rand_pool_bytes_v1((int32_t){}, (int32_t){});",
+            pool_handle.c_name, n.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_rand_pool_u64_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.rand.pool_u64_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_RAND,
+            native::ABI_MAJOR_V1,
+            "os.rand.pool_u64_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.rand.pool_u64_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::ResultBytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_u64_v1 returns result_bytes".to_string(),
+            ));
+        }
+        let pool_handle = self.emit_expr(&args[0])?;
+        if pool_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_u64_v1 expects i32 pool_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_rand_pool_u64_v1((int32_t){});",
+            pool_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_rand_pool_close_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_standalone_only("os.rand.pool_close_v1")?;
+        self.require_native_backend(
+            native::BACKEND_ID_EXT_RAND,
+            native::ABI_MAJOR_V1,
+            "os.rand.pool_close_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.rand.pool_close_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_close_v1 returns i32".to_string(),
+            ));
+        }
+        let pool_handle = self.emit_expr(&args[0])?;
+        if pool_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.rand.pool_close_v1 expects i32 pool_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = x07_ext_rand_pool_close_v1((int32_t){});",
+            pool_handle.c_name
+        ));
+        Ok(())
+    }
+
     pub(super) fn emit_os_db_call_bytes_v1_to(
         &mut self,
         builtin: &str,
@@ -2202,60 +2988,120 @@ impl<'a> Emitter<'a> {
         Ok(())
     }
 
-    pub(super) fn emit_os_db_sqlite_open_v1_to(
+    pub(super) fn emit_os_db_sqlite_open_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.sqlite.open_v1",
+            "x07_ext_db_sqlite_open_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_sqlite_query_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.sqlite.query_v1",
+            "x07_ext_db_sqlite_query_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_sqlite_exec_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.sqlite.exec_v1",
+            "x07_ext_db_sqlite_exec_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_sqlite_close_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
         self.emit_os_db_call_bytes_v1_to(
-            "os.db.sqlite.open_v1",
-            "x07_ext_db_sqlite_open_v1",
+            "os.db.sqlite.close_v1",
+            "x07_ext_db_sqlite_close_v1",
             args,
             dest_ty,
             dest,
         )
     }
 
-    pub(super) fn emit_os_db_sqlite_query_v1_to(
+    pub(super) fn emit_os_db_sqlite_prepare_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
         self.emit_os_db_call_bytes_v1_to(
-            "os.db.sqlite.query_v1",
-            "x07_ext_db_sqlite_query_v1",
+            "os.db.sqlite.prepare_v1",
+            "x07_ext_db_sqlite_prepare_v1",
             args,
             dest_ty,
             dest,
         )
     }
 
-    pub(super) fn emit_os_db_sqlite_exec_v1_to(
+    pub(super) fn emit_os_db_sqlite_stmt_query_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
         self.emit_os_db_call_bytes_v1_to(
-            "os.db.sqlite.exec_v1",
-            "x07_ext_db_sqlite_exec_v1",
+            "os.db.sqlite.stmt_query_v1",
+            "x07_ext_db_sqlite_stmt_query_v1",
             args,
             dest_ty,
             dest,
         )
     }
 
-    pub(super) fn emit_os_db_sqlite_close_v1_to(
+    pub(super) fn emit_os_db_sqlite_stmt_exec_v1_to(
         &mut self,
         args: &[Expr],
         dest_ty: Ty,
         dest: &str,
     ) -> Result<(), CompilerError> {
         self.emit_os_db_call_bytes_v1_to(
-            "os.db.sqlite.close_v1",
-            "x07_ext_db_sqlite_close_v1",
+            "os.db.sqlite.stmt_exec_v1",
+            "x07_ext_db_sqlite_stmt_exec_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_sqlite_finalize_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.sqlite.finalize_v1",
+            "x07_ext_db_sqlite_finalize_v1",
             args,
             dest_ty,
             dest,
@@ -2322,6 +3168,111 @@ impl<'a> Emitter<'a> {
         )
     }
 
+    pub(super) fn emit_os_db_pg_prepare_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.prepare_v1",
+            "x07_ext_db_pg_prepare_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_pg_stmt_query_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.stmt_query_v1",
+            "x07_ext_db_pg_stmt_query_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_pg_stmt_exec_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.stmt_exec_v1",
+            "x07_ext_db_pg_stmt_exec_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_pg_finalize_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.finalize_v1",
+            "x07_ext_db_pg_finalize_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_pg_copy_begin_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.copy_begin_v1",
+            "x07_ext_db_pg_copy_begin_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_pg_copy_write_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.copy_write_v1",
+            "x07_ext_db_pg_copy_write_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
+    pub(super) fn emit_os_db_pg_copy_finish_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.pg.copy_finish_v1",
+            "x07_ext_db_pg_copy_finish_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
     pub(super) fn emit_os_db_mysql_open_v1_to(
         &mut self,
         args: &[Expr],
@@ -2427,6 +3378,21 @@ impl<'a> Emitter<'a> {
         )
     }
 
+    pub(super) fn emit_os_db_redis_pipeline_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.emit_os_db_call_bytes_v1_to(
+            "os.db.redis.pipeline_v1",
+            "x07_ext_db_redis_pipeline_v1",
+            args,
+            dest_ty,
+            dest,
+        )
+    }
+
     pub(super) fn emit_os_obj_s3_dispatch_v1_to(
         &mut self,
         args: &[Expr],
@@ -2683,6 +3649,164 @@ impl<'a> Emitter<'a> {
         Ok(())
     }
 
+    pub(super) fn emit_os_time_tzdb_zone_open_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_TIME,
+            native::ABI_MAJOR_V1,
+            "os.time.tzdb_zone_open_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.time.tzdb_zone_open_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_open_v1 returns i32".to_string(),
+            ));
+        }
+        let tzid = self.emit_expr(&args[0])?;
+        if tzid.ty != Ty::BytesView {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_open_v1 expects bytes_view tzid".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = ev_time_tzdb_zone_open_v1((bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+            tzid.c_name, tzid.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_time_tzdb_zone_offset_duration_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_TIME,
+            native::ABI_MAJOR_V1,
+            "os.time.tzdb_zone_offset_duration_v1",
+        )?;
+        if args.len() != 3 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.time.tzdb_zone_offset_duration_v1 expects 3 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_offset_duration_v1 returns bytes".to_string(),
+            ));
+        }
+        let zone_handle = self.emit_expr(&args[0])?;
+        let unix_s_lo = self.emit_expr(&args[1])?;
+        let unix_s_hi = self.emit_expr(&args[2])?;
+        if zone_handle.ty != Ty::I32
+            || unix_s_lo.ty != Ty::I32
+            || unix_s_hi.ty != Ty::I32
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_offset_duration_v1 expects (i32 zone_handle, i32 unix_s_lo, i32 unix_s_hi)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = ev_time_tzdb_zone_offset_duration_v1((int32_t){}, (int32_t){}, (int32_t){});",
+            zone_handle.c_name, unix_s_lo.c_name, unix_s_hi.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_time_tzdb_zone_drop_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_TIME,
+            native::ABI_MAJOR_V1,
+            "os.time.tzdb_zone_drop_v1",
+        )?;
+        if args.len() != 1 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.time.tzdb_zone_drop_v1 expects 1 arg".to_string(),
+            ));
+        }
+        if dest_ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_drop_v1 returns i32".to_string(),
+            ));
+        }
+        let zone_handle = self.emit_expr(&args[0])?;
+        if zone_handle.ty != Ty::I32 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_drop_v1 expects i32 zone_handle".to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = ev_time_tzdb_zone_drop_v1((int32_t){});",
+            zone_handle.c_name
+        ));
+        Ok(())
+    }
+
+    pub(super) fn emit_os_time_tzdb_zone_offsets_batch_v1_to(
+        &mut self,
+        args: &[Expr],
+        dest_ty: Ty,
+        dest: &str,
+    ) -> Result<(), CompilerError> {
+        self.require_native_backend(
+            native::BACKEND_ID_TIME,
+            native::ABI_MAJOR_V1,
+            "os.time.tzdb_zone_offsets_batch_v1",
+        )?;
+        if args.len() != 2 {
+            return Err(CompilerError::new(
+                CompileErrorKind::Parse,
+                "os.time.tzdb_zone_offsets_batch_v1 expects 2 args".to_string(),
+            ));
+        }
+        if dest_ty != Ty::Bytes {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_offsets_batch_v1 returns bytes".to_string(),
+            ));
+        }
+        let zone_handle = self.emit_expr(&args[0])?;
+        let unix_s_packed = self.emit_expr(&args[1])?;
+        if zone_handle.ty != Ty::I32
+            || unix_s_packed.ty != Ty::BytesView
+        {
+            return Err(CompilerError::new(
+                CompileErrorKind::Typing,
+                "os.time.tzdb_zone_offsets_batch_v1 expects (i32 zone_handle, bytes_view unix_s_packed)"
+                    .to_string(),
+            ));
+        }
+        self.line(&format!(
+            "{dest} = ev_time_tzdb_zone_offsets_batch_v1((int32_t){}, (bytes_t){{ .ptr = {}.ptr, .len = {}.len }});",
+            zone_handle.c_name, unix_s_packed.c_name, unix_s_packed.c_name
+        ));
+        Ok(())
+    }
+
     pub(super) fn emit_os_process_exit_to(
         &mut self,
         args: &[Expr],
@@ -6242,6 +7366,55 @@ static __attribute__((noreturn)) void rt_os_process_exit(ctx_t* ctx, int32_t cod
   exit((int)code);
 }
 
+// Adapts a runtime io reader iface to the archive backend's pull callback so
+// reader-based extraction can consume http/socket streams without staging the
+// whole archive on disk. Extraction is synchronous, so one static slot holds
+// the live reader for the duration of the backend call.
+static struct { ctx_t* ctx; iface_t reader; } rt_os_archive_reader_state;
+
+static uint32_t rt_os_archive_reader_read(uint32_t data, uint8_t* dst, uint32_t cap) {
+  (void)data;
+  ctx_t* ctx = rt_os_archive_reader_state.ctx;
+  if (!ctx) rt_trap("os.archive reader callback outside extract");
+  bytes_t chunk = rt_iface_io_read_block(ctx, rt_os_archive_reader_state.reader, cap);
+  uint32_t got = chunk.len <= cap ? chunk.len : cap;
+  if (got) memcpy(dst, chunk.ptr, got);
+  rt_bytes_drop(ctx, &chunk);
+  return got;
+}
+
+static bytes_t rt_os_archive_tar_extract_reader(
+  ctx_t* ctx,
+  bytes_t out_root,
+  iface_t reader,
+  bytes_t caps_read,
+  bytes_t caps_write,
+  bytes_t profile_id
+) {
+  rt_os_archive_reader_state.ctx = ctx;
+  rt_os_archive_reader_state.reader = reader;
+  bytes_t out = x07_ext_archive_tar_extract_reader_to_fs_v1(
+    out_root, rt_os_archive_reader_read, 0, caps_read, caps_write, profile_id);
+  rt_os_archive_reader_state.ctx = NULL;
+  return out;
+}
+
+static bytes_t rt_os_archive_tgz_extract_reader(
+  ctx_t* ctx,
+  bytes_t out_root,
+  iface_t reader,
+  bytes_t caps_read,
+  bytes_t caps_write,
+  bytes_t profile_id
+) {
+  rt_os_archive_reader_state.ctx = ctx;
+  rt_os_archive_reader_state.reader = reader;
+  bytes_t out = x07_ext_archive_tgz_extract_reader_to_fs_v1(
+    out_root, rt_os_archive_reader_read, 0, caps_read, caps_write, profile_id);
+  rt_os_archive_reader_state.ctx = NULL;
+  return out;
+}
+
 static bytes_t rt_os_net_http_request(ctx_t* ctx, bytes_t req) {
   rt_os_policy_init(ctx);
   (void)req;
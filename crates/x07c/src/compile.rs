@@ -698,6 +698,11 @@ const INTERNAL_ONLY_HEADS: &[&str] = &[
     "__internal.bytes.alloc_aligned_v1",
     "__internal.stream_xf.plugin_init_v1",
     "__internal.stream_xf.plugin_step_v1",
+    "__internal.stream_xf.plugin_step_batch_v1",
+    "__internal.stream_xf.plugin_chain_step_v1",
+    "__internal.stream_xf.plugin_chain_flush_v1",
+    "__internal.stream_xf.plugin_shard_step_v1",
+    "__internal.stream_xf.plugin_shard_flush_v1",
     "__internal.stream_xf.plugin_flush_v1",
 ];
 
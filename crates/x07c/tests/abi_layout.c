@@ -1,9 +1,20 @@
 #include "x07_abi_v2.h"
+#include "x07_abi_v3.h"
+#include "x07_abi_wide_v1.h"
+#include "x07_stream_xf_plugin_abi_v1.h"
 
 #include <stdalign.h>
+#include <stddef.h>
 
 #define EV_STATIC_ASSERT(COND, MSG) _Static_assert((COND), MSG)
 
+#define EV_CACHE_LINE_BYTES 64u
+
+// Two fields share a cache line when their offsets land in the same
+// EV_CACHE_LINE_BYTES-sized window of a line-aligned struct.
+#define EV_SAME_CACHE_LINE(T, A, B) \
+  (offsetof(T, A) / EV_CACHE_LINE_BYTES == offsetof(T, B) / EV_CACHE_LINE_BYTES)
+
 EV_STATIC_ASSERT(sizeof(ev_bytes_v2_t) >= sizeof(void*) + sizeof(uint32_t), "bytes size");
 EV_STATIC_ASSERT(alignof(ev_bytes_v2_t) == alignof(void*), "bytes alignment");
 
@@ -30,3 +41,210 @@ EV_STATIC_ASSERT(alignof(ev_iface_v2_t) == alignof(uint32_t), "iface alignment")
 
 EV_STATIC_ASSERT(sizeof(ev_allocator_v1_t) >= 4u * sizeof(void*), "allocator size");
 EV_STATIC_ASSERT(alignof(ev_allocator_v1_t) == alignof(void*), "allocator alignment");
+
+EV_STATIC_ASSERT(EV_BYTES_V3_SMALL_CAP >= 16u, "bytes_v3 small cap");
+EV_STATIC_ASSERT(sizeof(ev_bytes_v3_t) >= sizeof(uint32_t) + sizeof(ev_bytes_v2_t), "bytes_v3 size");
+EV_STATIC_ASSERT(alignof(ev_bytes_v3_t) == alignof(void*), "bytes_v3 alignment");
+EV_STATIC_ASSERT(offsetof(ev_bytes_v3_t, repr) >= sizeof(uint32_t), "bytes_v3 repr offset");
+
+EV_STATIC_ASSERT(sizeof(ev_option_bytes_v3_t) >= sizeof(uint32_t) + sizeof(ev_bytes_v3_t), "option_bytes_v3 size");
+EV_STATIC_ASSERT(alignof(ev_option_bytes_v3_t) == alignof(ev_bytes_v3_t), "option_bytes_v3 alignment");
+
+EV_STATIC_ASSERT(sizeof(ev_result_bytes_v3_t) >= sizeof(uint32_t) + sizeof(ev_bytes_v3_t), "result_bytes_v3 size");
+EV_STATIC_ASSERT(alignof(ev_result_bytes_v3_t) == alignof(ev_bytes_v3_t), "result_bytes_v3 alignment");
+
+EV_STATIC_ASSERT(sizeof(ev_bytes_wide_v1_t) >= sizeof(void*) + sizeof(uint64_t), "bytes_wide size");
+EV_STATIC_ASSERT(alignof(ev_bytes_wide_v1_t) == alignof(void*), "bytes_wide alignment");
+
+EV_STATIC_ASSERT(sizeof(ev_bytes_view_wide_v1_t) >= sizeof(void*) + sizeof(uint64_t), "bytes_view_wide size");
+EV_STATIC_ASSERT(alignof(ev_bytes_view_wide_v1_t) == alignof(void*), "bytes_view_wide alignment");
+
+EV_STATIC_ASSERT(sizeof(ev_vec_u8_wide_v1_t) >= sizeof(void*) + 2u * sizeof(uint64_t), "vec_u8_wide size");
+EV_STATIC_ASSERT(alignof(ev_vec_u8_wide_v1_t) == alignof(void*), "vec_u8_wide alignment");
+
+EV_STATIC_ASSERT(sizeof(ev_heap_hdr_wide_v1_t) == 32u, "heap_hdr_wide size");
+EV_STATIC_ASSERT(sizeof(ev_heap_hdr_wide_v1_t) % 16u == 0u, "heap_hdr_wide keeps 16-byte payload alignment");
+EV_STATIC_ASSERT(alignof(ev_heap_hdr_wide_v1_t) == alignof(uint64_t), "heap_hdr_wide alignment");
+
+// --- Layout audit: exact sizes (LP64) ---
+//
+// The minimum-size asserts above keep the headers honest on any target;
+// the exact asserts below pin the LP64 layout so padding cannot creep in
+// (or out) unnoticed. X07_DEBUG_BORROW widens the view structs, so exact
+// sizes only apply to the release layout.
+
+#if UINTPTR_MAX == UINT64_MAX && !defined(X07_DEBUG_BORROW)
+
+EV_STATIC_ASSERT(sizeof(ev_bytes_v2_t) == 16u, "bytes exact size");
+EV_STATIC_ASSERT(sizeof(ev_bytes_view_v2_t) == 16u, "bytes_view exact size");
+EV_STATIC_ASSERT(sizeof(ev_vec_u8_v2_t) == 16u, "vec_u8 exact size");
+EV_STATIC_ASSERT(sizeof(ev_option_i32_v2_t) == 8u, "option_i32 exact size");
+EV_STATIC_ASSERT(sizeof(ev_option_bytes_v2_t) == 24u, "option_bytes exact size");
+EV_STATIC_ASSERT(sizeof(ev_result_i32_v2_t) == 8u, "result_i32 exact size");
+EV_STATIC_ASSERT(sizeof(ev_result_bytes_v2_t) == 24u, "result_bytes exact size");
+EV_STATIC_ASSERT(sizeof(ev_allocator_v1_t) == 32u, "allocator exact size");
+
+EV_STATIC_ASSERT(sizeof(ev_bytes_v3_t) == 32u, "bytes_v3 exact size");
+EV_STATIC_ASSERT(offsetof(ev_bytes_v3_t, repr) == 8u, "bytes_v3 repr exact offset");
+EV_STATIC_ASSERT(sizeof(ev_option_bytes_v3_t) == 40u, "option_bytes_v3 exact size");
+EV_STATIC_ASSERT(sizeof(ev_result_bytes_v3_t) == 40u, "result_bytes_v3 exact size");
+
+EV_STATIC_ASSERT(sizeof(ev_bytes_wide_v1_t) == 16u, "bytes_wide exact size");
+EV_STATIC_ASSERT(sizeof(ev_bytes_view_wide_v1_t) == 16u, "bytes_view_wide exact size");
+EV_STATIC_ASSERT(sizeof(ev_vec_u8_wide_v1_t) == 24u, "vec_u8_wide exact size");
+
+EV_STATIC_ASSERT(sizeof(x07_bytes_view_v1) == 16u, "xf bytes_view exact size");
+EV_STATIC_ASSERT(sizeof(x07_out_buf_v1) == 16u, "xf out_buf exact size");
+EV_STATIC_ASSERT(sizeof(x07_scratch_v1) == 16u, "xf scratch exact size");
+EV_STATIC_ASSERT(sizeof(x07_xf_budget_v1) == 24u, "xf budget exact size");
+EV_STATIC_ASSERT(sizeof(x07_xf_emit_v1) == 32u, "xf emit exact size");
+EV_STATIC_ASSERT(sizeof(x07_stream_xf_plugin_v1) == 88u, "xf plugin_v1 exact size");
+EV_STATIC_ASSERT(sizeof(x07_stream_xf_plugin_v2) == 96u, "xf plugin_v2 exact size");
+
+EV_STATIC_ASSERT(offsetof(x07_stream_xf_plugin_v1, init) == 56u, "xf plugin init exact offset");
+EV_STATIC_ASSERT(offsetof(x07_stream_xf_plugin_v1, step) == 64u, "xf plugin step exact offset");
+EV_STATIC_ASSERT(offsetof(x07_stream_xf_plugin_v1, flush) == 72u, "xf plugin flush exact offset");
+EV_STATIC_ASSERT(offsetof(x07_stream_xf_plugin_v1, drop) == 80u, "xf plugin drop exact offset");
+
+#endif // LP64 exact layout
+
+// --- Layout audit: cache-line discipline ---
+//
+// Hot/shared designations:
+//  - ev_allocator_v1_t: shared, read-mostly vtable; must fit one line so
+//    concurrent allocators never split the dispatch across lines.
+//  - x07_xf_emit_v1 + x07_xf_budget_v1: passed by value on every plugin
+//    step; together they must fit one line of call-frame traffic.
+//  - x07_stream_xf_plugin_v1: read-only descriptor; the per-item
+//    lifecycle pointers (step/flush/drop) must share one line so steady
+//    state dispatch touches a single line, with identity/cold fields
+//    confined to the lines before it.
+
+EV_STATIC_ASSERT(sizeof(ev_allocator_v1_t) <= EV_CACHE_LINE_BYTES, "allocator vtable fits one cache line");
+EV_STATIC_ASSERT(sizeof(x07_xf_emit_v1) + sizeof(x07_xf_budget_v1) <= EV_CACHE_LINE_BYTES,
+                 "xf emit + budget fit one cache line");
+EV_STATIC_ASSERT(EV_SAME_CACHE_LINE(x07_stream_xf_plugin_v1, step, flush),
+                 "xf plugin step/flush share a cache line");
+EV_STATIC_ASSERT(EV_SAME_CACHE_LINE(x07_stream_xf_plugin_v1, step, drop),
+                 "xf plugin step/drop share a cache line");
+EV_STATIC_ASSERT(offsetof(x07_stream_xf_plugin_v1, plugin_id) / EV_CACHE_LINE_BYTES == 0u,
+                 "xf plugin identity fields stay in the first cache line");
+
+// --- Layout audit: generated offset report ---
+//
+// Compiled with -DX07_ABI_LAYOUT_REPORT the translation unit gains a
+// main() that prints one JSON object per audited struct (size, align,
+// field offsets). The Rust driver runs it and archives the report so
+// layout drift shows up in diffs, not just as assert failures.
+
+#ifdef X07_ABI_LAYOUT_REPORT
+
+#include <stdio.h>
+
+#define EV_REPORT_BEGIN(T) \
+  printf("{\"struct\":\"" #T "\",\"size\":%zu,\"align\":%zu,\"fields\":[", sizeof(T), alignof(T))
+#define EV_REPORT_FIELD(T, F) printf("{\"name\":\"" #F "\",\"offset\":%zu}", offsetof(T, F))
+#define EV_REPORT_SEP() printf(",")
+#define EV_REPORT_END() printf("]}\n")
+
+int main(void) {
+  EV_REPORT_BEGIN(ev_bytes_v2_t);
+  EV_REPORT_FIELD(ev_bytes_v2_t, ptr);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_bytes_v2_t, len);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_bytes_view_v2_t);
+  EV_REPORT_FIELD(ev_bytes_view_v2_t, ptr);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_bytes_view_v2_t, len);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_vec_u8_v2_t);
+  EV_REPORT_FIELD(ev_vec_u8_v2_t, data);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_vec_u8_v2_t, len);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_vec_u8_v2_t, cap);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_option_bytes_v2_t);
+  EV_REPORT_FIELD(ev_option_bytes_v2_t, tag);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_option_bytes_v2_t, payload);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_result_bytes_v2_t);
+  EV_REPORT_FIELD(ev_result_bytes_v2_t, tag);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_result_bytes_v2_t, payload);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_allocator_v1_t);
+  EV_REPORT_FIELD(ev_allocator_v1_t, ctx);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_allocator_v1_t, alloc);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_allocator_v1_t, realloc);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_allocator_v1_t, free);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_bytes_v3_t);
+  EV_REPORT_FIELD(ev_bytes_v3_t, tag);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_bytes_v3_t, repr);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(ev_heap_hdr_wide_v1_t);
+  EV_REPORT_FIELD(ev_heap_hdr_wide_v1_t, size);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_heap_hdr_wide_v1_t, next_off);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_heap_hdr_wide_v1_t, magic);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(ev_heap_hdr_wide_v1_t, req_size);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(x07_xf_emit_v1);
+  EV_REPORT_FIELD(x07_xf_emit_v1, emit_ctx);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_xf_emit_v1, emit_alloc);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_xf_emit_v1, emit_commit);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_xf_emit_v1, emit_view);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(x07_xf_budget_v1);
+  EV_REPORT_FIELD(x07_xf_budget_v1, max_out_bytes_per_step);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_xf_budget_v1, max_scratch_bytes);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(x07_stream_xf_plugin_v1);
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, abi_tag);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, plugin_id);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, state_size);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, init);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, step);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, flush);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v1, drop);
+  EV_REPORT_END();
+
+  EV_REPORT_BEGIN(x07_stream_xf_plugin_v2);
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v2, base);
+  EV_REPORT_SEP();
+  EV_REPORT_FIELD(x07_stream_xf_plugin_v2, step_batch);
+  EV_REPORT_END();
+
+  return 0;
+}
+
+#endif // X07_ABI_LAYOUT_REPORT
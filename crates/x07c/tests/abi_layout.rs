@@ -33,3 +33,59 @@ fn abi_layout_c_static_asserts_compile() {
         String::from_utf8_lossy(&out.stderr),
     );
 }
+
+#[test]
+fn abi_layout_offset_report_generates() {
+    let repo_root = PathBuf::from(env!("CARGO_MANIFEST_DIR")).join("../..");
+    let include_dir = repo_root.join("crates/x07c/include");
+
+    let rel = "crates/x07c/tests/abi_layout.c";
+    let c_path = repo_root.join(rel);
+    let cc = std::env::var_os("X07_CC").unwrap_or_else(|| OsStr::new("cc").to_os_string());
+    let bin_path = std::env::temp_dir().join(format!("x07_abi_layout_report_{}", std::process::id()));
+
+    let out = Command::new(cc)
+        .args([
+            "-std=c11",
+            "-Werror",
+            "-DX07_ABI_LAYOUT_REPORT",
+            "-I",
+            include_dir.to_str().expect("include dir must be UTF-8"),
+            c_path.to_str().expect("c path must be UTF-8"),
+            "-o",
+            bin_path.to_str().expect("bin path must be UTF-8"),
+        ])
+        .output()
+        .expect("run cc");
+    assert!(
+        out.status.success(),
+        "C ABI layout report build failed:\nstdout:\n{}\nstderr:\n{}",
+        String::from_utf8_lossy(&out.stdout),
+        String::from_utf8_lossy(&out.stderr),
+    );
+
+    let report = Command::new(&bin_path).output().expect("run layout report");
+    let _ = std::fs::remove_file(&bin_path);
+    assert!(report.status.success(), "layout report exited nonzero");
+
+    let text = String::from_utf8(report.stdout).expect("layout report must be UTF-8");
+    // One JSON object per audited struct; a missing entry means the audit
+    // and the report drifted apart.
+    for name in [
+        "ev_bytes_v2_t",
+        "ev_vec_u8_v2_t",
+        "ev_allocator_v1_t",
+        "ev_bytes_v3_t",
+        "ev_heap_hdr_wide_v1_t",
+        "x07_xf_emit_v1",
+        "x07_xf_budget_v1",
+        "x07_stream_xf_plugin_v1",
+        "x07_stream_xf_plugin_v2",
+    ] {
+        assert!(
+            text.contains(&format!("{{\"struct\":\"{name}\"")),
+            "layout report is missing {name}:\n{text}"
+        );
+    }
+    println!("{text}");
+}
@@ -0,0 +1,351 @@
+//! Lowering coverage for native-backend builtins: each test compiles a small
+//! program that calls a builtin and asserts the emitted C reaches the backend
+//! entrypoint the builtin is specified against. This is what keeps the extern
+//! decls in the preamble, the ABI headers, and the builtin surface in sync.
+
+use std::path::PathBuf;
+
+use serde_json::json;
+use x07_contracts::X07AST_SCHEMA_VERSION;
+use x07_worlds::WorldId;
+use x07c::compile::{compile_program_to_c, CompileOptions};
+
+fn repo_root() -> PathBuf {
+    PathBuf::from(env!("CARGO_MANIFEST_DIR"))
+        .parent()
+        .and_then(|p| p.parent())
+        .expect("repo root")
+        .to_path_buf()
+}
+
+fn entry(decls: Vec<serde_json::Value>, solve: serde_json::Value) -> Vec<u8> {
+    serde_json::to_vec(&json!({
+        "schema_version": X07AST_SCHEMA_VERSION,
+        "kind": "entry",
+        "module_id": "main",
+        "imports": [],
+        "decls": decls,
+        "solve": solve,
+    }))
+    .expect("encode x07AST entry JSON")
+}
+
+fn compile(program: &[u8], mut options: CompileOptions) -> String {
+    options.arch_root = Some(repo_root());
+    let program = program.to_vec();
+    std::thread::Builder::new()
+        .name("c_emit_backend_lowering_compile".to_string())
+        .stack_size(32 * 1024 * 1024)
+        .spawn(move || {
+            compile_program_to_c(program.as_slice(), &options).expect("program must compile")
+        })
+        .expect("spawn compile thread")
+        .join()
+        .expect("join compile thread")
+}
+
+fn compile_pure(solve: serde_json::Value) -> String {
+    compile(
+        entry(Vec::new(), solve).as_slice(),
+        CompileOptions::default(),
+    )
+}
+
+fn compile_run_os(solve: serde_json::Value) -> String {
+    let mut options = x07c::world_config::compile_options_for_world(WorldId::RunOs, Vec::new());
+    options.profile_fns = false;
+    compile(entry(Vec::new(), solve).as_slice(), options)
+}
+
+fn assert_lowers_to(c: &str, symbols: &[&str]) {
+    for sym in symbols {
+        assert!(
+            c.contains(&format!("{sym}(")),
+            "emitted C does not call {sym}"
+        );
+    }
+}
+
+#[test]
+fn regex_handle_builtins_lower_to_ext_regex_handle_entrypoints() {
+    let c = compile_pure(json!([
+        "begin",
+        ["let", "p", ["bytes.lit", "a+"]],
+        ["let", "t", ["bytes.lit", "aaa"]],
+        ["let", "r", ["bytes.lit", "b"]],
+        ["let", "pv", ["bytes.view", "p"]],
+        ["let", "tv", ["bytes.view", "t"]],
+        ["let", "rv", ["bytes.view", "r"]],
+        ["let", "compiled", ["regex.handle_compile_v1", "pv", 0]],
+        ["let", "m", ["regex.handle_exec_v1", 1, "tv", 0]],
+        ["let", "mc", ["regex.handle_exec_caps_v1", 1, "tv", 0]],
+        ["let", "fa", ["regex.handle_find_all_x7sl_v1", 1, "tv", 16]],
+        ["let", "sp", ["regex.handle_split_v1", 1, "tv", 16]],
+        ["let", "ra", ["regex.handle_replace_all_v1", 1, "tv", "rv", 4096]],
+        ["let", "rc", ["regex.handle_drop_v1", 1]],
+        "compiled"
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_regex_handle_compile_v1",
+            "x07_ext_regex_handle_exec_v1",
+            "x07_ext_regex_handle_exec_caps_v1",
+            "x07_ext_regex_handle_find_all_x7sl_v1",
+            "x07_ext_regex_handle_split_v1",
+            "x07_ext_regex_handle_replace_all_v1",
+            "x07_ext_regex_handle_drop_v1",
+        ],
+    );
+}
+
+#[test]
+fn regex_set_builtins_lower_to_ext_regex_set_entrypoints() {
+    let c = compile_pure(json!([
+        "begin",
+        ["let", "p", ["bytes.lit", "a+\nb+"]],
+        ["let", "t", ["bytes.lit", "aabb"]],
+        ["let", "pv", ["bytes.view", "p"]],
+        ["let", "tv", ["bytes.view", "t"]],
+        ["let", "compiled", ["regex.set_compile_v1", "pv", 2, 0]],
+        ["let", "hits", ["regex.set_scan_x7sl_v1", 1, "tv", 16]],
+        ["let", "rc", ["regex.set_drop_v1", 1]],
+        "hits"
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_regex_set_compile_v1",
+            "x07_ext_regex_set_scan_x7sl_v1",
+            "x07_ext_regex_set_drop_v1",
+        ],
+    );
+}
+
+#[test]
+fn jsonschema_handle_builtins_lower_to_ext_jsonschema_entrypoints() {
+    let c = compile_pure(json!([
+        "begin",
+        ["let", "s", ["bytes.lit", "{}"]],
+        ["let", "i", ["bytes.lit", "{}"]],
+        ["let", "sv", ["bytes.view", "s"]],
+        ["let", "iv", ["bytes.view", "i"]],
+        ["let", "compiled", ["jsonschema.handle_compile_v1", "sv"]],
+        ["let", "v", ["jsonschema.handle_validate_v1", 1, "iv"]],
+        ["let", "vb", ["jsonschema.validate_batch_v1", 1, "iv", 1]],
+        ["let", "rc", ["jsonschema.handle_drop_v1", 1]],
+        "compiled"
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_jsonschema_handle_compile_v1",
+            "x07_ext_jsonschema_handle_validate_v1",
+            "x07_ext_jsonschema_validate_batch_v1",
+            "x07_ext_jsonschema_handle_drop_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_archive_reader_builtins_lower_through_the_iface_thunk() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "caps_read", ["bytes.alloc", 0]],
+        ["let", "caps_write", ["bytes.alloc", 0]],
+        ["let", "rdr", ["fs.open_read", ["bytes.lit", "a.tar"]]],
+        [
+            "os.archive.tar_extract_reader_to_fs_v1",
+            ["bytes.lit", "out"],
+            "rdr",
+            "caps_read",
+            "caps_write",
+            ["bytes.lit", "default"]
+        ]
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "rt_os_archive_tar_extract_reader",
+            "x07_ext_archive_tar_extract_reader_to_fs_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_db_prepared_stmt_builtins_lower_to_db_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "a", ["os.db.sqlite.prepare_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "b", ["os.db.sqlite.stmt_query_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "c", ["os.db.sqlite.stmt_exec_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "d", ["os.db.sqlite.finalize_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "e", ["os.db.pg.prepare_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "f", ["os.db.pg.stmt_query_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "g", ["os.db.pg.stmt_exec_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "h", ["os.db.pg.finalize_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        "a"
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_db_sqlite_prepare_v1",
+            "x07_ext_db_sqlite_stmt_query_v1",
+            "x07_ext_db_sqlite_stmt_exec_v1",
+            "x07_ext_db_sqlite_finalize_v1",
+            "x07_ext_db_pg_prepare_v1",
+            "x07_ext_db_pg_stmt_query_v1",
+            "x07_ext_db_pg_stmt_exec_v1",
+            "x07_ext_db_pg_finalize_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_db_redis_pipeline_builtin_lowers_to_redis_entrypoint() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["os.db.redis.pipeline_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]
+    ]));
+    assert_lowers_to(&c, &["x07_ext_db_redis_pipeline_v1"]);
+}
+
+#[test]
+fn os_db_pg_copy_builtins_lower_to_pg_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "a", ["os.db.pg.copy_begin_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "b", ["os.db.pg.copy_write_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["os.db.pg.copy_finish_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_db_pg_copy_begin_v1",
+            "x07_ext_db_pg_copy_write_v1",
+            "x07_ext_db_pg_copy_finish_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_time_tzdb_zone_builtins_lower_to_time_backend_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "z", ["bytes.lit", "UTC"]],
+        ["let", "stamps", ["bytes.alloc", 8]],
+        ["let", "zv", ["bytes.view", "z"]],
+        ["let", "sv", ["bytes.view", "stamps"]],
+        ["let", "h", ["os.time.tzdb_zone_open_v1", "zv"]],
+        ["let", "off", ["os.time.tzdb_zone_offset_duration_v1", "h", 0, 0]],
+        ["let", "batch", ["os.time.tzdb_zone_offsets_batch_v1", "h", "sv"]],
+        ["let", "rc", ["os.time.tzdb_zone_drop_v1", "h"]],
+        "off"
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "ev_time_tzdb_zone_open_v1",
+            "ev_time_tzdb_zone_offset_duration_v1",
+            "ev_time_tzdb_zone_offsets_batch_v1",
+            "ev_time_tzdb_zone_drop_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_rand_pool_builtins_lower_to_ext_rand_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "caps", ["bytes.alloc", 0]],
+        ["let", "opened", ["os.rand.pool_open_v1", 65536, "caps"]],
+        ["let", "chunk", ["os.rand.pool_bytes_v1", 1, 32]],
+        ["let", "word", ["os.rand.pool_u64_v1", 1]],
+        ["let", "rc", ["os.rand.pool_close_v1", 1]],
+        ["result_bytes.unwrap_or", "chunk", ["bytes.alloc", 0]]
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_rand_pool_open_v1",
+            "x07_ext_rand_pool_bytes_v1",
+            "x07_ext_rand_pool_u64_v1",
+            "x07_ext_rand_pool_close_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_stdio_vectored_and_buffered_builtins_lower_to_ext_stdio_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "a", ["os.stdio.write_vec_stdout_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "b", ["os.stdio.write_vec_stderr_v1", ["bytes.alloc", 0], ["bytes.alloc", 0]]],
+        ["let", "c", ["os.stdio.buf_set_stdout_v1", 65536, ["bytes.alloc", 0]]],
+        ["let", "d", ["os.stdio.buf_set_stderr_v1", 65536, ["bytes.alloc", 0]]],
+        ["let", "e", ["os.stdio.buf_write_stdout_v1", ["bytes.alloc", 0]]],
+        ["let", "f", ["os.stdio.buf_write_stderr_v1", ["bytes.alloc", 0]]],
+        ["let", "g", ["os.stdio.buf_flush_stdout_v1"]],
+        ["let", "h", ["os.stdio.buf_flush_stderr_v1"]],
+        ["bytes.alloc", ["result_i32.unwrap_or", "h", 0]]
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_stdio_write_vec_stdout_v1",
+            "x07_ext_stdio_write_vec_stderr_v1",
+            "x07_ext_stdio_buf_set_stdout_v1",
+            "x07_ext_stdio_buf_set_stderr_v1",
+            "x07_ext_stdio_buf_write_stdout_v1",
+            "x07_ext_stdio_buf_write_stderr_v1",
+            "x07_ext_stdio_buf_flush_stdout_v1",
+            "x07_ext_stdio_buf_flush_stderr_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_fs_view_builtins_lower_to_ext_fs_view_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "caps", ["bytes.alloc", 0]],
+        ["let", "r", ["os.fs.view_open_v1", ["bytes.lit", "a.txt"], "caps"]],
+        ["let", "h", ["result_i32.unwrap_or", "r", 0]],
+        ["let", "b", ["os.fs.view_bytes_v1", "h"]],
+        ["let", "rc", ["os.fs.view_release_v1", "h"]],
+        "b"
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_fs_view_open_v1",
+            "x07_ext_fs_view_bytes_v1",
+            "x07_ext_fs_view_release_v1",
+        ],
+    );
+}
+
+#[test]
+fn os_fs_walk_builtins_lower_to_ext_fs_walk_entrypoints() {
+    let c = compile_run_os(json!([
+        "begin",
+        ["let", "caps", ["bytes.alloc", 0]],
+        [
+            "let",
+            "r",
+            ["os.fs.walk_open_v1", ["bytes.lit", "."], ["bytes.lit", "**/*.txt"], "caps"]
+        ],
+        ["let", "h", ["result_i32.unwrap_or", "r", 0]],
+        ["let", "batch", ["os.fs.walk_next_v1", "h", 128]],
+        ["let", "rc", ["os.fs.walk_drop_v1", "h"]],
+        ["result_bytes.unwrap_or", "batch", ["bytes.alloc", 0]]
+    ]));
+    assert_lowers_to(
+        &c,
+        &[
+            "x07_ext_fs_walk_open_v1",
+            "x07_ext_fs_walk_next_v1",
+            "x07_ext_fs_walk_drop_v1",
+        ],
+    );
+}
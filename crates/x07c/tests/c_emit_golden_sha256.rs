@@ -1,3 +1,9 @@
+// Pins sha256 hashes of the emitted C for a few representative programs so
+// unintended emitter drift fails loudly. Any deliberate change to the
+// emitted C (runtime preamble included) shifts these hashes: run
+// scripts/rebaseline_c_emit_golden.sh and commit the rewritten hashes in
+// the same commit as the emitter change so the series stays bisectable.
+
 use std::path::PathBuf;
 
 use serde_json::json;
@@ -84,7 +90,7 @@ fn golden_sha256_solve_pure_stream_json_canon_pipe() {
     let c = compile(program.as_slice(), CompileOptions::default());
     assert_eq!(
         sha256_hex(&c),
-        "e76f9fba240ab567b0c3727abb269820a806e5f3aa570bef97d23b62c8b30122"
+        "0f37b6610dbaea61edff7ab6a8cf2b7d5fa16f99af2723a5df9ab6aa9d2dd36f"
     );
 }
 
@@ -112,7 +118,7 @@ fn golden_sha256_solve_pure_async_tasks() {
     let c = compile(program.as_slice(), CompileOptions::default());
     assert_eq!(
         sha256_hex(&c),
-        "dc85e23c979bcc3c77fa988135dd35a3303aadb707d6642f4e9d29ca21638b47"
+        "be7fb8cf2a36de97ec8e98c4c7c516cff352f23874a0e782ed8b2c4a460aa248"
     );
 }
 
@@ -133,7 +139,7 @@ fn golden_sha256_solve_pure_contracts_runtime_trap() {
     let c = compile(program.as_slice(), CompileOptions::default());
     assert_eq!(
         sha256_hex(&c),
-        "2157fbacd9d9a0847092cb7ca5c372606c06557c704201ec5f9f1ab1dd9be0b0"
+        "772ed62c39043da0a832e13898fc1dd84f5f1705ed7665ece3e858390a82a710"
     );
 }
 
@@ -148,7 +154,7 @@ fn golden_sha256_run_os_os_fs_read_file() {
     let c = compile(program.as_slice(), options);
     assert_eq!(
         sha256_hex(&c),
-        "480bf61ca7e6057d9b6ba2977e7640c94fcf7afe8f968a6f0d5056c009e9fae3"
+        "7806cfa1b539b566ce6e6ee4a3e5c2cf8ba02ad4b904ed0bfa8db81c7ddb3468"
     );
 }
 
@@ -197,6 +203,6 @@ fn golden_sha256_run_os_mega_fixture() {
     let c = compile(program.as_slice(), options);
     assert_eq!(
         sha256_hex(&c),
-        "948cda74ba5e3206e56ece7da6270d3cc5496363fdcf5678b8be3e275e36fcc3"
+        "48775a3660cff6dcabec6c48c7d55c950d172e4d1cb9661c5b47e6815535f13d"
     );
 }
@@ -35,6 +35,16 @@ fn compile_accepts_std_http_envelope() {
         ]),
     );
 
-    compile_program_to_c_with_meta(program.as_slice(), &CompileOptions::default())
-        .expect("program must compile");
+    // Deep stdlib imports outgrow the default test-thread stack in debug
+    // builds; compile on a bigger thread.
+    std::thread::Builder::new()
+        .name("http_envelope_compile".to_string())
+        .stack_size(16 * 1024 * 1024)
+        .spawn(move || {
+            compile_program_to_c_with_meta(program.as_slice(), &CompileOptions::default())
+                .expect("program must compile");
+        })
+        .expect("spawn compile thread")
+        .join()
+        .expect("join compile thread");
 }
@@ -2,6 +2,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
+#include <time.h>
 
 #  include <arpa/inet.h>
 #  include <netdb.h>
@@ -38,10 +39,15 @@ uint32_t x07_ext_curl_easy_init(void) {
     return 0;
 }
 
+// Origin a pool checkout recorded for the handle, so checkin knows where
+// to park it (see the easy-handle pool below). Empty = not poolable.
+static char g_handle_origin[X07_EXT_CURL_MAX_HANDLES][512];
+
 void x07_ext_curl_easy_cleanup(uint32_t handle) {
     CURL* h = x07_ext_curl_get(handle);
     if (!h) return;
     g_handles[handle] = (CURL*)0;
+    g_handle_origin[handle][0] = '\0';
     curl_easy_cleanup(h);
 }
 
@@ -72,6 +78,319 @@ int32_t x07_ext_curl_easy_getinfo_long(uint32_t handle, uint32_t info, uint32_t*
     return (int32_t)rc;
 }
 
+// ---- multi engine ----
+//
+// Concurrent transfers over the easy-handle table: add prepared easy
+// handles to a multi handle, then drive them from one loop:
+//
+//   while (x07_ext_curl_multi_perform(m, &running) == 0 && running) {
+//       x07_ext_curl_multi_poll(m, timeout_ms, NULL);
+//   }
+//   while (x07_ext_curl_multi_next_done(m, &easy, &result)) { ... }
+//
+// so N upstream requests overlap instead of serializing through
+// x07_ext_curl_easy_perform. An easy handle stays owned by the caller;
+// remove it (or clean up the multi handle) before x07_ext_curl_easy_cleanup.
+
+#define X07_EXT_CURL_MAX_MULTI 64u
+
+static CURLM* g_multi[X07_EXT_CURL_MAX_MULTI];
+
+static CURLM* x07_ext_curl_multi_get(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_CURL_MAX_MULTI) return (CURLM*)0;
+    return g_multi[handle];
+}
+
+uint32_t x07_ext_curl_multi_init(void) {
+    CURLM* m = curl_multi_init();
+    if (!m) return 0;
+    for (uint32_t i = 1; i < X07_EXT_CURL_MAX_MULTI; i++) {
+        if (!g_multi[i]) {
+            g_multi[i] = m;
+            return i;
+        }
+    }
+    curl_multi_cleanup(m);
+    return 0;
+}
+
+void x07_ext_curl_multi_cleanup(uint32_t handle) {
+    CURLM* m = x07_ext_curl_multi_get(handle);
+    if (!m) return;
+    g_multi[handle] = (CURLM*)0;
+    // Detach any easy handles still attached so they stay usable afterwards.
+    for (uint32_t i = 1; i < X07_EXT_CURL_MAX_HANDLES; i++) {
+        if (g_handles[i]) (void)curl_multi_remove_handle(m, g_handles[i]);
+    }
+    curl_multi_cleanup(m);
+}
+
+int32_t x07_ext_curl_multi_add(uint32_t handle, uint32_t easy_handle) {
+    CURLM* m = x07_ext_curl_multi_get(handle);
+    CURL* h = x07_ext_curl_get(easy_handle);
+    if (!m || !h) return -1;
+    return (int32_t)curl_multi_add_handle(m, h);
+}
+
+int32_t x07_ext_curl_multi_remove(uint32_t handle, uint32_t easy_handle) {
+    CURLM* m = x07_ext_curl_multi_get(handle);
+    CURL* h = x07_ext_curl_get(easy_handle);
+    if (!m || !h) return -1;
+    return (int32_t)curl_multi_remove_handle(m, h);
+}
+
+int32_t x07_ext_curl_multi_perform(uint32_t handle, uint32_t* out_running) {
+    CURLM* m = x07_ext_curl_multi_get(handle);
+    if (!m) return -1;
+    int running = 0;
+    CURLMcode rc = curl_multi_perform(m, &running);
+    if (out_running) *out_running = (running > 0) ? (uint32_t)running : 0u;
+    return (int32_t)rc;
+}
+
+int32_t x07_ext_curl_multi_poll(uint32_t handle, uint32_t timeout_ms, uint32_t* out_numfds) {
+    CURLM* m = x07_ext_curl_multi_get(handle);
+    if (!m) return -1;
+    int numfds = 0;
+    CURLMcode rc = curl_multi_poll(m, (struct curl_waitfd*)0, 0, (int)timeout_ms, &numfds);
+    if (out_numfds) *out_numfds = (numfds > 0) ? (uint32_t)numfds : 0u;
+    return (int32_t)rc;
+}
+
+// Takes the next completed transfer off the multi handle: detaches it and
+// reports its easy handle and CURLcode. Returns 1 when one was collected,
+// 0 when none are pending.
+int32_t x07_ext_curl_multi_next_done(uint32_t handle, uint32_t* out_easy, int32_t* out_result) {
+    CURLM* m = x07_ext_curl_multi_get(handle);
+    if (out_easy) *out_easy = 0;
+    if (out_result) *out_result = 0;
+    if (!m) return -1;
+
+    int msgs_left = 0;
+    for (;;) {
+        CURLMsg* msg = curl_multi_info_read(m, &msgs_left);
+        if (!msg) return 0;
+        if (msg->msg != CURLMSG_DONE) continue;
+
+        uint32_t easy = 0;
+        for (uint32_t i = 1; i < X07_EXT_CURL_MAX_HANDLES; i++) {
+            if (g_handles[i] == msg->easy_handle) {
+                easy = i;
+                break;
+            }
+        }
+        CURLcode result = msg->data.result;
+        (void)curl_multi_remove_handle(m, msg->easy_handle);
+        if (out_easy) *out_easy = easy;
+        if (out_result) *out_result = (int32_t)result;
+        return 1;
+    }
+}
+
+// ---- streaming response bodies (std.io / bufread) ----
+//
+// The doc-tier request path buffers the whole body in shim memory, so a
+// 2 GB download needs 2 GB plus a copy-out. A stream instead drives the
+// transfer from a private multi handle and surfaces body chunks through
+// the runtime's reader vtable: the write callback fills a bounded buffer
+// and pauses the transfer when it is full, the reader's read() drains it
+// and unpauses, so memory stays O(buffer) regardless of body size.
+// Open a stream on a prepared easy handle (URL and options set by the
+// caller); the easy handle stays caller-owned and must outlive the
+// stream.
+
+typedef uint32_t (*x07_rt_ext_io_reader_read_fn_t)(uint32_t data, uint8_t* dst, uint32_t cap);
+typedef void (*x07_rt_ext_io_reader_drop_fn_t)(uint32_t data);
+
+extern uint32_t x07_rt_register_io_reader_vtable_v1(
+    x07_rt_ext_io_reader_read_fn_t read,
+    x07_rt_ext_io_reader_drop_fn_t drop
+);
+
+#define X07_EXT_CURL_MAX_STREAMS 256u
+// Well above CURL_MAX_WRITE_SIZE, so a delivered chunk always fits in an
+// empty buffer and pausing only happens with data still unread.
+#define X07_EXT_CURL_STREAM_BUF_CAP (256u * 1024u)
+
+typedef struct x07ExtCurlStream {
+    CURLM* multi;
+    CURL* easy; // borrowed from the easy-handle table, not owned
+    uint8_t buf[X07_EXT_CURL_STREAM_BUF_CAP];
+    uint32_t buf_len;
+    uint32_t buf_off;
+    int paused;
+    int done;
+    int32_t result; // CURLcode once done
+} x07ExtCurlStream;
+
+static x07ExtCurlStream* g_streams[X07_EXT_CURL_MAX_STREAMS];
+
+static x07ExtCurlStream* x07_ext_curl_stream_get(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_CURL_MAX_STREAMS) return (x07ExtCurlStream*)0;
+    return g_streams[handle];
+}
+
+static size_t x07_ext_curl_stream_write_cb(char* ptr, size_t size, size_t nmemb, void* userdata) {
+    x07ExtCurlStream* s = (x07ExtCurlStream*)userdata;
+    if (!s || !ptr) return 0;
+    size_t n = size * nmemb;
+    if (n == 0) return 0;
+    if (n > (size_t)(X07_EXT_CURL_STREAM_BUF_CAP - s->buf_len)) {
+        s->paused = 1;
+        return CURL_WRITEFUNC_PAUSE;
+    }
+    memcpy(s->buf + s->buf_len, ptr, n);
+    s->buf_len += (uint32_t)n;
+    return n;
+}
+
+static void x07_ext_curl_stream_reap(x07ExtCurlStream* s) {
+    int msgs_left = 0;
+    CURLMsg* msg;
+    while ((msg = curl_multi_info_read(s->multi, &msgs_left)) != (CURLMsg*)0) {
+        if (msg->msg == CURLMSG_DONE) {
+            s->done = 1;
+            s->result = (int32_t)msg->data.result;
+        }
+    }
+}
+
+static uint32_t x07_ext_curl_stream_read(uint32_t data, uint8_t* dst, uint32_t cap) {
+    x07ExtCurlStream* s = x07_ext_curl_stream_get(data);
+    if (!s || !dst || cap == 0) return 0;
+
+    for (;;) {
+        if (s->buf_len > s->buf_off) {
+            uint32_t n = s->buf_len - s->buf_off;
+            if (n > cap) n = cap;
+            memcpy(dst, s->buf + s->buf_off, n);
+            s->buf_off += n;
+            if (s->buf_off == s->buf_len) {
+                s->buf_off = 0;
+                s->buf_len = 0;
+                if (s->paused) {
+                    s->paused = 0;
+                    (void)curl_easy_pause(s->easy, CURLPAUSE_CONT);
+                }
+            }
+            return n;
+        }
+        if (s->done) return 0;
+
+        if (s->paused) {
+            // Unpausing redelivers the held chunk synchronously.
+            s->paused = 0;
+            (void)curl_easy_pause(s->easy, CURLPAUSE_CONT);
+            continue;
+        }
+
+        int running = 0;
+        if (curl_multi_perform(s->multi, &running) != CURLM_OK) {
+            s->done = 1;
+            s->result = (int32_t)CURLE_FAILED_INIT;
+            return 0;
+        }
+        x07_ext_curl_stream_reap(s);
+        if (s->buf_len > s->buf_off || s->done) continue;
+        if (running == 0) {
+            s->done = 1;
+            continue;
+        }
+        if (curl_multi_poll(s->multi, (struct curl_waitfd*)0, 0, 1000, (int*)0) != CURLM_OK) {
+            s->done = 1;
+            s->result = (int32_t)CURLE_FAILED_INIT;
+            return 0;
+        }
+    }
+}
+
+static void x07_ext_curl_stream_close(x07ExtCurlStream* s) {
+    if (s->easy) (void)curl_multi_remove_handle(s->multi, s->easy);
+    if (s->multi) curl_multi_cleanup(s->multi);
+    free(s);
+}
+
+static void x07_ext_curl_stream_drop(uint32_t data) {
+    x07ExtCurlStream* s = x07_ext_curl_stream_get(data);
+    if (!s) return;
+    g_streams[data] = (x07ExtCurlStream*)0;
+    x07_ext_curl_stream_close(s);
+}
+
+static uint32_t g_stream_reader_vtable = 0;
+
+static uint32_t x07_ext_curl_stream_reader_vtable(void) {
+    if (g_stream_reader_vtable) return g_stream_reader_vtable;
+    g_stream_reader_vtable = x07_rt_register_io_reader_vtable_v1(
+        x07_ext_curl_stream_read,
+        x07_ext_curl_stream_drop
+    );
+    return g_stream_reader_vtable;
+}
+
+// Starts a streaming transfer on a prepared easy handle. The shim takes
+// over CURLOPT_WRITEFUNCTION/WRITEDATA; everything else (URL, headers,
+// timeouts) is whatever the caller set. Returns 0 with the stream handle
+// in *out_stream, or -1.
+int32_t x07_ext_curl_easy_stream_open(uint32_t easy_handle, uint32_t* out_stream) {
+    if (out_stream) *out_stream = 0;
+    CURL* h = x07_ext_curl_get(easy_handle);
+    if (!h || !out_stream) return -1;
+
+    uint32_t slot = 0;
+    for (uint32_t i = 1; i < X07_EXT_CURL_MAX_STREAMS; i++) {
+        if (!g_streams[i]) {
+            slot = i;
+            break;
+        }
+    }
+    if (!slot) return -1;
+
+    x07ExtCurlStream* s = (x07ExtCurlStream*)calloc(1, sizeof(x07ExtCurlStream));
+    if (!s) return -1;
+    s->multi = curl_multi_init();
+    if (!s->multi) {
+        free(s);
+        return -1;
+    }
+    s->easy = h;
+    s->result = -1;
+
+    (void)curl_easy_setopt(h, CURLOPT_WRITEFUNCTION, x07_ext_curl_stream_write_cb);
+    (void)curl_easy_setopt(h, CURLOPT_WRITEDATA, s);
+    if (curl_multi_add_handle(s->multi, h) != CURLM_OK) {
+        curl_multi_cleanup(s->multi);
+        free(s);
+        return -1;
+    }
+
+    g_streams[slot] = s;
+    *out_stream = slot;
+    return 0;
+}
+
+// Reader vtable id for a stream handle (the stream handle is the reader's
+// data word). 0 on a dead handle.
+int32_t x07_ext_curl_stream_reader_prepare_v1(uint32_t stream_handle) {
+    if (!x07_ext_curl_stream_get(stream_handle)) return 0;
+    uint32_t vtable = x07_ext_curl_stream_reader_vtable();
+    if (vtable == 0 || vtable > (uint32_t)INT32_MAX) return 0;
+    return (int32_t)vtable;
+}
+
+// CURLcode of a finished stream, or -1 while the transfer is still in
+// flight. Lets the caller tell a clean EOF from a truncated body.
+int32_t x07_ext_curl_stream_result(uint32_t stream_handle) {
+    x07ExtCurlStream* s = x07_ext_curl_stream_get(stream_handle);
+    if (!s) return -1;
+    return s->done ? s->result : -1;
+}
+
+// Closes a stream without going through the reader vtable.
+void x07_ext_curl_stream_free(uint32_t stream_handle) {
+    x07_ext_curl_stream_drop(stream_handle);
+}
+
 #define X07_EXT_CURL_MAX_BUFS 4096u
 
 static uint8_t* g_bufs[X07_EXT_CURL_MAX_BUFS];
@@ -101,6 +420,19 @@ void x07_ext_curl_buf_free(uint32_t handle) {
     g_lens[handle] = 0;
 }
 
+// Copies a buf slot into caller memory and frees the slot in one hop,
+// replacing the ptr/len/memcpy/free call sequence. Returns the copied
+// length, or -1 on a bad handle / insufficient cap.
+int32_t x07_ext_curl_buf_take_into(uint32_t handle, uint8_t* dst, uint32_t cap) {
+    if (handle == 0 || handle >= X07_EXT_CURL_MAX_BUFS) return -1;
+    if (!g_bufs[handle]) return -1;
+    uint32_t len = g_lens[handle];
+    if (len > (uint32_t)INT32_MAX || len > cap) return -1;
+    if (len) memcpy(dst, g_bufs[handle], (size_t)len);
+    x07_ext_curl_buf_free(handle);
+    return (int32_t)len;
+}
+
 static void x07_ext_write_u32_le(uint8_t* dst, uint32_t v) {
     dst[0] = (uint8_t)(v & 0xff);
     dst[1] = (uint8_t)((v >> 8) & 0xff);
@@ -686,6 +1018,176 @@ static char* x07_ext_join_root_and_rel(const char* root, size_t root_len, const
     return out;
 }
 
+// ---- easy-handle pool ----
+//
+// Creating and destroying an easy handle per logical request throws away
+// libcurl's per-handle connection cache, so every request to the same
+// upstream re-does TCP connect + TLS handshake. Idle handles are parked
+// here keyed by effective origin (scheme, lowered host, port); checkout
+// hands back a warm handle whose kept-alive connection is reused, checkin
+// resets options with curl_easy_reset — which keeps live connections and
+// the session caches — and parks the handle again. Pool size and idle TTL
+// come from X07_EXT_CURL_POOL_SIZE / X07_EXT_CURL_POOL_IDLE_MS (size 0
+// disables pooling). Expired handles are dropped lazily on pool access.
+
+#define X07_EXT_CURL_POOL_MAX_SIZE 256u
+#define X07_EXT_CURL_POOL_DEFAULT_SIZE 16u
+#define X07_EXT_CURL_POOL_DEFAULT_IDLE_MS (30u * 1000u)
+#define X07_EXT_CURL_ORIGIN_MAX 512u
+
+typedef struct x07ExtCurlPoolSlot {
+    CURL* h; // NULL = slot empty
+    char origin[X07_EXT_CURL_ORIGIN_MAX];
+    int64_t idle_since_ms;
+} x07ExtCurlPoolSlot;
+
+static x07ExtCurlPoolSlot g_pool[X07_EXT_CURL_POOL_MAX_SIZE];
+static uint32_t g_pool_size;
+static uint32_t g_pool_idle_ms;
+static int g_pool_configured;
+
+static int64_t x07_ext_curl_now_ms(void) {
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) return 0;
+    return (int64_t)ts.tv_sec * 1000 + (int64_t)(ts.tv_nsec / 1000000);
+}
+
+static void x07_ext_curl_pool_config(void) {
+    if (g_pool_configured) return;
+    g_pool_configured = 1;
+    g_pool_size = X07_EXT_CURL_POOL_DEFAULT_SIZE;
+    g_pool_idle_ms = X07_EXT_CURL_POOL_DEFAULT_IDLE_MS;
+
+    const char* size_s = getenv("X07_EXT_CURL_POOL_SIZE");
+    if (size_s && *size_s) {
+        uint32_t v = 0;
+        if (x07_ext_parse_u32_dec(size_s, strlen(size_s), &v)) {
+            g_pool_size = (v > X07_EXT_CURL_POOL_MAX_SIZE) ? X07_EXT_CURL_POOL_MAX_SIZE : v;
+        }
+    }
+    const char* idle_s = getenv("X07_EXT_CURL_POOL_IDLE_MS");
+    if (idle_s && *idle_s) {
+        uint32_t v = 0;
+        if (x07_ext_parse_u32_dec(idle_s, strlen(idle_s), &v) && v != 0) g_pool_idle_ms = v;
+    }
+}
+
+// Builds the pool key for an http(s) URL: "scheme|host|port" with the
+// host lowered. Returns 0 (not poolable) for other schemes or oversized
+// hosts.
+static int x07_ext_curl_url_origin(const uint8_t* url, uint32_t url_len, char* out, size_t out_cap) {
+    int is_http = x07_ext_bytes_has_prefix(url, url_len, "http://");
+    int is_https = x07_ext_bytes_has_prefix(url, url_len, "https://");
+    if (!is_http && !is_https) return 0;
+
+    const uint8_t* host = NULL;
+    size_t host_len = 0;
+    uint32_t port = 0;
+    uint32_t scheme_len = is_https ? 8u : 7u;
+    uint32_t def_port = is_https ? 443u : 80u;
+    if (!x07_ext_parse_http_host_port(url, url_len, scheme_len, def_port, &host, &host_len, &port)) return 0;
+    if (host_len + 32 > out_cap) return 0;
+
+    // Bounded writes instead of one snprintf: the host_len guard above
+    // caps the total, but -Wformat-truncation cannot see that.
+    const char* scheme = is_https ? "https" : "http";
+    size_t scheme_len_s = strlen(scheme);
+    char port_s[16];
+    int port_n = snprintf(port_s, sizeof(port_s), "%u", (unsigned)port);
+    size_t pos = 0;
+    memcpy(out + pos, scheme, scheme_len_s);
+    pos += scheme_len_s;
+    out[pos++] = '|';
+    for (size_t i = 0; i < host_len; i++) {
+        out[pos++] = (char)x07_ext_ascii_lower(host[i]);
+    }
+    out[pos++] = '|';
+    memcpy(out + pos, port_s, (size_t)port_n);
+    pos += (size_t)port_n;
+    out[pos] = '\0';
+    return 1;
+}
+
+static void x07_ext_curl_pool_drop_expired(int64_t now) {
+    for (uint32_t i = 0; i < g_pool_size; i++) {
+        if (g_pool[i].h && now - g_pool[i].idle_since_ms > (int64_t)g_pool_idle_ms) {
+            curl_easy_cleanup(g_pool[i].h);
+            g_pool[i].h = (CURL*)0;
+        }
+    }
+}
+
+// Warm handle for the origin, or a fresh one. Never returns NULL short of
+// curl_easy_init failing.
+static CURL* x07_ext_curl_pool_take(const char* origin) {
+    x07_ext_curl_pool_config();
+    int64_t now = x07_ext_curl_now_ms();
+    x07_ext_curl_pool_drop_expired(now);
+    for (uint32_t i = 0; i < g_pool_size; i++) {
+        if (g_pool[i].h && strcmp(g_pool[i].origin, origin) == 0) {
+            CURL* h = g_pool[i].h;
+            g_pool[i].h = (CURL*)0;
+            return h;
+        }
+    }
+    return curl_easy_init();
+}
+
+// Resets the handle and parks it for its origin. Returns 1 when parked;
+// 0 means the pool is full or disabled and the caller still owns the
+// handle.
+static int x07_ext_curl_pool_put(CURL* h, const char* origin) {
+    if (!h || !origin || !*origin) return 0;
+    x07_ext_curl_pool_config();
+    int64_t now = x07_ext_curl_now_ms();
+    x07_ext_curl_pool_drop_expired(now);
+    for (uint32_t i = 0; i < g_pool_size; i++) {
+        if (!g_pool[i].h) {
+            curl_easy_reset(h);
+            g_pool[i].h = h;
+            snprintf(g_pool[i].origin, sizeof(g_pool[i].origin), "%s", origin);
+            g_pool[i].idle_since_ms = now;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Checkout/checkin over the handle table, for callers driving the raw
+// setopt/perform (or multi) tier themselves. Checkout slots the handle
+// into the easy-handle table like x07_ext_curl_easy_init; checkin
+// invalidates the table entry and parks the underlying handle, falling
+// back to cleanup when it cannot be pooled.
+uint32_t x07_ext_curl_pool_checkout(const uint8_t* url, uint32_t url_len) {
+    char origin[X07_EXT_CURL_ORIGIN_MAX];
+    int poolable = url && url_len != 0 && x07_ext_curl_url_origin(url, url_len, origin, sizeof(origin));
+
+    CURL* h = poolable ? x07_ext_curl_pool_take(origin) : curl_easy_init();
+    if (!h) return 0;
+    for (uint32_t i = 1; i < X07_EXT_CURL_MAX_HANDLES; i++) {
+        if (!g_handles[i]) {
+            g_handles[i] = h;
+            if (poolable) {
+                snprintf(g_handle_origin[i], sizeof(g_handle_origin[i]), "%s", origin);
+            } else {
+                g_handle_origin[i][0] = '\0';
+            }
+            return i;
+        }
+    }
+    curl_easy_cleanup(h);
+    return 0;
+}
+
+int32_t x07_ext_curl_pool_checkin(uint32_t handle) {
+    CURL* h = x07_ext_curl_get(handle);
+    if (!h) return -1;
+    g_handles[handle] = (CURL*)0;
+    if (!x07_ext_curl_pool_put(h, g_handle_origin[handle])) curl_easy_cleanup(h);
+    g_handle_origin[handle][0] = '\0';
+    return 0;
+}
+
 static uint8_t* x07_ext_make_ok_http_resp(uint32_t status_code, const uint8_t* body, uint32_t body_len, uint32_t* out_len) {
     uint32_t payload_len = 1 + 4 + 4 + 4 + body_len;
     uint32_t doc_len = 1 + payload_len;
@@ -1107,7 +1609,11 @@ int32_t x07_ext_curl_http_request_alloc(
     memcpy(url_c, url, url_len);
     url_c[url_len] = '\0';
 
-    CURL* h = curl_easy_init();
+    // http(s) requests draw a warm handle from the pool so the kept-alive
+    // connection (and TLS session) to the same origin is reused.
+    char origin[X07_EXT_CURL_ORIGIN_MAX];
+    int poolable = x07_ext_curl_url_origin(url, url_len, origin, sizeof(origin));
+    CURL* h = poolable ? x07_ext_curl_pool_take(origin) : curl_easy_init();
     if (!h) {
         free(url_c);
         goto internal_err;
@@ -1320,7 +1826,7 @@ int32_t x07_ext_curl_http_request_alloc(
 
     if (headers) curl_slist_free_all(headers);
     if (resolve_list) curl_slist_free_all(resolve_list);
-    curl_easy_cleanup(h);
+    if (!poolable || !x07_ext_curl_pool_put(h, origin)) curl_easy_cleanup(h);
     free(url_c);
     if (buf.data) free(buf.data);
     if (capture_headers && resp_headers.data) free(resp_headers.data);
@@ -0,0 +1,1493 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+uint8_t* SHA256(const uint8_t* data, size_t len, uint8_t* md);
+uint8_t* SHA512(const uint8_t* data, size_t len, uint8_t* md);
+
+const void* EVP_sha256(void);
+const void* EVP_sha512(void);
+
+int RAND_bytes(uint8_t* buf, int num);
+
+typedef struct evp_pkey_st EVP_PKEY;
+typedef struct evp_md_ctx_st EVP_MD_CTX;
+typedef struct bignum_st BIGNUM;
+typedef struct rsa_st RSA;
+typedef struct ec_key_st EC_KEY;
+typedef struct ecdsa_sig_st ECDSA_SIG;
+
+int OBJ_txt2nid(const char* s);
+EVP_PKEY* EVP_PKEY_new_raw_public_key(int type, void* e, const uint8_t* key, size_t keylen);
+EVP_PKEY* EVP_PKEY_new_raw_private_key(int type, void* e, const uint8_t* key, size_t keylen);
+int EVP_PKEY_get_raw_public_key(const EVP_PKEY* pkey, uint8_t* pub, size_t* len);
+EVP_PKEY* EVP_PKEY_new(void);
+void EVP_PKEY_free(EVP_PKEY* pkey);
+int EVP_PKEY_set1_RSA(EVP_PKEY* pkey, RSA* key);
+int EVP_PKEY_set1_EC_KEY(EVP_PKEY* pkey, EC_KEY* key);
+EVP_MD_CTX* EVP_MD_CTX_new(void);
+void EVP_MD_CTX_free(EVP_MD_CTX* ctx);
+int EVP_DigestVerifyInit(EVP_MD_CTX* ctx, void** pctx, const void* type, void* e, EVP_PKEY* pkey);
+int EVP_DigestVerify(EVP_MD_CTX* ctx, const uint8_t* sig, size_t siglen, const uint8_t* tbs, size_t tbslen);
+int EVP_DigestSignInit(EVP_MD_CTX* ctx, void** pctx, const void* type, void* e, EVP_PKEY* pkey);
+int EVP_DigestSign(EVP_MD_CTX* ctx, uint8_t* sigret, size_t* siglen, const uint8_t* tbs, size_t tbslen);
+typedef struct evp_cipher_ctx_st EVP_CIPHER_CTX;
+const void* EVP_aes_256_gcm(void);
+const void* EVP_chacha20_poly1305(void);
+EVP_CIPHER_CTX* EVP_CIPHER_CTX_new(void);
+void EVP_CIPHER_CTX_free(EVP_CIPHER_CTX* ctx);
+int EVP_CipherInit_ex(EVP_CIPHER_CTX* ctx, const void* cipher, void* impl, const uint8_t* key, const uint8_t* iv, int enc);
+int EVP_CipherUpdate(EVP_CIPHER_CTX* ctx, uint8_t* out, int* outl, const uint8_t* in, int inl);
+int EVP_CipherFinal_ex(EVP_CIPHER_CTX* ctx, uint8_t* outm, int* outl);
+int EVP_CIPHER_CTX_ctrl(EVP_CIPHER_CTX* ctx, int type, int arg, void* ptr);
+
+int EVP_DigestInit_ex(EVP_MD_CTX* ctx, const void* type, void* impl);
+int EVP_DigestUpdate(EVP_MD_CTX* ctx, const void* d, size_t cnt);
+int EVP_DigestFinal_ex(EVP_MD_CTX* ctx, uint8_t* md, unsigned int* s);
+
+BIGNUM* BN_bin2bn(const uint8_t* s, int len, BIGNUM* ret);
+int BN_num_bits(const BIGNUM* a);
+int BN_bn2bin(const BIGNUM* a, uint8_t* to);
+BIGNUM* BN_new(void);
+int BN_set_word(BIGNUM* a, unsigned long w);
+void BN_free(BIGNUM* a);
+
+RSA* RSA_new(void);
+void RSA_free(RSA* rsa);
+int RSA_set0_key(RSA* r, BIGNUM* n, BIGNUM* e, BIGNUM* d);
+int RSA_generate_key_ex(RSA* rsa, int bits, BIGNUM* e, void* cb);
+void RSA_get0_key(const RSA* r, const BIGNUM** n, const BIGNUM** e, const BIGNUM** d);
+void RSA_get0_factors(const RSA* r, const BIGNUM** p, const BIGNUM** q);
+void RSA_get0_crt_params(
+    const RSA* r,
+    const BIGNUM** dmp1,
+    const BIGNUM** dmq1,
+    const BIGNUM** iqmp
+);
+
+EC_KEY* EC_KEY_new_by_curve_name(int nid);
+void EC_KEY_free(EC_KEY* key);
+int EC_KEY_set_public_key_affine_coordinates(EC_KEY* key, BIGNUM* x, BIGNUM* y);
+int EC_KEY_check_key(const EC_KEY* key);
+
+ECDSA_SIG* ECDSA_SIG_new(void);
+void ECDSA_SIG_free(ECDSA_SIG* sig);
+int ECDSA_SIG_set0(ECDSA_SIG* sig, BIGNUM* r, BIGNUM* s);
+int i2d_ECDSA_SIG(const ECDSA_SIG* sig, uint8_t** pp);
+
+typedef struct hmac_ctx_st HMAC_CTX;
+HMAC_CTX* HMAC_CTX_new(void);
+void HMAC_CTX_free(HMAC_CTX* ctx);
+int HMAC_Init_ex(HMAC_CTX* ctx, const void* key, int len, const void* md, void* impl);
+int HMAC_Update(HMAC_CTX* ctx, const uint8_t* data, size_t len);
+int HMAC_Final(HMAC_CTX* ctx, uint8_t* md, unsigned int* len);
+
+uint8_t* HMAC(
+    const void* evp_md,
+    const void* key,
+    int key_len,
+    const uint8_t* data,
+    size_t data_len,
+    uint8_t* md,
+    unsigned int* md_len
+);
+
+uint8_t* x07_ext_openssl_sha256(const uint8_t* data, uint32_t len, uint8_t* md) {
+    return SHA256(data, (size_t)len, md);
+}
+
+uint8_t* x07_ext_openssl_sha512(const uint8_t* data, uint32_t len, uint8_t* md) {
+    return SHA512(data, (size_t)len, md);
+}
+
+uint8_t* x07_ext_openssl_hmac(
+    const void* evp_md,
+    const void* key,
+    uint32_t key_len,
+    const uint8_t* data,
+    uint32_t data_len,
+    uint8_t* md,
+    uint32_t* md_len
+) {
+    unsigned int out_len = 0;
+    uint8_t* out = HMAC(
+        evp_md,
+        key,
+        (int)key_len,
+        data,
+        (size_t)data_len,
+        md,
+        &out_len
+    );
+    if (md_len) *md_len = (uint32_t)out_len;
+    return out;
+}
+
+// Incremental digest contexts. Streamed data (fs/socket reads) can be
+// hashed chunk-by-chunk instead of being concatenated into one buffer
+// for the one-shot x07_ext_openssl_sha256/sha512 entry points. Each slot
+// keeps its EVP_MD_CTX allocated across uses; EVP_DigestInit_ex resets
+// the context, so a busy caller never pays a ctx malloc after warm-up.
+
+#define X07_EXT_OPENSSL_MAX_DIGESTS 256u
+
+#define X07_EXT_OPENSSL_DIGEST_SHA256 1u
+#define X07_EXT_OPENSSL_DIGEST_SHA512 2u
+
+typedef struct {
+    EVP_MD_CTX* ctx;
+    uint32_t md_len; // 0 = slot free
+} x07ExtOpensslDigestSlot;
+
+static x07ExtOpensslDigestSlot g_digests[X07_EXT_OPENSSL_MAX_DIGESTS];
+
+// Returns a digest handle (>0) ready for updates, or 0 on failure.
+// alg is X07_EXT_OPENSSL_DIGEST_SHA256 or X07_EXT_OPENSSL_DIGEST_SHA512.
+uint32_t x07_ext_openssl_digest_init(uint32_t alg) {
+    const void* md;
+    uint32_t md_len;
+    if (alg == X07_EXT_OPENSSL_DIGEST_SHA256) {
+        md = EVP_sha256();
+        md_len = 32u;
+    } else if (alg == X07_EXT_OPENSSL_DIGEST_SHA512) {
+        md = EVP_sha512();
+        md_len = 64u;
+    } else {
+        return 0;
+    }
+    if (!md) return 0;
+
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_DIGESTS; i++) {
+        if (g_digests[i].md_len != 0) continue;
+        if (!g_digests[i].ctx) {
+            g_digests[i].ctx = EVP_MD_CTX_new();
+            if (!g_digests[i].ctx) return 0;
+        }
+        if (EVP_DigestInit_ex(g_digests[i].ctx, md, NULL) != 1) return 0;
+        g_digests[i].md_len = md_len;
+        return i;
+    }
+    return 0;
+}
+
+int32_t x07_ext_openssl_digest_update(uint32_t handle, const uint8_t* data, uint32_t len) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_DIGESTS) return 0;
+    if (g_digests[handle].md_len == 0) return 0;
+    if (len == 0) return 1;
+    if (!data) return 0;
+    return EVP_DigestUpdate(g_digests[handle].ctx, data, (size_t)len) == 1 ? 1 : 0;
+}
+
+// Writes the digest into md (md_cap must cover it) and releases the
+// handle; returns the digest length, or 0 on failure. The slot's ctx is
+// kept for the next init.
+uint32_t x07_ext_openssl_digest_final(uint32_t handle, uint8_t* md, uint32_t md_cap) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_DIGESTS) return 0;
+    uint32_t md_len = g_digests[handle].md_len;
+    if (md_len == 0) return 0;
+    g_digests[handle].md_len = 0;
+    if (!md || md_cap < md_len) return 0;
+
+    unsigned int out_len = 0;
+    if (EVP_DigestFinal_ex(g_digests[handle].ctx, md, &out_len) != 1) return 0;
+    return out_len == md_len ? md_len : 0;
+}
+
+// Abandons an in-flight digest without producing output.
+void x07_ext_openssl_digest_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_DIGESTS) return;
+    g_digests[handle].md_len = 0;
+}
+
+// Keyed HMAC handles. x07_ext_openssl_hmac re-derives the inner/outer
+// key pads on every call, which dominates when the same few keys sign
+// millions of short messages. A handle absorbs the key once; each sign
+// re-inits with a NULL key, which OpenSSL serves from the precomputed
+// pads, leaving only the compression-function work per message.
+
+#define X07_EXT_OPENSSL_MAX_HMACS 256u
+
+typedef struct {
+    HMAC_CTX* ctx;
+    uint32_t md_len; // 0 = slot free
+} x07ExtOpensslHmacSlot;
+
+static x07ExtOpensslHmacSlot g_hmacs[X07_EXT_OPENSSL_MAX_HMACS];
+
+// Returns an HMAC handle (>0) keyed for alg (same constants as
+// x07_ext_openssl_digest_init), or 0.
+uint32_t x07_ext_openssl_hmac_init(uint32_t alg, const uint8_t* key, uint32_t key_len) {
+    const void* md;
+    uint32_t md_len;
+    if (alg == X07_EXT_OPENSSL_DIGEST_SHA256) {
+        md = EVP_sha256();
+        md_len = 32u;
+    } else if (alg == X07_EXT_OPENSSL_DIGEST_SHA512) {
+        md = EVP_sha512();
+        md_len = 64u;
+    } else {
+        return 0;
+    }
+    if (!md) return 0;
+    if (!key && key_len != 0) return 0;
+    if (key_len > 2147483647u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!key) key = &zero;
+
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_HMACS; i++) {
+        if (g_hmacs[i].md_len != 0) continue;
+        if (!g_hmacs[i].ctx) {
+            g_hmacs[i].ctx = HMAC_CTX_new();
+            if (!g_hmacs[i].ctx) return 0;
+        }
+        if (HMAC_Init_ex(g_hmacs[i].ctx, key, (int)key_len, md, NULL) != 1) return 0;
+        g_hmacs[i].md_len = md_len;
+        return i;
+    }
+    return 0;
+}
+
+void x07_ext_openssl_hmac_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_HMACS) return;
+    g_hmacs[handle].md_len = 0;
+}
+
+// Signs one message; writes the tag into md and returns its length, or
+// 0 on failure. The handle stays keyed for further signs.
+uint32_t x07_ext_openssl_hmac_sign(
+    uint32_t handle,
+    const uint8_t* data,
+    uint32_t len,
+    uint8_t* md,
+    uint32_t md_cap
+) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_HMACS) return 0;
+    uint32_t md_len = g_hmacs[handle].md_len;
+    if (md_len == 0) return 0;
+    if (!md || md_cap < md_len) return 0;
+    if (!data && len != 0) return 0;
+    if (len > 2147483647u) return 0;
+
+    HMAC_CTX* ctx = g_hmacs[handle].ctx;
+    if (HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) != 1) return 0;
+    if (len != 0 && HMAC_Update(ctx, data, (size_t)len) != 1) return 0;
+    unsigned int out_len = 0;
+    if (HMAC_Final(ctx, md, &out_len) != 1) return 0;
+    return out_len == md_len ? md_len : 0;
+}
+
+// Signs count messages in one call: the plaintexts sit back to back in
+// data with their lengths in lens, and the tags land back to back in
+// out_mds (count * tag length bytes). Returns the tag length, or 0.
+uint32_t x07_ext_openssl_hmac_sign_batch(
+    uint32_t handle,
+    uint32_t count,
+    const uint8_t* data,
+    const uint32_t* lens,
+    uint8_t* out_mds,
+    uint32_t out_mds_cap
+) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_HMACS) return 0;
+    uint32_t md_len = g_hmacs[handle].md_len;
+    if (md_len == 0) return 0;
+    if (count == 0 || count > 65536u) return 0;
+    if (!lens || !out_mds) return 0;
+    if ((uint64_t)count * md_len > out_mds_cap) return 0;
+
+    size_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (lens[i] > 2147483647u) return 0;
+        total += lens[i];
+    }
+    if (!data && total != 0) return 0;
+
+    HMAC_CTX* ctx = g_hmacs[handle].ctx;
+    const uint8_t* r = data;
+    uint8_t* w = out_mds;
+    for (uint32_t i = 0; i < count; i++) {
+        if (HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) != 1) return 0;
+        if (lens[i] != 0 && HMAC_Update(ctx, r, (size_t)lens[i]) != 1) return 0;
+        unsigned int out_len = 0;
+        if (HMAC_Final(ctx, w, &out_len) != 1) return 0;
+        if (out_len != md_len) return 0;
+        r += lens[i];
+        w += md_len;
+    }
+    return md_len;
+}
+
+#define X07_EXT_OPENSSL_MAX_BUFS 4096u
+
+static uint8_t* g_bufs[X07_EXT_OPENSSL_MAX_BUFS];
+static uint32_t g_lens[X07_EXT_OPENSSL_MAX_BUFS];
+
+static uint32_t x07_ext_openssl_alloc_buf_slot(void) {
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_BUFS; i++) {
+        if (!g_bufs[i]) return i;
+    }
+    return 0;
+}
+
+uint32_t x07_ext_openssl_buf_len(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_BUFS) return 0;
+    return g_lens[handle];
+}
+
+const uint8_t* x07_ext_openssl_buf_ptr(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_BUFS) return (const uint8_t*)0;
+    return g_bufs[handle];
+}
+
+void x07_ext_openssl_buf_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_BUFS) return;
+    if (g_bufs[handle]) free(g_bufs[handle]);
+    g_bufs[handle] = (uint8_t*)0;
+    g_lens[handle] = 0;
+}
+
+static void x07_ext_write_u32_le(uint8_t* dst, uint32_t v) {
+    dst[0] = (uint8_t)(v & 0xff);
+    dst[1] = (uint8_t)((v >> 8) & 0xff);
+    dst[2] = (uint8_t)((v >> 16) & 0xff);
+    dst[3] = (uint8_t)((v >> 24) & 0xff);
+}
+
+static uint8_t* x07_ext_make_err_doc(uint32_t code, uint32_t* out_len) {
+    uint8_t* buf = (uint8_t*)malloc(9);
+    if (!buf) return (uint8_t*)0;
+    buf[0] = 0;
+    x07_ext_write_u32_le(buf + 1, code);
+    x07_ext_write_u32_le(buf + 5, 0);
+    if (out_len) *out_len = 9;
+    return buf;
+}
+
+static const char x07_ext_b64url_tbl[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// 12 bits -> two output characters, so the hot encode loop does two table
+// loads and two stores per 3 input bytes instead of four of each. Built
+// lazily on first use (8 KiB).
+static uint16_t g_b64url_pairs[4096];
+static int g_b64url_pairs_ready = 0;
+
+static void x07_ext_b64url_pairs_init(void) {
+    for (uint32_t v = 0; v < 4096u; v++) {
+        uint8_t c[2];
+        c[0] = (uint8_t)x07_ext_b64url_tbl[(v >> 6) & 0x3fu];
+        c[1] = (uint8_t)x07_ext_b64url_tbl[v & 0x3fu];
+        memcpy(&g_b64url_pairs[v], c, 2);
+    }
+    g_b64url_pairs_ready = 1;
+}
+
+static size_t x07_ext_b64url_encode_into(const uint8_t* data, size_t len, char* out) {
+    if (!g_b64url_pairs_ready) x07_ext_b64url_pairs_init();
+
+    size_t i = 0u;
+    size_t j = 0u;
+    while (i + 3u <= len) {
+        uint32_t v = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1u] << 8) | (uint32_t)data[i + 2u];
+        memcpy(out + j, &g_b64url_pairs[(v >> 12) & 0xfffu], 2);
+        memcpy(out + j + 2u, &g_b64url_pairs[v & 0xfffu], 2);
+        i += 3u;
+        j += 4u;
+    }
+
+    size_t rem = len - i;
+    if (rem == 1u) {
+        uint32_t v = ((uint32_t)data[i] << 4);
+        memcpy(out + j, &g_b64url_pairs[v & 0xfffu], 2);
+        j += 2u;
+    } else if (rem == 2u) {
+        uint32_t v = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1u] << 8);
+        memcpy(out + j, &g_b64url_pairs[(v >> 12) & 0xfffu], 2);
+        out[j + 2u] = x07_ext_b64url_tbl[(v >> 6) & 0x3fu];
+        j += 3u;
+    }
+    return j;
+}
+
+static char* x07_ext_b64url_nopad(const uint8_t* data, size_t len, size_t* out_len) {
+    if (!data && len != 0u) return (char*)0;
+
+    size_t cap = ((len + 2u) / 3u) * 4u;
+    char* out = (char*)malloc(cap + 1u);
+    if (!out) return (char*)0;
+
+    size_t j = x07_ext_b64url_encode_into(data, len, out);
+    out[j] = '\0';
+    if (out_len) *out_len = j;
+    return out;
+}
+
+// Character -> 6-bit value; 0xff marks anything outside the url-safe
+// alphabet (including '=' padding, which nopad input must not carry).
+static uint8_t g_b64url_rev[256];
+static int g_b64url_rev_ready = 0;
+
+static void x07_ext_b64url_rev_init(void) {
+    memset(g_b64url_rev, 0xff, sizeof(g_b64url_rev));
+    for (uint8_t v = 0; v < 64u; v++) {
+        g_b64url_rev[(uint8_t)x07_ext_b64url_tbl[v]] = v;
+    }
+    g_b64url_rev_ready = 1;
+}
+
+// Decodes base64url (no padding) into out; returns the decoded length,
+// or (size_t)-1 on malformed input. out must hold (len / 4) * 3 + 2.
+static size_t x07_ext_b64url_decode_into(const uint8_t* data, size_t len, uint8_t* out) {
+    if (!g_b64url_rev_ready) x07_ext_b64url_rev_init();
+    if (len % 4u == 1u) return (size_t)-1;
+
+    size_t i = 0u;
+    size_t j = 0u;
+    uint32_t bad = 0;
+    while (i + 4u <= len) {
+        uint32_t a = g_b64url_rev[data[i]];
+        uint32_t b = g_b64url_rev[data[i + 1u]];
+        uint32_t c = g_b64url_rev[data[i + 2u]];
+        uint32_t d = g_b64url_rev[data[i + 3u]];
+        bad |= a | b | c | d;
+        uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+        out[j] = (uint8_t)(v >> 16);
+        out[j + 1u] = (uint8_t)(v >> 8);
+        out[j + 2u] = (uint8_t)v;
+        i += 4u;
+        j += 3u;
+    }
+    if (bad & 0x80u) return (size_t)-1;
+
+    size_t rem = len - i;
+    if (rem == 2u) {
+        uint32_t a = g_b64url_rev[data[i]];
+        uint32_t b = g_b64url_rev[data[i + 1u]];
+        if ((a | b) & 0x80u) return (size_t)-1;
+        if (b & 0x0fu) return (size_t)-1; // stray bits
+        out[j++] = (uint8_t)((a << 2) | (b >> 4));
+    } else if (rem == 3u) {
+        uint32_t a = g_b64url_rev[data[i]];
+        uint32_t b = g_b64url_rev[data[i + 1u]];
+        uint32_t c = g_b64url_rev[data[i + 2u]];
+        if ((a | b | c) & 0x80u) return (size_t)-1;
+        if (c & 0x03u) return (size_t)-1; // stray bits
+        out[j++] = (uint8_t)((a << 2) | (b >> 4));
+        out[j++] = (uint8_t)((b << 4) | (c >> 2));
+    }
+    return j;
+}
+
+static char* x07_ext_bn_b64url(const BIGNUM* bn, size_t* out_len) {
+    if (!bn) return (char*)0;
+    int bits = BN_num_bits(bn);
+    int n = bits <= 0 ? 1 : ((bits + 7) / 8);
+    if (n <= 0) return (char*)0;
+    uint8_t* raw = (uint8_t*)malloc((size_t)n);
+    if (!raw) return (char*)0;
+    if (bits <= 0) {
+        raw[0] = 0;
+    } else if (BN_bn2bin(bn, raw) != n) {
+        free(raw);
+        return (char*)0;
+    }
+    char* out = x07_ext_b64url_nopad(raw, (size_t)n, out_len);
+    free(raw);
+    return out;
+}
+
+// Encodes data as base64url without padding; returns a buf handle or 0.
+int32_t x07_ext_openssl_b64url_encode_alloc(const uint8_t* data, uint32_t len) {
+    if (!data && len != 0u) return 0;
+    if (len > 1073741823u) return 0; // output length must fit uint32_t
+
+    size_t cap = (((size_t)len + 2u) / 3u) * 4u;
+    uint8_t* out = (uint8_t*)malloc(cap ? cap : 1u);
+    if (!out) return 0;
+
+    size_t out_len = x07_ext_b64url_encode_into(data, (size_t)len, (char*)out);
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+// Decodes base64url (no padding); returns a buf handle, or 0 on
+// malformed input.
+int32_t x07_ext_openssl_b64url_decode_alloc(const uint8_t* data, uint32_t len) {
+    if (!data && len != 0u) return 0;
+
+    size_t cap = ((size_t)len / 4u) * 3u + 2u;
+    uint8_t* out = (uint8_t*)malloc(cap);
+    if (!out) return 0;
+
+    size_t out_len = x07_ext_b64url_decode_into(data, (size_t)len, out);
+    if (out_len == (size_t)-1) {
+        free(out);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+// AEAD seal/open with reusable cipher contexts. A handle binds a key to
+// an EVP_CIPHER_CTX that lives for the handle's lifetime, so the AES key
+// schedule is computed once per key rather than once per record.
+// Sealed output is ciphertext || 16-byte tag in one buf slot.
+
+#define X07_EXT_OPENSSL_MAX_AEADS 256u
+
+#define X07_EXT_OPENSSL_AEAD_AES_256_GCM 1u
+#define X07_EXT_OPENSSL_AEAD_CHACHA20_POLY1305 2u
+
+#define X07_EXT_OPENSSL_AEAD_NONCE_LEN 12u
+#define X07_EXT_OPENSSL_AEAD_TAG_LEN 16u
+
+// EVP_CTRL_AEAD_{SET_IVLEN,GET_TAG,SET_TAG}
+#define X07_EXT_OPENSSL_CTRL_SET_IVLEN 0x9
+#define X07_EXT_OPENSSL_CTRL_GET_TAG 0x10
+#define X07_EXT_OPENSSL_CTRL_SET_TAG 0x11
+
+typedef struct {
+    EVP_CIPHER_CTX* ctx;
+    uint8_t key[32];
+    uint32_t alg; // 0 = slot free
+    int dir;      // last EVP direction keyed into ctx; -1 = none
+} x07ExtOpensslAeadSlot;
+
+static x07ExtOpensslAeadSlot g_aeads[X07_EXT_OPENSSL_MAX_AEADS];
+
+static const void* x07_ext_openssl_aead_cipher(uint32_t alg) {
+    if (alg == X07_EXT_OPENSSL_AEAD_AES_256_GCM) return EVP_aes_256_gcm();
+    if (alg == X07_EXT_OPENSSL_AEAD_CHACHA20_POLY1305) return EVP_chacha20_poly1305();
+    return (const void*)0;
+}
+
+// Returns an AEAD handle (>0) or 0. Both algorithms take 32-byte keys.
+uint32_t x07_ext_openssl_aead_init(uint32_t alg, const uint8_t* key, uint32_t key_len) {
+    if (!key || key_len != 32u) return 0;
+    if (!x07_ext_openssl_aead_cipher(alg)) return 0;
+
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_AEADS; i++) {
+        if (g_aeads[i].alg != 0) continue;
+        if (!g_aeads[i].ctx) {
+            g_aeads[i].ctx = EVP_CIPHER_CTX_new();
+            if (!g_aeads[i].ctx) return 0;
+        }
+        memcpy(g_aeads[i].key, key, 32u);
+        g_aeads[i].alg = alg;
+        g_aeads[i].dir = -1;
+        return i;
+    }
+    return 0;
+}
+
+void x07_ext_openssl_aead_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_AEADS) return;
+    memset(g_aeads[handle].key, 0, sizeof(g_aeads[handle].key));
+    g_aeads[handle].alg = 0;
+    g_aeads[handle].dir = -1;
+}
+
+// Readies the slot's ctx for one record in the given direction. Re-keys
+// only on the first use in a direction; otherwise just loads the nonce,
+// reusing the cached key schedule.
+static int x07_ext_openssl_aead_begin(x07ExtOpensslAeadSlot* s, int enc, const uint8_t* nonce) {
+    if (s->dir != enc) {
+        const void* cipher = x07_ext_openssl_aead_cipher(s->alg);
+        if (EVP_CipherInit_ex(s->ctx, cipher, NULL, NULL, NULL, enc) != 1) return 0;
+        if (EVP_CIPHER_CTX_ctrl(s->ctx, X07_EXT_OPENSSL_CTRL_SET_IVLEN,
+                                (int)X07_EXT_OPENSSL_AEAD_NONCE_LEN, NULL) != 1) {
+            return 0;
+        }
+        if (EVP_CipherInit_ex(s->ctx, NULL, NULL, s->key, NULL, enc) != 1) return 0;
+        s->dir = enc;
+    }
+    return EVP_CipherInit_ex(s->ctx, NULL, NULL, NULL, nonce, enc) == 1;
+}
+
+// Seals aad + (pt1 || pt2) into out (pt1_len + pt2_len + 16 bytes).
+// Two plaintext segments let header+body framing seal without an
+// assembly copy; pt2 may be NULL with pt2_len 0.
+static int x07_ext_openssl_aead_seal_into(
+    x07ExtOpensslAeadSlot* s,
+    const uint8_t* nonce,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pt1,
+    uint32_t pt1_len,
+    const uint8_t* pt2,
+    uint32_t pt2_len,
+    uint8_t* out
+) {
+    if (!x07_ext_openssl_aead_begin(s, 1, nonce)) return 0;
+
+    int outl = 0;
+    if (aad_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, NULL, &outl, aad, (int)aad_len) != 1) return 0;
+    }
+    uint8_t* w = out;
+    if (pt1_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, w, &outl, pt1, (int)pt1_len) != 1) return 0;
+        w += outl;
+    }
+    if (pt2_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, w, &outl, pt2, (int)pt2_len) != 1) return 0;
+        w += outl;
+    }
+    if (EVP_CipherFinal_ex(s->ctx, w, &outl) != 1) return 0;
+    w += outl;
+    if ((size_t)(w - out) != (size_t)pt1_len + (size_t)pt2_len) return 0;
+    if (EVP_CIPHER_CTX_ctrl(s->ctx, X07_EXT_OPENSSL_CTRL_GET_TAG,
+                            (int)X07_EXT_OPENSSL_AEAD_TAG_LEN, w) != 1) {
+        return 0;
+    }
+    return 1;
+}
+
+static x07ExtOpensslAeadSlot* x07_ext_openssl_aead_get(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_AEADS) return (x07ExtOpensslAeadSlot*)0;
+    if (g_aeads[handle].alg == 0) return (x07ExtOpensslAeadSlot*)0;
+    return &g_aeads[handle];
+}
+
+// Seals one record with a header and body segment; returns a buf handle
+// holding ciphertext || tag, or 0.
+int32_t x07_ext_openssl_aead_seal2_alloc(
+    uint32_t handle,
+    const uint8_t* nonce,
+    uint32_t nonce_len,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pt1,
+    uint32_t pt1_len,
+    const uint8_t* pt2,
+    uint32_t pt2_len
+) {
+    x07ExtOpensslAeadSlot* s = x07_ext_openssl_aead_get(handle);
+    if (!s) return 0;
+    if (!nonce || nonce_len != X07_EXT_OPENSSL_AEAD_NONCE_LEN) return 0;
+    if (!aad && aad_len != 0) return 0;
+    if ((!pt1 && pt1_len != 0) || (!pt2 && pt2_len != 0)) return 0;
+    if (aad_len > 2147483647u || pt1_len > 1073741823u || pt2_len > 1073741823u) return 0;
+
+    size_t out_len = (size_t)pt1_len + (size_t)pt2_len + X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    uint8_t* out = (uint8_t*)malloc(out_len);
+    if (!out) return 0;
+
+    if (!x07_ext_openssl_aead_seal_into(s, nonce, aad, aad_len, pt1, pt1_len, pt2, pt2_len, out)) {
+        free(out);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_aead_seal_alloc(
+    uint32_t handle,
+    const uint8_t* nonce,
+    uint32_t nonce_len,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pt,
+    uint32_t pt_len
+) {
+    return x07_ext_openssl_aead_seal2_alloc(handle, nonce, nonce_len, aad, aad_len, pt, pt_len, NULL, 0);
+}
+
+// Seals count records sharing one aad in a single call; nonces is
+// count * 12 bytes, pts holds the plaintexts back to back with their
+// lengths in pt_lens. Returns a buf handle holding the sealed records
+// back to back (each pt_lens[i] + 16 bytes), or 0.
+int32_t x07_ext_openssl_aead_seal_batch_alloc(
+    uint32_t handle,
+    uint32_t count,
+    const uint8_t* nonces,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pts,
+    const uint32_t* pt_lens
+) {
+    x07ExtOpensslAeadSlot* s = x07_ext_openssl_aead_get(handle);
+    if (!s) return 0;
+    if (count == 0 || count > 65536u) return 0;
+    if (!nonces || !pt_lens) return 0;
+    if (!aad && aad_len != 0) return 0;
+    if (aad_len > 2147483647u) return 0;
+
+    size_t total_pt = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (pt_lens[i] > 1073741823u) return 0;
+        total_pt += pt_lens[i];
+    }
+    if (!pts && total_pt != 0) return 0;
+    size_t out_len = total_pt + (size_t)count * X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    if (out_len > 4294967295u) return 0;
+
+    uint8_t* out = (uint8_t*)malloc(out_len ? out_len : 1u);
+    if (!out) return 0;
+
+    const uint8_t* r = pts;
+    uint8_t* w = out;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!x07_ext_openssl_aead_seal_into(s, nonces + (size_t)i * X07_EXT_OPENSSL_AEAD_NONCE_LEN,
+                                            aad, aad_len, r, pt_lens[i], NULL, 0, w)) {
+            free(out);
+            return 0;
+        }
+        r += pt_lens[i];
+        w += pt_lens[i] + X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+// Opens ciphertext || tag; returns a buf handle holding the plaintext,
+// or 0 on authentication failure (no partial output escapes).
+int32_t x07_ext_openssl_aead_open_alloc(
+    uint32_t handle,
+    const uint8_t* nonce,
+    uint32_t nonce_len,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* ct,
+    uint32_t ct_len
+) {
+    x07ExtOpensslAeadSlot* s = x07_ext_openssl_aead_get(handle);
+    if (!s) return 0;
+    if (!nonce || nonce_len != X07_EXT_OPENSSL_AEAD_NONCE_LEN) return 0;
+    if (!aad && aad_len != 0) return 0;
+    if (!ct || ct_len < X07_EXT_OPENSSL_AEAD_TAG_LEN) return 0;
+    if (aad_len > 2147483647u || ct_len > 2147483647u) return 0;
+
+    uint32_t pt_len = ct_len - X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    uint8_t* out = (uint8_t*)malloc(pt_len ? pt_len : 1u);
+    if (!out) return 0;
+
+    if (!x07_ext_openssl_aead_begin(s, 0, nonce)) {
+        free(out);
+        return 0;
+    }
+
+    int outl = 0;
+    int ok = 1;
+    if (aad_len != 0 && EVP_CipherUpdate(s->ctx, NULL, &outl, aad, (int)aad_len) != 1) ok = 0;
+    uint8_t* w = out;
+    if (ok && pt_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, w, &outl, ct, (int)pt_len) != 1) ok = 0;
+        else w += outl;
+    }
+    uint8_t tag[X07_EXT_OPENSSL_AEAD_TAG_LEN];
+    memcpy(tag, ct + pt_len, sizeof(tag));
+    if (ok && EVP_CIPHER_CTX_ctrl(s->ctx, X07_EXT_OPENSSL_CTRL_SET_TAG,
+                                  (int)sizeof(tag), tag) != 1) {
+        ok = 0;
+    }
+    if (ok && EVP_CipherFinal_ex(s->ctx, w, &outl) != 1) ok = 0;
+    if (ok) w += outl;
+    if (ok && (size_t)(w - out) != (size_t)pt_len) ok = 0;
+    if (!ok) {
+        free(out);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = pt_len;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_rand_bytes_alloc(uint32_t len, uint32_t* out_handle) {
+    if (out_handle) *out_handle = 0;
+
+    uint32_t doc_len = 0;
+
+    if (len > 1024u * 1024u) {
+        uint8_t* doc = x07_ext_make_err_doc(3, &doc_len);
+        if (!doc) return -1;
+        uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+        if (!slot) {
+            free(doc);
+            return -1;
+        }
+        g_bufs[slot] = doc;
+        g_lens[slot] = doc_len;
+        if (out_handle) *out_handle = slot;
+        return 0;
+    }
+
+    uint32_t need = 1u + len;
+    uint8_t* doc = (uint8_t*)malloc((size_t)need);
+    if (!doc) return -1;
+    doc[0] = 1;
+    if (len != 0) {
+        if (RAND_bytes(doc + 1, (int)len) != 1) {
+            free(doc);
+            doc = x07_ext_make_err_doc(1, &doc_len);
+            if (!doc) return -1;
+            need = doc_len;
+        }
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(doc);
+        return -1;
+    }
+    g_bufs[slot] = doc;
+    g_lens[slot] = need;
+    if (out_handle) *out_handle = slot;
+    return 0;
+}
+
+int32_t x07_ext_openssl_rand_bytes(uint8_t* out, uint32_t len) {
+    if (len == 0) return 1;
+    if (!out) return 0;
+    if (len > 2147483647u) return 0;
+    return RAND_bytes(out, (int)len) == 1 ? 1 : 0;
+}
+
+int32_t x07_ext_openssl_ed25519_verify(
+    const uint8_t* pk,
+    uint32_t pk_len,
+    const uint8_t* msg,
+    uint32_t msg_len,
+    const uint8_t* sig,
+    uint32_t sig_len
+) {
+    if (!pk || !sig) return 0;
+    if (pk_len != 32u || sig_len != 64u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!msg && msg_len == 0) msg = &zero;
+
+    int nid = OBJ_txt2nid("ED25519");
+    if (nid <= 0) return 0;
+
+    EVP_PKEY* pkey = EVP_PKEY_new_raw_public_key(nid, NULL, pk, (size_t)pk_len);
+    if (!pkey) return 0;
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    if (EVP_DigestVerifyInit(ctx, NULL, NULL, NULL, pkey) != 1) {
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    int ok = EVP_DigestVerify(ctx, sig, (size_t)sig_len, msg, (size_t)msg_len) == 1 ? 1 : 0;
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return ok;
+}
+
+int32_t x07_ext_openssl_ed25519_sign(
+    const uint8_t* sk,
+    uint32_t sk_len,
+    const uint8_t* msg,
+    uint32_t msg_len,
+    uint8_t* out_sig,
+    uint32_t out_sig_len
+) {
+    if (!sk || !out_sig) return 0;
+    if (sk_len != 32u || out_sig_len != 64u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!msg && msg_len == 0) msg = &zero;
+
+    int nid = OBJ_txt2nid("ED25519");
+    if (nid <= 0) return 0;
+
+    EVP_PKEY* pkey = EVP_PKEY_new_raw_private_key(nid, NULL, sk, (size_t)sk_len);
+    if (!pkey) return 0;
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    if (EVP_DigestSignInit(ctx, NULL, NULL, NULL, pkey) != 1) {
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    size_t siglen = (size_t)out_sig_len;
+    int ok = EVP_DigestSign(ctx, out_sig, &siglen, msg, (size_t)msg_len) == 1 ? 1 : 0;
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    if (!ok) return 0;
+    return siglen == 64u ? 1 : 0;
+}
+
+int32_t x07_ext_openssl_ed25519_sign_alloc(
+    const uint8_t* sk,
+    uint32_t sk_len,
+    const uint8_t* msg,
+    uint32_t msg_len
+) {
+    if (!sk) return 0;
+    if (sk_len != 32u) return 0;
+
+    uint8_t* sig = (uint8_t*)malloc(64);
+    if (!sig) return 0;
+    if (x07_ext_openssl_ed25519_sign(sk, sk_len, msg, msg_len, sig, 64u) != 1) {
+        free(sig);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(sig);
+        return 0;
+    }
+    g_bufs[slot] = sig;
+    g_lens[slot] = 64u;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_ed25519_pk_from_seed_alloc(
+    const uint8_t* sk,
+    uint32_t sk_len
+) {
+    if (!sk) return 0;
+    if (sk_len != 32u) return 0;
+
+    int nid = OBJ_txt2nid("ED25519");
+    if (nid <= 0) return 0;
+
+    EVP_PKEY* sk_pkey = EVP_PKEY_new_raw_private_key(nid, NULL, sk, (size_t)sk_len);
+    if (!sk_pkey) return 0;
+
+    uint8_t pk[32];
+    size_t pk_len = sizeof(pk);
+    if (EVP_PKEY_get_raw_public_key(sk_pkey, pk, &pk_len) != 1 || pk_len != 32u) {
+        EVP_PKEY_free(sk_pkey);
+        return 0;
+    }
+    EVP_PKEY_free(sk_pkey);
+
+    uint8_t* out = (uint8_t*)malloc(32u);
+    if (!out) return 0;
+    memcpy(out, pk, 32u);
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = 32u;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_ed25519_verify_sk(
+    const uint8_t* sk,
+    uint32_t sk_len,
+    const uint8_t* msg,
+    uint32_t msg_len,
+    const uint8_t* sig,
+    uint32_t sig_len
+) {
+    if (!sk || !sig) return 0;
+    if (sk_len != 32u || sig_len != 64u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!msg && msg_len == 0) msg = &zero;
+
+    int nid = OBJ_txt2nid("ED25519");
+    if (nid <= 0) return 0;
+
+    EVP_PKEY* sk_pkey = EVP_PKEY_new_raw_private_key(nid, NULL, sk, (size_t)sk_len);
+    if (!sk_pkey) return 0;
+
+    uint8_t pk[32];
+    size_t pk_len = sizeof(pk);
+    if (EVP_PKEY_get_raw_public_key(sk_pkey, pk, &pk_len) != 1 || pk_len != 32u) {
+        EVP_PKEY_free(sk_pkey);
+        return 0;
+    }
+
+    EVP_PKEY* pk_pkey = EVP_PKEY_new_raw_public_key(nid, NULL, pk, pk_len);
+    EVP_PKEY_free(sk_pkey);
+    if (!pk_pkey) return 0;
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        EVP_PKEY_free(pk_pkey);
+        return 0;
+    }
+
+    if (EVP_DigestVerifyInit(ctx, NULL, NULL, NULL, pk_pkey) != 1) {
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pk_pkey);
+        return 0;
+    }
+
+    int ok = EVP_DigestVerify(ctx, sig, (size_t)sig_len, msg, (size_t)msg_len) == 1 ? 1 : 0;
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pk_pkey);
+    return ok;
+}
+
+int32_t x07_ext_openssl_rsa_pkcs1_sha256_verify(
+    const uint8_t* n,
+    uint32_t n_len,
+    const uint8_t* e,
+    uint32_t e_len,
+    const uint8_t* msg,
+    uint32_t msg_len,
+    const uint8_t* sig,
+    uint32_t sig_len
+) {
+    if (!n || !e || !sig) return 0;
+    if (n_len == 0u || e_len == 0u || sig_len == 0u) return 0;
+    if (sig_len != n_len) return 0;
+    if (n_len > 2147483647u || e_len > 2147483647u || msg_len > 2147483647u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!msg && msg_len == 0) msg = &zero;
+
+    RSA* rsa = RSA_new();
+    if (!rsa) return 0;
+
+    BIGNUM* bn_n = BN_bin2bn(n, (int)n_len, NULL);
+    BIGNUM* bn_e = BN_bin2bn(e, (int)e_len, NULL);
+    if (!bn_n || !bn_e) {
+        if (bn_n) BN_free(bn_n);
+        if (bn_e) BN_free(bn_e);
+        RSA_free(rsa);
+        return 0;
+    }
+
+    if (RSA_set0_key(rsa, bn_n, bn_e, NULL) != 1) {
+        BN_free(bn_n);
+        BN_free(bn_e);
+        RSA_free(rsa);
+        return 0;
+    }
+
+    EVP_PKEY* pkey = EVP_PKEY_new();
+    if (!pkey) {
+        RSA_free(rsa);
+        return 0;
+    }
+    if (EVP_PKEY_set1_RSA(pkey, rsa) != 1) {
+        EVP_PKEY_free(pkey);
+        RSA_free(rsa);
+        return 0;
+    }
+    RSA_free(rsa);
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    if (EVP_DigestVerifyInit(ctx, NULL, EVP_sha256(), NULL, pkey) != 1) {
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    int ok = EVP_DigestVerify(ctx, sig, (size_t)sig_len, msg, (size_t)msg_len) == 1 ? 1 : 0;
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    return ok;
+}
+
+int32_t x07_ext_openssl_rsa_pkcs1_sha256_sign_alloc(
+    const uint8_t* n,
+    uint32_t n_len,
+    const uint8_t* e,
+    uint32_t e_len,
+    const uint8_t* d,
+    uint32_t d_len,
+    const uint8_t* msg,
+    uint32_t msg_len
+) {
+    if (!n || !e || !d) return 0;
+    if (n_len == 0u || e_len == 0u || d_len == 0u) return 0;
+    if (n_len > 2147483647u || e_len > 2147483647u || d_len > 2147483647u || msg_len > 2147483647u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!msg && msg_len == 0) msg = &zero;
+
+    RSA* rsa = RSA_new();
+    if (!rsa) return 0;
+
+    BIGNUM* bn_n = BN_bin2bn(n, (int)n_len, NULL);
+    BIGNUM* bn_e = BN_bin2bn(e, (int)e_len, NULL);
+    BIGNUM* bn_d = BN_bin2bn(d, (int)d_len, NULL);
+    if (!bn_n || !bn_e || !bn_d) {
+        if (bn_n) BN_free(bn_n);
+        if (bn_e) BN_free(bn_e);
+        if (bn_d) BN_free(bn_d);
+        RSA_free(rsa);
+        return 0;
+    }
+
+    if (RSA_set0_key(rsa, bn_n, bn_e, bn_d) != 1) {
+        BN_free(bn_n);
+        BN_free(bn_e);
+        BN_free(bn_d);
+        RSA_free(rsa);
+        return 0;
+    }
+
+    EVP_PKEY* pkey = EVP_PKEY_new();
+    if (!pkey) {
+        RSA_free(rsa);
+        return 0;
+    }
+    if (EVP_PKEY_set1_RSA(pkey, rsa) != 1) {
+        EVP_PKEY_free(pkey);
+        RSA_free(rsa);
+        return 0;
+    }
+    RSA_free(rsa);
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    if (EVP_DigestSignInit(ctx, NULL, EVP_sha256(), NULL, pkey) != 1) {
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    uint8_t* sig = (uint8_t*)malloc(n_len);
+    if (!sig) {
+        EVP_MD_CTX_free(ctx);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    size_t siglen = (size_t)n_len;
+    int ok = EVP_DigestSign(ctx, sig, &siglen, msg, (size_t)msg_len) == 1 ? 1 : 0;
+    EVP_MD_CTX_free(ctx);
+    EVP_PKEY_free(pkey);
+    if (!ok || siglen != (size_t)n_len) {
+        free(sig);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(sig);
+        return 0;
+    }
+    g_bufs[slot] = sig;
+    g_lens[slot] = n_len;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_rsa_rs256_private_jwk_generate_alloc(int32_t bits) {
+    if (bits < 2048) bits = 2048;
+    if (bits > 8192) return 0;
+
+    RSA* rsa = RSA_new();
+    if (!rsa) return 0;
+    BIGNUM* e = BN_new();
+    if (!e) {
+        RSA_free(rsa);
+        return 0;
+    }
+    if (BN_set_word(e, 65537ul) != 1) {
+        BN_free(e);
+        RSA_free(rsa);
+        return 0;
+    }
+    if (RSA_generate_key_ex(rsa, bits, e, NULL) != 1) {
+        BN_free(e);
+        RSA_free(rsa);
+        return 0;
+    }
+    BN_free(e);
+
+    const BIGNUM* n_bn = (const BIGNUM*)0;
+    const BIGNUM* e_bn = (const BIGNUM*)0;
+    const BIGNUM* d_bn = (const BIGNUM*)0;
+    const BIGNUM* p_bn = (const BIGNUM*)0;
+    const BIGNUM* q_bn = (const BIGNUM*)0;
+    const BIGNUM* dp_bn = (const BIGNUM*)0;
+    const BIGNUM* dq_bn = (const BIGNUM*)0;
+    const BIGNUM* qi_bn = (const BIGNUM*)0;
+    RSA_get0_key(rsa, &n_bn, &e_bn, &d_bn);
+    RSA_get0_factors(rsa, &p_bn, &q_bn);
+    RSA_get0_crt_params(rsa, &dp_bn, &dq_bn, &qi_bn);
+    if (!n_bn || !e_bn || !d_bn || !p_bn || !q_bn || !dp_bn || !dq_bn || !qi_bn) {
+        RSA_free(rsa);
+        return 0;
+    }
+
+    size_t n_len = 0u, e_len2 = 0u, d_len = 0u, p_len = 0u, q_len = 0u, dp_len = 0u, dq_len = 0u, qi_len = 0u;
+    char* n = x07_ext_bn_b64url(n_bn, &n_len);
+    char* e_s = x07_ext_bn_b64url(e_bn, &e_len2);
+    char* d = x07_ext_bn_b64url(d_bn, &d_len);
+    char* p = x07_ext_bn_b64url(p_bn, &p_len);
+    char* q = x07_ext_bn_b64url(q_bn, &q_len);
+    char* dp = x07_ext_bn_b64url(dp_bn, &dp_len);
+    char* dq = x07_ext_bn_b64url(dq_bn, &dq_len);
+    char* qi = x07_ext_bn_b64url(qi_bn, &qi_len);
+    if (!n || !e_s || !d || !p || !q || !dp || !dq || !qi) {
+        if (n) free(n);
+        if (e_s) free(e_s);
+        if (d) free(d);
+        if (p) free(p);
+        if (q) free(q);
+        if (dp) free(dp);
+        if (dq) free(dq);
+        if (qi) free(qi);
+        RSA_free(rsa);
+        return 0;
+    }
+
+    const char* a0 = "{\"kty\":\"RSA\",\"n\":\"";
+    const char* a1 = "\",\"e\":\"";
+    const char* a2 = "\",\"d\":\"";
+    const char* a3 = "\",\"p\":\"";
+    const char* a4 = "\",\"q\":\"";
+    const char* a5 = "\",\"dp\":\"";
+    const char* a6 = "\",\"dq\":\"";
+    const char* a7 = "\",\"qi\":\"";
+    const char* a8 = "\"}\n";
+
+    size_t total = strlen(a0) + n_len + strlen(a1) + e_len2 + strlen(a2) + d_len + strlen(a3) + p_len +
+                   strlen(a4) + q_len + strlen(a5) + dp_len + strlen(a6) + dq_len + strlen(a7) + qi_len +
+                   strlen(a8);
+    uint8_t* out = (uint8_t*)malloc(total);
+    if (!out) {
+        free(n);
+        free(e_s);
+        free(d);
+        free(p);
+        free(q);
+        free(dp);
+        free(dq);
+        free(qi);
+        RSA_free(rsa);
+        return 0;
+    }
+
+    uint8_t* w = out;
+    memcpy(w, a0, strlen(a0));
+    w += strlen(a0);
+    memcpy(w, n, n_len);
+    w += n_len;
+    memcpy(w, a1, strlen(a1));
+    w += strlen(a1);
+    memcpy(w, e_s, e_len2);
+    w += e_len2;
+    memcpy(w, a2, strlen(a2));
+    w += strlen(a2);
+    memcpy(w, d, d_len);
+    w += d_len;
+    memcpy(w, a3, strlen(a3));
+    w += strlen(a3);
+    memcpy(w, p, p_len);
+    w += p_len;
+    memcpy(w, a4, strlen(a4));
+    w += strlen(a4);
+    memcpy(w, q, q_len);
+    w += q_len;
+    memcpy(w, a5, strlen(a5));
+    w += strlen(a5);
+    memcpy(w, dp, dp_len);
+    w += dp_len;
+    memcpy(w, a6, strlen(a6));
+    w += strlen(a6);
+    memcpy(w, dq, dq_len);
+    w += dq_len;
+    memcpy(w, a7, strlen(a7));
+    w += strlen(a7);
+    memcpy(w, qi, qi_len);
+    w += qi_len;
+    memcpy(w, a8, strlen(a8));
+    w += strlen(a8);
+
+    free(n);
+    free(e_s);
+    free(d);
+    free(p);
+    free(q);
+    free(dp);
+    free(dq);
+    free(qi);
+    RSA_free(rsa);
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)total;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_ecdsa_p256_sha256_verify_rawsig(
+    const uint8_t* x,
+    uint32_t x_len,
+    const uint8_t* y,
+    uint32_t y_len,
+    const uint8_t* msg,
+    uint32_t msg_len,
+    const uint8_t* sig,
+    uint32_t sig_len
+) {
+    if (!x || !y || !sig) return 0;
+    if (x_len != 32u || y_len != 32u || sig_len != 64u) return 0;
+    if (msg_len > 2147483647u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!msg && msg_len == 0) msg = &zero;
+
+    int nid = OBJ_txt2nid("prime256v1");
+    if (nid <= 0) return 0;
+
+    EC_KEY* ec = EC_KEY_new_by_curve_name(nid);
+    if (!ec) return 0;
+
+    BIGNUM* bn_x = BN_bin2bn(x, (int)x_len, NULL);
+    BIGNUM* bn_y = BN_bin2bn(y, (int)y_len, NULL);
+    if (!bn_x || !bn_y) {
+        if (bn_x) BN_free(bn_x);
+        if (bn_y) BN_free(bn_y);
+        EC_KEY_free(ec);
+        return 0;
+    }
+
+    if (EC_KEY_set_public_key_affine_coordinates(ec, bn_x, bn_y) != 1) {
+        BN_free(bn_x);
+        BN_free(bn_y);
+        EC_KEY_free(ec);
+        return 0;
+    }
+
+    BN_free(bn_x);
+    BN_free(bn_y);
+
+    if (EC_KEY_check_key(ec) != 1) {
+        EC_KEY_free(ec);
+        return 0;
+    }
+
+    EVP_PKEY* pkey = EVP_PKEY_new();
+    if (!pkey) {
+        EC_KEY_free(ec);
+        return 0;
+    }
+    if (EVP_PKEY_set1_EC_KEY(pkey, ec) != 1) {
+        EVP_PKEY_free(pkey);
+        EC_KEY_free(ec);
+        return 0;
+    }
+    EC_KEY_free(ec);
+
+    ECDSA_SIG* ecdsa_sig = ECDSA_SIG_new();
+    if (!ecdsa_sig) {
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    BIGNUM* r = BN_bin2bn(sig, 32, NULL);
+    BIGNUM* s = BN_bin2bn(sig + 32, 32, NULL);
+    if (!r || !s) {
+        if (r) BN_free(r);
+        if (s) BN_free(s);
+        ECDSA_SIG_free(ecdsa_sig);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    if (ECDSA_SIG_set0(ecdsa_sig, r, s) != 1) {
+        BN_free(r);
+        BN_free(s);
+        ECDSA_SIG_free(ecdsa_sig);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    int der_len = i2d_ECDSA_SIG(ecdsa_sig, NULL);
+    if (der_len <= 0) {
+        ECDSA_SIG_free(ecdsa_sig);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    uint8_t* der = (uint8_t*)malloc((size_t)der_len);
+    if (!der) {
+        ECDSA_SIG_free(ecdsa_sig);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+    uint8_t* p = der;
+    if (i2d_ECDSA_SIG(ecdsa_sig, &p) != der_len) {
+        free(der);
+        ECDSA_SIG_free(ecdsa_sig);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+    ECDSA_SIG_free(ecdsa_sig);
+
+    EVP_MD_CTX* ctx = EVP_MD_CTX_new();
+    if (!ctx) {
+        free(der);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    if (EVP_DigestVerifyInit(ctx, NULL, EVP_sha256(), NULL, pkey) != 1) {
+        EVP_MD_CTX_free(ctx);
+        free(der);
+        EVP_PKEY_free(pkey);
+        return 0;
+    }
+
+    int ok = EVP_DigestVerify(ctx, der, (size_t)der_len, msg, (size_t)msg_len) == 1 ? 1 : 0;
+    EVP_MD_CTX_free(ctx);
+    free(der);
+    EVP_PKEY_free(pkey);
+    return ok;
+}
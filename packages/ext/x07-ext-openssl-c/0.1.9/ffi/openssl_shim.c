@@ -7,6 +7,7 @@ uint8_t* SHA256(const uint8_t* data, size_t len, uint8_t* md);
 uint8_t* SHA512(const uint8_t* data, size_t len, uint8_t* md);
 
 const void* EVP_sha256(void);
+const void* EVP_sha512(void);
 
 int RAND_bytes(uint8_t* buf, int num);
 
@@ -31,6 +32,19 @@ int EVP_DigestVerifyInit(EVP_MD_CTX* ctx, void** pctx, const void* type, void* e
 int EVP_DigestVerify(EVP_MD_CTX* ctx, const uint8_t* sig, size_t siglen, const uint8_t* tbs, size_t tbslen);
 int EVP_DigestSignInit(EVP_MD_CTX* ctx, void** pctx, const void* type, void* e, EVP_PKEY* pkey);
 int EVP_DigestSign(EVP_MD_CTX* ctx, uint8_t* sigret, size_t* siglen, const uint8_t* tbs, size_t tbslen);
+typedef struct evp_cipher_ctx_st EVP_CIPHER_CTX;
+const void* EVP_aes_256_gcm(void);
+const void* EVP_chacha20_poly1305(void);
+EVP_CIPHER_CTX* EVP_CIPHER_CTX_new(void);
+void EVP_CIPHER_CTX_free(EVP_CIPHER_CTX* ctx);
+int EVP_CipherInit_ex(EVP_CIPHER_CTX* ctx, const void* cipher, void* impl, const uint8_t* key, const uint8_t* iv, int enc);
+int EVP_CipherUpdate(EVP_CIPHER_CTX* ctx, uint8_t* out, int* outl, const uint8_t* in, int inl);
+int EVP_CipherFinal_ex(EVP_CIPHER_CTX* ctx, uint8_t* outm, int* outl);
+int EVP_CIPHER_CTX_ctrl(EVP_CIPHER_CTX* ctx, int type, int arg, void* ptr);
+
+int EVP_DigestInit_ex(EVP_MD_CTX* ctx, const void* type, void* impl);
+int EVP_DigestUpdate(EVP_MD_CTX* ctx, const void* d, size_t cnt);
+int EVP_DigestFinal_ex(EVP_MD_CTX* ctx, uint8_t* md, unsigned int* s);
 
 BIGNUM* BN_bin2bn(const uint8_t* s, int len, BIGNUM* ret);
 int BN_num_bits(const BIGNUM* a);
@@ -62,6 +76,13 @@ void ECDSA_SIG_free(ECDSA_SIG* sig);
 int ECDSA_SIG_set0(ECDSA_SIG* sig, BIGNUM* r, BIGNUM* s);
 int i2d_ECDSA_SIG(const ECDSA_SIG* sig, uint8_t** pp);
 
+typedef struct hmac_ctx_st HMAC_CTX;
+HMAC_CTX* HMAC_CTX_new(void);
+void HMAC_CTX_free(HMAC_CTX* ctx);
+int HMAC_Init_ex(HMAC_CTX* ctx, const void* key, int len, const void* md, void* impl);
+int HMAC_Update(HMAC_CTX* ctx, const uint8_t* data, size_t len);
+int HMAC_Final(HMAC_CTX* ctx, uint8_t* md, unsigned int* len);
+
 uint8_t* HMAC(
     const void* evp_md,
     const void* key,
@@ -103,6 +124,200 @@ uint8_t* x07_ext_openssl_hmac(
     return out;
 }
 
+// Incremental digest contexts. Streamed data (fs/socket reads) can be
+// hashed chunk-by-chunk instead of being concatenated into one buffer
+// for the one-shot x07_ext_openssl_sha256/sha512 entry points. Each slot
+// keeps its EVP_MD_CTX allocated across uses; EVP_DigestInit_ex resets
+// the context, so a busy caller never pays a ctx malloc after warm-up.
+
+#define X07_EXT_OPENSSL_MAX_DIGESTS 256u
+
+#define X07_EXT_OPENSSL_DIGEST_SHA256 1u
+#define X07_EXT_OPENSSL_DIGEST_SHA512 2u
+
+typedef struct {
+    EVP_MD_CTX* ctx;
+    uint32_t md_len; // 0 = slot free
+} x07ExtOpensslDigestSlot;
+
+static x07ExtOpensslDigestSlot g_digests[X07_EXT_OPENSSL_MAX_DIGESTS];
+
+// Returns a digest handle (>0) ready for updates, or 0 on failure.
+// alg is X07_EXT_OPENSSL_DIGEST_SHA256 or X07_EXT_OPENSSL_DIGEST_SHA512.
+uint32_t x07_ext_openssl_digest_init(uint32_t alg) {
+    const void* md;
+    uint32_t md_len;
+    if (alg == X07_EXT_OPENSSL_DIGEST_SHA256) {
+        md = EVP_sha256();
+        md_len = 32u;
+    } else if (alg == X07_EXT_OPENSSL_DIGEST_SHA512) {
+        md = EVP_sha512();
+        md_len = 64u;
+    } else {
+        return 0;
+    }
+    if (!md) return 0;
+
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_DIGESTS; i++) {
+        if (g_digests[i].md_len != 0) continue;
+        if (!g_digests[i].ctx) {
+            g_digests[i].ctx = EVP_MD_CTX_new();
+            if (!g_digests[i].ctx) return 0;
+        }
+        if (EVP_DigestInit_ex(g_digests[i].ctx, md, NULL) != 1) return 0;
+        g_digests[i].md_len = md_len;
+        return i;
+    }
+    return 0;
+}
+
+int32_t x07_ext_openssl_digest_update(uint32_t handle, const uint8_t* data, uint32_t len) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_DIGESTS) return 0;
+    if (g_digests[handle].md_len == 0) return 0;
+    if (len == 0) return 1;
+    if (!data) return 0;
+    return EVP_DigestUpdate(g_digests[handle].ctx, data, (size_t)len) == 1 ? 1 : 0;
+}
+
+// Writes the digest into md (md_cap must cover it) and releases the
+// handle; returns the digest length, or 0 on failure. The slot's ctx is
+// kept for the next init.
+uint32_t x07_ext_openssl_digest_final(uint32_t handle, uint8_t* md, uint32_t md_cap) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_DIGESTS) return 0;
+    uint32_t md_len = g_digests[handle].md_len;
+    if (md_len == 0) return 0;
+    g_digests[handle].md_len = 0;
+    if (!md || md_cap < md_len) return 0;
+
+    unsigned int out_len = 0;
+    if (EVP_DigestFinal_ex(g_digests[handle].ctx, md, &out_len) != 1) return 0;
+    return out_len == md_len ? md_len : 0;
+}
+
+// Abandons an in-flight digest without producing output.
+void x07_ext_openssl_digest_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_DIGESTS) return;
+    g_digests[handle].md_len = 0;
+}
+
+// Keyed HMAC handles. x07_ext_openssl_hmac re-derives the inner/outer
+// key pads on every call, which dominates when the same few keys sign
+// millions of short messages. A handle absorbs the key once; each sign
+// re-inits with a NULL key, which OpenSSL serves from the precomputed
+// pads, leaving only the compression-function work per message.
+
+#define X07_EXT_OPENSSL_MAX_HMACS 256u
+
+typedef struct {
+    HMAC_CTX* ctx;
+    uint32_t md_len; // 0 = slot free
+} x07ExtOpensslHmacSlot;
+
+static x07ExtOpensslHmacSlot g_hmacs[X07_EXT_OPENSSL_MAX_HMACS];
+
+// Returns an HMAC handle (>0) keyed for alg (same constants as
+// x07_ext_openssl_digest_init), or 0.
+uint32_t x07_ext_openssl_hmac_init(uint32_t alg, const uint8_t* key, uint32_t key_len) {
+    const void* md;
+    uint32_t md_len;
+    if (alg == X07_EXT_OPENSSL_DIGEST_SHA256) {
+        md = EVP_sha256();
+        md_len = 32u;
+    } else if (alg == X07_EXT_OPENSSL_DIGEST_SHA512) {
+        md = EVP_sha512();
+        md_len = 64u;
+    } else {
+        return 0;
+    }
+    if (!md) return 0;
+    if (!key && key_len != 0) return 0;
+    if (key_len > 2147483647u) return 0;
+
+    static const uint8_t zero = 0;
+    if (!key) key = &zero;
+
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_HMACS; i++) {
+        if (g_hmacs[i].md_len != 0) continue;
+        if (!g_hmacs[i].ctx) {
+            g_hmacs[i].ctx = HMAC_CTX_new();
+            if (!g_hmacs[i].ctx) return 0;
+        }
+        if (HMAC_Init_ex(g_hmacs[i].ctx, key, (int)key_len, md, NULL) != 1) return 0;
+        g_hmacs[i].md_len = md_len;
+        return i;
+    }
+    return 0;
+}
+
+void x07_ext_openssl_hmac_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_HMACS) return;
+    g_hmacs[handle].md_len = 0;
+}
+
+// Signs one message; writes the tag into md and returns its length, or
+// 0 on failure. The handle stays keyed for further signs.
+uint32_t x07_ext_openssl_hmac_sign(
+    uint32_t handle,
+    const uint8_t* data,
+    uint32_t len,
+    uint8_t* md,
+    uint32_t md_cap
+) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_HMACS) return 0;
+    uint32_t md_len = g_hmacs[handle].md_len;
+    if (md_len == 0) return 0;
+    if (!md || md_cap < md_len) return 0;
+    if (!data && len != 0) return 0;
+    if (len > 2147483647u) return 0;
+
+    HMAC_CTX* ctx = g_hmacs[handle].ctx;
+    if (HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) != 1) return 0;
+    if (len != 0 && HMAC_Update(ctx, data, (size_t)len) != 1) return 0;
+    unsigned int out_len = 0;
+    if (HMAC_Final(ctx, md, &out_len) != 1) return 0;
+    return out_len == md_len ? md_len : 0;
+}
+
+// Signs count messages in one call: the plaintexts sit back to back in
+// data with their lengths in lens, and the tags land back to back in
+// out_mds (count * tag length bytes). Returns the tag length, or 0.
+uint32_t x07_ext_openssl_hmac_sign_batch(
+    uint32_t handle,
+    uint32_t count,
+    const uint8_t* data,
+    const uint32_t* lens,
+    uint8_t* out_mds,
+    uint32_t out_mds_cap
+) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_HMACS) return 0;
+    uint32_t md_len = g_hmacs[handle].md_len;
+    if (md_len == 0) return 0;
+    if (count == 0 || count > 65536u) return 0;
+    if (!lens || !out_mds) return 0;
+    if ((uint64_t)count * md_len > out_mds_cap) return 0;
+
+    size_t total = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (lens[i] > 2147483647u) return 0;
+        total += lens[i];
+    }
+    if (!data && total != 0) return 0;
+
+    HMAC_CTX* ctx = g_hmacs[handle].ctx;
+    const uint8_t* r = data;
+    uint8_t* w = out_mds;
+    for (uint32_t i = 0; i < count; i++) {
+        if (HMAC_Init_ex(ctx, NULL, 0, NULL, NULL) != 1) return 0;
+        if (lens[i] != 0 && HMAC_Update(ctx, r, (size_t)lens[i]) != 1) return 0;
+        unsigned int out_len = 0;
+        if (HMAC_Final(ctx, w, &out_len) != 1) return 0;
+        if (out_len != md_len) return 0;
+        r += lens[i];
+        w += md_len;
+    }
+    return md_len;
+}
+
 #define X07_EXT_OPENSSL_MAX_BUFS 4096u
 
 static uint8_t* g_bufs[X07_EXT_OPENSSL_MAX_BUFS];
@@ -149,46 +364,121 @@ static uint8_t* x07_ext_make_err_doc(uint32_t code, uint32_t* out_len) {
     return buf;
 }
 
-static char x07_ext_b64url_char(uint8_t v) {
-    static const char tbl[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
-    return tbl[v & 0x3fu];
+static const char x07_ext_b64url_tbl[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+// 12 bits -> two output characters, so the hot encode loop does two table
+// loads and two stores per 3 input bytes instead of four of each. Built
+// lazily on first use (8 KiB).
+static uint16_t g_b64url_pairs[4096];
+static int g_b64url_pairs_ready = 0;
+
+static void x07_ext_b64url_pairs_init(void) {
+    for (uint32_t v = 0; v < 4096u; v++) {
+        uint8_t c[2];
+        c[0] = (uint8_t)x07_ext_b64url_tbl[(v >> 6) & 0x3fu];
+        c[1] = (uint8_t)x07_ext_b64url_tbl[v & 0x3fu];
+        memcpy(&g_b64url_pairs[v], c, 2);
+    }
+    g_b64url_pairs_ready = 1;
 }
 
-static char* x07_ext_b64url_nopad(const uint8_t* data, size_t len, size_t* out_len) {
-    if (!data && len != 0u) return (char*)0;
-
-    size_t cap = ((len + 2u) / 3u) * 4u;
-    char* out = (char*)malloc(cap + 1u);
-    if (!out) return (char*)0;
+static size_t x07_ext_b64url_encode_into(const uint8_t* data, size_t len, char* out) {
+    if (!g_b64url_pairs_ready) x07_ext_b64url_pairs_init();
 
     size_t i = 0u;
     size_t j = 0u;
     while (i + 3u <= len) {
         uint32_t v = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1u] << 8) | (uint32_t)data[i + 2u];
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 18) & 0x3f));
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 12) & 0x3f));
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 6) & 0x3f));
-        out[j++] = x07_ext_b64url_char((uint8_t)(v & 0x3f));
+        memcpy(out + j, &g_b64url_pairs[(v >> 12) & 0xfffu], 2);
+        memcpy(out + j + 2u, &g_b64url_pairs[v & 0xfffu], 2);
         i += 3u;
+        j += 4u;
     }
 
     size_t rem = len - i;
     if (rem == 1u) {
-        uint32_t v = ((uint32_t)data[i] << 16);
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 18) & 0x3f));
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 12) & 0x3f));
+        uint32_t v = ((uint32_t)data[i] << 4);
+        memcpy(out + j, &g_b64url_pairs[v & 0xfffu], 2);
+        j += 2u;
     } else if (rem == 2u) {
         uint32_t v = ((uint32_t)data[i] << 16) | ((uint32_t)data[i + 1u] << 8);
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 18) & 0x3f));
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 12) & 0x3f));
-        out[j++] = x07_ext_b64url_char((uint8_t)((v >> 6) & 0x3f));
+        memcpy(out + j, &g_b64url_pairs[(v >> 12) & 0xfffu], 2);
+        out[j + 2u] = x07_ext_b64url_tbl[(v >> 6) & 0x3fu];
+        j += 3u;
     }
+    return j;
+}
+
+static char* x07_ext_b64url_nopad(const uint8_t* data, size_t len, size_t* out_len) {
+    if (!data && len != 0u) return (char*)0;
 
+    size_t cap = ((len + 2u) / 3u) * 4u;
+    char* out = (char*)malloc(cap + 1u);
+    if (!out) return (char*)0;
+
+    size_t j = x07_ext_b64url_encode_into(data, len, out);
     out[j] = '\0';
     if (out_len) *out_len = j;
     return out;
 }
 
+// Character -> 6-bit value; 0xff marks anything outside the url-safe
+// alphabet (including '=' padding, which nopad input must not carry).
+static uint8_t g_b64url_rev[256];
+static int g_b64url_rev_ready = 0;
+
+static void x07_ext_b64url_rev_init(void) {
+    memset(g_b64url_rev, 0xff, sizeof(g_b64url_rev));
+    for (uint8_t v = 0; v < 64u; v++) {
+        g_b64url_rev[(uint8_t)x07_ext_b64url_tbl[v]] = v;
+    }
+    g_b64url_rev_ready = 1;
+}
+
+// Decodes base64url (no padding) into out; returns the decoded length,
+// or (size_t)-1 on malformed input. out must hold (len / 4) * 3 + 2.
+static size_t x07_ext_b64url_decode_into(const uint8_t* data, size_t len, uint8_t* out) {
+    if (!g_b64url_rev_ready) x07_ext_b64url_rev_init();
+    if (len % 4u == 1u) return (size_t)-1;
+
+    size_t i = 0u;
+    size_t j = 0u;
+    uint32_t bad = 0;
+    while (i + 4u <= len) {
+        uint32_t a = g_b64url_rev[data[i]];
+        uint32_t b = g_b64url_rev[data[i + 1u]];
+        uint32_t c = g_b64url_rev[data[i + 2u]];
+        uint32_t d = g_b64url_rev[data[i + 3u]];
+        bad |= a | b | c | d;
+        uint32_t v = (a << 18) | (b << 12) | (c << 6) | d;
+        out[j] = (uint8_t)(v >> 16);
+        out[j + 1u] = (uint8_t)(v >> 8);
+        out[j + 2u] = (uint8_t)v;
+        i += 4u;
+        j += 3u;
+    }
+    if (bad & 0x80u) return (size_t)-1;
+
+    size_t rem = len - i;
+    if (rem == 2u) {
+        uint32_t a = g_b64url_rev[data[i]];
+        uint32_t b = g_b64url_rev[data[i + 1u]];
+        if ((a | b) & 0x80u) return (size_t)-1;
+        if (b & 0x0fu) return (size_t)-1; // stray bits
+        out[j++] = (uint8_t)((a << 2) | (b >> 4));
+    } else if (rem == 3u) {
+        uint32_t a = g_b64url_rev[data[i]];
+        uint32_t b = g_b64url_rev[data[i + 1u]];
+        uint32_t c = g_b64url_rev[data[i + 2u]];
+        if ((a | b | c) & 0x80u) return (size_t)-1;
+        if (c & 0x03u) return (size_t)-1; // stray bits
+        out[j++] = (uint8_t)((a << 2) | (b >> 4));
+        out[j++] = (uint8_t)((b << 4) | (c >> 2));
+    }
+    return j;
+}
+
 static char* x07_ext_bn_b64url(const BIGNUM* bn, size_t* out_len) {
     if (!bn) return (char*)0;
     int bits = BN_num_bits(bn);
@@ -207,6 +497,337 @@ static char* x07_ext_bn_b64url(const BIGNUM* bn, size_t* out_len) {
     return out;
 }
 
+// Encodes data as base64url without padding; returns a buf handle or 0.
+int32_t x07_ext_openssl_b64url_encode_alloc(const uint8_t* data, uint32_t len) {
+    if (!data && len != 0u) return 0;
+    if (len > 1073741823u) return 0; // output length must fit uint32_t
+
+    size_t cap = (((size_t)len + 2u) / 3u) * 4u;
+    uint8_t* out = (uint8_t*)malloc(cap ? cap : 1u);
+    if (!out) return 0;
+
+    size_t out_len = x07_ext_b64url_encode_into(data, (size_t)len, (char*)out);
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+// Decodes base64url (no padding); returns a buf handle, or 0 on
+// malformed input.
+int32_t x07_ext_openssl_b64url_decode_alloc(const uint8_t* data, uint32_t len) {
+    if (!data && len != 0u) return 0;
+
+    size_t cap = ((size_t)len / 4u) * 3u + 2u;
+    uint8_t* out = (uint8_t*)malloc(cap);
+    if (!out) return 0;
+
+    size_t out_len = x07_ext_b64url_decode_into(data, (size_t)len, out);
+    if (out_len == (size_t)-1) {
+        free(out);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+// AEAD seal/open with reusable cipher contexts. A handle binds a key to
+// an EVP_CIPHER_CTX that lives for the handle's lifetime, so the AES key
+// schedule is computed once per key rather than once per record.
+// Sealed output is ciphertext || 16-byte tag in one buf slot.
+
+#define X07_EXT_OPENSSL_MAX_AEADS 256u
+
+#define X07_EXT_OPENSSL_AEAD_AES_256_GCM 1u
+#define X07_EXT_OPENSSL_AEAD_CHACHA20_POLY1305 2u
+
+#define X07_EXT_OPENSSL_AEAD_NONCE_LEN 12u
+#define X07_EXT_OPENSSL_AEAD_TAG_LEN 16u
+
+// EVP_CTRL_AEAD_{SET_IVLEN,GET_TAG,SET_TAG}
+#define X07_EXT_OPENSSL_CTRL_SET_IVLEN 0x9
+#define X07_EXT_OPENSSL_CTRL_GET_TAG 0x10
+#define X07_EXT_OPENSSL_CTRL_SET_TAG 0x11
+
+typedef struct {
+    EVP_CIPHER_CTX* ctx;
+    uint8_t key[32];
+    uint32_t alg; // 0 = slot free
+    int dir;      // last EVP direction keyed into ctx; -1 = none
+} x07ExtOpensslAeadSlot;
+
+static x07ExtOpensslAeadSlot g_aeads[X07_EXT_OPENSSL_MAX_AEADS];
+
+static const void* x07_ext_openssl_aead_cipher(uint32_t alg) {
+    if (alg == X07_EXT_OPENSSL_AEAD_AES_256_GCM) return EVP_aes_256_gcm();
+    if (alg == X07_EXT_OPENSSL_AEAD_CHACHA20_POLY1305) return EVP_chacha20_poly1305();
+    return (const void*)0;
+}
+
+// Returns an AEAD handle (>0) or 0. Both algorithms take 32-byte keys.
+uint32_t x07_ext_openssl_aead_init(uint32_t alg, const uint8_t* key, uint32_t key_len) {
+    if (!key || key_len != 32u) return 0;
+    if (!x07_ext_openssl_aead_cipher(alg)) return 0;
+
+    for (uint32_t i = 1; i < X07_EXT_OPENSSL_MAX_AEADS; i++) {
+        if (g_aeads[i].alg != 0) continue;
+        if (!g_aeads[i].ctx) {
+            g_aeads[i].ctx = EVP_CIPHER_CTX_new();
+            if (!g_aeads[i].ctx) return 0;
+        }
+        memcpy(g_aeads[i].key, key, 32u);
+        g_aeads[i].alg = alg;
+        g_aeads[i].dir = -1;
+        return i;
+    }
+    return 0;
+}
+
+void x07_ext_openssl_aead_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_AEADS) return;
+    memset(g_aeads[handle].key, 0, sizeof(g_aeads[handle].key));
+    g_aeads[handle].alg = 0;
+    g_aeads[handle].dir = -1;
+}
+
+// Readies the slot's ctx for one record in the given direction. Re-keys
+// only on the first use in a direction; otherwise just loads the nonce,
+// reusing the cached key schedule.
+static int x07_ext_openssl_aead_begin(x07ExtOpensslAeadSlot* s, int enc, const uint8_t* nonce) {
+    if (s->dir != enc) {
+        const void* cipher = x07_ext_openssl_aead_cipher(s->alg);
+        if (EVP_CipherInit_ex(s->ctx, cipher, NULL, NULL, NULL, enc) != 1) return 0;
+        if (EVP_CIPHER_CTX_ctrl(s->ctx, X07_EXT_OPENSSL_CTRL_SET_IVLEN,
+                                (int)X07_EXT_OPENSSL_AEAD_NONCE_LEN, NULL) != 1) {
+            return 0;
+        }
+        if (EVP_CipherInit_ex(s->ctx, NULL, NULL, s->key, NULL, enc) != 1) return 0;
+        s->dir = enc;
+    }
+    return EVP_CipherInit_ex(s->ctx, NULL, NULL, NULL, nonce, enc) == 1;
+}
+
+// Seals aad + (pt1 || pt2) into out (pt1_len + pt2_len + 16 bytes).
+// Two plaintext segments let header+body framing seal without an
+// assembly copy; pt2 may be NULL with pt2_len 0.
+static int x07_ext_openssl_aead_seal_into(
+    x07ExtOpensslAeadSlot* s,
+    const uint8_t* nonce,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pt1,
+    uint32_t pt1_len,
+    const uint8_t* pt2,
+    uint32_t pt2_len,
+    uint8_t* out
+) {
+    if (!x07_ext_openssl_aead_begin(s, 1, nonce)) return 0;
+
+    int outl = 0;
+    if (aad_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, NULL, &outl, aad, (int)aad_len) != 1) return 0;
+    }
+    uint8_t* w = out;
+    if (pt1_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, w, &outl, pt1, (int)pt1_len) != 1) return 0;
+        w += outl;
+    }
+    if (pt2_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, w, &outl, pt2, (int)pt2_len) != 1) return 0;
+        w += outl;
+    }
+    if (EVP_CipherFinal_ex(s->ctx, w, &outl) != 1) return 0;
+    w += outl;
+    if ((size_t)(w - out) != (size_t)pt1_len + (size_t)pt2_len) return 0;
+    if (EVP_CIPHER_CTX_ctrl(s->ctx, X07_EXT_OPENSSL_CTRL_GET_TAG,
+                            (int)X07_EXT_OPENSSL_AEAD_TAG_LEN, w) != 1) {
+        return 0;
+    }
+    return 1;
+}
+
+static x07ExtOpensslAeadSlot* x07_ext_openssl_aead_get(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_OPENSSL_MAX_AEADS) return (x07ExtOpensslAeadSlot*)0;
+    if (g_aeads[handle].alg == 0) return (x07ExtOpensslAeadSlot*)0;
+    return &g_aeads[handle];
+}
+
+// Seals one record with a header and body segment; returns a buf handle
+// holding ciphertext || tag, or 0.
+int32_t x07_ext_openssl_aead_seal2_alloc(
+    uint32_t handle,
+    const uint8_t* nonce,
+    uint32_t nonce_len,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pt1,
+    uint32_t pt1_len,
+    const uint8_t* pt2,
+    uint32_t pt2_len
+) {
+    x07ExtOpensslAeadSlot* s = x07_ext_openssl_aead_get(handle);
+    if (!s) return 0;
+    if (!nonce || nonce_len != X07_EXT_OPENSSL_AEAD_NONCE_LEN) return 0;
+    if (!aad && aad_len != 0) return 0;
+    if ((!pt1 && pt1_len != 0) || (!pt2 && pt2_len != 0)) return 0;
+    if (aad_len > 2147483647u || pt1_len > 1073741823u || pt2_len > 1073741823u) return 0;
+
+    size_t out_len = (size_t)pt1_len + (size_t)pt2_len + X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    uint8_t* out = (uint8_t*)malloc(out_len);
+    if (!out) return 0;
+
+    if (!x07_ext_openssl_aead_seal_into(s, nonce, aad, aad_len, pt1, pt1_len, pt2, pt2_len, out)) {
+        free(out);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+int32_t x07_ext_openssl_aead_seal_alloc(
+    uint32_t handle,
+    const uint8_t* nonce,
+    uint32_t nonce_len,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pt,
+    uint32_t pt_len
+) {
+    return x07_ext_openssl_aead_seal2_alloc(handle, nonce, nonce_len, aad, aad_len, pt, pt_len, NULL, 0);
+}
+
+// Seals count records sharing one aad in a single call; nonces is
+// count * 12 bytes, pts holds the plaintexts back to back with their
+// lengths in pt_lens. Returns a buf handle holding the sealed records
+// back to back (each pt_lens[i] + 16 bytes), or 0.
+int32_t x07_ext_openssl_aead_seal_batch_alloc(
+    uint32_t handle,
+    uint32_t count,
+    const uint8_t* nonces,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* pts,
+    const uint32_t* pt_lens
+) {
+    x07ExtOpensslAeadSlot* s = x07_ext_openssl_aead_get(handle);
+    if (!s) return 0;
+    if (count == 0 || count > 65536u) return 0;
+    if (!nonces || !pt_lens) return 0;
+    if (!aad && aad_len != 0) return 0;
+    if (aad_len > 2147483647u) return 0;
+
+    size_t total_pt = 0;
+    for (uint32_t i = 0; i < count; i++) {
+        if (pt_lens[i] > 1073741823u) return 0;
+        total_pt += pt_lens[i];
+    }
+    if (!pts && total_pt != 0) return 0;
+    size_t out_len = total_pt + (size_t)count * X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    if (out_len > 4294967295u) return 0;
+
+    uint8_t* out = (uint8_t*)malloc(out_len ? out_len : 1u);
+    if (!out) return 0;
+
+    const uint8_t* r = pts;
+    uint8_t* w = out;
+    for (uint32_t i = 0; i < count; i++) {
+        if (!x07_ext_openssl_aead_seal_into(s, nonces + (size_t)i * X07_EXT_OPENSSL_AEAD_NONCE_LEN,
+                                            aad, aad_len, r, pt_lens[i], NULL, 0, w)) {
+            free(out);
+            return 0;
+        }
+        r += pt_lens[i];
+        w += pt_lens[i] + X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = (uint32_t)out_len;
+    return (int32_t)slot;
+}
+
+// Opens ciphertext || tag; returns a buf handle holding the plaintext,
+// or 0 on authentication failure (no partial output escapes).
+int32_t x07_ext_openssl_aead_open_alloc(
+    uint32_t handle,
+    const uint8_t* nonce,
+    uint32_t nonce_len,
+    const uint8_t* aad,
+    uint32_t aad_len,
+    const uint8_t* ct,
+    uint32_t ct_len
+) {
+    x07ExtOpensslAeadSlot* s = x07_ext_openssl_aead_get(handle);
+    if (!s) return 0;
+    if (!nonce || nonce_len != X07_EXT_OPENSSL_AEAD_NONCE_LEN) return 0;
+    if (!aad && aad_len != 0) return 0;
+    if (!ct || ct_len < X07_EXT_OPENSSL_AEAD_TAG_LEN) return 0;
+    if (aad_len > 2147483647u || ct_len > 2147483647u) return 0;
+
+    uint32_t pt_len = ct_len - X07_EXT_OPENSSL_AEAD_TAG_LEN;
+    uint8_t* out = (uint8_t*)malloc(pt_len ? pt_len : 1u);
+    if (!out) return 0;
+
+    if (!x07_ext_openssl_aead_begin(s, 0, nonce)) {
+        free(out);
+        return 0;
+    }
+
+    int outl = 0;
+    int ok = 1;
+    if (aad_len != 0 && EVP_CipherUpdate(s->ctx, NULL, &outl, aad, (int)aad_len) != 1) ok = 0;
+    uint8_t* w = out;
+    if (ok && pt_len != 0) {
+        if (EVP_CipherUpdate(s->ctx, w, &outl, ct, (int)pt_len) != 1) ok = 0;
+        else w += outl;
+    }
+    uint8_t tag[X07_EXT_OPENSSL_AEAD_TAG_LEN];
+    memcpy(tag, ct + pt_len, sizeof(tag));
+    if (ok && EVP_CIPHER_CTX_ctrl(s->ctx, X07_EXT_OPENSSL_CTRL_SET_TAG,
+                                  (int)sizeof(tag), tag) != 1) {
+        ok = 0;
+    }
+    if (ok && EVP_CipherFinal_ex(s->ctx, w, &outl) != 1) ok = 0;
+    if (ok) w += outl;
+    if (ok && (size_t)(w - out) != (size_t)pt_len) ok = 0;
+    if (!ok) {
+        free(out);
+        return 0;
+    }
+
+    uint32_t slot = x07_ext_openssl_alloc_buf_slot();
+    if (!slot) {
+        free(out);
+        return 0;
+    }
+    g_bufs[slot] = out;
+    g_lens[slot] = pt_len;
+    return (int32_t)slot;
+}
+
 int32_t x07_ext_openssl_rand_bytes_alloc(uint32_t len, uint32_t* out_handle) {
     if (out_handle) *out_handle = 0;
 
@@ -0,0 +1,3734 @@
+// recvmmsg needs _GNU_SOURCE; define it before any libc header lands.
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#  define _GNU_SOURCE
+#endif
+
+#include <limits.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#  include <arpa/inet.h>
+#  include <errno.h>
+#  include <fcntl.h>
+#  include <netdb.h>
+#  include <netinet/in.h>
+#  include <poll.h>
+#  include <sys/socket.h>
+#  include <sys/types.h>
+#  include <sys/uio.h>
+#  include <time.h>
+#  include <unistd.h>
+typedef int x07_sock_t;
+#  define X07_SOCK_INVALID (-1)
+#  define x07_sock_close close
+#  define x07_sock_errno() (errno)
+typedef socklen_t x07_socklen_t;
+
+#if defined(__linux__)
+#  include <sys/epoll.h>
+#  define X07_EXT_SOCKETS_HAVE_EPOLL 1
+#else
+#  define X07_EXT_SOCKETS_HAVE_EPOLL 0
+#endif
+
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <openssl/x509v3.h>
+
+// Net error codes (pinned in docs/net/errors-v1.md).
+enum {
+  X07_NET_ERR_POLICY_DENIED = 1,
+  X07_NET_ERR_INVALID_REQ = 2,
+  X07_NET_ERR_TIMEOUT = 3,
+  X07_NET_ERR_TOO_LARGE = 4,
+  X07_NET_ERR_DNS = 5,
+  X07_NET_ERR_CONNECT = 6,
+  X07_NET_ERR_TLS = 7,
+  X07_NET_ERR_INTERNAL = 8,
+};
+
+// V1 NetAddr tags (pinned in docs/net/net-v1.md).
+enum {
+  X07_NET_ADDR_TAG_IPV4 = 1,
+  X07_NET_ADDR_TAG_IPV6 = 2,
+  X07_NET_ADDR_TAG_DNS = 3,
+};
+
+enum {
+  X07_SOCK_KIND_NONE = 0,
+  X07_SOCK_KIND_TCP_STREAM = 1,
+  X07_SOCK_KIND_TCP_LISTENER = 2,
+  X07_SOCK_KIND_UDP = 3,
+  X07_SOCK_KIND_TLS_STREAM = 4,
+};
+
+typedef struct x07SockEntry {
+  uint8_t alive;
+  uint8_t kind;
+  uint8_t closed;
+  uint8_t _pad;
+  x07_sock_t fd;
+} x07SockEntry;
+
+// The SSL_CTX is shared across streams (see the TLS client context cache
+// below); only the per-connection SSL lives in the slot.
+typedef struct x07TlsEntry {
+  SSL* ssl;
+} x07TlsEntry;
+
+typedef struct x07NetCapsV1 {
+  uint32_t connect_timeout_ms;
+  uint32_t io_timeout_ms;
+  uint32_t max_read_bytes;
+  uint32_t max_write_bytes;
+  uint32_t dns_ttl_ms; // resolver-cache TTL; carried in the v1 reserved word
+} x07NetCapsV1;
+
+// Socket slots live in lazily allocated slabs behind generation-tagged
+// handles: handle = (gen << 20) | index. Acquire and release are O(1)
+// through a LIFO free list, the table grows one slab at a time up to ~1M
+// live sockets, and a stale handle whose slot was reused fails the
+// generation check in x07_ext_sockets_sock_ptr instead of silently
+// addressing the new socket.
+#define X07_EXT_SOCKETS_SLAB_BITS 10u
+#define X07_EXT_SOCKETS_SLAB_SIZE (1u << X07_EXT_SOCKETS_SLAB_BITS)
+#define X07_EXT_SOCKETS_MAX_SLABS 1024u
+#define X07_EXT_SOCKETS_IDX_BITS 20u
+#define X07_EXT_SOCKETS_IDX_MASK ((1u << X07_EXT_SOCKETS_IDX_BITS) - 1u)
+// 11 generation bits keep the whole handle below INT32_MAX: the public
+// entrypoints pass handles as int32_t.
+#define X07_EXT_SOCKETS_GEN_MASK 0x7FFu
+// Index 0 stays reserved so handle 0 is never valid.
+#define X07_EXT_SOCKETS_MAX_SOCKS (X07_EXT_SOCKETS_MAX_SLABS * X07_EXT_SOCKETS_SLAB_SIZE - 1u)
+
+typedef struct x07SockSlot {
+  x07SockEntry e; // must stay first: entry pointers are cast back to slots
+  x07TlsEntry tls;
+  x07NetCapsV1 caps;
+  uint8_t caps_ready;
+  uint8_t ready; // cached readiness bits (see the readiness engine below)
+  // Caps-doc memo: the last caps blob parsed for this socket and its parsed
+  // form, so repeated calls with the same doc skip the parse + bounds checks
+  // (see x07_ext_sock_caps_parse_cached).
+  uint8_t caps_doc_len;
+  uint8_t caps_memo_ready;
+  uint8_t caps_doc[24];
+  x07NetCapsV1 caps_memo;
+  uint32_t gen;
+  uint32_t next_free;
+} x07SockSlot;
+
+static x07SockSlot* g_sock_slabs[X07_EXT_SOCKETS_MAX_SLABS];
+static uint32_t g_sock_next_unused = 1; // lowest never-allocated index
+static uint32_t g_sock_free_head = 0;   // LIFO free list, 0 = empty
+
+// Readiness engine (defined below, after the poll helpers). Cached readiness
+// bits use the wait-doc event encoding: 1 = readable, 2 = writable,
+// 4 = hup/err.
+enum {
+  X07_SOCK_READY_IN = 1u,
+  X07_SOCK_READY_OUT = 2u,
+  X07_SOCK_READY_ERR = 4u,
+};
+static void x07_ext_sockets_ready_register(uint32_t h, x07_sock_t fd);
+static void x07_ext_sockets_ready_unregister(x07_sock_t fd);
+
+static x07SockSlot* x07_ext_sockets_slot_at(uint32_t idx) {
+  if (idx == 0 || idx > X07_EXT_SOCKETS_MAX_SOCKS) return NULL;
+  x07SockSlot* slab = g_sock_slabs[idx >> X07_EXT_SOCKETS_SLAB_BITS];
+  if (!slab) return NULL;
+  return &slab[idx & (X07_EXT_SOCKETS_SLAB_SIZE - 1u)];
+}
+
+static x07SockSlot* x07_ext_sockets_slot_of(x07SockEntry* e) {
+  return (x07SockSlot*)(void*)e;
+}
+
+static uint32_t x07_ext_sockets_slot_handle(const x07SockSlot* s, uint32_t idx) {
+  return ((s->gen & X07_EXT_SOCKETS_GEN_MASK) << X07_EXT_SOCKETS_IDX_BITS) | idx;
+}
+
+static uint32_t x07_ext_sockets_alloc_sock_slot(uint8_t kind, x07_sock_t fd) {
+  uint32_t idx;
+  if (g_sock_free_head != 0) {
+    idx = g_sock_free_head;
+    g_sock_free_head = x07_ext_sockets_slot_at(idx)->next_free;
+  } else {
+    if (g_sock_next_unused > X07_EXT_SOCKETS_MAX_SOCKS) return 0;
+    uint32_t slab = g_sock_next_unused >> X07_EXT_SOCKETS_SLAB_BITS;
+    if (!g_sock_slabs[slab]) {
+      g_sock_slabs[slab] = (x07SockSlot*)calloc(X07_EXT_SOCKETS_SLAB_SIZE, sizeof(x07SockSlot));
+      if (!g_sock_slabs[slab]) return 0;
+    }
+    idx = g_sock_next_unused++;
+  }
+  x07SockSlot* s = x07_ext_sockets_slot_at(idx);
+  uint32_t gen = s->gen;
+  memset(s, 0, sizeof(*s));
+  s->gen = gen;
+  s->e.alive = 1;
+  s->e.kind = kind;
+  s->e.fd = fd;
+  uint32_t h = x07_ext_sockets_slot_handle(s, idx);
+  x07_ext_sockets_ready_register(h, fd);
+  return h;
+}
+
+static x07SockEntry* x07_ext_sockets_sock_ptr(uint32_t h) {
+  uint32_t idx = h & X07_EXT_SOCKETS_IDX_MASK;
+  x07SockSlot* s = x07_ext_sockets_slot_at(idx);
+  if (!s || !s->e.alive) return NULL;
+  if (x07_ext_sockets_slot_handle(s, idx) != h) return NULL;
+  return &s->e;
+}
+
+static void x07_ext_sockets_tls_drop_in_place(x07SockSlot* s) {
+  SSL* ssl = s->tls.ssl;
+  s->tls.ssl = NULL;
+  if (ssl) {
+    (void)SSL_shutdown(ssl);
+    SSL_free(ssl);
+  }
+}
+
+// Live-handle lookup straight to the TLS state; NULL on a dead or stale
+// handle.
+static x07TlsEntry* x07_ext_sockets_tls_ptr(uint32_t h) {
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+  return e ? &x07_ext_sockets_slot_of(e)->tls : NULL;
+}
+
+static void x07_ext_sockets_sock_close_in_place(x07SockEntry* e) {
+  if (!e || !e->alive || e->closed) return;
+  x07SockSlot* s = x07_ext_sockets_slot_of(e);
+  if (e->kind == X07_SOCK_KIND_TLS_STREAM) {
+    x07_ext_sockets_tls_drop_in_place(s);
+  }
+  if (e->fd != X07_SOCK_INVALID) {
+    x07_ext_sockets_ready_unregister(e->fd);
+    (void)x07_sock_close(e->fd);
+  }
+  s->ready = 0;
+  e->fd = X07_SOCK_INVALID;
+  e->closed = 1;
+}
+
+static int32_t x07_ext_sockets_sock_close(uint32_t h, uint8_t expected_kind) {
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+  if (!e || e->kind != expected_kind) return 0;
+  if (e->closed) return 0;
+  x07_ext_sockets_sock_close_in_place(e);
+  return 1;
+}
+
+static int32_t x07_ext_sockets_sock_drop(uint32_t h, uint8_t expected_kind) {
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+  if (!e || e->kind != expected_kind) return 0;
+  x07_ext_sockets_sock_close_in_place(e);
+  x07SockSlot* s = x07_ext_sockets_slot_of(e);
+  memset(&s->e, 0, sizeof(s->e));
+  s->caps_ready = 0;
+  // Bump the generation so outstanding copies of this handle go stale, then
+  // push the slot onto the free list.
+  s->gen = (s->gen + 1u) & X07_EXT_SOCKETS_GEN_MASK;
+  s->next_free = g_sock_free_head;
+  g_sock_free_head = h & X07_EXT_SOCKETS_IDX_MASK;
+  return 1;
+}
+
+// ---- Output buffer slots (like ext-curl-c, but with sockets-specific names) ----
+//
+// Slot acquire/release is O(1) via a LIFO stack of free indexes, and the
+// backing buffers are recycled through a small size-classed pool so the
+// read paths refill a warm buffer instead of paying a malloc per read.
+
+#define X07_EXT_SOCKETS_MAX_BUFS 4096u
+static uint8_t* g_bufs[X07_EXT_SOCKETS_MAX_BUFS + 1];
+static uint32_t g_lens[X07_EXT_SOCKETS_MAX_BUFS + 1];
+// Pool capacity of each parked buffer; 0 = plain malloc, freed on release.
+static uint32_t g_buf_caps[X07_EXT_SOCKETS_MAX_BUFS + 1];
+
+static uint32_t g_buf_free_stack[X07_EXT_SOCKETS_MAX_BUFS];
+static uint32_t g_buf_free_top;
+static uint32_t g_buf_next_unused = 1; // lowest never-allocated slot
+
+// Size classes are powers of two, 1 KiB through 1 MiB (the default
+// max_read_bytes); larger requests fall back to plain malloc (cap 0).
+#define X07_EXT_SOCKETS_POOL_MIN_SHIFT 10u
+#define X07_EXT_SOCKETS_POOL_MAX_SHIFT 20u
+#define X07_EXT_SOCKETS_POOL_CLASSES (X07_EXT_SOCKETS_POOL_MAX_SHIFT - X07_EXT_SOCKETS_POOL_MIN_SHIFT + 1u)
+#define X07_EXT_SOCKETS_POOL_PER_CLASS 4u
+static uint8_t* g_buf_pool[X07_EXT_SOCKETS_POOL_CLASSES][X07_EXT_SOCKETS_POOL_PER_CLASS];
+static uint32_t g_buf_pool_count[X07_EXT_SOCKETS_POOL_CLASSES];
+
+static uint32_t x07_ext_sockets_pool_class(uint32_t cap) {
+  uint32_t shift = X07_EXT_SOCKETS_POOL_MIN_SHIFT;
+  while ((1u << shift) < cap) shift++;
+  return shift - X07_EXT_SOCKETS_POOL_MIN_SHIFT;
+}
+
+// Returns a buffer of at least `want` bytes. *out_cap is the pool capacity
+// to hand back on release, or 0 when the buffer is plain malloc.
+static uint8_t* x07_ext_sockets_pool_get(uint32_t want, uint32_t* out_cap) {
+  *out_cap = 0;
+  if (want == 0) want = 1;
+  if (want > (1u << X07_EXT_SOCKETS_POOL_MAX_SHIFT)) return (uint8_t*)malloc((size_t)want);
+  uint32_t cls = x07_ext_sockets_pool_class(want);
+  uint32_t cap = 1u << (cls + X07_EXT_SOCKETS_POOL_MIN_SHIFT);
+  if (g_buf_pool_count[cls]) {
+    *out_cap = cap;
+    return g_buf_pool[cls][--g_buf_pool_count[cls]];
+  }
+  uint8_t* buf = (uint8_t*)malloc((size_t)cap);
+  if (!buf) return NULL;
+  *out_cap = cap;
+  return buf;
+}
+
+static void x07_ext_sockets_pool_put(uint8_t* buf, uint32_t cap) {
+  if (!buf) return;
+  if (cap == 0) {
+    free(buf);
+    return;
+  }
+  uint32_t cls = x07_ext_sockets_pool_class(cap);
+  if (g_buf_pool_count[cls] < X07_EXT_SOCKETS_POOL_PER_CLASS) {
+    g_buf_pool[cls][g_buf_pool_count[cls]++] = buf;
+  } else {
+    free(buf);
+  }
+}
+
+static uint32_t x07_ext_sockets_alloc_buf_slot(void) {
+  if (g_buf_free_top) return g_buf_free_stack[--g_buf_free_top];
+  if (g_buf_next_unused <= X07_EXT_SOCKETS_MAX_BUFS) return g_buf_next_unused++;
+  return 0;
+}
+
+int32_t x07_ext_sockets_buf_len(int32_t handle) {
+  if (handle <= 0 || (uint32_t)handle > X07_EXT_SOCKETS_MAX_BUFS) return -1;
+  uint32_t h = (uint32_t)handle;
+  if (!g_bufs[h]) return -1;
+  if (g_lens[h] > (uint32_t)INT32_MAX) return -1;
+  return (int32_t)g_lens[h];
+}
+
+const uint8_t* x07_ext_sockets_buf_ptr(int32_t handle) {
+  if (handle <= 0 || (uint32_t)handle > X07_EXT_SOCKETS_MAX_BUFS) return NULL;
+  return g_bufs[(uint32_t)handle];
+}
+
+void x07_ext_sockets_buf_free(int32_t handle) {
+  if (handle <= 0 || (uint32_t)handle > X07_EXT_SOCKETS_MAX_BUFS) return;
+  uint32_t h = (uint32_t)handle;
+  if (!g_bufs[h]) return; // already free; keep the slot stack consistent
+  x07_ext_sockets_pool_put(g_bufs[h], g_buf_caps[h]);
+  g_bufs[h] = NULL;
+  g_lens[h] = 0;
+  g_buf_caps[h] = 0;
+  g_buf_free_stack[g_buf_free_top++] = h;
+}
+
+// Copies a buf slot into caller memory and frees the slot in one hop,
+// replacing the ptr/len/memcpy/free call sequence. For streaming reads the
+// io-reader vtable (x07_ext_sockets_*_reader_prepare_v1) is the fully
+// zero-copy path: it writes into runtime memory directly. Returns the
+// copied length, or -1 on a bad handle / insufficient cap.
+int32_t x07_ext_sockets_buf_take_into(int32_t handle, uint8_t* dst, uint32_t cap) {
+  if (handle <= 0 || (uint32_t)handle > X07_EXT_SOCKETS_MAX_BUFS) return -1;
+  uint32_t h = (uint32_t)handle;
+  if (!g_bufs[h]) return -1;
+  uint32_t len = g_lens[h];
+  if (len > (uint32_t)INT32_MAX || len > cap) return -1;
+  if (len) memcpy(dst, g_bufs[h], (size_t)len);
+  x07_ext_sockets_buf_free(handle);
+  return (int32_t)len;
+}
+
+// ---- Bytes helpers ----
+
+static void x07_ext_write_u32_le(uint8_t* out, uint32_t x) {
+  out[0] = (uint8_t)(x & 255u);
+  out[1] = (uint8_t)((x >> 8) & 255u);
+  out[2] = (uint8_t)((x >> 16) & 255u);
+  out[3] = (uint8_t)((x >> 24) & 255u);
+}
+
+static int x07_ext_read_u32_le(const uint8_t* b, uint32_t n, uint32_t* pos, uint32_t* out) {
+  if (!b || !pos || !out) return 0;
+  uint32_t p = *pos;
+  if (p > n || n - p < 4u) return 0;
+  uint32_t x = 0;
+  x |= (uint32_t)b[p + 0];
+  x |= (uint32_t)b[p + 1] << 8;
+  x |= (uint32_t)b[p + 2] << 16;
+  x |= (uint32_t)b[p + 3] << 24;
+  *pos = p + 4u;
+  *out = x;
+  return 1;
+}
+
+static uint8_t* x07_ext_make_err_doc(uint32_t code, uint32_t* out_len) {
+  uint8_t* buf = (uint8_t*)malloc(9);
+  if (!buf) return NULL;
+  buf[0] = 0;
+  x07_ext_write_u32_le(buf + 1, code);
+  x07_ext_write_u32_le(buf + 5, 0);
+  if (out_len) *out_len = 9;
+  return buf;
+}
+
+static int x07_ext_env_is_1(const char* key) {
+  const char* v = getenv(key);
+  return v && strcmp(v, "1") == 0;
+}
+
+static int x07_ext_split_next(const char** s, const char** out_p, size_t* out_n) {
+  if (!s || !*s || !out_p || !out_n) return 0;
+  const char* cur = *s;
+  if (!cur || !*cur) return 0;
+  const char* start = cur;
+  while (*cur && *cur != ';') cur++;
+  const char* end = cur;
+  if (*cur == ';') cur++;
+  *s = cur;
+  *out_p = start;
+  *out_n = (size_t)(end - start);
+  return 1;
+}
+
+static uint8_t x07_ext_ascii_lower(uint8_t c) {
+  if (c >= (uint8_t)'A' && c <= (uint8_t)'Z') return (uint8_t)(c + 32);
+  return c;
+}
+
+static int x07_ext_parse_port(const char* s, size_t n, uint32_t* out) {
+  if (!s || !out || n == 0) return 0;
+  uint32_t x = 0;
+  for (size_t i = 0; i < n; i++) {
+    char c = s[i];
+    if (c < '0' || c > '9') return 0;
+    uint32_t d = (uint32_t)(c - '0');
+    if (x > (UINT32_MAX / 10u)) return 0;
+    x = x * 10u + d;
+    if (x > 65535u) return 0;
+  }
+  *out = x;
+  return 1;
+}
+
+static int x07_ext_parse_u32_dec(const char* s, size_t n, uint32_t* out) {
+  if (!s || !out || n == 0) return 0;
+  uint32_t x = 0;
+  for (size_t i = 0; i < n; i++) {
+    char c = s[i];
+    if (c < '0' || c > '9') return 0;
+    uint32_t d = (uint32_t)(c - '0');
+    if (x > (UINT32_MAX / 10u)) return 0;
+    x = x * 10u + d;
+  }
+  *out = x;
+  return 1;
+}
+
+static int x07_ext_parse_ip_bytes(const uint8_t* s, size_t n, int* out_family, uint8_t out_addr[16]) {
+  if (out_family) *out_family = 0;
+  if (!s || n == 0 || !out_family || !out_addr) return 0;
+
+  // Policy host strings are max 255; hard-cap any dynamic inputs here too.
+  if (n > 255u) return 0;
+  char buf[256];
+  memcpy(buf, s, n);
+  buf[n] = '\0';
+
+  struct in_addr a4;
+  memset(&a4, 0, sizeof(a4));
+  if (inet_pton(AF_INET, buf, &a4) == 1) {
+    *out_family = AF_INET;
+    memset(out_addr, 0, 16);
+    memcpy(out_addr, &a4, 4);
+    return 1;
+  }
+
+  struct in6_addr a6;
+  memset(&a6, 0, sizeof(a6));
+  if (inet_pton(AF_INET6, buf, &a6) == 1) {
+    *out_family = AF_INET6;
+    memcpy(out_addr, &a6, 16);
+    return 1;
+  }
+
+  return 0;
+}
+
+static uint32_t x07_ext_ipv4_u32(const uint8_t ip[4]) {
+  return ((uint32_t)ip[0] << 24) | ((uint32_t)ip[1] << 16) | ((uint32_t)ip[2] << 8) | (uint32_t)ip[3];
+}
+
+
+// ---- Compiled sandbox policy ----
+//
+// The X07_OS_* env policy is ambient and fixed for the life of the process,
+// so there is no reason to re-walk X07_OS_NET_ALLOW_HOSTS — parsing IPs,
+// CIDRs, and port lists out of the raw string — on every connect, DNS
+// lookup, and UDP datagram. Compile it once on first use: the
+// flags become plain ints, every allow-hosts entry becomes a pre-parsed
+// record (exact/CIDR/lo-hi IP forms normalized to a range, DNS names
+// lowered) with a sorted port array, and the IP entries get an index sorted
+// by range start for binary search. Steady-state checks then do no string
+// parsing at all, and binary addresses (NetAddr tags, resolved sockaddrs)
+// are matched directly instead of round-tripping through inet_ntop.
+
+enum {
+  X07_NET_POLICY_ENTRY_NAME = 0,
+  X07_NET_POLICY_ENTRY_IPV4 = 1,
+  X07_NET_POLICY_ENTRY_IPV6 = 2,
+};
+
+typedef struct x07NetPolicyEntry {
+  uint8_t kind;
+  char* text; // entry host part, lowered (kept for the literal-text match)
+  uint32_t text_len;
+  uint32_t lo4, hi4;        // X07_NET_POLICY_ENTRY_IPV4
+  uint8_t lo6[16], hi6[16]; // X07_NET_POLICY_ENTRY_IPV6
+  uint16_t* ports;          // sorted ascending, unique
+  uint32_t port_count;
+} x07NetPolicyEntry;
+
+typedef struct x07NetPolicy {
+  uint8_t ready;
+  uint8_t sandboxed;
+  uint8_t net;
+  uint8_t tcp;
+  uint8_t udp;
+  uint8_t dns;
+  uint8_t have_hosts; // X07_OS_NET_ALLOW_HOSTS present and non-empty
+  x07NetPolicyEntry* entries;
+  uint32_t entry_count;
+  uint32_t* v4_idx;   // entry indices sorted by lo4
+  uint32_t* v4_maxhi; // running max of hi4 over v4_idx[0..j]
+  uint32_t v4_count;
+  uint32_t* v6_idx;   // entry indices sorted by lo6 (memcmp order)
+  uint8_t (*v6_maxhi)[16];
+  uint32_t v6_count;
+} x07NetPolicy;
+
+static x07NetPolicy g_net_policy;
+
+static int x07_ext_policy_ports_compile(const char* ports_s, size_t ports_n, x07NetPolicyEntry* e) {
+  uint16_t tmp[256];
+  uint32_t n = 0;
+  size_t p = 0;
+  while (p < ports_n && n < 256u) {
+    while (p < ports_n && (ports_s[p] == ',' || ports_s[p] == ' ' || ports_s[p] == '\t' || ports_s[p] == '\n' || ports_s[p] == '\r')) {
+      p++;
+    }
+    if (p >= ports_n) break;
+    size_t q = p;
+    while (q < ports_n && ports_s[q] != ',') q++;
+    size_t q2 = q;
+    while (q2 > p && (ports_s[q2 - 1] == ' ' || ports_s[q2 - 1] == '\t' || ports_s[q2 - 1] == '\n' || ports_s[q2 - 1] == '\r')) {
+      q2--;
+    }
+    uint32_t pv = 0;
+    if (x07_ext_parse_port(ports_s + p, q2 - p, &pv)) {
+      uint32_t j = n;
+      while (j > 0 && tmp[j - 1] > (uint16_t)pv) {
+        tmp[j] = tmp[j - 1];
+        j--;
+      }
+      if (j == n || tmp[j] != (uint16_t)pv) {
+        tmp[j] = (uint16_t)pv;
+        n++;
+      }
+    }
+    p = (q < ports_n) ? (q + 1) : q;
+  }
+  if (n == 0) return 0; // entry can never match
+  e->ports = (uint16_t*)malloc((size_t)n * sizeof(uint16_t));
+  if (!e->ports) return 0;
+  memcpy(e->ports, tmp, (size_t)n * sizeof(uint16_t));
+  e->port_count = n;
+  return 1;
+}
+
+static int x07_ext_policy_entry_ports_allow(const x07NetPolicyEntry* e, uint32_t port) {
+  uint32_t lo = 0;
+  uint32_t hi = e->port_count;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2u;
+    if ((uint32_t)e->ports[mid] < port) lo = mid + 1u;
+    else hi = mid;
+  }
+  return lo < e->port_count && (uint32_t)e->ports[lo] == port;
+}
+
+static void x07_ext_net_policy_compile(x07NetPolicy* p) {
+  memset(p, 0, sizeof(*p));
+  p->sandboxed = x07_ext_env_is_1("X07_OS_SANDBOXED") ? 1 : 0;
+  p->net = x07_ext_env_is_1("X07_OS_NET") ? 1 : 0;
+  p->tcp = x07_ext_env_is_1("X07_OS_NET_ALLOW_TCP") ? 1 : 0;
+  p->udp = x07_ext_env_is_1("X07_OS_NET_ALLOW_UDP") ? 1 : 0;
+  p->dns = x07_ext_env_is_1("X07_OS_NET_ALLOW_DNS") ? 1 : 0;
+
+  const char* allow = getenv("X07_OS_NET_ALLOW_HOSTS");
+  if (!allow || !*allow) return;
+  p->have_hosts = 1;
+
+  uint32_t cap = 1;
+  for (const char* s = allow; *s; s++) {
+    if (*s == ';') cap++;
+  }
+  p->entries = (x07NetPolicyEntry*)calloc(cap, sizeof(x07NetPolicyEntry));
+  if (!p->entries) return;
+
+  const char* cur = allow;
+  const char* entry = NULL;
+  size_t entry_len = 0;
+  while (x07_ext_split_next(&cur, &entry, &entry_len)) {
+    size_t colon = (size_t)-1;
+    for (size_t i = 0; i < entry_len; i++) {
+      if (entry[i] == ':') colon = i;
+    }
+    if (colon == (size_t)-1) continue;
+
+    const char* host_s = entry;
+    size_t host_n = colon;
+    const char* ports_s = entry + colon + 1;
+    size_t ports_n = entry_len - colon - 1;
+
+    if (host_n >= 2 && host_s[0] == '[' && host_s[host_n - 1] == ']') {
+      const char* inner = (const char*)memchr(host_s + 1, ']', host_n - 2);
+      if (!inner) {
+        host_s += 1;
+        host_n -= 2;
+      }
+    }
+    if (host_n == 0 || host_n > 255u) continue;
+
+    x07NetPolicyEntry* e = &p->entries[p->entry_count];
+    memset(e, 0, sizeof(*e));
+    if (!x07_ext_policy_ports_compile(ports_s, ports_n, e)) continue;
+
+    e->text = (char*)malloc(host_n);
+    if (!e->text) {
+      free(e->ports);
+      continue;
+    }
+    for (size_t i = 0; i < host_n; i++) {
+      e->text[i] = (char)x07_ext_ascii_lower((uint8_t)host_s[i]);
+    }
+    e->text_len = (uint32_t)host_n;
+    e->kind = X07_NET_POLICY_ENTRY_NAME;
+
+    const char* slash = (const char*)memchr(host_s, '/', host_n);
+    const char* dash = (const char*)memchr(host_s, '-', host_n);
+    int fam = 0;
+    uint8_t ip[16];
+    memset(ip, 0, sizeof(ip));
+
+    if (slash) {
+      size_t ip_n = (size_t)(slash - host_s);
+      uint32_t pref = 0;
+      const char* base_s = host_s;
+      size_t base_n = ip_n;
+      if (base_n >= 2 && base_s[0] == '[' && base_s[base_n - 1] == ']') {
+        base_s += 1;
+        base_n -= 2;
+      }
+      if (x07_ext_parse_u32_dec(slash + 1, host_n - ip_n - 1, &pref) &&
+          x07_ext_parse_ip_bytes((const uint8_t*)base_s, base_n, &fam, ip)) {
+        if (fam == AF_INET && pref <= 32u) {
+          uint32_t base = x07_ext_ipv4_u32(ip);
+          uint32_t mask = (pref == 0) ? 0u : ((pref == 32u) ? 0xFFFFFFFFu : (0xFFFFFFFFu << (32u - pref)));
+          e->kind = X07_NET_POLICY_ENTRY_IPV4;
+          e->lo4 = base & mask;
+          e->hi4 = base | ~mask;
+        } else if (fam == AF_INET6 && pref <= 128u) {
+          e->kind = X07_NET_POLICY_ENTRY_IPV6;
+          for (uint32_t i = 0; i < 16u; i++) {
+            uint32_t bit_base = i * 8u;
+            uint8_t mask = 0;
+            if (pref >= bit_base + 8u) mask = 0xFFu;
+            else if (pref > bit_base) mask = (uint8_t)(0xFFu << (8u - (pref - bit_base)));
+            e->lo6[i] = (uint8_t)(ip[i] & mask);
+            e->hi6[i] = (uint8_t)(ip[i] | (uint8_t)~mask);
+          }
+        }
+      }
+    } else if (dash) {
+      size_t lo_n = (size_t)(dash - host_s);
+      size_t hi_n = host_n - lo_n - 1;
+      const char* lo_s = host_s;
+      const char* hi_s = dash + 1;
+      if (lo_n >= 2 && lo_s[0] == '[' && lo_s[lo_n - 1] == ']') {
+        lo_s += 1;
+        lo_n -= 2;
+      }
+      if (hi_n >= 2 && hi_s[0] == '[' && hi_s[hi_n - 1] == ']') {
+        hi_s += 1;
+        hi_n -= 2;
+      }
+      int lo_fam = 0;
+      int hi_fam = 0;
+      uint8_t lo_ip[16];
+      uint8_t hi_ip[16];
+      memset(lo_ip, 0, sizeof(lo_ip));
+      memset(hi_ip, 0, sizeof(hi_ip));
+      if (hi_n != 0 &&
+          x07_ext_parse_ip_bytes((const uint8_t*)lo_s, lo_n, &lo_fam, lo_ip) &&
+          x07_ext_parse_ip_bytes((const uint8_t*)hi_s, hi_n, &hi_fam, hi_ip) &&
+          lo_fam == hi_fam) {
+        if (lo_fam == AF_INET) {
+          uint32_t lo = x07_ext_ipv4_u32(lo_ip);
+          uint32_t hi = x07_ext_ipv4_u32(hi_ip);
+          e->kind = X07_NET_POLICY_ENTRY_IPV4;
+          e->lo4 = lo <= hi ? lo : hi;
+          e->hi4 = lo <= hi ? hi : lo;
+        } else {
+          e->kind = X07_NET_POLICY_ENTRY_IPV6;
+          if (memcmp(lo_ip, hi_ip, 16) <= 0) {
+            memcpy(e->lo6, lo_ip, 16);
+            memcpy(e->hi6, hi_ip, 16);
+          } else {
+            memcpy(e->lo6, hi_ip, 16);
+            memcpy(e->hi6, lo_ip, 16);
+          }
+        }
+      }
+    } else if (x07_ext_parse_ip_bytes((const uint8_t*)host_s, host_n, &fam, ip)) {
+      if (fam == AF_INET) {
+        e->kind = X07_NET_POLICY_ENTRY_IPV4;
+        e->lo4 = x07_ext_ipv4_u32(ip);
+        e->hi4 = e->lo4;
+      } else {
+        e->kind = X07_NET_POLICY_ENTRY_IPV6;
+        memcpy(e->lo6, ip, 16);
+        memcpy(e->hi6, ip, 16);
+      }
+    }
+
+    p->entry_count++;
+  }
+
+  // Index the IP entries by range start for binary search; v4_maxhi/v6_maxhi
+  // carry a running max of range ends so overlapping ranges are still found
+  // by the bounded leftward scan.
+  uint32_t v4n = 0;
+  uint32_t v6n = 0;
+  for (uint32_t i = 0; i < p->entry_count; i++) {
+    if (p->entries[i].kind == X07_NET_POLICY_ENTRY_IPV4) v4n++;
+    if (p->entries[i].kind == X07_NET_POLICY_ENTRY_IPV6) v6n++;
+  }
+  if (v4n) {
+    p->v4_idx = (uint32_t*)malloc((size_t)v4n * sizeof(uint32_t));
+    p->v4_maxhi = (uint32_t*)malloc((size_t)v4n * sizeof(uint32_t));
+  }
+  if (v6n) {
+    p->v6_idx = (uint32_t*)malloc((size_t)v6n * sizeof(uint32_t));
+    p->v6_maxhi = (uint8_t(*)[16])malloc((size_t)v6n * 16u);
+  }
+  if ((v4n && (!p->v4_idx || !p->v4_maxhi)) || (v6n && (!p->v6_idx || !p->v6_maxhi))) {
+    free(p->v4_idx);
+    free(p->v4_maxhi);
+    free(p->v6_idx);
+    free(p->v6_maxhi);
+    p->v4_idx = NULL;
+    p->v4_maxhi = NULL;
+    p->v6_idx = NULL;
+    p->v6_maxhi = NULL;
+    return; // fall back to the linear scans over p->entries
+  }
+  for (uint32_t i = 0; i < p->entry_count; i++) {
+    if (p->entries[i].kind == X07_NET_POLICY_ENTRY_IPV4) {
+      uint32_t j = p->v4_count;
+      while (j > 0 && p->entries[p->v4_idx[j - 1]].lo4 > p->entries[i].lo4) {
+        p->v4_idx[j] = p->v4_idx[j - 1];
+        j--;
+      }
+      p->v4_idx[j] = i;
+      p->v4_count++;
+    } else if (p->entries[i].kind == X07_NET_POLICY_ENTRY_IPV6) {
+      uint32_t j = p->v6_count;
+      while (j > 0 && memcmp(p->entries[p->v6_idx[j - 1]].lo6, p->entries[i].lo6, 16) > 0) {
+        p->v6_idx[j] = p->v6_idx[j - 1];
+        j--;
+      }
+      p->v6_idx[j] = i;
+      p->v6_count++;
+    }
+  }
+  for (uint32_t j = 0; j < p->v4_count; j++) {
+    uint32_t hi = p->entries[p->v4_idx[j]].hi4;
+    p->v4_maxhi[j] = (j == 0 || hi > p->v4_maxhi[j - 1]) ? hi : p->v4_maxhi[j - 1];
+  }
+  for (uint32_t j = 0; j < p->v6_count; j++) {
+    const uint8_t* hi = p->entries[p->v6_idx[j]].hi6;
+    if (j == 0 || memcmp(hi, p->v6_maxhi[j - 1], 16) > 0) memcpy(p->v6_maxhi[j], hi, 16);
+    else memcpy(p->v6_maxhi[j], p->v6_maxhi[j - 1], 16);
+  }
+}
+
+static const x07NetPolicy* x07_ext_net_policy(void) {
+  if (!g_net_policy.ready) {
+    x07_ext_net_policy_compile(&g_net_policy);
+    g_net_policy.ready = 1;
+  }
+  return &g_net_policy;
+}
+
+static int x07_ext_policy_v4_allowed(const x07NetPolicy* p, uint32_t ip, uint32_t port) {
+  if (!p->v4_idx) {
+    for (uint32_t i = 0; i < p->entry_count; i++) {
+      const x07NetPolicyEntry* e = &p->entries[i];
+      if (e->kind == X07_NET_POLICY_ENTRY_IPV4 && e->lo4 <= ip && ip <= e->hi4 &&
+          x07_ext_policy_entry_ports_allow(e, port)) {
+        return 1;
+      }
+    }
+    return 0;
+  }
+  uint32_t lo = 0;
+  uint32_t hi = p->v4_count;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2u;
+    if (p->entries[p->v4_idx[mid]].lo4 <= ip) lo = mid + 1u;
+    else hi = mid;
+  }
+  for (uint32_t j = lo; j-- > 0;) {
+    if (p->v4_maxhi[j] < ip) break;
+    const x07NetPolicyEntry* e = &p->entries[p->v4_idx[j]];
+    if (e->hi4 >= ip && x07_ext_policy_entry_ports_allow(e, port)) return 1;
+  }
+  return 0;
+}
+
+static int x07_ext_policy_v6_allowed(const x07NetPolicy* p, const uint8_t ip[16], uint32_t port) {
+  if (!p->v6_idx) {
+    for (uint32_t i = 0; i < p->entry_count; i++) {
+      const x07NetPolicyEntry* e = &p->entries[i];
+      if (e->kind == X07_NET_POLICY_ENTRY_IPV6 && memcmp(e->lo6, ip, 16) <= 0 &&
+          memcmp(ip, e->hi6, 16) <= 0 && x07_ext_policy_entry_ports_allow(e, port)) {
+        return 1;
+      }
+    }
+    return 0;
+  }
+  uint32_t lo = 0;
+  uint32_t hi = p->v6_count;
+  while (lo < hi) {
+    uint32_t mid = lo + (hi - lo) / 2u;
+    if (memcmp(p->entries[p->v6_idx[mid]].lo6, ip, 16) <= 0) lo = mid + 1u;
+    else hi = mid;
+  }
+  for (uint32_t j = lo; j-- > 0;) {
+    if (memcmp(p->v6_maxhi[j], ip, 16) < 0) break;
+    const x07NetPolicyEntry* e = &p->entries[p->v6_idx[j]];
+    if (memcmp(ip, e->hi6, 16) <= 0 && x07_ext_policy_entry_ports_allow(e, port)) return 1;
+  }
+  return 0;
+}
+
+// Binary-address check: NetAddr payloads and resolved sockaddrs skip the
+// inet_ntop round trip entirely.
+static int x07_ext_policy_ip_allowed(const x07NetPolicy* p, int family, const uint8_t* ip, uint32_t port) {
+  if (!p->have_hosts || !ip) return 0;
+  if (family == AF_INET) return x07_ext_policy_v4_allowed(p, x07_ext_ipv4_u32(ip), port);
+  if (family == AF_INET6) return x07_ext_policy_v6_allowed(p, ip, port);
+  return 0;
+}
+
+static int x07_ext_policy_sockaddr_allowed(const x07NetPolicy* p, const struct sockaddr* sa, uint32_t port) {
+  if (!sa) return 0;
+  if (sa->sa_family == AF_INET) {
+    const struct sockaddr_in* in = (const struct sockaddr_in*)sa;
+    return x07_ext_policy_ip_allowed(p, AF_INET, (const uint8_t*)&in->sin_addr, port);
+  }
+  if (sa->sa_family == AF_INET6) {
+    const struct sockaddr_in6* in6 = (const struct sockaddr_in6*)sa;
+    return x07_ext_policy_ip_allowed(p, AF_INET6, (const uint8_t*)&in6->sin6_addr, port);
+  }
+  return 0;
+}
+
+// Host-by-name check: IP-literal hosts go through the range indexes, and
+// the host text is still compared against every entry's host part (lowered
+// at compile time) to preserve the literal-text match of the old string
+// walker.
+static int x07_ext_policy_host_port_allowed(const x07NetPolicy* p, const uint8_t* host, size_t host_len, uint32_t port) {
+  if (!p->have_hosts || !host || host_len == 0) return 0;
+  int fam = 0;
+  uint8_t ip[16];
+  memset(ip, 0, sizeof(ip));
+  if (x07_ext_parse_ip_bytes(host, host_len, &fam, ip) &&
+      x07_ext_policy_ip_allowed(p, fam, ip, port)) {
+    return 1;
+  }
+  for (uint32_t i = 0; i < p->entry_count; i++) {
+    const x07NetPolicyEntry* e = &p->entries[i];
+    if ((size_t)e->text_len != host_len) continue;
+    size_t k = 0;
+    while (k < host_len && x07_ext_ascii_lower(host[k]) == (uint8_t)e->text[k]) k++;
+    if (k == host_len && x07_ext_policy_entry_ports_allow(e, port)) return 1;
+  }
+  return 0;
+}
+
+// ---- NetAddr/NetCaps parsing ----
+
+typedef struct x07NetAddrV1 {
+  uint32_t tag;
+  uint32_t port;
+  const uint8_t* ip;
+  uint32_t ip_len;
+  const uint8_t* dns;
+  uint32_t dns_len;
+} x07NetAddrV1;
+
+typedef struct x07TlsClientCfgV1 {
+  uint32_t verify_peer;
+  const uint8_t* sni;
+  uint32_t sni_len;
+} x07TlsClientCfgV1;
+
+static int x07_ext_parse_caps_v1(const uint8_t* caps, uint32_t caps_len, x07NetCapsV1* out) {
+  if (!out) return 0;
+
+  // Defaults (v1).
+  out->connect_timeout_ms = 30u * 1000u;
+  out->io_timeout_ms = 30u * 1000u;
+  out->max_read_bytes = 1024u * 1024u;
+  out->max_write_bytes = 1024u * 1024u;
+  out->dns_ttl_ms = 30u * 1000u;
+
+  if (!caps || caps_len < 24u) return 1;
+
+  uint32_t pos = 0;
+  uint32_t ver = 0;
+  if (!x07_ext_read_u32_le(caps, caps_len, &pos, &ver)) return 0;
+  if (ver != 1u) return 0;
+
+  uint32_t connect_timeout_ms = 0;
+  uint32_t io_timeout_ms = 0;
+  uint32_t max_read_bytes = 0;
+  uint32_t max_write_bytes = 0;
+  uint32_t dns_ttl_ms = 0; // v1 reserved word; 0 keeps the default TTL
+
+  if (!x07_ext_read_u32_le(caps, caps_len, &pos, &connect_timeout_ms)) return 0;
+  if (!x07_ext_read_u32_le(caps, caps_len, &pos, &io_timeout_ms)) return 0;
+  if (!x07_ext_read_u32_le(caps, caps_len, &pos, &max_read_bytes)) return 0;
+  if (!x07_ext_read_u32_le(caps, caps_len, &pos, &max_write_bytes)) return 0;
+  if (!x07_ext_read_u32_le(caps, caps_len, &pos, &dns_ttl_ms)) return 0;
+  if (pos != caps_len) return 0;
+
+  if (connect_timeout_ms != 0) out->connect_timeout_ms = connect_timeout_ms;
+  if (io_timeout_ms != 0) out->io_timeout_ms = io_timeout_ms;
+  if (max_read_bytes != 0) out->max_read_bytes = max_read_bytes;
+  if (max_write_bytes != 0) out->max_write_bytes = max_write_bytes;
+  if (dns_ttl_ms != 0) out->dns_ttl_ms = dns_ttl_ms;
+
+  // Hard upper bounds to keep behavior resource-bounded.
+  if (out->connect_timeout_ms > 10u * 60u * 1000u) return 0;
+  if (out->io_timeout_ms > 10u * 60u * 1000u) return 0;
+  if (out->max_read_bytes > 64u * 1024u * 1024u) return 0;
+  if (out->max_write_bytes > 64u * 1024u * 1024u) return 0;
+  if (out->dns_ttl_ms > 10u * 60u * 1000u) return 0;
+
+  return 1;
+}
+
+// ---- iface streaming support (std.io / bufread) ----
+
+static uint32_t x07_ext_netaddr_ipv4_len(void);
+static uint32_t x07_ext_netaddr_ipv6_len(void);
+static void x07_ext_build_netaddr_ipv4(uint8_t* out, const uint8_t ip[4], uint32_t port);
+static void x07_ext_build_netaddr_ipv6(uint8_t* out, const uint8_t ip[16], uint32_t port);
+static int x07_ext_wsa_ready(void);
+static int x07_ext_poll_one(x07_sock_t fd, int events, int timeout_ms, int* out_revents);
+static int x07_ext_sock_poll(x07SockEntry* e, int events, int timeout_ms, int* out_revents);
+
+typedef uint32_t (*x07_rt_ext_io_reader_read_fn_t)(uint32_t data, uint8_t* dst, uint32_t cap);
+typedef void (*x07_rt_ext_io_reader_drop_fn_t)(uint32_t data);
+
+typedef struct {
+  uint8_t* ptr;
+  uint32_t cap;
+} x07_rt_ext_io_vec_t;
+
+typedef uint32_t (*x07_rt_ext_io_reader_read_vec_fn_t)(
+  uint32_t data,
+  x07_rt_ext_io_vec_t* vecs,
+  uint32_t vec_count
+);
+
+extern uint32_t x07_rt_register_io_reader_vtable_v2(
+  x07_rt_ext_io_reader_read_fn_t read,
+  x07_rt_ext_io_reader_read_vec_fn_t read_vec,
+  x07_rt_ext_io_reader_drop_fn_t drop
+);
+
+static uint32_t x07_ext_sockets_io_reader_read(uint32_t data, uint8_t* dst, uint32_t cap);
+static uint32_t x07_ext_sockets_io_reader_read_vec(
+  uint32_t data,
+  x07_rt_ext_io_vec_t* vecs,
+  uint32_t vec_count
+);
+static void x07_ext_sockets_io_reader_drop(uint32_t data);
+
+static uint32_t g_io_reader_vtable = 0;
+
+static uint32_t x07_ext_sockets_io_reader_vtable(void) {
+  if (g_io_reader_vtable) return g_io_reader_vtable;
+  g_io_reader_vtable = x07_rt_register_io_reader_vtable_v2(
+    x07_ext_sockets_io_reader_read,
+    x07_ext_sockets_io_reader_read_vec,
+    x07_ext_sockets_io_reader_drop
+  );
+  return g_io_reader_vtable;
+}
+
+static uint32_t x07_ext_sock_caps_get(uint32_t h, x07NetCapsV1* out) {
+  if (!out) return 0;
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+  if (e) {
+    x07SockSlot* s = x07_ext_sockets_slot_of(e);
+    if (s->caps_ready) {
+      *out = s->caps;
+      return 1;
+    }
+  }
+  return x07_ext_parse_caps_v1(NULL, 0, out);
+}
+
+static void x07_ext_sock_caps_set(uint32_t h, const x07NetCapsV1* c) {
+  if (!c) return;
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+  if (!e) return;
+  x07SockSlot* s = x07_ext_sockets_slot_of(e);
+  s->caps = *c;
+  s->caps_ready = 1;
+}
+
+// Parse a caps doc for an existing socket, memoizing the result in the slot.
+// Callers overwhelmingly pass the same caps blob (often NULL) on every read
+// and write, so after the first call this is a 24-byte memcmp instead of a
+// parse plus bounds checks. Docs over 24 bytes are invalid and oversized, so
+// they fall through to the plain parser for the error path.
+static uint32_t x07_ext_sock_caps_parse_cached(uint32_t h, const uint8_t* caps, uint32_t caps_len, x07NetCapsV1* out) {
+  if (!caps) caps_len = 0;
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+  if (!e || caps_len > 24u) return (uint32_t)x07_ext_parse_caps_v1(caps, caps_len, out);
+  x07SockSlot* s = x07_ext_sockets_slot_of(e);
+  if (s->caps_memo_ready && s->caps_doc_len == (uint8_t)caps_len &&
+      (caps_len == 0 || memcmp(s->caps_doc, caps, caps_len) == 0)) {
+    *out = s->caps_memo;
+    return 1;
+  }
+  if (!x07_ext_parse_caps_v1(caps, caps_len, out)) return 0;
+  if (caps_len) memcpy(s->caps_doc, caps, caps_len);
+  s->caps_doc_len = (uint8_t)caps_len;
+  s->caps_memo = *out;
+  s->caps_memo_ready = 1;
+  return 1;
+}
+
+static uint32_t x07_ext_sockaddr_to_netaddr_v1_in_place(const struct sockaddr* sa, uint8_t* out, uint32_t out_cap) {
+  if (!sa || !out) return 0;
+  if (sa->sa_family == AF_INET) {
+    if (out_cap < x07_ext_netaddr_ipv4_len()) return 0;
+    const struct sockaddr_in* in = (const struct sockaddr_in*)sa;
+    uint8_t ip[4];
+    memcpy(ip, &in->sin_addr, 4);
+    uint32_t port = (uint32_t)ntohs(in->sin_port);
+    x07_ext_build_netaddr_ipv4(out, ip, port);
+    return x07_ext_netaddr_ipv4_len();
+  }
+  if (sa->sa_family == AF_INET6) {
+    if (out_cap < x07_ext_netaddr_ipv6_len()) return 0;
+    const struct sockaddr_in6* in6 = (const struct sockaddr_in6*)sa;
+    uint8_t ip[16];
+    memcpy(ip, &in6->sin6_addr, 16);
+    uint32_t port = (uint32_t)ntohs(in6->sin6_port);
+    x07_ext_build_netaddr_ipv6(out, ip, port);
+    return x07_ext_netaddr_ipv6_len();
+  }
+  return 0;
+}
+
+static uint32_t x07_ext_sockets_tcp_stream_read_into(
+  x07SockEntry* e,
+  uint32_t max_bytes,
+  uint32_t timeout_ms,
+  uint8_t* dst
+) {
+  if (!e || e->closed) return 0;
+  if (max_bytes == 0) return 0;
+
+  for (;;) {
+    int revents = 0;
+    int prc = x07_ext_sock_poll(e, POLLIN, (int)timeout_ms, &revents);
+    if (prc == 0) {
+      x07_ext_sockets_sock_close_in_place(e);
+      return 0;
+    }
+    if (prc < 0) {
+      x07_ext_sockets_sock_close_in_place(e);
+      return 0;
+    }
+
+    ssize_t got = recv(e->fd, dst, (size_t)max_bytes, 0);
+    if (got == 0) {
+      x07_ext_sockets_sock_close_in_place(e);
+      return 0;
+    }
+    if (got < 0) {
+      int err = x07_sock_errno();
+      if (err == EINTR) continue;
+      if (err == EAGAIN || err == EWOULDBLOCK) continue;
+      x07_ext_sockets_sock_close_in_place(e);
+      return 0;
+    }
+    return (got > 0) ? (uint32_t)got : 0u;
+  }
+}
+
+static uint32_t x07_ext_sockets_tls_stream_read_into(
+  x07SockEntry* e,
+  uint32_t max_bytes,
+  uint32_t timeout_ms,
+  uint8_t* dst
+) {
+  if (!e || e->closed) return 0;
+  if (max_bytes == 0) return 0;
+
+  SSL* ssl = x07_ext_sockets_slot_of(e)->tls.ssl;
+  if (!ssl) {
+    x07_ext_sockets_sock_close_in_place(e);
+    return 0;
+  }
+
+  for (;;) {
+    int n = SSL_read(ssl, (void*)dst, (int)max_bytes);
+    if (n > 0) return (uint32_t)n;
+
+    int err = SSL_get_error(ssl, n);
+    if (err == SSL_ERROR_ZERO_RETURN) {
+      x07_ext_sockets_sock_close_in_place(e);
+      return 0;
+    }
+    if (err == SSL_ERROR_WANT_READ) {
+      int revents = 0;
+      int prc = x07_ext_sock_poll(e, POLLIN, (int)timeout_ms, &revents);
+      if (prc == 0) {
+        x07_ext_sockets_sock_close_in_place(e);
+        return 0;
+      }
+      if (prc < 0) {
+        x07_ext_sockets_sock_close_in_place(e);
+        return 0;
+      }
+      continue;
+    }
+    if (err == SSL_ERROR_WANT_WRITE) {
+      int revents = 0;
+      int prc = x07_ext_sock_poll(e, POLLOUT, (int)timeout_ms, &revents);
+      if (prc == 0) {
+        x07_ext_sockets_sock_close_in_place(e);
+        return 0;
+      }
+      if (prc < 0) {
+        x07_ext_sockets_sock_close_in_place(e);
+        return 0;
+      }
+      continue;
+    }
+
+    x07_ext_sockets_sock_close_in_place(e);
+    return 0;
+  }
+}
+
+static uint32_t x07_ext_sockets_write_err_doc_v1(uint32_t code, uint8_t* dst, uint32_t cap) {
+  if (!dst || cap < 9u) return 0;
+  dst[0] = 0;
+  x07_ext_write_u32_le(dst + 1, code);
+  x07_ext_write_u32_le(dst + 5, 0u);
+  return 9u;
+}
+
+static uint32_t x07_ext_sockets_udp_recv_doc_into(
+  x07SockEntry* e,
+  uint32_t max_payload_bytes,
+  uint32_t timeout_ms,
+  uint8_t* dst,
+  uint32_t cap
+) {
+  if (!e || e->closed) return 0;
+  if (!dst) return 0;
+  if (cap < 40u) return x07_ext_sockets_write_err_doc_v1(X07_NET_ERR_TOO_LARGE, dst, cap);
+
+  for (;;) {
+    int revents = 0;
+    int prc = x07_ext_sock_poll(e, POLLIN, (int)timeout_ms, &revents);
+    if (prc == 0) return x07_ext_sockets_write_err_doc_v1(X07_NET_ERR_TIMEOUT, dst, cap);
+    if (prc < 0) return x07_ext_sockets_write_err_doc_v1(X07_NET_ERR_INTERNAL, dst, cap);
+
+    const uint32_t hdr_max = 40u;
+    uint32_t payload_cap = cap - hdr_max;
+    if (max_payload_bytes < payload_cap) payload_cap = max_payload_bytes;
+    if (payload_cap > (uint32_t)INT_MAX) payload_cap = (uint32_t)INT_MAX;
+
+    struct sockaddr_storage ss;
+    memset(&ss, 0, sizeof(ss));
+    x07_socklen_t ss_len = (x07_socklen_t)sizeof(ss);
+
+    ssize_t got = recvfrom(e->fd, dst + hdr_max, (size_t)payload_cap, 0, (struct sockaddr*)&ss, &ss_len);
+    if (got < 0) {
+      int err = x07_sock_errno();
+      if (err == EINTR) continue;
+      if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_sockets_write_err_doc_v1(X07_NET_ERR_TIMEOUT, dst, cap);
+      return x07_ext_sockets_write_err_doc_v1(X07_NET_ERR_CONNECT, dst, cap);
+    }
+    uint32_t payload_len = (got > 0) ? (uint32_t)got : 0u;
+
+    uint32_t addr_len = x07_ext_sockaddr_to_netaddr_v1_in_place((const struct sockaddr*)&ss, dst + 8, 28u);
+    if (addr_len == 0) return x07_ext_sockets_write_err_doc_v1(X07_NET_ERR_INTERNAL, dst, cap);
+
+    uint32_t payload_off = 12u + addr_len;
+    if (payload_len != 0 && payload_off != hdr_max) {
+      memmove(dst + payload_off, dst + hdr_max, payload_len);
+    }
+
+    dst[0] = 1;
+    dst[1] = 1;
+    dst[2] = 0;
+    dst[3] = 0;
+    x07_ext_write_u32_le(dst + 4, addr_len);
+    x07_ext_write_u32_le(dst + 8 + addr_len, payload_len);
+    return payload_off + payload_len;
+  }
+}
+
+static uint32_t x07_ext_sockets_io_reader_read(uint32_t data, uint8_t* dst, uint32_t cap) {
+  if (!x07_ext_wsa_ready()) return 0;
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(data);
+  if (!e || e->closed) return 0;
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_get(data, &c)) return 0;
+
+  if (e->kind == X07_SOCK_KIND_TCP_STREAM) {
+    uint32_t max_bytes = cap;
+    if (max_bytes > c.max_read_bytes) max_bytes = c.max_read_bytes;
+    if (max_bytes > (uint32_t)INT_MAX) max_bytes = (uint32_t)INT_MAX;
+    return x07_ext_sockets_tcp_stream_read_into(e, max_bytes, c.io_timeout_ms, dst);
+  }
+  if (e->kind == X07_SOCK_KIND_TLS_STREAM) {
+    uint32_t max_bytes = cap;
+    if (max_bytes > c.max_read_bytes) max_bytes = c.max_read_bytes;
+    if (max_bytes > (uint32_t)INT_MAX) max_bytes = (uint32_t)INT_MAX;
+    return x07_ext_sockets_tls_stream_read_into(e, max_bytes, c.io_timeout_ms, dst);
+  }
+  if (e->kind == X07_SOCK_KIND_UDP) {
+    uint32_t max_payload_bytes = cap > 40u ? (cap - 40u) : 0u;
+    if (max_payload_bytes > c.max_read_bytes) max_payload_bytes = c.max_read_bytes;
+    return x07_ext_sockets_udp_recv_doc_into(e, max_payload_bytes, c.io_timeout_ms, dst, cap);
+  }
+  return 0;
+}
+
+// Scatter read for the v2 vtable. The first chunk honors the normal
+// (possibly blocking) read semantics; after that we only keep draining a
+// TCP stream while the kernel already has data queued, so one vtable call
+// can absorb many segments without ever blocking longer than a single read
+// would. TLS and UDP docs fall back to one chunk per call: TLS readability
+// of the fd says nothing about decryptable record bytes, and UDP reads are
+// framed per datagram.
+static uint32_t x07_ext_sockets_io_reader_read_vec(
+  uint32_t data,
+  x07_rt_ext_io_vec_t* vecs,
+  uint32_t vec_count
+) {
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(data);
+  if (!e || e->closed) return 0;
+
+  uint32_t total = 0;
+  for (uint32_t i = 0; i < vec_count; i++) {
+    uint32_t off = 0;
+    while (off < vecs[i].cap) {
+      if (total > 0) {
+        if (e->kind != X07_SOCK_KIND_TCP_STREAM) return total;
+        int revents = 0;
+        if (x07_ext_poll_one(e->fd, POLLIN, 0, &revents) <= 0) return total;
+        if (!(revents & POLLIN)) return total;
+      }
+      uint32_t got = x07_ext_sockets_io_reader_read(data, vecs[i].ptr + off, vecs[i].cap - off);
+      if (got == 0) return total;
+      off += got;
+      total += got;
+    }
+  }
+  return total;
+}
+
+static void x07_ext_sockets_io_reader_drop(uint32_t data) {
+  (void)data;
+}
+
+int32_t x07_ext_sockets_tcp_stream_reader_prepare_v1(uint32_t stream_handle, const uint8_t* caps, uint32_t caps_len) {
+  if (!x07_ext_wsa_ready()) return 0;
+  uint32_t vtable = x07_ext_sockets_io_reader_vtable();
+  if (vtable == 0 || vtable > (uint32_t)INT32_MAX) return 0;
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->closed) return 0;
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM && e->kind != X07_SOCK_KIND_TLS_STREAM) return 0;
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(stream_handle, caps, caps_len, &c)) {
+    (void)x07_ext_parse_caps_v1(NULL, 0, &c);
+  }
+  x07_ext_sock_caps_set(stream_handle, &c);
+  return (int32_t)vtable;
+}
+
+int32_t x07_ext_sockets_udp_recv_doc_reader_prepare_v1(uint32_t sock_handle, const uint8_t* caps, uint32_t caps_len) {
+  if (!x07_ext_wsa_ready()) return 0;
+  uint32_t vtable = x07_ext_sockets_io_reader_vtable();
+  if (vtable == 0 || vtable > (uint32_t)INT32_MAX) return 0;
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(sock_handle);
+  if (!e || e->closed) return 0;
+  if (e->kind != X07_SOCK_KIND_UDP) return 0;
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(sock_handle, caps, caps_len, &c)) {
+    (void)x07_ext_parse_caps_v1(NULL, 0, &c);
+  }
+  x07_ext_sock_caps_set(sock_handle, &c);
+  return (int32_t)vtable;
+}
+
+static int x07_ext_parse_tls_client_cfg_v1(
+  const uint8_t* cfg,
+  uint32_t cfg_len,
+  const x07NetAddrV1* addr,
+  x07TlsClientCfgV1* out
+) {
+  if (!out) return 0;
+  out->verify_peer = 1;
+  out->sni = NULL;
+  out->sni_len = 0;
+
+  if (!cfg || cfg_len == 0) {
+    if (addr && addr->tag == X07_NET_ADDR_TAG_DNS) {
+      out->sni = addr->dns;
+      out->sni_len = addr->dns_len;
+    }
+    if (out->verify_peer && out->sni_len == 0) return 0;
+    return 1;
+  }
+
+  if (cfg_len < 16u) return 0;
+  uint32_t pos = 0;
+  uint32_t ver = 0;
+  uint32_t verify_peer = 0;
+  uint32_t sni_len = 0;
+  uint32_t reserved = 0;
+
+  if (!x07_ext_read_u32_le(cfg, cfg_len, &pos, &ver)) return 0;
+  if (ver != 1u) return 0;
+  if (!x07_ext_read_u32_le(cfg, cfg_len, &pos, &verify_peer)) return 0;
+  if (verify_peer > 1u) return 0;
+  if (!x07_ext_read_u32_le(cfg, cfg_len, &pos, &sni_len)) return 0;
+  if (sni_len > 1024u) return 0;
+  if (pos > cfg_len || cfg_len - pos < sni_len + 4u) return 0;
+
+  const uint8_t* sni = cfg + pos;
+  pos += sni_len;
+  if (!x07_ext_read_u32_le(cfg, cfg_len, &pos, &reserved)) return 0;
+  if (pos != cfg_len) return 0;
+  if (reserved != 0) return 0;
+
+  if (sni_len) {
+    if (memchr(sni, 0, sni_len) != NULL) return 0;
+    out->sni = sni;
+    out->sni_len = sni_len;
+  } else {
+    if (addr && addr->tag == X07_NET_ADDR_TAG_DNS) {
+      out->sni = addr->dns;
+      out->sni_len = addr->dns_len;
+    }
+  }
+  out->verify_peer = verify_peer;
+  if (out->verify_peer && out->sni_len == 0) return 0;
+  return 1;
+}
+
+static int x07_ext_parse_addr_v1(const uint8_t* b, uint32_t n, x07NetAddrV1* out) {
+  if (!b || !out) return 0;
+  memset(out, 0, sizeof(*out));
+
+  uint32_t pos = 0;
+  uint32_t ver = 0;
+  if (!x07_ext_read_u32_le(b, n, &pos, &ver)) return 0;
+  if (ver != 1u) return 0;
+  uint32_t tag = 0;
+  if (!x07_ext_read_u32_le(b, n, &pos, &tag)) return 0;
+  uint32_t port = 0;
+  if (!x07_ext_read_u32_le(b, n, &pos, &port)) return 0;
+  if (port > 65535u) return 0;
+
+  out->tag = tag;
+  out->port = port;
+
+  if (tag == X07_NET_ADDR_TAG_IPV4) {
+    if (pos > n || n - pos != 4u) return 0;
+    out->ip = b + pos;
+    out->ip_len = 4u;
+    return 1;
+  }
+  if (tag == X07_NET_ADDR_TAG_IPV6) {
+    if (pos > n || n - pos != 16u) return 0;
+    out->ip = b + pos;
+    out->ip_len = 16u;
+    return 1;
+  }
+  if (tag == X07_NET_ADDR_TAG_DNS) {
+    uint32_t name_len = 0;
+    if (!x07_ext_read_u32_le(b, n, &pos, &name_len)) return 0;
+    if (pos > n || name_len > n - pos) return 0;
+    if (name_len == 0) return 0;
+    const uint8_t* name = b + pos;
+    // Reject NUL bytes so we can safely treat it as a string boundary when needed.
+    if (memchr(name, 0, name_len) != NULL) return 0;
+    out->dns = name;
+    out->dns_len = name_len;
+    pos += name_len;
+    if (pos != n) return 0;
+    return 1;
+  }
+
+  return 0;
+}
+
+static uint32_t x07_ext_netaddr_ipv4_len(void) { return 4u + 4u + 4u + 4u; }
+static uint32_t x07_ext_netaddr_ipv6_len(void) { return 4u + 4u + 4u + 16u; }
+
+static void x07_ext_build_netaddr_ipv4(uint8_t* out, const uint8_t ip[4], uint32_t port) {
+  x07_ext_write_u32_le(out + 0, 1u);
+  x07_ext_write_u32_le(out + 4, X07_NET_ADDR_TAG_IPV4);
+  x07_ext_write_u32_le(out + 8, port);
+  memcpy(out + 12, ip, 4);
+}
+
+static void x07_ext_build_netaddr_ipv6(uint8_t* out, const uint8_t ip[16], uint32_t port) {
+  x07_ext_write_u32_le(out + 0, 1u);
+  x07_ext_write_u32_le(out + 4, X07_NET_ADDR_TAG_IPV6);
+  x07_ext_write_u32_le(out + 8, port);
+  memcpy(out + 12, ip, 16);
+}
+
+static int x07_ext_wsa_ready(void) { return 1; }
+
+static int x07_ext_sock_set_nonblocking(x07_sock_t fd) {
+  int flags = fcntl(fd, F_GETFL, 0);
+  if (flags < 0) return 0;
+  if (fcntl(fd, F_SETFL, flags | O_NONBLOCK) != 0) return 0;
+  return 1;
+}
+
+static int x07_ext_poll_one(x07_sock_t fd, int events, int timeout_ms, int* out_revents) {
+  if (out_revents) *out_revents = 0;
+  struct pollfd pfd;
+  memset(&pfd, 0, sizeof(pfd));
+  pfd.fd = fd;
+  pfd.events = (short)events;
+  int rc = poll(&pfd, 1, timeout_ms);
+  if (rc <= 0) return rc;
+  if (out_revents) *out_revents = (int)pfd.revents;
+  return rc;
+}
+
+// ---- Readiness engine ----
+//
+// One-fd poll() per operation is fine for a handful of sockets, but it costs
+// a syscall before every read and write even when the kernel already told us
+// the fd was ready. On Linux every live socket stays registered in a single
+// edge-triggered epoll set and its events are folded into g_sock_ready. The
+// cached bits are consumed on use and only short-circuit the pre-syscall
+// poll: a stale hint makes the following recv/send return EAGAIN and the
+// caller loops back into the plain poll path, so timeout and error semantics
+// are unchanged. On platforms without epoll the cache stays cold and every
+// path behaves exactly as before.
+
+static int64_t x07_ext_now_ms(void) {
+  struct timespec ts;
+  if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0) return 0;
+  return (int64_t)ts.tv_sec * 1000 + (int64_t)(ts.tv_nsec / 1000000);
+}
+
+#if X07_EXT_SOCKETS_HAVE_EPOLL
+
+static int g_ready_epfd = -2; // -2 = not created yet, -1 = unavailable
+
+static int x07_ext_sockets_ready_epfd(void) {
+  if (g_ready_epfd == -2) {
+    g_ready_epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (g_ready_epfd < 0) g_ready_epfd = -1;
+  }
+  return g_ready_epfd;
+}
+
+static void x07_ext_sockets_ready_register(uint32_t h, x07_sock_t fd) {
+  int ep = x07_ext_sockets_ready_epfd();
+  if (ep < 0 || fd == X07_SOCK_INVALID) return;
+  struct epoll_event ev;
+  memset(&ev, 0, sizeof(ev));
+  ev.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  ev.data.u32 = h;
+  (void)epoll_ctl(ep, EPOLL_CTL_ADD, fd, &ev);
+}
+
+static void x07_ext_sockets_ready_unregister(x07_sock_t fd) {
+  if (g_ready_epfd < 0 || fd == X07_SOCK_INVALID) return;
+  (void)epoll_ctl(g_ready_epfd, EPOLL_CTL_DEL, fd, NULL);
+}
+
+// Runs one epoll_wait and folds every reported event into the readiness
+// cache. Returns the number of events folded, 0 on timeout (EINTR counts as
+// an empty wake-up), -1 when the engine is unavailable or the wait failed.
+static int x07_ext_sockets_ready_pump(int timeout_ms) {
+  int ep = x07_ext_sockets_ready_epfd();
+  if (ep < 0) return -1;
+  struct epoll_event evs[64];
+  int n = epoll_wait(ep, evs, 64, timeout_ms);
+  if (n < 0) return (x07_sock_errno() == EINTR) ? 0 : -1;
+  for (int i = 0; i < n; i++) {
+    // The registered data is the full generation-tagged handle, so events
+    // for a since-reused slot fail the lookup and are dropped.
+    x07SockEntry* e = x07_ext_sockets_sock_ptr(evs[i].data.u32);
+    if (!e) continue;
+    uint8_t bits = 0;
+    if (evs[i].events & EPOLLIN) bits |= X07_SOCK_READY_IN;
+    if (evs[i].events & EPOLLOUT) bits |= X07_SOCK_READY_OUT;
+    if (evs[i].events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP)) bits |= X07_SOCK_READY_ERR;
+    x07_ext_sockets_slot_of(e)->ready |= bits;
+  }
+  return n;
+}
+
+#else
+
+static void x07_ext_sockets_ready_register(uint32_t h, x07_sock_t fd) {
+  (void)h;
+  (void)fd;
+}
+
+static void x07_ext_sockets_ready_unregister(x07_sock_t fd) { (void)fd; }
+
+static int x07_ext_sockets_ready_pump(int timeout_ms) {
+  (void)timeout_ms;
+  return -1;
+}
+
+#endif
+
+// x07_ext_poll_one with the readiness cache in front. `e` must be a live
+// entry. A cached hit is consumed, so a stale hint costs at most one EAGAIN
+// before the caller falls back into the plain poll path above.
+static int x07_ext_sock_poll(x07SockEntry* e, int events, int timeout_ms, int* out_revents) {
+  x07SockSlot* s = x07_ext_sockets_slot_of(e);
+  uint8_t want = 0;
+  if (events & POLLIN) want |= X07_SOCK_READY_IN;
+  if (events & POLLOUT) want |= X07_SOCK_READY_OUT;
+  uint8_t cached = (uint8_t)(s->ready & (want | X07_SOCK_READY_ERR));
+  if (cached & want) {
+    s->ready = (uint8_t)(s->ready & (uint8_t)~cached);
+    if (out_revents) {
+      int rev = 0;
+      if (cached & X07_SOCK_READY_IN) rev |= POLLIN;
+      if (cached & X07_SOCK_READY_OUT) rev |= POLLOUT;
+      if (cached & X07_SOCK_READY_ERR) rev |= POLLERR;
+      *out_revents = rev;
+    }
+    return 1;
+  }
+  return x07_ext_poll_one(e->fd, events, timeout_ms, out_revents);
+}
+
+static int x07_ext_sock_get_so_error(x07_sock_t fd, int* out_err) {
+  if (out_err) *out_err = 0;
+  int so_error = 0;
+  x07_socklen_t len = (x07_socklen_t)sizeof(so_error);
+  if (getsockopt(fd, SOL_SOCKET, SO_ERROR, &so_error, &len) != 0) return 0;
+  if (out_err) *out_err = so_error;
+  return 1;
+}
+
+static uint32_t x07_ext_tcp_connect_addr(const struct sockaddr* sa, x07_socklen_t sa_len, uint32_t timeout_ms, x07_sock_t* out_fd) {
+  if (out_fd) *out_fd = X07_SOCK_INVALID;
+  if (!sa || sa_len == 0) return X07_NET_ERR_CONNECT;
+
+  x07_sock_t fd = socket(sa->sa_family, SOCK_STREAM, IPPROTO_TCP);
+  if (fd == X07_SOCK_INVALID) return X07_NET_ERR_CONNECT;
+  if (!x07_ext_sock_set_nonblocking(fd)) {
+    (void)x07_sock_close(fd);
+    return X07_NET_ERR_INTERNAL;
+  }
+
+  int rc = connect(fd, sa, (x07_socklen_t)sa_len);
+  if (rc != 0) {
+    int err = x07_sock_errno();
+    if (err != EINPROGRESS) {
+      (void)x07_sock_close(fd);
+      return X07_NET_ERR_CONNECT;
+    }
+  }
+
+  int revents = 0;
+  int prc = x07_ext_poll_one(fd, POLLOUT, (int)timeout_ms, &revents);
+  if (prc == 0) {
+    (void)x07_sock_close(fd);
+    return X07_NET_ERR_TIMEOUT;
+  }
+  if (prc < 0) {
+    (void)x07_sock_close(fd);
+    return X07_NET_ERR_INTERNAL;
+  }
+
+  int so_error = 0;
+  if (!x07_ext_sock_get_so_error(fd, &so_error) || so_error != 0) {
+    (void)x07_sock_close(fd);
+    return X07_NET_ERR_CONNECT;
+  }
+
+  if (out_fd) *out_fd = fd;
+  return 0;
+}
+
+// ---- DNS resolution cache ----
+//
+// Workloads reconnect to the same few hostnames continuously, and a
+// blocking getaddrinfo costs 1-30ms per call. Resolved address lists are
+// cached keyed by (lowered host, port, protocol) under the TTL from the
+// caps doc (the v1 reserved word; 0 keeps the 30s default), so
+// steady-state connects and sends skip the resolver entirely. Failures
+// are never cached, and policy filtering stays at the point of use, not
+// at insert. Entries hold the sockaddrs getaddrinfo produced (service
+// port already baked in); hosts longer than the key buffer just bypass
+// the cache.
+
+#define X07_EXT_SOCKETS_DNS_CACHE_SLOTS 32u
+#define X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS 8u
+
+typedef struct x07DnsCacheSlot {
+  uint32_t host_len; // 0 = slot empty
+  uint32_t port;
+  uint8_t proto; // IPPROTO_TCP or IPPROTO_UDP
+  char host[256]; // lowered; longest legal hostname is 253 bytes
+  uint32_t count;
+  struct sockaddr_storage addrs[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+  x07_socklen_t addr_lens[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+  int64_t expires_ms;
+  uint64_t stamp;
+} x07DnsCacheSlot;
+
+static x07DnsCacheSlot g_dns_cache[X07_EXT_SOCKETS_DNS_CACHE_SLOTS];
+static uint64_t g_dns_cache_clock;
+
+static x07DnsCacheSlot* x07_ext_dns_cache_find(const char* host, uint32_t host_len, uint32_t port, uint8_t proto) {
+  for (uint32_t i = 0; i < X07_EXT_SOCKETS_DNS_CACHE_SLOTS; i++) {
+    x07DnsCacheSlot* s = &g_dns_cache[i];
+    if (s->host_len == host_len && s->port == port && s->proto == proto &&
+        memcmp(s->host, host, host_len) == 0) {
+      return s;
+    }
+  }
+  return NULL;
+}
+
+// Resolves host:port for the given protocol, serving from the cache while
+// the entry is fresh. Copies up to max_out sockaddrs into out_addrs and
+// returns 0, or an X07_NET_ERR_* code.
+static uint32_t x07_ext_dns_resolve_cached(
+  const uint8_t* host_bytes,
+  uint32_t host_bytes_len,
+  uint32_t port,
+  uint8_t proto,
+  uint32_t ttl_ms,
+  struct sockaddr_storage* out_addrs,
+  x07_socklen_t* out_lens,
+  uint32_t max_out,
+  uint32_t* out_count
+) {
+  *out_count = 0;
+  if (!host_bytes || host_bytes_len == 0 || host_bytes_len > 1024u) return X07_NET_ERR_INVALID_REQ;
+
+  char host[1025];
+  memcpy(host, host_bytes, (size_t)host_bytes_len);
+  host[host_bytes_len] = '\0';
+
+  char key[256];
+  int cacheable = host_bytes_len <= (uint32_t)sizeof(key);
+  if (cacheable) {
+    for (uint32_t i = 0; i < host_bytes_len; i++) {
+      key[i] = (char)x07_ext_ascii_lower((uint8_t)host[i]);
+    }
+    x07DnsCacheSlot* hit = x07_ext_dns_cache_find(key, host_bytes_len, port, proto);
+    if (hit && x07_ext_now_ms() < hit->expires_ms) {
+      uint32_t n = hit->count;
+      if (n > max_out) n = max_out;
+      for (uint32_t i = 0; i < n; i++) {
+        out_addrs[i] = hit->addrs[i];
+        out_lens[i] = hit->addr_lens[i];
+      }
+      *out_count = n;
+      hit->stamp = ++g_dns_cache_clock;
+      return 0;
+    }
+  }
+
+  char service[16];
+  snprintf(service, sizeof(service), "%u", (unsigned)port);
+
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = (proto == IPPROTO_UDP) ? SOCK_DGRAM : SOCK_STREAM;
+  hints.ai_protocol = (int)proto;
+  struct addrinfo* res = NULL;
+  int gai = getaddrinfo(host, service, &hints, &res);
+  if (gai != 0 || !res) return X07_NET_ERR_DNS;
+
+  struct sockaddr_storage addrs[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+  x07_socklen_t lens[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+  uint32_t count = 0;
+  for (struct addrinfo* it = res; it && count < X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS; it = it->ai_next) {
+    if (!it->ai_addr || it->ai_addrlen == 0 || it->ai_addrlen > (x07_socklen_t)sizeof(addrs[0])) continue;
+    memcpy(&addrs[count], it->ai_addr, (size_t)it->ai_addrlen);
+    lens[count] = (x07_socklen_t)it->ai_addrlen;
+    count += 1;
+  }
+  freeaddrinfo(res);
+  if (count == 0) return X07_NET_ERR_DNS;
+
+  if (cacheable) {
+    // Reuse the same key's slot, else an empty one, else the oldest.
+    x07DnsCacheSlot* dst = x07_ext_dns_cache_find(key, host_bytes_len, port, proto);
+    if (!dst) {
+      for (uint32_t i = 0; i < X07_EXT_SOCKETS_DNS_CACHE_SLOTS; i++) {
+        if (g_dns_cache[i].host_len == 0) {
+          dst = &g_dns_cache[i];
+          break;
+        }
+      }
+    }
+    if (!dst) {
+      dst = &g_dns_cache[0];
+      for (uint32_t i = 1; i < X07_EXT_SOCKETS_DNS_CACHE_SLOTS; i++) {
+        if (g_dns_cache[i].stamp < dst->stamp) dst = &g_dns_cache[i];
+      }
+    }
+    memcpy(dst->host, key, (size_t)host_bytes_len);
+    dst->host_len = host_bytes_len;
+    dst->port = port;
+    dst->proto = proto;
+    dst->count = count;
+    for (uint32_t i = 0; i < count; i++) {
+      dst->addrs[i] = addrs[i];
+      dst->addr_lens[i] = lens[i];
+    }
+    dst->expires_ms = x07_ext_now_ms() + (int64_t)ttl_ms;
+    dst->stamp = ++g_dns_cache_clock;
+  }
+
+  uint32_t n = count;
+  if (n > max_out) n = max_out;
+  for (uint32_t i = 0; i < n; i++) {
+    out_addrs[i] = addrs[i];
+    out_lens[i] = lens[i];
+  }
+  *out_count = n;
+  return 0;
+}
+
+static int x07_ext_addr_policy_check_sandboxed(const x07NetAddrV1* addr, uint32_t op_port);
+
+static uint32_t x07_ext_tcp_connect_fd_v1(const x07NetAddrV1* a, const x07NetCapsV1* c, x07_sock_t* out_fd) {
+  if (out_fd) *out_fd = X07_SOCK_INVALID;
+  if (!a || !c || !out_fd) return X07_NET_ERR_INTERNAL;
+
+  const x07NetPolicy* pol = x07_ext_net_policy();
+  int sandboxed = pol->sandboxed;
+  if (sandboxed) {
+    if (!pol->net) return X07_NET_ERR_POLICY_DENIED;
+    if (!pol->tcp) return X07_NET_ERR_POLICY_DENIED;
+    if (!pol->have_hosts) return X07_NET_ERR_POLICY_DENIED;
+
+    if (a->tag == X07_NET_ADDR_TAG_DNS) {
+      if (!pol->dns) return X07_NET_ERR_POLICY_DENIED;
+      if (!x07_ext_policy_host_port_allowed(pol, a->dns, (size_t)a->dns_len, a->port)) return X07_NET_ERR_POLICY_DENIED;
+    } else {
+      if (!x07_ext_addr_policy_check_sandboxed(a, a->port)) return X07_NET_ERR_POLICY_DENIED;
+    }
+  }
+
+  struct sockaddr_storage ss;
+  x07_socklen_t ss_len = 0;
+  memset(&ss, 0, sizeof(ss));
+
+  x07_sock_t fd = X07_SOCK_INVALID;
+  uint32_t saw_timeout = 0;
+  uint32_t saw_internal = 0;
+  uint32_t saw_policy_allowed_addr = 0;
+
+  if (a->tag == X07_NET_ADDR_TAG_DNS) {
+    struct sockaddr_storage cands[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+    x07_socklen_t cand_lens[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+    uint32_t cand_count = 0;
+    uint32_t derr = x07_ext_dns_resolve_cached(a->dns, a->dns_len, a->port, IPPROTO_TCP, c->dns_ttl_ms,
+                                               cands, cand_lens, X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS, &cand_count);
+    if (derr != 0) return derr;
+
+    for (uint32_t i = 0; i < cand_count; i++) {
+      if (sandboxed && !x07_ext_policy_sockaddr_allowed(pol, (struct sockaddr*)&cands[i], a->port)) continue;
+
+      saw_policy_allowed_addr = 1;
+      uint32_t err = x07_ext_tcp_connect_addr((struct sockaddr*)&cands[i], cand_lens[i], c->connect_timeout_ms, &fd);
+      if (err == 0) break;
+      if (err == X07_NET_ERR_TIMEOUT) saw_timeout = 1;
+      if (err == X07_NET_ERR_INTERNAL) saw_internal = 1;
+      fd = X07_SOCK_INVALID;
+    }
+
+    if (fd == X07_SOCK_INVALID) {
+      if (sandboxed && !saw_policy_allowed_addr) return X07_NET_ERR_POLICY_DENIED;
+      if (saw_timeout) return X07_NET_ERR_TIMEOUT;
+      if (saw_internal) return X07_NET_ERR_INTERNAL;
+      return X07_NET_ERR_CONNECT;
+    }
+  } else if (a->tag == X07_NET_ADDR_TAG_IPV4) {
+    struct sockaddr_in in;
+    memset(&in, 0, sizeof(in));
+    in.sin_family = AF_INET;
+    in.sin_port = htons((uint16_t)a->port);
+    memcpy(&in.sin_addr, a->ip, 4);
+    memcpy(&ss, &in, sizeof(in));
+    ss_len = (x07_socklen_t)sizeof(in);
+  } else if (a->tag == X07_NET_ADDR_TAG_IPV6) {
+    struct sockaddr_in6 in6;
+    memset(&in6, 0, sizeof(in6));
+    in6.sin6_family = AF_INET6;
+    in6.sin6_port = htons((uint16_t)a->port);
+    memcpy(&in6.sin6_addr, a->ip, 16);
+    memcpy(&ss, &in6, sizeof(in6));
+    ss_len = (x07_socklen_t)sizeof(in6);
+  } else {
+    return X07_NET_ERR_INVALID_REQ;
+  }
+
+  if (a->tag != X07_NET_ADDR_TAG_DNS) {
+    uint32_t err = x07_ext_tcp_connect_addr((struct sockaddr*)&ss, ss_len, c->connect_timeout_ms, &fd);
+    if (err != 0) return err;
+  }
+
+  *out_fd = fd;
+  return 0;
+}
+
+// ---- TLS client context cache + session resumption ----
+//
+// Context construction (option setup, cert-store loading via the default
+// verify paths) is identical for every client stream except for the verify
+// mode, so two shared SSL_CTX instances cover all connections. Completed
+// sessions are cached keyed by SNI host + port + verify mode and handed
+// back to the next handshake to the same peer, so reconnects to the same
+// few upstreams run abbreviated handshakes. A cached session is consumed
+// on use (TLS 1.3 tickets are single-use); the server's replacement
+// tickets repopulate the cache via the new-session callback.
+
+typedef struct x07TlsPeerKey {
+  uint32_t verify;
+  uint32_t port;
+  uint32_t host_len;
+  char host[256]; // lowered; longest legal hostname is 253 bytes
+} x07TlsPeerKey;
+
+#define X07_EXT_SOCKETS_TLS_SESS_SLOTS 16u
+
+typedef struct x07TlsSessSlot {
+  x07TlsPeerKey key;
+  SSL_SESSION* sess; // NULL = slot empty
+  uint64_t stamp;
+} x07TlsSessSlot;
+
+static SSL_CTX* g_tls_client_ctx[2]; // indexed by verify_peer
+static int g_tls_sess_key_index = -1; // SSL ex_data slot holding the peer key
+static x07TlsSessSlot g_tls_sess[X07_EXT_SOCKETS_TLS_SESS_SLOTS];
+static uint64_t g_tls_sess_clock;
+
+static int x07_ext_tls_peer_key_eq(const x07TlsPeerKey* a, const x07TlsPeerKey* b) {
+  return a->verify == b->verify && a->port == b->port && a->host_len == b->host_len &&
+         memcmp(a->host, b->host, a->host_len) == 0;
+}
+
+static void x07_ext_tls_peer_key_free(void* parent, void* ptr, CRYPTO_EX_DATA* ad, int idx, long argl, void* argp) {
+  (void)parent;
+  (void)ad;
+  (void)idx;
+  (void)argl;
+  (void)argp;
+  free(ptr);
+}
+
+// New-session callback: fires when the handshake (or, for TLS 1.3, a
+// post-handshake ticket) produces a cacheable session. Returning 1 keeps
+// the reference.
+static int x07_ext_tls_sess_new_cb(SSL* ssl, SSL_SESSION* sess) {
+  const x07TlsPeerKey* key = NULL;
+  if (g_tls_sess_key_index >= 0) {
+    key = (const x07TlsPeerKey*)SSL_get_ex_data(ssl, g_tls_sess_key_index);
+  }
+  if (!key) return 0;
+
+  x07TlsSessSlot* victim = &g_tls_sess[0];
+  for (uint32_t i = 0; i < X07_EXT_SOCKETS_TLS_SESS_SLOTS; i++) {
+    x07TlsSessSlot* s = &g_tls_sess[i];
+    if (s->sess && x07_ext_tls_peer_key_eq(&s->key, key)) {
+      victim = s;
+      break;
+    }
+    if (!s->sess) {
+      if (victim->sess) victim = s;
+      continue;
+    }
+    if (victim->sess && s->stamp < victim->stamp) victim = s;
+  }
+  if (victim->sess) SSL_SESSION_free(victim->sess);
+  victim->key = *key;
+  victim->sess = sess;
+  victim->stamp = ++g_tls_sess_clock;
+  return 1;
+}
+
+// Removes and returns the cached session for a peer (caller owns the ref),
+// or NULL.
+static SSL_SESSION* x07_ext_tls_sess_take(const x07TlsPeerKey* key) {
+  for (uint32_t i = 0; i < X07_EXT_SOCKETS_TLS_SESS_SLOTS; i++) {
+    x07TlsSessSlot* s = &g_tls_sess[i];
+    if (s->sess && x07_ext_tls_peer_key_eq(&s->key, key)) {
+      SSL_SESSION* sess = s->sess;
+      s->sess = NULL;
+      return sess;
+    }
+  }
+  return NULL;
+}
+
+static SSL_CTX* x07_ext_tls_client_ctx(uint32_t verify) {
+  verify = verify ? 1u : 0u;
+  if (g_tls_client_ctx[verify]) return g_tls_client_ctx[verify];
+
+  SSL_CTX* ctx = SSL_CTX_new(TLS_client_method());
+  if (!ctx) return NULL;
+
+  // Disable legacy protocols unconditionally.
+  (void)SSL_CTX_set_options(ctx, SSL_OP_NO_SSLv2 | SSL_OP_NO_SSLv3);
+
+  if (verify) {
+    SSL_CTX_set_verify(ctx, SSL_VERIFY_PEER, NULL);
+    if (SSL_CTX_set_default_verify_paths(ctx) != 1) {
+      SSL_CTX_free(ctx);
+      return NULL;
+    }
+  } else {
+    SSL_CTX_set_verify(ctx, SSL_VERIFY_NONE, NULL);
+  }
+
+  if (g_tls_sess_key_index < 0) {
+    g_tls_sess_key_index = SSL_get_ex_new_index(0, NULL, NULL, NULL, x07_ext_tls_peer_key_free);
+  }
+  (void)SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+  SSL_CTX_sess_set_new_cb(ctx, x07_ext_tls_sess_new_cb);
+
+  g_tls_client_ctx[verify] = ctx;
+  return ctx;
+}
+
+static uint32_t x07_ext_tls_client_handshake(
+  x07_sock_t fd,
+  const x07TlsClientCfgV1* cfg,
+  uint32_t port,
+  uint32_t timeout_ms,
+  SSL** out_ssl
+) {
+  if (out_ssl) *out_ssl = NULL;
+  if (!cfg || !out_ssl) return X07_NET_ERR_INTERNAL;
+
+  SSL_CTX* ctx = x07_ext_tls_client_ctx(cfg->verify_peer);
+  if (!ctx) return X07_NET_ERR_INTERNAL;
+
+  SSL* ssl = SSL_new(ctx);
+  if (!ssl) {
+    return X07_NET_ERR_INTERNAL;
+  }
+
+  // Attach the peer key for the session cache; the ex_data free hook owns
+  // it from here, so every SSL_free below also releases the key.
+  if (cfg->sni && cfg->sni_len && cfg->sni_len <= 255u && g_tls_sess_key_index >= 0) {
+    x07TlsPeerKey* key = (x07TlsPeerKey*)calloc(1, sizeof(*key));
+    if (key) {
+      key->verify = cfg->verify_peer ? 1u : 0u;
+      key->port = port;
+      key->host_len = cfg->sni_len;
+      for (uint32_t i = 0; i < cfg->sni_len; i++) {
+        key->host[i] = (char)x07_ext_ascii_lower(cfg->sni[i]);
+      }
+      if (SSL_set_ex_data(ssl, g_tls_sess_key_index, key) == 1) {
+        SSL_SESSION* sess = x07_ext_tls_sess_take(key);
+        if (sess) {
+          (void)SSL_set_session(ssl, sess); // up-refs; drop ours either way
+          SSL_SESSION_free(sess);
+        }
+      } else {
+        free(key);
+      }
+    }
+  }
+
+  if (cfg->sni && cfg->sni_len) {
+    char sni_raw[1025];
+    if (cfg->sni_len > 1024u) {
+      SSL_free(ssl);
+      return X07_NET_ERR_INVALID_REQ;
+    }
+    memcpy(sni_raw, cfg->sni, (size_t)cfg->sni_len);
+    sni_raw[cfg->sni_len] = '\0';
+
+    const char* sni = sni_raw;
+    size_t sni_len = (size_t)cfg->sni_len;
+    if (sni_len >= 2 && sni[0] == '[' && sni[sni_len - 1] == ']') {
+      sni += 1;
+      sni_len -= 2;
+    }
+
+    int sni_is_ip = 0;
+    {
+      int fam = 0;
+      uint8_t ip[16];
+      memset(ip, 0, sizeof(ip));
+      sni_is_ip = x07_ext_parse_ip_bytes((const uint8_t*)sni, sni_len, &fam, ip);
+    }
+
+    if (!sni_is_ip) {
+      if (SSL_set_tlsext_host_name(ssl, sni) != 1) {
+        SSL_free(ssl);
+        return X07_NET_ERR_TLS;
+      }
+      if (cfg->verify_peer) {
+        X509_VERIFY_PARAM* param = SSL_get0_param(ssl);
+        (void)X509_VERIFY_PARAM_set_hostflags(param, X509_CHECK_FLAG_NO_PARTIAL_WILDCARDS);
+        if (X509_VERIFY_PARAM_set1_host(param, sni, 0) != 1) {
+          SSL_free(ssl);
+          return X07_NET_ERR_TLS;
+        }
+      }
+    } else {
+      if (cfg->verify_peer) {
+        char ip_str[1025];
+        if (sni_len > 1024u) {
+          SSL_free(ssl);
+          return X07_NET_ERR_INVALID_REQ;
+        }
+        memcpy(ip_str, sni, sni_len);
+        ip_str[sni_len] = '\0';
+
+        X509_VERIFY_PARAM* param = SSL_get0_param(ssl);
+        if (X509_VERIFY_PARAM_set1_ip_asc(param, ip_str) != 1) {
+          SSL_free(ssl);
+          return X07_NET_ERR_TLS;
+        }
+      }
+    }
+  }
+
+  if (SSL_set_fd(ssl, fd) != 1) {
+    SSL_free(ssl);
+    return X07_NET_ERR_TLS;
+  }
+
+  for (;;) {
+    ERR_clear_error();
+    int rc = SSL_connect(ssl);
+    if (rc == 1) break;
+
+    int err = SSL_get_error(ssl, rc);
+    if (err == SSL_ERROR_WANT_READ) {
+      int revents = 0;
+      int prc = x07_ext_poll_one(fd, POLLIN, (int)timeout_ms, &revents);
+      if (prc == 0) {
+        SSL_free(ssl);
+        return X07_NET_ERR_TIMEOUT;
+      }
+      if (prc < 0) {
+        SSL_free(ssl);
+        return X07_NET_ERR_INTERNAL;
+      }
+      continue;
+    }
+    if (err == SSL_ERROR_WANT_WRITE) {
+      int revents = 0;
+      int prc = x07_ext_poll_one(fd, POLLOUT, (int)timeout_ms, &revents);
+      if (prc == 0) {
+        SSL_free(ssl);
+        return X07_NET_ERR_TIMEOUT;
+      }
+      if (prc < 0) {
+        SSL_free(ssl);
+        return X07_NET_ERR_INTERNAL;
+      }
+      continue;
+    }
+
+    SSL_free(ssl);
+    return X07_NET_ERR_TLS;
+  }
+
+  *out_ssl = ssl;
+  return 0;
+}
+
+static int x07_ext_sockaddr_to_netaddr_v1(const struct sockaddr* sa, uint32_t port_override, uint8_t** out_bytes, uint32_t* out_len) {
+  if (out_bytes) *out_bytes = NULL;
+  if (out_len) *out_len = 0;
+  if (!sa) return 0;
+
+  if (sa->sa_family == AF_INET) {
+    const struct sockaddr_in* in = (const struct sockaddr_in*)sa;
+    uint8_t ip[4];
+    memcpy(ip, &in->sin_addr, 4);
+    uint32_t port = port_override ? port_override : (uint32_t)ntohs(in->sin_port);
+    uint32_t len = x07_ext_netaddr_ipv4_len();
+    uint8_t* b = (uint8_t*)malloc((size_t)len);
+    if (!b) return 0;
+    x07_ext_build_netaddr_ipv4(b, ip, port);
+    if (out_bytes) *out_bytes = b;
+    if (out_len) *out_len = len;
+    return 1;
+  }
+  if (sa->sa_family == AF_INET6) {
+    const struct sockaddr_in6* in6 = (const struct sockaddr_in6*)sa;
+    uint8_t ip[16];
+    memcpy(ip, &in6->sin6_addr, 16);
+    uint32_t port = port_override ? port_override : (uint32_t)ntohs(in6->sin6_port);
+    uint32_t len = x07_ext_netaddr_ipv6_len();
+    uint8_t* b = (uint8_t*)malloc((size_t)len);
+    if (!b) return 0;
+    x07_ext_build_netaddr_ipv6(b, ip, port);
+    if (out_bytes) *out_bytes = b;
+    if (out_len) *out_len = len;
+    return 1;
+  }
+  return 0;
+}
+
+static int x07_ext_addr_policy_check_sandboxed(const x07NetAddrV1* addr, uint32_t op_port) {
+  if (!addr) return 0;
+  const x07NetPolicy* pol = x07_ext_net_policy();
+  if (!pol->sandboxed) return 1;
+
+  if (!pol->net) return 0;
+  if (!pol->have_hosts) return 0;
+
+  uint32_t port = op_port ? op_port : addr->port;
+  if (port == 0) return 0;
+
+  if (addr->tag == X07_NET_ADDR_TAG_DNS) {
+    if (!pol->dns) return 0;
+    return x07_ext_policy_host_port_allowed(pol, addr->dns, (size_t)addr->dns_len, port);
+  }
+  if (addr->tag == X07_NET_ADDR_TAG_IPV4) {
+    return x07_ext_policy_ip_allowed(pol, AF_INET, addr->ip, port);
+  }
+  if (addr->tag == X07_NET_ADDR_TAG_IPV6) {
+    return x07_ext_policy_ip_allowed(pol, AF_INET6, addr->ip, port);
+  }
+  return 0;
+}
+
+// ---- Doc builders ----
+
+static uint8_t* x07_ext_make_ok_handle_doc(uint32_t handle, uint32_t* out_len) {
+  uint8_t* buf = (uint8_t*)malloc(8);
+  if (!buf) return NULL;
+  buf[0] = 1;
+  buf[1] = 1;
+  buf[2] = 0;
+  buf[3] = 0;
+  x07_ext_write_u32_le(buf + 4, handle);
+  if (out_len) *out_len = 8;
+  return buf;
+}
+
+static uint8_t* x07_ext_make_ok_wait_doc(uint32_t events, uint32_t* out_len) {
+  uint8_t* buf = (uint8_t*)malloc(8);
+  if (!buf) return NULL;
+  buf[0] = 1;
+  buf[1] = 1;
+  buf[2] = 0;
+  buf[3] = 0;
+  x07_ext_write_u32_le(buf + 4, events);
+  if (out_len) *out_len = 8;
+  return buf;
+}
+
+static uint8_t* x07_ext_make_ok_write_doc(uint32_t bytes_written, uint32_t* out_len) {
+  return x07_ext_make_ok_wait_doc(bytes_written, out_len);
+}
+
+static uint8_t* x07_ext_make_ok_read_doc(const uint8_t* payload, uint32_t payload_len, uint32_t* out_len) {
+  uint64_t doc_len = 8ull + (uint64_t)payload_len;
+  if (doc_len > (uint64_t)UINT32_MAX) return NULL;
+  uint8_t* buf = (uint8_t*)malloc((size_t)doc_len);
+  if (!buf) return NULL;
+  buf[0] = 1;
+  buf[1] = 1;
+  buf[2] = 0;
+  buf[3] = 0;
+  x07_ext_write_u32_le(buf + 4, payload_len);
+  if (payload_len && payload) memcpy(buf + 8, payload, (size_t)payload_len);
+  if (out_len) *out_len = (uint32_t)doc_len;
+  return buf;
+}
+
+static uint8_t* x07_ext_make_ok_handle_addr_doc(uint32_t handle, const uint8_t* addr, uint32_t addr_len, uint32_t* out_len) {
+  uint64_t doc_len = 12ull + (uint64_t)addr_len;
+  if (doc_len > (uint64_t)UINT32_MAX) return NULL;
+  uint8_t* buf = (uint8_t*)malloc((size_t)doc_len);
+  if (!buf) return NULL;
+  buf[0] = 1;
+  buf[1] = 1;
+  buf[2] = 0;
+  buf[3] = 0;
+  x07_ext_write_u32_le(buf + 4, handle);
+  x07_ext_write_u32_le(buf + 8, addr_len);
+  if (addr_len && addr) memcpy(buf + 12, addr, (size_t)addr_len);
+  if (out_len) *out_len = (uint32_t)doc_len;
+  return buf;
+}
+
+static uint8_t* x07_ext_make_ok_handle_peer_doc(uint32_t handle, const uint8_t* peer_addr, uint32_t peer_addr_len, uint32_t* out_len) {
+  return x07_ext_make_ok_handle_addr_doc(handle, peer_addr, peer_addr_len, out_len);
+}
+
+static uint8_t* x07_ext_make_ok_dns_doc(uint32_t count, const uint8_t* addrs_blob, uint32_t addrs_blob_len, uint32_t* out_len) {
+  uint64_t doc_len = 8ull + (uint64_t)addrs_blob_len;
+  if (doc_len > (uint64_t)UINT32_MAX) return NULL;
+  uint8_t* buf = (uint8_t*)malloc((size_t)doc_len);
+  if (!buf) return NULL;
+  buf[0] = 1;
+  buf[1] = 1;
+  buf[2] = 0;
+  buf[3] = 0;
+  x07_ext_write_u32_le(buf + 4, count);
+  if (addrs_blob_len && addrs_blob) memcpy(buf + 8, addrs_blob, (size_t)addrs_blob_len);
+  if (out_len) *out_len = (uint32_t)doc_len;
+  return buf;
+}
+
+static int x07_ext_store_doc(uint8_t* doc, uint32_t doc_len, uint32_t* out_handle) {
+  if (out_handle) *out_handle = 0;
+  if (!doc || doc_len == 0) return 0;
+  uint32_t slot = x07_ext_sockets_alloc_buf_slot();
+  if (!slot) return 0;
+  g_bufs[slot] = doc;
+  g_lens[slot] = doc_len;
+  g_buf_caps[slot] = 0;
+  if (out_handle) *out_handle = slot;
+  return 1;
+}
+
+// Same, but for a pool-backed doc: buf_free returns it to the pool instead
+// of free().
+static int x07_ext_store_pooled_doc(uint8_t* doc, uint32_t doc_len, uint32_t pool_cap, uint32_t* out_handle) {
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) return 0;
+  if (out_handle && *out_handle) g_buf_caps[*out_handle] = pool_cap;
+  return 1;
+}
+
+static int32_t x07_ext_return_err(uint32_t code, uint32_t* out_handle) {
+  uint32_t len = 0;
+  uint8_t* doc = x07_ext_make_err_doc(code, &len);
+  if (!doc) return -1;
+  if (!x07_ext_store_doc(doc, len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+// ---- Public entrypoints (exported to X07 via extern) ----
+
+int32_t x07_ext_sockets_dns_lookup_alloc(
+  const uint8_t* name,
+  uint32_t name_len,
+  uint32_t port,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_parse_caps_v1(caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (!name || name_len == 0 || name_len > 1024u) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (memchr(name, 0, name_len) != NULL) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (port == 0 || port > 65535u) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  const x07NetPolicy* pol = x07_ext_net_policy();
+  int sandboxed = pol->sandboxed;
+  if (sandboxed) {
+    if (!pol->net) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!pol->dns) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!pol->have_hosts) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!x07_ext_policy_host_port_allowed(pol, name, (size_t)name_len, port)) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+  }
+
+  char host[1025];
+  memcpy(host, name, (size_t)name_len);
+  host[name_len] = '\0';
+
+  char service[16];
+  snprintf(service, sizeof(service), "%u", (unsigned)port);
+
+  struct addrinfo hints;
+  memset(&hints, 0, sizeof(hints));
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  hints.ai_protocol = IPPROTO_TCP;
+
+  struct addrinfo* res = NULL;
+  int gai = getaddrinfo(host, service, &hints, &res);
+  if (gai != 0 || !res) return x07_ext_return_err(X07_NET_ERR_DNS, out_handle);
+
+  // Pack as: repeated (addr_len:u32_le + addr_bytes[addr_len]).
+  uint8_t addrs_tmp[64 * 64];
+  uint32_t addrs_len = 0;
+  uint32_t count = 0;
+
+  for (struct addrinfo* it = res; it && count < 64u; it = it->ai_next) {
+    if (sandboxed && !x07_ext_policy_sockaddr_allowed(pol, it->ai_addr, port)) continue;
+
+    uint8_t* addr_bytes = NULL;
+    uint32_t addr_len = 0;
+    if (!x07_ext_sockaddr_to_netaddr_v1(it->ai_addr, port, &addr_bytes, &addr_len)) continue;
+    if (addr_len == 0 || addr_len > 128u) {
+      free(addr_bytes);
+      continue;
+    }
+    if (addrs_len > sizeof(addrs_tmp) || (uint32_t)sizeof(addrs_tmp) - addrs_len < 4u + addr_len) {
+      free(addr_bytes);
+      break;
+    }
+    x07_ext_write_u32_le(addrs_tmp + addrs_len, addr_len);
+    addrs_len += 4u;
+    memcpy(addrs_tmp + addrs_len, addr_bytes, addr_len);
+    addrs_len += addr_len;
+    free(addr_bytes);
+    count += 1;
+  }
+  freeaddrinfo(res);
+
+  if (sandboxed && count == 0) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_dns_doc(count, addrs_tmp, addrs_len, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tcp_connect_alloc(
+  const uint8_t* addr,
+  uint32_t addr_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_parse_caps_v1(caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetAddrV1 a;
+  if (!x07_ext_parse_addr_v1(addr, addr_len, &a)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07_sock_t fd = X07_SOCK_INVALID;
+  uint32_t err = x07_ext_tcp_connect_fd_v1(&a, &c, &fd);
+  if (err != 0) return x07_ext_return_err(err, out_handle);
+
+  uint32_t stream_handle = x07_ext_sockets_alloc_sock_slot(X07_SOCK_KIND_TCP_STREAM, fd);
+  if (!stream_handle) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_handle_doc(stream_handle, &doc_len);
+  if (!doc) {
+    (void)x07_ext_sockets_sock_drop(stream_handle, X07_SOCK_KIND_TCP_STREAM);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    (void)x07_ext_sockets_sock_drop(stream_handle, X07_SOCK_KIND_TCP_STREAM);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tls_connect_alloc(
+  const uint8_t* addr,
+  uint32_t addr_len,
+  const uint8_t* tls_cfg,
+  uint32_t tls_cfg_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_parse_caps_v1(caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetAddrV1 a;
+  if (!x07_ext_parse_addr_v1(addr, addr_len, &a)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07TlsClientCfgV1 t;
+  if (!x07_ext_parse_tls_client_cfg_v1(tls_cfg, tls_cfg_len, &a, &t)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07_sock_t fd = X07_SOCK_INVALID;
+  uint32_t err = x07_ext_tcp_connect_fd_v1(&a, &c, &fd);
+  if (err != 0) return x07_ext_return_err(err, out_handle);
+
+  SSL* ssl = NULL;
+  err = x07_ext_tls_client_handshake(fd, &t, a.port, c.connect_timeout_ms, &ssl);
+  if (err != 0) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(err, out_handle);
+  }
+
+  uint32_t stream_handle = x07_ext_sockets_alloc_sock_slot(X07_SOCK_KIND_TLS_STREAM, fd);
+  if (!stream_handle) {
+    SSL_free(ssl);
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  x07TlsEntry* te = x07_ext_sockets_tls_ptr(stream_handle);
+  te->ssl = ssl;
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_handle_doc(stream_handle, &doc_len);
+  if (!doc) {
+    (void)x07_ext_sockets_sock_drop(stream_handle, X07_SOCK_KIND_TLS_STREAM);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    (void)x07_ext_sockets_sock_drop(stream_handle, X07_SOCK_KIND_TLS_STREAM);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tcp_listen_alloc(
+  const uint8_t* addr,
+  uint32_t addr_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_parse_caps_v1(caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetAddrV1 a;
+  if (!x07_ext_parse_addr_v1(addr, addr_len, &a)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (a.tag != X07_NET_ADDR_TAG_IPV4 && a.tag != X07_NET_ADDR_TAG_IPV6) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  const x07NetPolicy* pol = x07_ext_net_policy();
+  if (pol->sandboxed) {
+    if (!pol->net) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!pol->tcp) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!x07_ext_addr_policy_check_sandboxed(&a, a.port)) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+  }
+
+  struct sockaddr_storage ss;
+  x07_socklen_t ss_len = 0;
+  memset(&ss, 0, sizeof(ss));
+
+  if (a.tag == X07_NET_ADDR_TAG_IPV4) {
+    struct sockaddr_in in;
+    memset(&in, 0, sizeof(in));
+    in.sin_family = AF_INET;
+    in.sin_port = htons((uint16_t)a.port);
+    memcpy(&in.sin_addr, a.ip, 4);
+    memcpy(&ss, &in, sizeof(in));
+    ss_len = (x07_socklen_t)sizeof(in);
+  } else {
+    struct sockaddr_in6 in6;
+    memset(&in6, 0, sizeof(in6));
+    in6.sin6_family = AF_INET6;
+    in6.sin6_port = htons((uint16_t)a.port);
+    memcpy(&in6.sin6_addr, a.ip, 16);
+    memcpy(&ss, &in6, sizeof(in6));
+    ss_len = (x07_socklen_t)sizeof(in6);
+  }
+
+  x07_sock_t fd = socket(ss.ss_family, SOCK_STREAM, IPPROTO_TCP);
+  if (fd == X07_SOCK_INVALID) return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+
+  int opt = 1;
+  (void)setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &opt, (x07_socklen_t)sizeof(opt));
+
+  if (bind(fd, (struct sockaddr*)&ss, (x07_socklen_t)ss_len) != 0) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  }
+  if (listen(fd, 128) != 0) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  }
+  if (!x07_ext_sock_set_nonblocking(fd)) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  // Discover bound addr (port=0).
+  struct sockaddr_storage bound;
+  x07_socklen_t bound_len = (x07_socklen_t)sizeof(bound);
+  memset(&bound, 0, sizeof(bound));
+  if (getsockname(fd, (struct sockaddr*)&bound, &bound_len) != 0) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint8_t* bound_addr = NULL;
+  uint32_t bound_addr_len = 0;
+  if (!x07_ext_sockaddr_to_netaddr_v1((struct sockaddr*)&bound, 0, &bound_addr, &bound_addr_len)) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  if (pol->sandboxed) {
+    x07NetAddrV1 ba;
+    if (!x07_ext_parse_addr_v1(bound_addr, bound_addr_len, &ba) || !x07_ext_addr_policy_check_sandboxed(&ba, ba.port)) {
+      free(bound_addr);
+      (void)x07_sock_close(fd);
+      return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    }
+  }
+
+  uint32_t listener_handle = x07_ext_sockets_alloc_sock_slot(X07_SOCK_KIND_TCP_LISTENER, fd);
+  if (!listener_handle) {
+    free(bound_addr);
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_handle_addr_doc(listener_handle, bound_addr, bound_addr_len, &doc_len);
+  free(bound_addr);
+  if (!doc) {
+    (void)x07_ext_sockets_sock_drop(listener_handle, X07_SOCK_KIND_TCP_LISTENER);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    (void)x07_ext_sockets_sock_drop(listener_handle, X07_SOCK_KIND_TCP_LISTENER);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tcp_accept_alloc(
+  uint32_t listener_handle,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(listener_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(listener_handle);
+  if (!e || e->kind != X07_SOCK_KIND_TCP_LISTENER || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLIN, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  struct sockaddr_storage peer;
+  x07_socklen_t peer_len = (x07_socklen_t)sizeof(peer);
+  memset(&peer, 0, sizeof(peer));
+  x07_sock_t fd = accept(e->fd, (struct sockaddr*)&peer, &peer_len);
+  if (fd == X07_SOCK_INVALID) return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  if (!x07_ext_sock_set_nonblocking(fd)) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint8_t* peer_addr = NULL;
+  uint32_t peer_addr_len = 0;
+  if (!x07_ext_sockaddr_to_netaddr_v1((struct sockaddr*)&peer, 0, &peer_addr, &peer_addr_len)) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t stream_handle = x07_ext_sockets_alloc_sock_slot(X07_SOCK_KIND_TCP_STREAM, fd);
+  if (!stream_handle) {
+    free(peer_addr);
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_handle_peer_doc(stream_handle, peer_addr, peer_addr_len, &doc_len);
+  free(peer_addr);
+  if (!doc) {
+    (void)x07_ext_sockets_sock_drop(stream_handle, X07_SOCK_KIND_TCP_STREAM);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    (void)x07_ext_sockets_sock_drop(stream_handle, X07_SOCK_KIND_TCP_STREAM);
+    return -1;
+  }
+  return 0;
+}
+
+static int32_t x07_ext_sockets_tls_stream_read_alloc(
+  uint32_t stream_handle,
+  uint32_t max_bytes,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+);
+
+static int32_t x07_ext_sockets_tls_stream_write_alloc(
+  uint32_t stream_handle,
+  const uint8_t* data,
+  uint32_t data_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+);
+
+static int32_t x07_ext_sockets_tls_stream_wait_alloc(
+  uint32_t stream_handle,
+  uint32_t events,
+  int32_t timeout_ms,
+  uint32_t* out_handle
+);
+
+int32_t x07_ext_sockets_tcp_stream_read_alloc(
+  uint32_t stream_handle,
+  uint32_t max_bytes,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (e->kind == X07_SOCK_KIND_TLS_STREAM) {
+    return x07_ext_sockets_tls_stream_read_alloc(stream_handle, max_bytes, caps, caps_len, out_handle);
+  }
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(stream_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (max_bytes > c.max_read_bytes) max_bytes = c.max_read_bytes;
+
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLIN, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  // Direct fill: recv lands in the doc's payload region, so the steady
+  // state is one pooled buffer reused across reads with no copy.
+  uint32_t pool_cap = 0;
+  uint8_t* doc = x07_ext_sockets_pool_get(8u + max_bytes, &pool_cap);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  ssize_t got = recv(e->fd, doc + 8, (size_t)max_bytes, 0);
+  if (got < 0) {
+    int err = x07_sock_errno();
+    x07_ext_sockets_pool_put(doc, pool_cap);
+    if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+    return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  }
+  uint32_t payload_len = (got > 0) ? (uint32_t)got : 0u;
+
+  doc[0] = 1;
+  doc[1] = 1;
+  doc[2] = 0;
+  doc[3] = 0;
+  x07_ext_write_u32_le(doc + 4, payload_len);
+  if (!x07_ext_store_pooled_doc(doc, 8u + payload_len, pool_cap, out_handle)) {
+    x07_ext_sockets_pool_put(doc, pool_cap);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tcp_stream_write_alloc(
+  uint32_t stream_handle,
+  const uint8_t* data,
+  uint32_t data_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (e->kind == X07_SOCK_KIND_TLS_STREAM) {
+    return x07_ext_sockets_tls_stream_write_alloc(stream_handle, data, data_len, caps, caps_len, out_handle);
+  }
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(stream_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (data_len > c.max_write_bytes) return x07_ext_return_err(X07_NET_ERR_TOO_LARGE, out_handle);
+
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLOUT, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  uint32_t wrote = 0;
+  if (data_len != 0) {
+    ssize_t n = send(e->fd, data, (size_t)data_len, 0);
+    if (n < 0) {
+      int err = x07_sock_errno();
+      if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+      return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+    }
+    if (n > 0) wrote = (uint32_t)n;
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_write_doc(wrote, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+// Vectored write. Framed protocols (length prefix + header + body) keep the
+// pieces in separate buffers; a writev submission sends them in one syscall
+// without assembling a contiguous copy first.
+typedef struct x07SockWriteVecV1 {
+  const uint8_t* ptr;
+  uint32_t len;
+} x07SockWriteVecV1;
+
+// At most this many non-empty segments go into one writev; extra segments
+// are left for the caller to resubmit, exactly like a partial write
+// (IOV_MAX is at least 1024 everywhere we run, so 64 never trips EINVAL).
+#define X07_EXT_SOCKETS_WRITEV_MAX_SEGS 64u
+// Frames at or below this total are packed into a stack buffer and sent
+// with a single send(): below MTU size the iovec setup costs more than the
+// copy.
+#define X07_EXT_SOCKETS_COALESCE_BYTES 1400u
+
+int32_t x07_ext_sockets_tcp_stream_writev_alloc(
+  uint32_t stream_handle,
+  const x07SockWriteVecV1* vecs,
+  uint32_t vec_count,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (vec_count != 0 && !vecs) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(stream_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  uint64_t total64 = 0;
+  for (uint32_t i = 0; i < vec_count; i++) {
+    if (vecs[i].len != 0 && !vecs[i].ptr) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+    total64 += vecs[i].len;
+  }
+  if (total64 > (uint64_t)c.max_write_bytes) return x07_ext_return_err(X07_NET_ERR_TOO_LARGE, out_handle);
+  uint32_t total = (uint32_t)total64;
+
+  if (e->kind == X07_SOCK_KIND_TLS_STREAM) {
+    // SSL_write has no scatter form; assemble one buffer so the frame goes
+    // out as one record sequence instead of a record per segment.
+    if (total == 0) return x07_ext_sockets_tls_stream_write_alloc(stream_handle, NULL, 0, caps, caps_len, out_handle);
+    uint8_t small[X07_EXT_SOCKETS_COALESCE_BYTES];
+    uint8_t* buf = small;
+    if (total > sizeof(small)) {
+      buf = (uint8_t*)malloc(total);
+      if (!buf) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+    }
+    uint32_t off = 0;
+    for (uint32_t i = 0; i < vec_count; i++) {
+      if (vecs[i].len == 0) continue;
+      memcpy(buf + off, vecs[i].ptr, vecs[i].len);
+      off += vecs[i].len;
+    }
+    int32_t rc = x07_ext_sockets_tls_stream_write_alloc(stream_handle, buf, total, caps, caps_len, out_handle);
+    if (buf != small) free(buf);
+    return rc;
+  }
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLOUT, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  uint32_t wrote = 0;
+  if (total != 0) {
+    ssize_t n;
+    if (total <= X07_EXT_SOCKETS_COALESCE_BYTES && vec_count > 1) {
+      uint8_t small[X07_EXT_SOCKETS_COALESCE_BYTES];
+      uint32_t off = 0;
+      for (uint32_t i = 0; i < vec_count; i++) {
+        if (vecs[i].len == 0) continue;
+        memcpy(small + off, vecs[i].ptr, vecs[i].len);
+        off += vecs[i].len;
+      }
+      n = send(e->fd, small, (size_t)off, 0);
+    } else {
+      struct iovec iov[X07_EXT_SOCKETS_WRITEV_MAX_SEGS];
+      int iov_count = 0;
+      for (uint32_t i = 0; i < vec_count && iov_count < (int)X07_EXT_SOCKETS_WRITEV_MAX_SEGS; i++) {
+        if (vecs[i].len == 0) continue;
+        iov[iov_count].iov_base = (void*)(uintptr_t)vecs[i].ptr;
+        iov[iov_count].iov_len = (size_t)vecs[i].len;
+        iov_count++;
+      }
+      n = writev(e->fd, iov, iov_count);
+    }
+    if (n < 0) {
+      int err = x07_sock_errno();
+      if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+      return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+    }
+    if (n > 0) wrote = (uint32_t)n;
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_write_doc(wrote, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tcp_stream_wait_alloc(
+  uint32_t stream_handle,
+  uint32_t events,
+  int32_t timeout_ms,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (timeout_ms < 0) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (e->kind == X07_SOCK_KIND_TLS_STREAM) {
+    return x07_ext_sockets_tls_stream_wait_alloc(stream_handle, events, timeout_ms, out_handle);
+  }
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  int pevents = 0;
+  if ((events & 1u) != 0u) pevents |= POLLIN;
+  if ((events & 2u) != 0u) pevents |= POLLOUT;
+  // Hangup is reported via revents.
+
+  int revents = 0;
+  int prc = x07_ext_poll_one(e->fd, pevents, timeout_ms, &revents);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  uint32_t out_events = 0;
+  if (prc == 0) {
+    out_events = 0;
+  } else {
+    if ((revents & POLLIN) != 0) out_events |= 1u;
+    if ((revents & POLLOUT) != 0) out_events |= 2u;
+    if ((revents & (POLLHUP | POLLERR | POLLNVAL)) != 0) out_events |= 4u;
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_wait_doc(out_events, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+// Batch wait across many socket handles. `handles` is a packed array of
+// u32-le socket handles (any live kind; a readable listener means a pending
+// accept). Ok doc: ready_count:u32 followed by ready_count pairs of
+// (handle:u32, events:u32) with the same event bits as the single-handle
+// waits (1 readable, 2 writable, 4 hup/err); a timeout yields an ok doc with
+// ready_count == 0. Readiness discovered here is also folded into the cache,
+// so the follow-up reads and writes skip their pre-syscall poll.
+int32_t x07_ext_sockets_wait_many_alloc(
+  const uint8_t* handles,
+  uint32_t handles_len,
+  int32_t timeout_ms,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (timeout_ms < 0) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (!handles || handles_len == 0u || (handles_len % 4u) != 0u) {
+    return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  }
+  uint32_t count = handles_len / 4u;
+  if (count > X07_EXT_SOCKETS_MAX_SOCKS) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  uint32_t* hs = (uint32_t*)malloc((size_t)count * sizeof(uint32_t));
+  x07SockSlot** slots = (x07SockSlot**)malloc((size_t)count * sizeof(x07SockSlot*));
+  struct pollfd* pfds = (struct pollfd*)malloc((size_t)count * sizeof(struct pollfd));
+  if (!hs || !slots || !pfds) {
+    free(hs);
+    free(slots);
+    free(pfds);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  for (uint32_t i = 0; i < count; i++) {
+    uint32_t pos = i * 4u;
+    uint32_t h = 0;
+    (void)x07_ext_read_u32_le(handles, handles_len, &pos, &h);
+    x07SockEntry* e = x07_ext_sockets_sock_ptr(h);
+    if (!e || e->closed) {
+      free(hs);
+      free(slots);
+      free(pfds);
+      return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+    }
+    hs[i] = h;
+    slots[i] = x07_ext_sockets_slot_of(e);
+    memset(&pfds[i], 0, sizeof(pfds[i]));
+    pfds[i].fd = e->fd;
+    pfds[i].events = POLLIN | POLLOUT;
+  }
+
+  int64_t deadline = x07_ext_now_ms() + (int64_t)timeout_ms;
+
+  for (;;) {
+    // Level snapshot of the requested set (also catches state the
+    // edge-triggered cache may have missed), folded into the cache.
+    int prc = poll(pfds, (nfds_t)count, 0);
+    if (prc < 0 && x07_sock_errno() != EINTR) {
+      free(hs);
+      free(slots);
+      free(pfds);
+      return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+    }
+    uint32_t ready = 0;
+    for (uint32_t i = 0; i < count; i++) {
+      uint8_t bits = slots[i]->ready;
+      if (prc > 0) {
+        if ((pfds[i].revents & POLLIN) != 0) bits |= X07_SOCK_READY_IN;
+        if ((pfds[i].revents & POLLOUT) != 0) bits |= X07_SOCK_READY_OUT;
+        if ((pfds[i].revents & (POLLHUP | POLLERR | POLLNVAL)) != 0) bits |= X07_SOCK_READY_ERR;
+      }
+      // Decrypted record bytes buffered inside the TLS object count as
+      // readable even when the fd itself is quiet.
+      if (slots[i]->e.kind == X07_SOCK_KIND_TLS_STREAM && slots[i]->tls.ssl &&
+          SSL_pending(slots[i]->tls.ssl) > 0) {
+        bits |= X07_SOCK_READY_IN;
+      }
+      slots[i]->ready = bits;
+      if (bits != 0) ready++;
+    }
+
+    int64_t remaining = deadline - x07_ext_now_ms();
+    if (ready > 0 || remaining <= 0) {
+      uint8_t* doc = (uint8_t*)malloc(8u + (size_t)count * 8u);
+      if (!doc) {
+        free(hs);
+        free(slots);
+        free(pfds);
+        return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+      }
+      doc[0] = 1;
+      doc[1] = 1;
+      doc[2] = 0;
+      doc[3] = 0;
+      uint32_t written = 0;
+      for (uint32_t i = 0; i < count; i++) {
+        uint8_t bits = slots[i]->ready;
+        uint32_t ev = 0;
+        if ((bits & X07_SOCK_READY_IN) != 0) ev |= 1u;
+        if ((bits & X07_SOCK_READY_OUT) != 0) ev |= 2u;
+        if ((bits & X07_SOCK_READY_ERR) != 0) ev |= 4u;
+        if (ev == 0) continue;
+        x07_ext_write_u32_le(doc + 8 + written * 8u, hs[i]);
+        x07_ext_write_u32_le(doc + 12 + written * 8u, ev);
+        written++;
+      }
+      x07_ext_write_u32_le(doc + 4, written);
+      free(hs);
+      free(slots);
+      free(pfds);
+      if (!x07_ext_store_doc(doc, 8u + written * 8u, out_handle)) {
+        free(doc);
+        return -1;
+      }
+      return 0;
+    }
+
+    int wait_ms = remaining > (int64_t)INT_MAX ? INT_MAX : (int)remaining;
+    if (x07_ext_sockets_ready_pump(wait_ms) < 0) {
+      // No engine on this platform: block in one poll over the requested
+      // set; its results are folded at the top of the next iteration.
+      int brc = poll(pfds, (nfds_t)count, wait_ms);
+      if (brc < 0 && x07_sock_errno() != EINTR) {
+        free(hs);
+        free(slots);
+        free(pfds);
+        return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+      }
+    }
+  }
+}
+
+static int32_t x07_ext_sockets_tls_stream_read_alloc(
+  uint32_t stream_handle,
+  uint32_t max_bytes,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(stream_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (max_bytes > c.max_read_bytes) max_bytes = c.max_read_bytes;
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->kind != X07_SOCK_KIND_TLS_STREAM || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  SSL* ssl = x07_ext_sockets_slot_of(e)->tls.ssl;
+  if (!ssl) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  if (max_bytes == 0) {
+    uint32_t doc_len = 0;
+    uint8_t* doc = x07_ext_make_ok_read_doc(NULL, 0, &doc_len);
+    if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+    if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+      free(doc);
+      return -1;
+    }
+    return 0;
+  }
+
+  // Direct fill, as in the plain TCP read: SSL_read decrypts straight into
+  // the doc's payload region of a pool-recycled buffer.
+  uint32_t pool_cap = 0;
+  uint8_t* doc = x07_ext_sockets_pool_get(8u + max_bytes, &pool_cap);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  for (;;) {
+    ERR_clear_error();
+    int got = SSL_read(ssl, (char*)(doc + 8), (int)max_bytes);
+    if (got > 0) {
+      uint32_t payload_len = (uint32_t)got;
+      doc[0] = 1;
+      doc[1] = 1;
+      doc[2] = 0;
+      doc[3] = 0;
+      x07_ext_write_u32_le(doc + 4, payload_len);
+      if (!x07_ext_store_pooled_doc(doc, 8u + payload_len, pool_cap, out_handle)) {
+        x07_ext_sockets_pool_put(doc, pool_cap);
+        return -1;
+      }
+      return 0;
+    }
+
+    int err = SSL_get_error(ssl, got);
+    if (err == SSL_ERROR_ZERO_RETURN) {
+      doc[0] = 1;
+      doc[1] = 1;
+      doc[2] = 0;
+      doc[3] = 0;
+      x07_ext_write_u32_le(doc + 4, 0u);
+      if (!x07_ext_store_pooled_doc(doc, 8u, pool_cap, out_handle)) {
+        x07_ext_sockets_pool_put(doc, pool_cap);
+        return -1;
+      }
+      return 0;
+    }
+    if (err == SSL_ERROR_WANT_READ) {
+      int revents = 0;
+      int prc = x07_ext_sock_poll(e, POLLIN, (int)c.io_timeout_ms, &revents);
+      if (prc == 0) {
+        x07_ext_sockets_pool_put(doc, pool_cap);
+        return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+      }
+      if (prc < 0) {
+        x07_ext_sockets_pool_put(doc, pool_cap);
+        return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+      }
+      continue;
+    }
+    if (err == SSL_ERROR_WANT_WRITE) {
+      int revents = 0;
+      int prc = x07_ext_sock_poll(e, POLLOUT, (int)c.io_timeout_ms, &revents);
+      if (prc == 0) {
+        x07_ext_sockets_pool_put(doc, pool_cap);
+        return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+      }
+      if (prc < 0) {
+        x07_ext_sockets_pool_put(doc, pool_cap);
+        return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+      }
+      continue;
+    }
+
+    x07_ext_sockets_pool_put(doc, pool_cap);
+    return x07_ext_return_err(X07_NET_ERR_TLS, out_handle);
+  }
+}
+
+static int32_t x07_ext_sockets_tls_stream_write_alloc(
+  uint32_t stream_handle,
+  const uint8_t* data,
+  uint32_t data_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(stream_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (data_len > c.max_write_bytes) return x07_ext_return_err(X07_NET_ERR_TOO_LARGE, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->kind != X07_SOCK_KIND_TLS_STREAM || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  SSL* ssl = x07_ext_sockets_slot_of(e)->tls.ssl;
+  if (!ssl) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  uint32_t wrote = 0;
+  if (data_len != 0) {
+    for (;;) {
+      ERR_clear_error();
+      int n = SSL_write(ssl, (const char*)data, (int)data_len);
+      if (n > 0) {
+        wrote = (uint32_t)n;
+        break;
+      }
+
+      int err = SSL_get_error(ssl, n);
+      if (err == SSL_ERROR_WANT_READ) {
+        int revents = 0;
+        int prc = x07_ext_sock_poll(e, POLLIN, (int)c.io_timeout_ms, &revents);
+        if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+        if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+        continue;
+      }
+      if (err == SSL_ERROR_WANT_WRITE) {
+        int revents = 0;
+        int prc = x07_ext_sock_poll(e, POLLOUT, (int)c.io_timeout_ms, &revents);
+        if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+        if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+        continue;
+      }
+      return x07_ext_return_err(X07_NET_ERR_TLS, out_handle);
+    }
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_write_doc(wrote, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+static int32_t x07_ext_sockets_tls_stream_wait_alloc(
+  uint32_t stream_handle,
+  uint32_t events,
+  int32_t timeout_ms,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (timeout_ms < 0) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(stream_handle);
+  if (!e || e->kind != X07_SOCK_KIND_TLS_STREAM || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  SSL* ssl = x07_ext_sockets_slot_of(e)->tls.ssl;
+  if (!ssl) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  uint32_t out_events = 0;
+  if ((events & 1u) != 0u) {
+    if (SSL_pending(ssl) > 0) out_events |= 1u;
+  }
+
+  if (out_events == 0) {
+    int pevents = 0;
+    if ((events & 1u) != 0u) pevents |= POLLIN;
+    if ((events & 2u) != 0u) pevents |= POLLOUT;
+
+    int revents = 0;
+    int prc = x07_ext_poll_one(e->fd, pevents, timeout_ms, &revents);
+    if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+    if (prc != 0) {
+      if ((revents & POLLIN) != 0) out_events |= 1u;
+      if ((revents & POLLOUT) != 0) out_events |= 2u;
+      if ((revents & (POLLHUP | POLLERR | POLLNVAL)) != 0) out_events |= 4u;
+    }
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_wait_doc(out_events, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_tcp_stream_shutdown_v1(int32_t stream_handle, int32_t how) {
+  if (!x07_ext_wsa_ready()) return 0;
+  if (stream_handle <= 0) return 0;
+  x07SockEntry* e = x07_ext_sockets_sock_ptr((uint32_t)stream_handle);
+  if (!e || e->kind != X07_SOCK_KIND_TCP_STREAM || e->closed) return 0;
+
+  int sh = SHUT_RDWR;
+  if (how == 0) sh = SHUT_RD;
+  else if (how == 1) sh = SHUT_WR;
+  else if (how == 2) sh = SHUT_RDWR;
+  else return 0;
+  return shutdown(e->fd, sh) == 0 ? 1 : 0;
+}
+
+int32_t x07_ext_sockets_tcp_stream_close_v1(int32_t stream_handle) {
+  if (stream_handle <= 0) return 0;
+  x07SockEntry* e = x07_ext_sockets_sock_ptr((uint32_t)stream_handle);
+  if (!e || e->closed) return 0;
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM && e->kind != X07_SOCK_KIND_TLS_STREAM) return 0;
+  x07_ext_sockets_sock_close_in_place(e);
+  return 1;
+}
+
+int32_t x07_ext_sockets_tcp_stream_drop_v1(int32_t stream_handle) {
+  if (stream_handle <= 0) return 0;
+  x07SockEntry* e = x07_ext_sockets_sock_ptr((uint32_t)stream_handle);
+  if (!e) return 0;
+  if (e->kind != X07_SOCK_KIND_TCP_STREAM && e->kind != X07_SOCK_KIND_TLS_STREAM) return 0;
+  return x07_ext_sockets_sock_drop((uint32_t)stream_handle, e->kind);
+}
+
+int32_t x07_ext_sockets_tcp_listener_close_v1(int32_t listener_handle) {
+  if (listener_handle <= 0) return 0;
+  return x07_ext_sockets_sock_close((uint32_t)listener_handle, X07_SOCK_KIND_TCP_LISTENER);
+}
+
+int32_t x07_ext_sockets_tcp_listener_drop_v1(int32_t listener_handle) {
+  if (listener_handle <= 0) return 0;
+  return x07_ext_sockets_sock_drop((uint32_t)listener_handle, X07_SOCK_KIND_TCP_LISTENER);
+}
+
+int32_t x07_ext_sockets_udp_bind_alloc(
+  const uint8_t* addr,
+  uint32_t addr_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_parse_caps_v1(caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetAddrV1 a;
+  if (!x07_ext_parse_addr_v1(addr, addr_len, &a)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (a.tag != X07_NET_ADDR_TAG_IPV4 && a.tag != X07_NET_ADDR_TAG_IPV6) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  const x07NetPolicy* pol = x07_ext_net_policy();
+  if (pol->sandboxed) {
+    if (!pol->net) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!pol->udp) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!x07_ext_addr_policy_check_sandboxed(&a, a.port)) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+  }
+
+  struct sockaddr_storage ss;
+  x07_socklen_t ss_len = 0;
+  memset(&ss, 0, sizeof(ss));
+
+  if (a.tag == X07_NET_ADDR_TAG_IPV4) {
+    struct sockaddr_in in;
+    memset(&in, 0, sizeof(in));
+    in.sin_family = AF_INET;
+    in.sin_port = htons((uint16_t)a.port);
+    memcpy(&in.sin_addr, a.ip, 4);
+    memcpy(&ss, &in, sizeof(in));
+    ss_len = (x07_socklen_t)sizeof(in);
+  } else {
+    struct sockaddr_in6 in6;
+    memset(&in6, 0, sizeof(in6));
+    in6.sin6_family = AF_INET6;
+    in6.sin6_port = htons((uint16_t)a.port);
+    memcpy(&in6.sin6_addr, a.ip, 16);
+    memcpy(&ss, &in6, sizeof(in6));
+    ss_len = (x07_socklen_t)sizeof(in6);
+  }
+
+  x07_sock_t fd = socket(ss.ss_family, SOCK_DGRAM, IPPROTO_UDP);
+  if (fd == X07_SOCK_INVALID) return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  if (!x07_ext_sock_set_nonblocking(fd)) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  if (bind(fd, (struct sockaddr*)&ss, (x07_socklen_t)ss_len) != 0) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  }
+
+  struct sockaddr_storage bound;
+  x07_socklen_t bound_len = (x07_socklen_t)sizeof(bound);
+  memset(&bound, 0, sizeof(bound));
+  if (getsockname(fd, (struct sockaddr*)&bound, &bound_len) != 0) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint8_t* bound_addr = NULL;
+  uint32_t bound_addr_len = 0;
+  if (!x07_ext_sockaddr_to_netaddr_v1((struct sockaddr*)&bound, 0, &bound_addr, &bound_addr_len)) {
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  if (pol->sandboxed) {
+    x07NetAddrV1 ba;
+    if (!x07_ext_parse_addr_v1(bound_addr, bound_addr_len, &ba) || !x07_ext_addr_policy_check_sandboxed(&ba, ba.port)) {
+      free(bound_addr);
+      (void)x07_sock_close(fd);
+      return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    }
+  }
+
+  uint32_t sock_handle = x07_ext_sockets_alloc_sock_slot(X07_SOCK_KIND_UDP, fd);
+  if (!sock_handle) {
+    free(bound_addr);
+    (void)x07_sock_close(fd);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_handle_addr_doc(sock_handle, bound_addr, bound_addr_len, &doc_len);
+  free(bound_addr);
+  if (!doc) {
+    (void)x07_ext_sockets_sock_drop(sock_handle, X07_SOCK_KIND_UDP);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    (void)x07_ext_sockets_sock_drop(sock_handle, X07_SOCK_KIND_UDP);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_udp_sendto_alloc(
+  uint32_t sock_handle,
+  const uint8_t* addr,
+  uint32_t addr_len,
+  const uint8_t* payload,
+  uint32_t payload_len,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(sock_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (payload_len > c.max_write_bytes) return x07_ext_return_err(X07_NET_ERR_TOO_LARGE, out_handle);
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(sock_handle);
+  if (!e || e->kind != X07_SOCK_KIND_UDP || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetAddrV1 a;
+  if (!x07_ext_parse_addr_v1(addr, addr_len, &a)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  const x07NetPolicy* pol = x07_ext_net_policy();
+  if (pol->sandboxed) {
+    if (!pol->net) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!pol->udp) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (!x07_ext_addr_policy_check_sandboxed(&a, a.port)) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+  }
+
+  struct sockaddr_storage ss;
+  x07_socklen_t ss_len = 0;
+  memset(&ss, 0, sizeof(ss));
+
+  if (a.tag == X07_NET_ADDR_TAG_DNS) {
+    struct sockaddr_storage cands[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+    x07_socklen_t cand_lens[X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS];
+    uint32_t cand_count = 0;
+    uint32_t derr = x07_ext_dns_resolve_cached(a.dns, a.dns_len, a.port, IPPROTO_UDP, c.dns_ttl_ms,
+                                               cands, cand_lens, X07_EXT_SOCKETS_DNS_CACHE_MAX_ADDRS, &cand_count);
+    if (derr != 0) return x07_ext_return_err(derr, out_handle);
+
+    int sandboxed = pol->sandboxed;
+    if (sandboxed && !pol->have_hosts) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+
+    int revents = 0;
+    int prc = x07_ext_sock_poll(e, POLLOUT, (int)c.io_timeout_ms, &revents);
+    if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+    if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+    int ok_addr = 0;
+    int saw_timeout = 0;
+    int saw_connect_err = 0;
+    for (uint32_t i = 0; i < cand_count; i++) {
+      if (sandboxed && !x07_ext_policy_sockaddr_allowed(pol, (struct sockaddr*)&cands[i], a.port)) continue;
+
+      ok_addr = 1;
+      ss = cands[i];
+      ss_len = cand_lens[i];
+
+      ssize_t sent = sendto(e->fd, payload, (size_t)payload_len, 0, (struct sockaddr*)&ss, (x07_socklen_t)ss_len);
+      if (sent < 0) {
+        int err = x07_sock_errno();
+        if (err == EAGAIN || err == EWOULDBLOCK) {
+          saw_timeout = 1;
+          break;
+        }
+        saw_connect_err = 1;
+        continue;
+      }
+      uint32_t wrote = (sent > 0) ? (uint32_t)sent : 0u;
+
+      uint32_t doc_len = 0;
+      uint8_t* doc = x07_ext_make_ok_write_doc(wrote, &doc_len);
+      if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+      if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+        free(doc);
+        return -1;
+      }
+      return 0;
+    }
+    if (sandboxed && !ok_addr) return x07_ext_return_err(X07_NET_ERR_POLICY_DENIED, out_handle);
+    if (saw_timeout) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+    if (saw_connect_err) return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+    return x07_ext_return_err(X07_NET_ERR_DNS, out_handle);
+  } else if (a.tag == X07_NET_ADDR_TAG_IPV4) {
+    struct sockaddr_in in;
+    memset(&in, 0, sizeof(in));
+    in.sin_family = AF_INET;
+    in.sin_port = htons((uint16_t)a.port);
+    memcpy(&in.sin_addr, a.ip, 4);
+    memcpy(&ss, &in, sizeof(in));
+    ss_len = (x07_socklen_t)sizeof(in);
+  } else if (a.tag == X07_NET_ADDR_TAG_IPV6) {
+    struct sockaddr_in6 in6;
+    memset(&in6, 0, sizeof(in6));
+    in6.sin6_family = AF_INET6;
+    in6.sin6_port = htons((uint16_t)a.port);
+    memcpy(&in6.sin6_addr, a.ip, 16);
+    memcpy(&ss, &in6, sizeof(in6));
+    ss_len = (x07_socklen_t)sizeof(in6);
+  } else {
+    return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  }
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLOUT, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  ssize_t sent = sendto(e->fd, payload, (size_t)payload_len, 0, (struct sockaddr*)&ss, (x07_socklen_t)ss_len);
+  if (sent < 0) {
+    int err = x07_sock_errno();
+    if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+    return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  }
+  uint32_t wrote = (sent > 0) ? (uint32_t)sent : 0u;
+
+  uint32_t doc_len = 0;
+  uint8_t* doc = x07_ext_make_ok_write_doc(wrote, &doc_len);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (!x07_ext_store_doc(doc, doc_len, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_udp_recvfrom_alloc(
+  uint32_t sock_handle,
+  uint32_t max_bytes,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(sock_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (max_bytes > c.max_read_bytes) max_bytes = c.max_read_bytes;
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(sock_handle);
+  if (!e || e->kind != X07_SOCK_KIND_UDP || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLIN, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  // Direct fill into a pooled buffer: the payload is received past the
+  // largest possible header (4 + 4 + 28 + 4) and moved back over the slack
+  // once the encoded peer address length is known.
+  uint32_t pool_cap = 0;
+  uint8_t* doc = x07_ext_sockets_pool_get(40u + max_bytes, &pool_cap);
+  if (!doc) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  struct sockaddr_storage peer;
+  x07_socklen_t peer_len = (x07_socklen_t)sizeof(peer);
+  memset(&peer, 0, sizeof(peer));
+
+  ssize_t got = recvfrom(e->fd, doc + 40, (size_t)max_bytes, 0, (struct sockaddr*)&peer, &peer_len);
+  if (got < 0) {
+    int err = x07_sock_errno();
+    x07_ext_sockets_pool_put(doc, pool_cap);
+    if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+    return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+  }
+  uint32_t payload_len = (got > 0) ? (uint32_t)got : 0u;
+
+  uint32_t addr_len = x07_ext_sockaddr_to_netaddr_v1_in_place((struct sockaddr*)&peer, doc + 8, 28u);
+  if (addr_len == 0) {
+    x07_ext_sockets_pool_put(doc, pool_cap);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t payload_off = 12u + addr_len;
+  if (payload_off != 40u && payload_len != 0) memmove(doc + payload_off, doc + 40, (size_t)payload_len);
+  doc[0] = 1;
+  doc[1] = 1;
+  doc[2] = 0;
+  doc[3] = 0;
+  x07_ext_write_u32_le(doc + 4, addr_len);
+  x07_ext_write_u32_le(doc + 8 + addr_len, payload_len);
+  if (!x07_ext_store_pooled_doc(doc, payload_off + payload_len, pool_cap, out_handle)) {
+    x07_ext_sockets_pool_put(doc, pool_cap);
+    return -1;
+  }
+  return 0;
+}
+
+// Batched receive: drains up to max_datagrams in one go (one recvmmsg
+// syscall on Linux, a MSG_DONTWAIT recvfrom loop elsewhere). The first
+// datagram obeys the usual io-timeout wait; the rest are whatever the
+// kernel already has queued. Ok doc: u32 count, then per datagram the same
+// framing as the single-recv doc body (u32 addr_len, addr, u32 payload_len,
+// payload).
+#define X07_EXT_SOCKETS_RECVMANY_MAX 64u
+// Per-call scratch ceiling; the batch shrinks rather than letting
+// batch * max_bytes allocate without bound.
+#define X07_EXT_SOCKETS_RECVMANY_SCRATCH_MAX (16u * 1024u * 1024u)
+
+int32_t x07_ext_sockets_udp_recvmany_alloc(
+  uint32_t sock_handle,
+  uint32_t max_datagrams,
+  uint32_t max_bytes,
+  const uint8_t* caps,
+  uint32_t caps_len,
+  uint32_t* out_handle
+) {
+  if (out_handle) *out_handle = 0;
+  if (!x07_ext_wsa_ready()) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  if (max_datagrams == 0) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  x07NetCapsV1 c;
+  if (!x07_ext_sock_caps_parse_cached(sock_handle, caps, caps_len, &c)) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+  if (max_bytes > c.max_read_bytes) max_bytes = c.max_read_bytes;
+
+  x07SockEntry* e = x07_ext_sockets_sock_ptr(sock_handle);
+  if (!e || e->kind != X07_SOCK_KIND_UDP || e->closed) return x07_ext_return_err(X07_NET_ERR_INVALID_REQ, out_handle);
+
+  uint32_t batch = max_datagrams > X07_EXT_SOCKETS_RECVMANY_MAX ? X07_EXT_SOCKETS_RECVMANY_MAX : max_datagrams;
+  uint32_t stride = max_bytes ? max_bytes : 1u;
+  while (batch > 1u && (uint64_t)batch * (uint64_t)stride > (uint64_t)X07_EXT_SOCKETS_RECVMANY_SCRATCH_MAX) {
+    batch /= 2u;
+  }
+
+  int revents = 0;
+  int prc = x07_ext_sock_poll(e, POLLIN, (int)c.io_timeout_ms, &revents);
+  if (prc == 0) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+  if (prc < 0) return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+
+  uint8_t* scratch = (uint8_t*)malloc((size_t)batch * (size_t)stride);
+  struct sockaddr_storage* peers = (struct sockaddr_storage*)calloc(batch, sizeof(*peers));
+  uint32_t* lens = (uint32_t*)calloc(batch, sizeof(uint32_t));
+  if (!scratch || !peers || !lens) {
+    free(scratch);
+    free(peers);
+    free(lens);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+
+  uint32_t got = 0;
+#if defined(__linux__)
+  {
+    struct mmsghdr msgs[X07_EXT_SOCKETS_RECVMANY_MAX];
+    struct iovec iovs[X07_EXT_SOCKETS_RECVMANY_MAX];
+    memset(msgs, 0, sizeof(msgs));
+    for (uint32_t i = 0; i < batch; i++) {
+      iovs[i].iov_base = scratch + (size_t)i * stride;
+      iovs[i].iov_len = (size_t)max_bytes;
+      msgs[i].msg_hdr.msg_iov = &iovs[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &peers[i];
+      msgs[i].msg_hdr.msg_namelen = (socklen_t)sizeof(peers[i]);
+    }
+    int n = recvmmsg(e->fd, msgs, (unsigned int)batch, MSG_DONTWAIT, NULL);
+    if (n < 0) {
+      int err = x07_sock_errno();
+      free(scratch);
+      free(peers);
+      free(lens);
+      if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+      return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+    }
+    got = (uint32_t)n;
+    for (uint32_t i = 0; i < got; i++) {
+      lens[i] = (uint32_t)msgs[i].msg_len;
+    }
+  }
+#else
+  while (got < batch) {
+    x07_socklen_t peer_len = (x07_socklen_t)sizeof(peers[got]);
+    ssize_t n = recvfrom(e->fd, scratch + (size_t)got * stride, (size_t)max_bytes, MSG_DONTWAIT,
+                         (struct sockaddr*)&peers[got], &peer_len);
+    if (n < 0) {
+      int err = x07_sock_errno();
+      if (err == EINTR) continue;
+      if ((err == EAGAIN || err == EWOULDBLOCK) && got > 0) break;
+      free(scratch);
+      free(peers);
+      free(lens);
+      if (err == EAGAIN || err == EWOULDBLOCK) return x07_ext_return_err(X07_NET_ERR_TIMEOUT, out_handle);
+      return x07_ext_return_err(X07_NET_ERR_CONNECT, out_handle);
+    }
+    lens[got] = (n > 0) ? (uint32_t)n : 0u;
+    got++;
+  }
+#endif
+
+  uint64_t doc_len64 = 8;
+  for (uint32_t i = 0; i < got; i++) {
+    uint32_t alen = (peers[i].ss_family == AF_INET6) ? x07_ext_netaddr_ipv6_len() : x07_ext_netaddr_ipv4_len();
+    doc_len64 += 8ull + (uint64_t)alen + (uint64_t)lens[i];
+  }
+  if (doc_len64 > (uint64_t)UINT32_MAX) {
+    free(scratch);
+    free(peers);
+    free(lens);
+    return x07_ext_return_err(X07_NET_ERR_TOO_LARGE, out_handle);
+  }
+  uint8_t* doc = (uint8_t*)malloc((size_t)doc_len64);
+  if (!doc) {
+    free(scratch);
+    free(peers);
+    free(lens);
+    return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+  }
+  doc[0] = 1;
+  doc[1] = 1;
+  doc[2] = 0;
+  doc[3] = 0;
+  x07_ext_write_u32_le(doc + 4, got);
+  uint32_t pos = 8;
+  for (uint32_t i = 0; i < got; i++) {
+    uint32_t alen = x07_ext_sockaddr_to_netaddr_v1_in_place((const struct sockaddr*)&peers[i], doc + pos + 4, 28u);
+    if (alen == 0) {
+      free(scratch);
+      free(peers);
+      free(lens);
+      free(doc);
+      return x07_ext_return_err(X07_NET_ERR_INTERNAL, out_handle);
+    }
+    x07_ext_write_u32_le(doc + pos, alen);
+    pos += 4 + alen;
+    x07_ext_write_u32_le(doc + pos, lens[i]);
+    pos += 4;
+    if (lens[i]) memcpy(doc + pos, scratch + (size_t)i * stride, lens[i]);
+    pos += lens[i];
+  }
+  free(scratch);
+  free(peers);
+  free(lens);
+  if (!x07_ext_store_doc(doc, pos, out_handle)) {
+    free(doc);
+    return -1;
+  }
+  return 0;
+}
+
+int32_t x07_ext_sockets_udp_close_v1(int32_t sock_handle) {
+  if (sock_handle <= 0) return 0;
+  return x07_ext_sockets_sock_close((uint32_t)sock_handle, X07_SOCK_KIND_UDP);
+}
+
+int32_t x07_ext_sockets_udp_drop_v1(int32_t sock_handle) {
+  if (sock_handle <= 0) return 0;
+  return x07_ext_sockets_sock_drop((uint32_t)sock_handle, X07_SOCK_KIND_UDP);
+}
@@ -0,0 +1,852 @@
+#include <limits.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <zlib.h>
+
+#define X07_EXT_ZLIB_MAX_BUFS 4096u
+
+static uint8_t* g_bufs[X07_EXT_ZLIB_MAX_BUFS];
+static uint32_t g_lens[X07_EXT_ZLIB_MAX_BUFS];
+
+static uint32_t x07_ext_zlib_alloc_slot(void) {
+    for (uint32_t i = 1; i < X07_EXT_ZLIB_MAX_BUFS; i++) {
+        if (!g_bufs[i]) return i;
+    }
+    return 0;
+}
+
+int32_t x07_ext_zlib_compress_alloc(const uint8_t* source, uint32_t source_len, uint32_t* out_handle) {
+    if (out_handle) *out_handle = 0;
+
+    uLong bound = compressBound((uLong)source_len);
+    if (bound > (uLong)UINT32_MAX) return -2;
+
+    uint8_t* buf = (uint8_t*)malloc((size_t)bound);
+    if (!buf) return -1;
+
+    uLongf out_len = (uLongf)bound;
+    int rc = compress((Bytef*)buf, &out_len, (const Bytef*)source, (uLong)source_len);
+    if (rc != 0) {
+        free(buf);
+        return (int32_t)rc;
+    }
+    if (out_len > (uLongf)UINT32_MAX) {
+        free(buf);
+        return -2;
+    }
+
+    uint32_t h = x07_ext_zlib_alloc_slot();
+    if (!h) {
+        free(buf);
+        return -1;
+    }
+    g_bufs[h] = buf;
+    g_lens[h] = (uint32_t)out_len;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+int32_t x07_ext_zlib_uncompress_alloc(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint32_t max_size,
+    uint32_t* out_handle
+) {
+    if (out_handle) *out_handle = 0;
+    if (max_size > UINT32_MAX) return -2;
+
+    uint8_t* buf = (uint8_t*)malloc((size_t)max_size);
+    if (!buf) return -1;
+
+    uLongf out_len = (uLongf)max_size;
+    int rc = uncompress((Bytef*)buf, &out_len, (const Bytef*)source, (uLong)source_len);
+    if (rc != 0) {
+        free(buf);
+        return (int32_t)rc;
+    }
+    if (out_len > (uLongf)UINT32_MAX) {
+        free(buf);
+        return -2;
+    }
+
+    uint32_t h = x07_ext_zlib_alloc_slot();
+    if (!h) {
+        free(buf);
+        return -1;
+    }
+    g_bufs[h] = buf;
+    g_lens[h] = (uint32_t)out_len;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+static int32_t x07_ext_zlib_inflate_alloc_window_bits(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint32_t max_size,
+    int window_bits,
+    uint32_t* out_handle
+) {
+    if (out_handle) *out_handle = 0;
+
+    uint8_t* buf = (uint8_t*)malloc((size_t)max_size);
+    if (!buf && max_size != 0) return -1;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    strm.next_in = (Bytef*)source;
+    strm.avail_in = (uInt)source_len;
+    strm.next_out = (Bytef*)buf;
+    strm.avail_out = (uInt)max_size;
+
+    int rc = inflateInit2(&strm, window_bits);
+    if (rc != Z_OK) {
+        if (buf) free(buf);
+        return (int32_t)rc;
+    }
+
+    rc = inflate(&strm, Z_FINISH);
+    if (rc != Z_STREAM_END) {
+        inflateEnd(&strm);
+        if (buf) free(buf);
+        return (int32_t)rc;
+    }
+
+    rc = inflateEnd(&strm);
+    if (rc != Z_OK) {
+        if (buf) free(buf);
+        return (int32_t)rc;
+    }
+
+    if (strm.total_out > (uLong)UINT32_MAX) {
+        if (buf) free(buf);
+        return -2;
+    }
+
+    uint32_t h = x07_ext_zlib_alloc_slot();
+    if (!h) {
+        if (buf) free(buf);
+        return -1;
+    }
+    g_bufs[h] = buf;
+    g_lens[h] = (uint32_t)strm.total_out;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+int32_t x07_ext_zlib_gzip_decompress_alloc(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint32_t max_size,
+    uint32_t* out_handle
+) {
+    return x07_ext_zlib_inflate_alloc_window_bits(
+        source,
+        source_len,
+        max_size,
+        16 + MAX_WBITS,
+        out_handle
+    );
+}
+
+int32_t x07_ext_zlib_inflate_raw_alloc(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint32_t max_size,
+    uint32_t* out_handle
+) {
+    return x07_ext_zlib_inflate_alloc_window_bits(source, source_len, max_size, -MAX_WBITS, out_handle);
+}
+
+// ---- Zero-copy variants: the caller supplies the destination buffer
+// (typically runtime-allocated bytes), so the output is produced in place
+// instead of being staged in a malloc'd slot and copied out. ----
+
+uint32_t x07_ext_zlib_compress_bound(uint32_t source_len) {
+    uLong bound = compressBound((uLong)source_len);
+    if (bound > (uLong)UINT32_MAX) return 0;
+    return (uint32_t)bound;
+}
+
+int32_t x07_ext_zlib_compress_into(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    uint32_t* out_len
+) {
+    if (out_len) *out_len = 0;
+    if (!dst && dst_cap != 0) return -1;
+
+    uLongf n = (uLongf)dst_cap;
+    int rc = compress((Bytef*)dst, &n, (const Bytef*)source, (uLong)source_len);
+    if (rc != 0) return (int32_t)rc;
+    if (n > (uLongf)UINT32_MAX) return -2;
+    if (out_len) *out_len = (uint32_t)n;
+    return 0;
+}
+
+int32_t x07_ext_zlib_uncompress_into(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    uint32_t* out_len
+) {
+    if (out_len) *out_len = 0;
+    if (!dst && dst_cap != 0) return -1;
+
+    uLongf n = (uLongf)dst_cap;
+    int rc = uncompress((Bytef*)dst, &n, (const Bytef*)source, (uLong)source_len);
+    if (rc != 0) return (int32_t)rc;
+    if (n > (uLongf)UINT32_MAX) return -2;
+    if (out_len) *out_len = (uint32_t)n;
+    return 0;
+}
+
+static int32_t x07_ext_zlib_inflate_into_window_bits(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    int window_bits,
+    uint32_t* out_len
+) {
+    if (out_len) *out_len = 0;
+    if (!dst && dst_cap != 0) return -1;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    strm.next_in = (Bytef*)source;
+    strm.avail_in = (uInt)source_len;
+    strm.next_out = (Bytef*)dst;
+    strm.avail_out = (uInt)dst_cap;
+
+    int rc = inflateInit2(&strm, window_bits);
+    if (rc != Z_OK) return (int32_t)rc;
+
+    rc = inflate(&strm, Z_FINISH);
+    if (rc != Z_STREAM_END) {
+        inflateEnd(&strm);
+        return (int32_t)rc;
+    }
+
+    rc = inflateEnd(&strm);
+    if (rc != Z_OK) return (int32_t)rc;
+
+    if (strm.total_out > (uLong)UINT32_MAX) return -2;
+    if (out_len) *out_len = (uint32_t)strm.total_out;
+    return 0;
+}
+
+int32_t x07_ext_zlib_gzip_decompress_into(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    uint32_t* out_len
+) {
+    return x07_ext_zlib_inflate_into_window_bits(
+        source,
+        source_len,
+        dst,
+        dst_cap,
+        16 + MAX_WBITS,
+        out_len
+    );
+}
+
+int32_t x07_ext_zlib_inflate_raw_into(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    uint32_t* out_len
+) {
+    return x07_ext_zlib_inflate_into_window_bits(source, source_len, dst, dst_cap, -MAX_WBITS, out_len);
+}
+
+// ---- Preset dictionaries: a dict handle holds one copy of a shared
+// dictionary (e.g. a sampled JSON schema corpus) that many small,
+// similar documents can be compressed against. ----
+
+#define X07_EXT_ZLIB_MAX_DICTS 256u
+
+static uint8_t* g_dict_bufs[X07_EXT_ZLIB_MAX_DICTS];
+static uint32_t g_dict_lens[X07_EXT_ZLIB_MAX_DICTS];
+
+// Copies dict into a slot; returns a dict handle (>0) or 0.
+uint32_t x07_ext_zlib_dict_create(const uint8_t* dict, uint32_t dict_len) {
+    if (!dict || dict_len == 0 || dict_len > 32768u) return 0;
+
+    for (uint32_t i = 1; i < X07_EXT_ZLIB_MAX_DICTS; i++) {
+        if (g_dict_bufs[i]) continue;
+        uint8_t* copy = (uint8_t*)malloc((size_t)dict_len);
+        if (!copy) return 0;
+        memcpy(copy, dict, (size_t)dict_len);
+        g_dict_bufs[i] = copy;
+        g_dict_lens[i] = dict_len;
+        return i;
+    }
+    return 0;
+}
+
+void x07_ext_zlib_dict_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_DICTS) return;
+    if (g_dict_bufs[handle]) free(g_dict_bufs[handle]);
+    g_dict_bufs[handle] = (uint8_t*)0;
+    g_dict_lens[handle] = 0;
+}
+
+static const uint8_t* x07_ext_zlib_dict_get(uint32_t handle, uint32_t* out_len) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_DICTS) return (const uint8_t*)0;
+    if (out_len) *out_len = g_dict_lens[handle];
+    return g_dict_bufs[handle];
+}
+
+// One-shot compress with explicit level, strategy (Z_DEFAULT_STRATEGY,
+// Z_FILTERED, ...) and optional preset dictionary (dict_handle 0 =
+// none). zlib framing, as with x07_ext_zlib_compress_alloc.
+int32_t x07_ext_zlib_compress_opts_alloc(
+    const uint8_t* source,
+    uint32_t source_len,
+    int32_t level,
+    int32_t strategy,
+    uint32_t dict_handle,
+    uint32_t* out_handle
+) {
+    if (out_handle) *out_handle = 0;
+
+    uint32_t dict_len = 0;
+    const uint8_t* dict = (const uint8_t*)0;
+    if (dict_handle != 0) {
+        dict = x07_ext_zlib_dict_get(dict_handle, &dict_len);
+        if (!dict) return -1;
+    }
+
+    uLong bound = compressBound((uLong)source_len);
+    if (bound > (uLong)UINT32_MAX) return -2;
+
+    uint8_t* buf = (uint8_t*)malloc((size_t)bound);
+    if (!buf) return -1;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    int rc = deflateInit2(&strm, (int)level, Z_DEFLATED, MAX_WBITS, 8, (int)strategy);
+    if (rc != Z_OK) {
+        free(buf);
+        return (int32_t)rc;
+    }
+    if (dict) {
+        rc = deflateSetDictionary(&strm, (const Bytef*)dict, (uInt)dict_len);
+        if (rc != Z_OK) {
+            deflateEnd(&strm);
+            free(buf);
+            return (int32_t)rc;
+        }
+    }
+
+    strm.next_in = (Bytef*)source;
+    strm.avail_in = (uInt)source_len;
+    strm.next_out = (Bytef*)buf;
+    strm.avail_out = (uInt)bound;
+
+    rc = deflate(&strm, Z_FINISH);
+    if (rc != Z_STREAM_END) {
+        deflateEnd(&strm);
+        free(buf);
+        return rc == Z_OK ? -2 : (int32_t)rc;
+    }
+    uLong total = strm.total_out;
+    rc = deflateEnd(&strm);
+    if (rc != Z_OK || total > (uLong)UINT32_MAX) {
+        free(buf);
+        return rc != Z_OK ? (int32_t)rc : -2;
+    }
+
+    uint32_t h = x07_ext_zlib_alloc_slot();
+    if (!h) {
+        free(buf);
+        return -1;
+    }
+    g_bufs[h] = buf;
+    g_lens[h] = (uint32_t)total;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+// One-shot uncompress that satisfies the stream's dictionary demand
+// (Z_NEED_DICT) from dict_handle; returns Z_NEED_DICT if the stream
+// wants a dictionary and none (or the wrong one) was supplied.
+int32_t x07_ext_zlib_uncompress_dict_alloc(
+    const uint8_t* source,
+    uint32_t source_len,
+    uint32_t max_size,
+    uint32_t dict_handle,
+    uint32_t* out_handle
+) {
+    if (out_handle) *out_handle = 0;
+
+    uint32_t dict_len = 0;
+    const uint8_t* dict = (const uint8_t*)0;
+    if (dict_handle != 0) {
+        dict = x07_ext_zlib_dict_get(dict_handle, &dict_len);
+        if (!dict) return -1;
+    }
+
+    uint8_t* buf = (uint8_t*)malloc((size_t)max_size);
+    if (!buf && max_size != 0) return -1;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    strm.next_in = (Bytef*)source;
+    strm.avail_in = (uInt)source_len;
+    strm.next_out = (Bytef*)buf;
+    strm.avail_out = (uInt)max_size;
+
+    int rc = inflateInit2(&strm, MAX_WBITS);
+    if (rc != Z_OK) {
+        if (buf) free(buf);
+        return (int32_t)rc;
+    }
+
+    rc = inflate(&strm, Z_FINISH);
+    if (rc == Z_NEED_DICT && dict) {
+        rc = inflateSetDictionary(&strm, (const Bytef*)dict, (uInt)dict_len);
+        if (rc == Z_OK) rc = inflate(&strm, Z_FINISH);
+    }
+    if (rc != Z_STREAM_END) {
+        inflateEnd(&strm);
+        if (buf) free(buf);
+        return rc == Z_OK ? -2 : (int32_t)rc;
+    }
+    uLong total = strm.total_out;
+    rc = inflateEnd(&strm);
+    if (rc != Z_OK || total > (uLong)UINT32_MAX) {
+        if (buf) free(buf);
+        return rc != Z_OK ? (int32_t)rc : -2;
+    }
+
+    uint32_t h = x07_ext_zlib_alloc_slot();
+    if (!h) {
+        if (buf) free(buf);
+        return -1;
+    }
+    g_bufs[h] = buf;
+    g_lens[h] = (uint32_t)total;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+// ---- Streaming contexts: handle-based z_streams so the stream xf
+// pipeline can compress/decompress incrementally. Peak memory is the
+// zlib window plus whatever chunk the caller stages, instead of the
+// whole input and a compressBound() output resident at once, and the
+// internal state (window, allocations) persists across chunks and --
+// via reset -- across streams. ----
+
+#define X07_EXT_ZLIB_MAX_STREAMS 256u
+
+#define X07_EXT_ZLIB_STREAM_DEFLATE 1
+#define X07_EXT_ZLIB_STREAM_INFLATE 2
+
+typedef struct {
+    z_stream strm;
+    int kind; // 0 = slot free
+    uint32_t dict;    // dict handle, 0 = none
+    int dict_pending; // deflate: set before the next chunk
+} x07ExtZlibStreamSlot;
+
+static x07ExtZlibStreamSlot g_streams[X07_EXT_ZLIB_MAX_STREAMS];
+
+static uint32_t x07_ext_zlib_alloc_stream_slot(void) {
+    for (uint32_t i = 1; i < X07_EXT_ZLIB_MAX_STREAMS; i++) {
+        if (g_streams[i].kind == 0) return i;
+    }
+    return 0;
+}
+
+// Opens a streaming compressor. level is a zlib level (-1 for default),
+// window_bits as for deflateInit2 (15 zlib, 16+15 gzip, -15 raw).
+// Returns 0 and a handle, or a zlib error / -1.
+int32_t x07_ext_zlib_deflate_open(int32_t level, int32_t window_bits, uint32_t* out_handle) {
+    if (out_handle) *out_handle = 0;
+
+    uint32_t h = x07_ext_zlib_alloc_stream_slot();
+    if (!h) return -1;
+
+    memset(&g_streams[h].strm, 0, sizeof(g_streams[h].strm));
+    int rc = deflateInit2(&g_streams[h].strm, (int)level, Z_DEFLATED, (int)window_bits, 8, Z_DEFAULT_STRATEGY);
+    if (rc != Z_OK) return (int32_t)rc;
+
+    g_streams[h].kind = X07_EXT_ZLIB_STREAM_DEFLATE;
+    g_streams[h].dict = 0;
+    g_streams[h].dict_pending = 0;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+// Opens a streaming decompressor; window_bits as for inflateInit2
+// (15 + 32 auto-detects zlib/gzip).
+int32_t x07_ext_zlib_inflate_open(int32_t window_bits, uint32_t* out_handle) {
+    if (out_handle) *out_handle = 0;
+
+    uint32_t h = x07_ext_zlib_alloc_stream_slot();
+    if (!h) return -1;
+
+    memset(&g_streams[h].strm, 0, sizeof(g_streams[h].strm));
+    int rc = inflateInit2(&g_streams[h].strm, (int)window_bits);
+    if (rc != Z_OK) return (int32_t)rc;
+
+    g_streams[h].kind = X07_EXT_ZLIB_STREAM_INFLATE;
+    g_streams[h].dict = 0;
+    g_streams[h].dict_pending = 0;
+    if (out_handle) *out_handle = h;
+    return 0;
+}
+
+static x07ExtZlibStreamSlot* x07_ext_zlib_stream_get(uint32_t handle, int kind) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_STREAMS) return (x07ExtZlibStreamSlot*)0;
+    if (g_streams[handle].kind != kind) return (x07ExtZlibStreamSlot*)0;
+    return &g_streams[handle];
+}
+
+// Feeds one chunk through an open context. On return *out_consumed /
+// *out_written report how much of src was eaten and how much of dst was
+// produced; the caller re-submits the unconsumed tail once it has
+// drained dst. flush is 0 (more input coming), 1 (Z_FINISH; repeat with
+// the remaining input until 1 is returned), or 2 (Z_SYNC_FLUSH).
+// Returns Z_OK (0), Z_STREAM_END (1), or a zlib error.
+int32_t x07_ext_zlib_deflate_chunk(
+    uint32_t handle,
+    const uint8_t* src,
+    uint32_t src_len,
+    int32_t flush,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    uint32_t* out_consumed,
+    uint32_t* out_written
+) {
+    if (out_consumed) *out_consumed = 0;
+    if (out_written) *out_written = 0;
+
+    x07ExtZlibStreamSlot* s = x07_ext_zlib_stream_get(handle, X07_EXT_ZLIB_STREAM_DEFLATE);
+    if (!s) return -1;
+    if ((!src && src_len != 0) || (!dst && dst_cap != 0)) return -1;
+    if (flush != 0 && flush != 1 && flush != 2) return -1;
+
+    if (s->dict_pending) {
+        uint32_t dict_len = 0;
+        const uint8_t* dict = x07_ext_zlib_dict_get(s->dict, &dict_len);
+        if (!dict) return -1;
+        int drc = deflateSetDictionary(&s->strm, (const Bytef*)dict, (uInt)dict_len);
+        if (drc != Z_OK) return (int32_t)drc;
+        s->dict_pending = 0;
+    }
+
+    s->strm.next_in = (Bytef*)src;
+    s->strm.avail_in = (uInt)src_len;
+    s->strm.next_out = (Bytef*)dst;
+    s->strm.avail_out = (uInt)dst_cap;
+
+    int zflush = flush == 1 ? Z_FINISH : (flush == 2 ? Z_SYNC_FLUSH : Z_NO_FLUSH);
+    int rc = deflate(&s->strm, zflush);
+    if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) return (int32_t)rc;
+
+    if (out_consumed) *out_consumed = src_len - (uint32_t)s->strm.avail_in;
+    if (out_written) *out_written = dst_cap - (uint32_t)s->strm.avail_out;
+    return rc == Z_STREAM_END ? 1 : 0;
+}
+
+// Inflate counterpart of deflate_chunk (no flush flag: the compressed
+// stream itself says when it ends). Returns 1 once the stream end has
+// been reached; further input past it is left unconsumed.
+int32_t x07_ext_zlib_inflate_chunk(
+    uint32_t handle,
+    const uint8_t* src,
+    uint32_t src_len,
+    uint8_t* dst,
+    uint32_t dst_cap,
+    uint32_t* out_consumed,
+    uint32_t* out_written
+) {
+    if (out_consumed) *out_consumed = 0;
+    if (out_written) *out_written = 0;
+
+    x07ExtZlibStreamSlot* s = x07_ext_zlib_stream_get(handle, X07_EXT_ZLIB_STREAM_INFLATE);
+    if (!s) return -1;
+    if ((!src && src_len != 0) || (!dst && dst_cap != 0)) return -1;
+
+    s->strm.next_in = (Bytef*)src;
+    s->strm.avail_in = (uInt)src_len;
+    s->strm.next_out = (Bytef*)dst;
+    s->strm.avail_out = (uInt)dst_cap;
+
+    int rc = inflate(&s->strm, Z_NO_FLUSH);
+    if (rc == Z_NEED_DICT && s->dict != 0) {
+        uint32_t dict_len = 0;
+        const uint8_t* dict = x07_ext_zlib_dict_get(s->dict, &dict_len);
+        if (!dict) return -1;
+        rc = inflateSetDictionary(&s->strm, (const Bytef*)dict, (uInt)dict_len);
+        if (rc == Z_OK) rc = inflate(&s->strm, Z_NO_FLUSH);
+    }
+    if (rc != Z_OK && rc != Z_STREAM_END && rc != Z_BUF_ERROR) return (int32_t)rc;
+
+    if (out_consumed) *out_consumed = src_len - (uint32_t)s->strm.avail_in;
+    if (out_written) *out_written = dst_cap - (uint32_t)s->strm.avail_out;
+    return rc == Z_STREAM_END ? 1 : 0;
+}
+
+// Attaches a preset dictionary to an open context (dict_handle 0
+// detaches). A deflate context absorbs it before its next chunk and
+// again after every reset; an inflate context serves it when the
+// stream demands one (Z_NEED_DICT). The dict handle must outlive its
+// attachment.
+int32_t x07_ext_zlib_stream_set_dictionary(uint32_t handle, uint32_t dict_handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_STREAMS) return -1;
+    if (g_streams[handle].kind == 0) return -1;
+    if (dict_handle != 0 && !x07_ext_zlib_dict_get(dict_handle, (uint32_t*)0)) return -1;
+
+    g_streams[handle].dict = dict_handle;
+    g_streams[handle].dict_pending =
+        (dict_handle != 0 && g_streams[handle].kind == X07_EXT_ZLIB_STREAM_DEFLATE) ? 1 : 0;
+    return 0;
+}
+
+// Retunes level/strategy of an open deflate context between chunks
+// (wraps deflateParams).
+int32_t x07_ext_zlib_stream_set_params(uint32_t handle, int32_t level, int32_t strategy) {
+    x07ExtZlibStreamSlot* s = x07_ext_zlib_stream_get(handle, X07_EXT_ZLIB_STREAM_DEFLATE);
+    if (!s) return -1;
+    return (int32_t)deflateParams(&s->strm, (int)level, (int)strategy);
+}
+
+// Rewinds a context for the next stream without tearing down its
+// window allocations; an attached dictionary stays attached.
+int32_t x07_ext_zlib_stream_reset(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_STREAMS) return -1;
+    if (g_streams[handle].kind == X07_EXT_ZLIB_STREAM_DEFLATE) {
+        int rc = deflateReset(&g_streams[handle].strm);
+        if (rc == Z_OK && g_streams[handle].dict != 0) g_streams[handle].dict_pending = 1;
+        return (int32_t)rc;
+    }
+    if (g_streams[handle].kind == X07_EXT_ZLIB_STREAM_INFLATE) {
+        return (int32_t)inflateReset(&g_streams[handle].strm);
+    }
+    return -1;
+}
+
+void x07_ext_zlib_stream_close(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_STREAMS) return;
+    if (g_streams[handle].kind == X07_EXT_ZLIB_STREAM_DEFLATE) {
+        deflateEnd(&g_streams[handle].strm);
+    } else if (g_streams[handle].kind == X07_EXT_ZLIB_STREAM_INFLATE) {
+        inflateEnd(&g_streams[handle].strm);
+    }
+    g_streams[handle].kind = 0;
+    g_streams[handle].dict = 0;
+    g_streams[handle].dict_pending = 0;
+}
+
+// ---- Parallel block compression: large inputs are split into
+// independent blocks, each compressed into its own gzip member on a
+// worker pool, and the members are concatenated (pigz-style). Any gzip
+// consumer reads the result, and throughput scales with cores at the
+// cost of a slightly worse ratio (no inter-block history). ----
+
+#define X07_EXT_ZLIB_PAR_MIN_BLOCK (64u * 1024u)
+#define X07_EXT_ZLIB_PAR_DEFAULT_BLOCK (1u * 1024u * 1024u)
+#define X07_EXT_ZLIB_PAR_MAX_WORKERS 64u
+
+typedef struct {
+    const uint8_t* src;
+    uint32_t src_len;
+    uint32_t block_size;
+    uint32_t nblocks;
+    int level;
+    uint8_t** outs;
+    uint32_t* out_lens;
+    uint32_t next; // claimed atomically by workers
+    int failed;
+} x07ExtZlibParJob;
+
+// Compresses block idx into its own complete gzip member.
+static int x07_ext_zlib_par_block(x07ExtZlibParJob* job, uint32_t idx) {
+    uint32_t off = idx * job->block_size;
+    uint32_t len = job->src_len - off;
+    if (len > job->block_size) len = job->block_size;
+
+    uLong bound = compressBound((uLong)len) + 32u; // + gzip header/trailer
+    uint8_t* out = (uint8_t*)malloc((size_t)bound);
+    if (!out) return -1;
+
+    z_stream strm;
+    memset(&strm, 0, sizeof(strm));
+    int rc = deflateInit2(&strm, job->level, Z_DEFLATED, 16 + MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    if (rc != Z_OK) {
+        free(out);
+        return rc;
+    }
+
+    strm.next_in = (Bytef*)(job->src + off);
+    strm.avail_in = (uInt)len;
+    strm.next_out = (Bytef*)out;
+    strm.avail_out = (uInt)bound;
+
+    rc = deflate(&strm, Z_FINISH);
+    if (rc != Z_STREAM_END) {
+        deflateEnd(&strm);
+        free(out);
+        return rc == Z_OK ? -2 : rc;
+    }
+    uLong total = strm.total_out;
+    rc = deflateEnd(&strm);
+    if (rc != Z_OK || total > (uLong)UINT32_MAX) {
+        free(out);
+        return rc != Z_OK ? rc : -2;
+    }
+
+    job->outs[idx] = out;
+    job->out_lens[idx] = (uint32_t)total;
+    return 0;
+}
+
+static void* x07_ext_zlib_par_worker(void* arg) {
+    x07ExtZlibParJob* job = (x07ExtZlibParJob*)arg;
+    for (;;) {
+        uint32_t idx = __atomic_fetch_add(&job->next, 1u, __ATOMIC_RELAXED);
+        if (idx >= job->nblocks) return (void*)0;
+        if (__atomic_load_n(&job->failed, __ATOMIC_RELAXED)) return (void*)0;
+        if (x07_ext_zlib_par_block(job, idx) != 0) {
+            __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+            return (void*)0;
+        }
+    }
+}
+
+// Compresses source into a concatenated-member gzip stream using up to
+// `workers` threads on `block_size`-byte blocks (0 picks defaults: the
+// online core count and 1 MiB). Returns 0 and a buf handle holding the
+// gzip bytes, a zlib error, or -1.
+int32_t x07_ext_zlib_gzip_compress_parallel_alloc(
+    const uint8_t* source,
+    uint32_t source_len,
+    int32_t level,
+    uint32_t block_size,
+    uint32_t workers,
+    uint32_t* out_handle
+) {
+    if (out_handle) *out_handle = 0;
+    if (!source && source_len != 0) return -1;
+
+    if (block_size == 0) block_size = X07_EXT_ZLIB_PAR_DEFAULT_BLOCK;
+    if (block_size < X07_EXT_ZLIB_PAR_MIN_BLOCK) block_size = X07_EXT_ZLIB_PAR_MIN_BLOCK;
+
+    if (workers == 0) {
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        workers = n > 0 ? (uint32_t)n : 1u;
+    }
+    if (workers > X07_EXT_ZLIB_PAR_MAX_WORKERS) workers = X07_EXT_ZLIB_PAR_MAX_WORKERS;
+
+    uint32_t nblocks = source_len == 0 ? 1u : (source_len + block_size - 1u) / block_size;
+
+    x07ExtZlibParJob job;
+    memset(&job, 0, sizeof(job));
+    job.src = source;
+    job.src_len = source_len;
+    job.block_size = block_size;
+    job.nblocks = nblocks;
+    job.level = (int)level;
+    job.outs = (uint8_t**)calloc(nblocks, sizeof(uint8_t*));
+    job.out_lens = (uint32_t*)calloc(nblocks, sizeof(uint32_t));
+    if (!job.outs || !job.out_lens) {
+        free(job.outs);
+        free(job.out_lens);
+        return -1;
+    }
+
+    if (workers > nblocks) workers = nblocks;
+    if (workers <= 1) {
+        for (uint32_t i = 0; i < nblocks && !job.failed; i++) {
+            if (x07_ext_zlib_par_block(&job, i) != 0) job.failed = 1;
+        }
+    } else {
+        pthread_t threads[X07_EXT_ZLIB_PAR_MAX_WORKERS];
+        uint32_t started = 0;
+        for (uint32_t i = 0; i < workers; i++) {
+            if (pthread_create(&threads[i], NULL, x07_ext_zlib_par_worker, &job) != 0) break;
+            started++;
+        }
+        if (started == 0) job.failed = 1;
+        for (uint32_t i = 0; i < started; i++) pthread_join(threads[i], NULL);
+    }
+
+    int32_t ret = -1;
+    uint8_t* buf = (uint8_t*)0;
+    if (!job.failed) {
+        uint64_t total = 0;
+        for (uint32_t i = 0; i < nblocks; i++) total += job.out_lens[i];
+        if (total <= (uint64_t)UINT32_MAX) {
+            buf = (uint8_t*)malloc((size_t)total);
+            if (buf) {
+                uint8_t* w = buf;
+                for (uint32_t i = 0; i < nblocks; i++) {
+                    memcpy(w, job.outs[i], job.out_lens[i]);
+                    w += job.out_lens[i];
+                }
+                uint32_t h = x07_ext_zlib_alloc_slot();
+                if (h) {
+                    g_bufs[h] = buf;
+                    g_lens[h] = (uint32_t)total;
+                    if (out_handle) *out_handle = h;
+                    buf = (uint8_t*)0;
+                    ret = 0;
+                }
+            }
+        } else {
+            ret = -2;
+        }
+    }
+
+    if (buf) free(buf);
+    for (uint32_t i = 0; i < nblocks; i++) {
+        if (job.outs[i]) free(job.outs[i]);
+    }
+    free(job.outs);
+    free(job.out_lens);
+    return ret;
+}
+
+uint32_t x07_ext_zlib_buf_len(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_BUFS) return 0;
+    return g_lens[handle];
+}
+
+const uint8_t* x07_ext_zlib_buf_ptr(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_BUFS) return (const uint8_t*)0;
+    return g_bufs[handle];
+}
+
+void x07_ext_zlib_buf_free(uint32_t handle) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_BUFS) return;
+    if (g_bufs[handle]) free(g_bufs[handle]);
+    g_bufs[handle] = (uint8_t*)0;
+    g_lens[handle] = 0;
+}
+
+// Copies a buf slot into caller memory and frees the slot in one hop,
+// replacing the ptr/len/memcpy/free call sequence. Returns the copied
+// length, or -1 on a bad handle / insufficient cap.
+int32_t x07_ext_zlib_buf_take_into(uint32_t handle, uint8_t* dst, uint32_t cap) {
+    if (handle == 0 || handle >= X07_EXT_ZLIB_MAX_BUFS) return -1;
+    if (!g_bufs[handle]) return -1;
+    uint32_t len = g_lens[handle];
+    if (len > (uint32_t)INT32_MAX || len > cap) return -1;
+    if (len) memcpy(dst, g_bufs[handle], (size_t)len);
+    x07_ext_zlib_buf_free(handle);
+    return (int32_t)len;
+}
@@ -0,0 +1,16 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+# Builds the native allocator backend static library and stages it into deps/.
+#
+# Expected consumers:
+# - x07c link step may add deps/x07/libx07_alloc.a (or .lib on MSVC) to swap
+#   the runtime heap for the THP/NUMA arena backend
+# - generated C can include deps/x07/include/x07_alloc_abi_v1.h
+
+ROOT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+
+exec "$ROOT_DIR/scripts/build_ext_staticlib.sh" \
+  --manifest crates/x07-alloc-native/Cargo.toml \
+  --lib-name x07_alloc \
+  --header crates/x07c/include/x07_alloc_abi_v1.h
@@ -5,11 +5,15 @@ set -euo pipefail
 #
 # Expected consumers:
 # - x07c link step should add deps/x07/libx07_math.a (or .lib on MSVC)
-# - generated C can include deps/x07/include/x07_math_abi_v1.h
+# - generated C can include deps/x07/include/x07_math_abi_v1.h,
+#   deps/x07/include/x07_math_abi_v2.h, and
+#   deps/x07/include/x07_math_batch_abi_v1.h
 
 ROOT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
 
 exec "$ROOT_DIR/scripts/build_ext_staticlib.sh" \
   --manifest crates/x07-math-native/Cargo.toml \
   --lib-name x07_math \
-  --header crates/x07c/include/x07_math_abi_v1.h
+  --header crates/x07c/include/x07_math_abi_v1.h \
+  --header crates/x07c/include/x07_math_abi_v2.h \
+  --header crates/x07c/include/x07_math_batch_abi_v1.h
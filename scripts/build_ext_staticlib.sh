@@ -8,10 +8,10 @@ repo_root() {
 usage() {
   cat <<'EOF' >&2
 Usage:
-  scripts/build_ext_staticlib.sh --manifest <Cargo.toml> --lib-name <name> --header <header.h>
+  scripts/build_ext_staticlib.sh --manifest <Cargo.toml> --lib-name <name> --header <header.h> [--header <header.h> ...]
 
 Builds a Rust `staticlib` crate and stages:
-  - deps/x07/include/<header>
+  - deps/x07/include/<header> (each --header)
   - deps/x07/lib<lib-name>.a   (Unix)
   - deps/x07/<lib-name>.lib    (Windows/MSVC-style)
 
@@ -26,7 +26,7 @@ root="$(repo_root)"
 
 manifest=""
 lib_name=""
-header=""
+headers=()
 
 while [[ $# -gt 0 ]]; do
   case "$1" in
@@ -39,7 +39,7 @@ while [[ $# -gt 0 ]]; do
       shift 2
       ;;
     --header)
-      header="${2:-}"
+      headers+=("${2:-}")
       shift 2
       ;;
     -h|--help)
@@ -54,7 +54,7 @@ while [[ $# -gt 0 ]]; do
   esac
 done
 
-if [[ -z "$manifest" || -z "$lib_name" || -z "$header" ]]; then
+if [[ -z "$manifest" || -z "$lib_name" || ${#headers[@]} -eq 0 ]]; then
   echo "ERROR: --manifest, --lib-name, and --header are required" >&2
   usage
   exit 2
@@ -85,19 +85,25 @@ else
   manifest_for_build="$host_manifest"
 fi
 
-host_header="$header"
-if [[ "$host_header" != /* ]]; then
-  host_header="$root/$host_header"
-fi
+host_headers=()
+for header in "${headers[@]}"; do
+  host_header="$header"
+  if [[ "$host_header" != /* ]]; then
+    host_header="$root/$host_header"
+  fi
+  host_headers+=("$host_header")
+done
 
 if [[ ! -f "$host_manifest" ]]; then
   echo "ERROR: manifest not found: $host_manifest" >&2
   exit 2
 fi
-if [[ ! -f "$host_header" ]]; then
-  echo "ERROR: header not found: $host_header" >&2
-  exit 2
-fi
+for host_header in "${host_headers[@]}"; do
+  if [[ ! -f "$host_header" ]]; then
+    echo "ERROR: header not found: $host_header" >&2
+    exit 2
+  fi
+done
 
 user_target_dir="${CARGO_TARGET_DIR:-}"
 host_target_dir=""
@@ -174,7 +180,9 @@ fi
 deps_dir="$root/deps/x07"
 mkdir -p "$deps_dir/include"
 
-cp -f "$host_header" "$deps_dir/include/$(basename "$host_header")"
+for host_header in "${host_headers[@]}"; do
+  cp -f "$host_header" "$deps_dir/include/$(basename "$host_header")"
+done
 
 staged_lib=""
 if [[ "$lib_path" == *.a ]]; then
@@ -186,5 +194,7 @@ else
 fi
 
 echo "Staged:"
-echo "  $deps_dir/include/$(basename "$header")"
+for host_header in "${host_headers[@]}"; do
+  echo "  $deps_dir/include/$(basename "$host_header")"
+done
 echo "  $staged_lib"
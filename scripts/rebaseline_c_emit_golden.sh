@@ -0,0 +1,45 @@
+#!/usr/bin/env bash
+set -uo pipefail
+
+# Re-runs the c_emit golden-hash test and rewrites any stale pinned sha256
+# values in crates/x07c/tests/c_emit_golden_sha256.rs in place.
+#
+# Any change to the emitted C (runtime preamble included) shifts these
+# hashes; run this script and commit the rewritten hashes TOGETHER with the
+# emitter change so every commit in the series stays green and the history
+# stays bisectable.
+
+ROOT_DIR=$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)
+cd "$ROOT_DIR"
+
+golden_file="crates/x07c/tests/c_emit_golden_sha256.rs"
+
+out=$(cargo test -p x07c --test c_emit_golden_sha256 2>&1)
+status=$?
+
+if [[ $status -eq 0 ]]; then
+  echo "ok: golden hashes already match"
+  exit 0
+fi
+
+# Failed assertions print the computed hash (left) directly above the pinned
+# hash (right); pair them up and swap old for new.
+pairs=$(printf '%s\n' "$out" | grep -A1 '^  left: ' | grep -o '"[0-9a-f]\{64\}"' | tr -d '"' | paste - -)
+
+if [[ -z "$pairs" ]]; then
+  echo "error: test failed but no stale hash pairs found; not a hash drift?" >&2
+  printf '%s\n' "$out" | tail -20 >&2
+  exit 1
+fi
+
+while read -r new old; do
+  [[ -z "$new" || -z "$old" ]] && continue
+  sed -i.bak "s/$old/$new/" "$golden_file" && rm -f "$golden_file.bak"
+  echo "rebaselined: $old -> $new"
+done <<<"$pairs"
+
+cargo test -p x07c --test c_emit_golden_sha256 >/dev/null 2>&1 || {
+  echo "error: golden test still failing after rebaseline" >&2
+  exit 1
+}
+echo "ok: wrote new hashes to $golden_file"